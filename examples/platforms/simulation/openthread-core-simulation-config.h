@@ -137,6 +137,16 @@
  */
 #define OPENTHREAD_CONFIG_PLATFORM_USEC_TIMER_ENABLE 1
 
+/**
+ * @def OPENTHREAD_CONFIG_TIMER_HEAP_ENABLE
+ *
+ * Define to 1 to keep the running timers in a pairing heap instead of a sorted list.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_TIMER_HEAP_ENABLE
+#define OPENTHREAD_CONFIG_TIMER_HEAP_ENABLE 1
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_PLATFORM_FLASH_API_ENABLE
  *
@@ -147,6 +157,16 @@
  */
 #define OPENTHREAD_CONFIG_PLATFORM_FLASH_API_ENABLE 1
 
+/**
+ * @def OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_SIZE
+ *
+ * The number of records the flash settings driver keeps in a RAM index.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_SIZE
+#define OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_SIZE 64
+#endif
+
 /**
  * @def CLI_COAP_SECURE_USE_COAP_DEFAULT_HANDLER
  *
@@ -179,6 +199,101 @@
 #define OPENTHREAD_CONFIG_PARENT_SEARCH_ENABLE 1
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_MESH_FORWARDER_SEND_QUEUE_INDEX_ENABLE
+ *
+ * Define as 1 to maintain per-destination indices over the mesh forwarder send queue.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MESH_FORWARDER_SEND_QUEUE_INDEX_ENABLE
+#define OPENTHREAD_CONFIG_MESH_FORWARDER_SEND_QUEUE_INDEX_ENABLE 1
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_NETDATA_FIB_ENABLE
+ *
+ * Define as 1 to compile the Leader Network Data into a forwarding table each time it changes.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_NETDATA_FIB_ENABLE
+#define OPENTHREAD_CONFIG_NETDATA_FIB_ENABLE 1
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MLE_ROUTE_TABLE_ENABLE
+ *
+ * Define as 1 to keep the next hop and path cost toward every router ID in a table indexed by router ID.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MLE_ROUTE_TABLE_ENABLE
+#define OPENTHREAD_CONFIG_MLE_ROUTE_TABLE_ENABLE 1
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MLE_CHILD_TIMEOUT_INDEX_ENABLE
+ *
+ * Define as 1 to process child timeouts from a timer set to the next child deadline.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MLE_CHILD_TIMEOUT_INDEX_ENABLE
+#define OPENTHREAD_CONFIG_MLE_CHILD_TIMEOUT_INDEX_ENABLE 1
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_KEY_SCHEDULE_CACHE_ENABLE
+ *
+ * Define as 1 to keep the expanded AES key schedules of the active MAC, MLE, TREL keys and KEK.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_KEY_SCHEDULE_CACHE_ENABLE
+#define OPENTHREAD_CONFIG_KEY_SCHEDULE_CACHE_ENABLE 1
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_MAX_BUFFERS_PER_SOURCE
+ *
+ * The maximum number of message buffers used by datagrams being reassembled from the same link-layer source. It is
+ * limited on simulation to exercise the limit in the unit tests.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_MAX_BUFFERS_PER_SOURCE
+#define OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_MAX_BUFFERS_PER_SOURCE (OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS / 2)
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MAC_TX_PIPELINE_ENABLE
+ *
+ * Define as 1 to prepare the next direct frame while the current frame is on air (not with TREL). It is enabled on
+ * simulation to exercise the tx pipeline in the unit tests.
+ *
+ */
+#if !defined(OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE) || !OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
+#ifndef OPENTHREAD_CONFIG_MAC_TX_PIPELINE_ENABLE
+#define OPENTHREAD_CONFIG_MAC_TX_PIPELINE_ENABLE 1
+#endif
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MESSAGE_BUFFER_MAGAZINE_SIZE
+ *
+ * The maximum number of freed message buffers kept in front of the heap message pool (with
+ * `OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE`).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MESSAGE_BUFFER_MAGAZINE_SIZE
+#define OPENTHREAD_CONFIG_MESSAGE_BUFFER_MAGAZINE_SIZE 8
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+ *
+ * Define as 1 to enable the DNS client response cache.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+#define OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE 1
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_LOG_PLATFORM
  *
@@ -525,6 +525,50 @@ otError otDnsServiceResponseGetHostAddress(const otDnsServiceResponse *aResponse
                                            otIp6Address *              aAddress,
                                            uint32_t *                  aTtl);
 
+/**
+ * This structure represents the DNS client cache counters.
+ *
+ */
+typedef struct otDnsCacheCounters
+{
+    uint32_t mHits;      ///< Number of queries answered from the cache.
+    uint32_t mMisses;    ///< Number of queries sent to the server.
+    uint32_t mCoalesced; ///< Number of queries answered by the response to an identical query already sent.
+    uint32_t mEvictions; ///< Number of unexpired responses removed from the cache to make room for new ones.
+} otDnsCacheCounters;
+
+/**
+ * This function gets the DNS client cache counters.
+ *
+ * This function is available only if `OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE` is enabled.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ * @returns A pointer to the DNS client cache counters.
+ *
+ */
+const otDnsCacheCounters *otDnsClientGetCacheCounters(otInstance *aInstance);
+
+/**
+ * This function resets the DNS client cache counters.
+ *
+ * This function is available only if `OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE` is enabled.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ */
+void otDnsClientResetCacheCounters(otInstance *aInstance);
+
+/**
+ * This function removes all the responses from the DNS client cache.
+ *
+ * This function is available only if `OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE` is enabled.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ */
+void otDnsClientClearCache(otInstance *aInstance);
+
 /**
  * @}
  *
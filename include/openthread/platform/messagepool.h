@@ -82,6 +82,36 @@ otMessage *otPlatMessagePoolNew(otInstance *aInstance);
  */
 void otPlatMessagePoolFree(otInstance *aInstance, otMessage *aBuffer);
 
+/**
+ * Allocate a number of buffers at once from the platform managed buffer pool.
+ *
+ * The buffers are returned linked through their `mNext` field, with the `mNext` of the last buffer set to NULL.
+ * OpenThread uses this function to allocate all the buffers of a message in one call, so that a platform pool shared
+ * with other threads can be locked once per message rather than once per buffer.
+ *
+ * This function is optional. The default implementation calls `otPlatMessagePoolNew()` for each buffer.
+ *
+ * @param[in] aInstance     A pointer to the OpenThread instance.
+ * @param[in] aNumBuffers   The number of buffers to allocate.
+ *
+ * @returns A pointer to the first Buffer, or NULL if fewer than @p aNumBuffers Buffers are available (in which case no
+ *          Buffer is allocated).
+ *
+ */
+otMessage *otPlatMessagePoolNewBuffers(otInstance *aInstance, uint16_t aNumBuffers);
+
+/**
+ * This function is used to free a list of Buffers back to the platform managed buffer pool at once.
+ *
+ * This function is optional. The default implementation calls `otPlatMessagePoolFree()` for each buffer.
+ *
+ * @param[in]  aInstance  A pointer to the OpenThread instance.
+ * @param[in]  aBuffers   The first Buffer to free. The Buffers are linked through their `mNext` field, with the
+ *                        `mNext` of the last Buffer set to NULL.
+ *
+ */
+void otPlatMessagePoolFreeBuffers(otInstance *aInstance, otMessage *aBuffers);
+
 /**
  * Get the number of free buffers.
  *
@@ -152,6 +152,52 @@ typedef struct otIpCounters
     uint32_t mRxFailure; ///< The number of IPv6 packets failed to receive.
 } otIpCounters;
 
+/**
+ * This structure represents the 6LoWPAN fragment reassembly counters.
+ *
+ */
+typedef struct otReassemblyCounters
+{
+    uint32_t mTimeouts;   ///< The number of datagrams dropped due to reassembly timeout.
+    uint32_t mEvictions;  ///< The number of datagrams evicted from reassembly to accept a new one.
+    uint32_t mDuplicates; ///< The number of duplicate fragments dropped.
+} otReassemblyCounters;
+
+/**
+ * The number of message priority levels tracked by the message eviction counters.
+ *
+ * The levels are the `otMessagePriority` values, followed by the network control level used by Thread control
+ * messages.
+ *
+ */
+#define OT_MESSAGE_EVICTION_PRIORITY_LEVELS 4
+
+/**
+ * This structure represents the message eviction counters, indexed by the priority level of the evicted message.
+ *
+ * A queued message is evicted when a message buffer cannot be allocated for a message of higher priority, or when a
+ * message pending indirect transmission to sleepy children is dropped for a message of the same or lower priority.
+ *
+ */
+typedef struct otMessageEvictionCounters
+{
+    uint32_t mLowerPriority[OT_MESSAGE_EVICTION_PRIORITY_LEVELS];   ///< Messages evicted for a higher priority one.
+    uint32_t mPendingIndirect[OT_MESSAGE_EVICTION_PRIORITY_LEVELS]; ///< Messages pending indirect tx evicted.
+    uint32_t mNotFound; ///< The number of times no message could be evicted.
+} otMessageEvictionCounters;
+
+/**
+ * This structure represents the AES key schedule cache counters.
+ *
+ * Without `OPENTHREAD_CONFIG_KEY_SCHEDULE_CACHE_ENABLE` every lookup is counted as a miss.
+ *
+ */
+typedef struct otKeyScheduleCacheCounters
+{
+    uint32_t mHits;   ///< The number of lookups served from an already expanded key schedule.
+    uint32_t mMisses; ///< The number of lookups that ran the AES key expansion.
+} otKeyScheduleCacheCounters;
+
 /**
  * This structure represents the Thread MLE counters.
  *
@@ -764,6 +810,60 @@ const otIpCounters *otThreadGetIp6Counters(otInstance *aInstance);
  */
 void otThreadResetIp6Counters(otInstance *aInstance);
 
+/**
+ * Get the 6LoWPAN fragment reassembly counters.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ * @returns A pointer to the reassembly counters.
+ *
+ */
+const otReassemblyCounters *otThreadGetReassemblyCounters(otInstance *aInstance);
+
+/**
+ * Reset the 6LoWPAN fragment reassembly counters.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ */
+void otThreadResetReassemblyCounters(otInstance *aInstance);
+
+/**
+ * Get the message eviction counters.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ * @returns A pointer to the message eviction counters.
+ *
+ */
+const otMessageEvictionCounters *otThreadGetMessageEvictionCounters(otInstance *aInstance);
+
+/**
+ * Reset the message eviction counters.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ */
+void otThreadResetMessageEvictionCounters(otInstance *aInstance);
+
+/**
+ * Get the AES key schedule cache counters.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ * @returns A pointer to the AES key schedule cache counters.
+ *
+ */
+const otKeyScheduleCacheCounters *otThreadGetKeyScheduleCacheCounters(otInstance *aInstance);
+
+/**
+ * Reset the AES key schedule cache counters.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ */
+void otThreadResetKeyScheduleCacheCounters(otInstance *aInstance);
+
 /**
  * Get the Thread MLE counters.
  *
@@ -1155,8 +1155,52 @@ otError Interpreter::ProcessCounters(uint8_t aArgsLength, char *aArgs[])
 
     if (aArgsLength == 0)
     {
+        OutputLine("eviction");
+        OutputLine("keyschedule");
         OutputLine("mac");
         OutputLine("mle");
+        OutputLine("reassembly");
+    }
+    else if (strcmp(aArgs[0], "eviction") == 0)
+    {
+        if (aArgsLength == 1)
+        {
+            const otMessageEvictionCounters *evictionCounters = otThreadGetMessageEvictionCounters(mInstance);
+
+            OutputLine("Lower Priority: low %u, normal %u, high %u, net %u", evictionCounters->mLowerPriority[0],
+                       evictionCounters->mLowerPriority[1], evictionCounters->mLowerPriority[2],
+                       evictionCounters->mLowerPriority[3]);
+            OutputLine("Pending Indirect: low %u, normal %u, high %u, net %u", evictionCounters->mPendingIndirect[0],
+                       evictionCounters->mPendingIndirect[1], evictionCounters->mPendingIndirect[2],
+                       evictionCounters->mPendingIndirect[3]);
+            OutputLine("Not Found: %u", evictionCounters->mNotFound);
+        }
+        else if ((aArgsLength == 2) && (strcmp(aArgs[1], "reset") == 0))
+        {
+            otThreadResetMessageEvictionCounters(mInstance);
+        }
+        else
+        {
+            ExitNow(error = OT_ERROR_INVALID_ARGS);
+        }
+    }
+    else if (strcmp(aArgs[0], "keyschedule") == 0)
+    {
+        if (aArgsLength == 1)
+        {
+            const otKeyScheduleCacheCounters *keyScheduleCounters = otThreadGetKeyScheduleCacheCounters(mInstance);
+
+            OutputLine("Hits: %u", keyScheduleCounters->mHits);
+            OutputLine("Misses: %u", keyScheduleCounters->mMisses);
+        }
+        else if ((aArgsLength == 2) && (strcmp(aArgs[1], "reset") == 0))
+        {
+            otThreadResetKeyScheduleCacheCounters(mInstance);
+        }
+        else
+        {
+            ExitNow(error = OT_ERROR_INVALID_ARGS);
+        }
     }
     else if (strcmp(aArgs[0], "mac") == 0)
     {
@@ -1230,6 +1274,25 @@ otError Interpreter::ProcessCounters(uint8_t aArgsLength, char *aArgs[])
             ExitNow(error = OT_ERROR_INVALID_ARGS);
         }
     }
+    else if (strcmp(aArgs[0], "reassembly") == 0)
+    {
+        if (aArgsLength == 1)
+        {
+            const otReassemblyCounters *reassemblyCounters = otThreadGetReassemblyCounters(mInstance);
+
+            OutputLine("Timeouts: %u", reassemblyCounters->mTimeouts);
+            OutputLine("Evictions: %u", reassemblyCounters->mEvictions);
+            OutputLine("Duplicates: %u", reassemblyCounters->mDuplicates);
+        }
+        else if ((aArgsLength == 2) && (strcmp(aArgs[1], "reset") == 0))
+        {
+            otThreadResetReassemblyCounters(mInstance);
+        }
+        else
+        {
+            ExitNow(error = OT_ERROR_INVALID_ARGS);
+        }
+    }
     else
     {
         ExitNow(error = OT_ERROR_INVALID_ARGS);
@@ -1465,6 +1528,32 @@ otError Interpreter::ProcessDns(uint8_t aArgsLength, char *aArgs[])
         error = OT_ERROR_PENDING;
     }
 #endif // OPENTHREAD_CONFIG_DNS_CLIENT_SERVICE_DISCOVERY_ENABLE
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    else if (strcmp(aArgs[0], "cache") == 0)
+    {
+        if (aArgsLength == 1)
+        {
+            const otDnsCacheCounters *counters = otDnsClientGetCacheCounters(mInstance);
+
+            OutputLine("Hits: %u", counters->mHits);
+            OutputLine("Misses: %u", counters->mMisses);
+            OutputLine("Coalesced: %u", counters->mCoalesced);
+            OutputLine("Evictions: %u", counters->mEvictions);
+        }
+        else if ((aArgsLength == 2) && (strcmp(aArgs[1], "clear") == 0))
+        {
+            otDnsClientClearCache(mInstance);
+        }
+        else if ((aArgsLength == 2) && (strcmp(aArgs[1], "reset") == 0))
+        {
+            otDnsClientResetCacheCounters(mInstance);
+        }
+        else
+        {
+            ExitNow(error = OT_ERROR_INVALID_ARGS);
+        }
+    }
+#endif // OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
     else
     {
         ExitNow(error = OT_ERROR_INVALID_COMMAND);
@@ -208,4 +208,29 @@ otError otDnsServiceResponseGetHostAddress(const otDnsServiceResponse *aResponse
 
 #endif // OPENTHREAD_CONFIG_DNS_CLIENT_SERVICE_DISCOVERY_ENABLE
 
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+
+const otDnsCacheCounters *otDnsClientGetCacheCounters(otInstance *aInstance)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return &instance.Get<Dns::Client>().GetCacheCounters();
+}
+
+void otDnsClientResetCacheCounters(otInstance *aInstance)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    instance.Get<Dns::Client>().ResetCacheCounters();
+}
+
+void otDnsClientClearCache(otInstance *aInstance)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    instance.Get<Dns::Client>().ClearCache();
+}
+
+#endif // OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+
 #endif // OPENTHREAD_CONFIG_DNS_CLIENT_ENABLE
@@ -493,6 +493,48 @@ void otThreadResetIp6Counters(otInstance *aInstance)
     instance.Get<MeshForwarder>().ResetCounters();
 }
 
+const otReassemblyCounters *otThreadGetReassemblyCounters(otInstance *aInstance)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return &instance.Get<MeshForwarder>().GetReassemblyCounters();
+}
+
+void otThreadResetReassemblyCounters(otInstance *aInstance)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    instance.Get<MeshForwarder>().ResetReassemblyCounters();
+}
+
+const otMessageEvictionCounters *otThreadGetMessageEvictionCounters(otInstance *aInstance)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return &instance.Get<MeshForwarder>().GetEvictionCounters();
+}
+
+void otThreadResetMessageEvictionCounters(otInstance *aInstance)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    instance.Get<MeshForwarder>().ResetEvictionCounters();
+}
+
+const otKeyScheduleCacheCounters *otThreadGetKeyScheduleCacheCounters(otInstance *aInstance)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return &instance.Get<KeyManager>().GetKeyScheduleCacheCounters();
+}
+
+void otThreadResetKeyScheduleCacheCounters(otInstance *aInstance)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    instance.Get<KeyManager>().ResetKeyScheduleCacheCounters();
+}
+
 const otMleCounters *otThreadGetMleCounters(otInstance *aInstance)
 {
     Instance &instance = *static_cast<Instance *>(aInstance);
@@ -121,6 +121,39 @@ public:
         return rval;
     }
 
+    /**
+     * This method finds the first set index at or after a given index.
+     *
+     * Bytes with no index set are skipped as a whole.
+     *
+     * @param[inout] aIndex  On input, the index to start from. On output, the set index (if found).
+     *
+     * @retval TRUE   If a set index was found and returned in @p aIndex.
+     * @retval FALSE  If no index at or after @p aIndex is set.
+     *
+     */
+    bool FindNextSet(uint16_t &aIndex) const
+    {
+        bool found = false;
+
+        for (; aIndex < N; aIndex++)
+        {
+            if (mMask[aIndex / 8] == 0)
+            {
+                aIndex |= 7;
+                continue;
+            }
+
+            if (Get(aIndex))
+            {
+                ExitNow(found = true);
+            }
+        }
+
+    exit:
+        return found;
+    }
+
 private:
     uint8_t mMask[BitVectorBytes(N)];
 };
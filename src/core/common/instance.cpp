@@ -189,6 +189,7 @@ void Instance::Finalize(void)
     IgnoreError(otLinkSetEnabled(this, false));
 
     Get<Settings>().Deinit();
+    Get<MessagePool>().Deinit();
 #endif
 
     IgnoreError(Get<Mac::SubMac>().Disable());
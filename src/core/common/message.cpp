@@ -53,6 +53,8 @@ MessagePool::MessagePool(Instance &aInstance)
     : InstanceLocator(aInstance)
 #if !OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT && !OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE
     , mNumFreeBuffers(kNumBuffers)
+#elif OPENTHREAD_CONFIG_MESSAGE_BUFFER_MAGAZINE_SIZE > 0
+    , mMagazineSize(0)
 #endif
 {
 #if OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT
@@ -65,7 +67,7 @@ Message *MessagePool::New(Message::Type aType, uint16_t aReserveHeader, Message:
     otError  error = OT_ERROR_NONE;
     Message *message;
 
-    VerifyOrExit((message = static_cast<Message *>(NewBuffer(aPriority))) != nullptr);
+    VerifyOrExit((message = static_cast<Message *>(NewBuffers(1, aPriority))) != nullptr);
 
     memset(message, 0, sizeof(*message));
     message->SetMessagePool(this);
@@ -105,58 +107,186 @@ void MessagePool::Free(Message *aMessage)
     FreeBuffers(static_cast<Buffer *>(aMessage));
 }
 
-Buffer *MessagePool::NewBuffer(Message::Priority aPriority)
+Buffer *MessagePool::NewBuffers(uint16_t aNumBuffers, Message::Priority aPriority)
 {
-    Buffer *buffer = nullptr;
+    Buffer *buffers;
 
-    while ((
-#if OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE
-               buffer = static_cast<Buffer *>(Instance::HeapCAlloc(1, sizeof(Buffer)))
-#elif OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT
-               buffer = static_cast<Buffer *>(otPlatMessagePoolNew(&GetInstance()))
-#else
-               buffer = mBufferPool.Allocate()
-#endif
-                   ) == nullptr)
+    OT_ASSERT(aNumBuffers > 0);
+
+    while ((buffers = AllocateBuffers(aNumBuffers)) == nullptr)
     {
         SuccessOrExit(ReclaimBuffers(aPriority));
     }
 
-#if !OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT && !OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE
-    mNumFreeBuffers--;
-#endif
-
-    buffer->SetNextBuffer(nullptr);
-
 exit:
-    if (buffer == nullptr)
+    if (buffers == nullptr)
     {
         otLogInfoMem("No available message buffer");
     }
 
-    return buffer;
+    return buffers;
 }
 
-void MessagePool::FreeBuffers(Buffer *aBuffer)
+Buffer *MessagePool::AllocateBuffers(uint16_t aNumBuffers)
 {
-    while (aBuffer != nullptr)
+    Buffer *buffers = nullptr;
+
+#if !OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT && !OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE
+    VerifyOrExit(aNumBuffers <= mNumFreeBuffers);
+
+    buffers = mBufferPool.Allocate(aNumBuffers);
+    OT_ASSERT(buffers != nullptr);
+    mNumFreeBuffers -= aNumBuffers;
+#else
+    Buffer * last  = nullptr;
+    uint16_t count = 0;
+
+#if OPENTHREAD_CONFIG_MESSAGE_BUFFER_MAGAZINE_SIZE > 0
+    // Take the buffers from the magazine first.
+
+    for (; (count < aNumBuffers) && !mMagazine.IsEmpty(); count++)
+    {
+        Buffer *buffer = mMagazine.Pop();
+
+        buffer->SetNextBuffer(buffers);
+        buffers = buffer;
+        last    = (last == nullptr) ? buffer : last;
+        mMagazineSize--;
+    }
+#endif
+
+    // Allocate the remaining buffers from the heap or platform and
+    // append them to the list.
+
+    while (count < aNumBuffers)
     {
-        Buffer *next = aBuffer->GetNextBuffer();
 #if OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE
-        Instance::HeapFree(aBuffer);
-#elif OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT
-        otPlatMessagePoolFree(&GetInstance(), aBuffer);
+        Buffer *buffer = static_cast<Buffer *>(Instance::HeapCAlloc(1, sizeof(Buffer)));
+
+        count++;
 #else
-        mBufferPool.Free(*aBuffer);
+        Buffer *buffer = static_cast<Buffer *>(otPlatMessagePoolNewBuffers(&GetInstance(), aNumBuffers - count));
+
+        count = aNumBuffers;
+#endif
+
+        if (buffer == nullptr)
+        {
+            FreeBuffers(buffers);
+            ExitNow(buffers = nullptr);
+        }
+
+        if (last == nullptr)
+        {
+            buffers = buffer;
+        }
+        else
+        {
+            last->SetNextBuffer(buffer);
+        }
+
+        for (last = buffer; last->GetNextBuffer() != nullptr;)
+        {
+            last = last->GetNextBuffer();
+        }
+    }
+#endif // !OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT && !OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE
+
+exit:
+    return buffers;
+}
+
+void MessagePool::FreeBuffers(Buffer *aBuffers)
+{
+    VerifyOrExit(aBuffers != nullptr);
+
+#if !OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT && !OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE
+    {
+        Buffer *last = aBuffers;
+
         mNumFreeBuffers++;
+
+        while (last->GetNextBuffer() != nullptr)
+        {
+            last = last->GetNextBuffer();
+            mNumFreeBuffers++;
+        }
+
+        mBufferPool.Free(*aBuffers, *last);
+    }
+#else
+#if OPENTHREAD_CONFIG_MESSAGE_BUFFER_MAGAZINE_SIZE > 0
+    // Keep the buffers in the magazine while there is room.
+
+    while ((aBuffers != nullptr) && (mMagazineSize < OPENTHREAD_CONFIG_MESSAGE_BUFFER_MAGAZINE_SIZE))
+    {
+        Buffer *next = aBuffers->GetNextBuffer();
+
+        mMagazine.Push(*aBuffers);
+        mMagazineSize++;
+        aBuffers = next;
+    }
 #endif
-        aBuffer = next;
+
+    ReleaseBuffers(aBuffers);
+#endif // !OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT && !OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE
+
+exit:
+    return;
+}
+
+#if OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT || OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE
+void MessagePool::ReleaseBuffers(Buffer *aBuffers)
+{
+    VerifyOrExit(aBuffers != nullptr);
+
+#if OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE
+    while (aBuffers != nullptr)
+    {
+        Buffer *next = aBuffers->GetNextBuffer();
+
+        Instance::HeapFree(aBuffers);
+        aBuffers = next;
     }
+#else
+    otPlatMessagePoolFreeBuffers(&GetInstance(), aBuffers);
+#endif
+
+exit:
+    return;
+}
+#endif
+
+void MessagePool::Deinit(void)
+{
+#if (OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE || OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT) && \
+    (OPENTHREAD_CONFIG_MESSAGE_BUFFER_MAGAZINE_SIZE > 0)
+    // The magazine buffers are linked through `GetNextBuffer()`, so
+    // they are released as one list.
+
+    ReleaseBuffers(mMagazine.GetHead());
+    mMagazine.Clear();
+    mMagazineSize = 0;
+#endif
 }
 
 otError MessagePool::ReclaimBuffers(Message::Priority aPriority)
 {
-    return Get<MeshForwarder>().EvictMessage(aPriority);
+    otError error = OT_ERROR_NOT_FOUND;
+
+#if OPENTHREAD_CONFIG_DNS_CLIENT_ENABLE && OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    // Cached DNS responses can always be queried again, so they give
+    // up their buffers before any queued message is evicted.
+
+    error = Get<Dns::Client>().EvictCacheEntry();
+#endif
+
+    if (error != OT_ERROR_NONE)
+    {
+        error = Get<MeshForwarder>().EvictMessage(aPriority);
+    }
+
+    return error;
 }
 
 uint16_t MessagePool::GetFreeBufferCount(void) const
@@ -171,6 +301,11 @@ uint16_t MessagePool::GetFreeBufferCount(void) const
     rval = mNumFreeBuffers;
 #endif
 
+#if (OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE || OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT) && \
+    (OPENTHREAD_CONFIG_MESSAGE_BUFFER_MAGAZINE_SIZE > 0)
+    rval += mMagazineSize;
+#endif
+
     return rval;
 }
 
@@ -199,25 +334,28 @@ Message::Settings::Settings(const otMessageSettings *aSettings)
 
 otError Message::ResizeMessage(uint16_t aLength)
 {
-    otError error = OT_ERROR_NONE;
-
-    // add buffers
+    otError  error     = OT_ERROR_NONE;
     Buffer * curBuffer = this;
     Buffer * lastBuffer;
     uint16_t curLength = kHeadBufferDataSize;
 
-    while (curLength < aLength)
+    // find the last buffer needed for the new length
+    while ((curLength < aLength) && (curBuffer->GetNextBuffer() != nullptr))
     {
-        if (curBuffer->GetNextBuffer() == nullptr)
-        {
-            curBuffer->SetNextBuffer(GetMessagePool()->NewBuffer(GetPriority()));
-            VerifyOrExit(curBuffer->GetNextBuffer() != nullptr, error = OT_ERROR_NO_BUFS);
-        }
-
         curBuffer = curBuffer->GetNextBuffer();
         curLength += kBufferDataSize;
     }
 
+    // add all the missing buffers at once
+    if (curLength < aLength)
+    {
+        uint16_t numBuffers = static_cast<uint16_t>((aLength - curLength + kBufferDataSize - 1) / kBufferDataSize);
+
+        curBuffer->SetNextBuffer(GetMessagePool()->NewBuffers(numBuffers, GetPriority()));
+        VerifyOrExit(curBuffer->GetNextBuffer() != nullptr, error = OT_ERROR_NO_BUFS);
+        ExitNow();
+    }
+
     // remove buffers
     lastBuffer = curBuffer;
     curBuffer  = curBuffer->GetNextBuffer();
@@ -290,6 +428,18 @@ uint8_t Message::GetBufferCount(void) const
     return rval;
 }
 
+uint16_t Message::GetBufferCountFor(uint16_t aLength)
+{
+    uint16_t rval = 1;
+
+    if (aLength > kHeadBufferDataSize)
+    {
+        rval += static_cast<uint16_t>((aLength - kHeadBufferDataSize + kBufferDataSize - 1) / kBufferDataSize);
+    }
+
+    return rval;
+}
+
 void Message::MoveOffset(int aDelta)
 {
     OT_ASSERT(GetOffset() + aDelta <= GetLength());
@@ -349,6 +499,30 @@ otError Message::SetPriority(Priority aPriority)
     if (priorityQueue != nullptr)
     {
         priorityQueue->Enqueue(*this);
+
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_SEND_QUEUE_INDEX_ENABLE
+        // Re-insert the message in its index lists to keep them
+        // ordered the same as the queue. Eviction lists hold a
+        // single priority level, so the message moves to the
+        // eviction list of its new priority.
+
+        for (uint8_t type = 0; type < kNumMessageIndexTypes; type++)
+        {
+            MessageIndexList *list = GetMetadata().mIndexList[type];
+
+            if (list != nullptr)
+            {
+                list->Remove(*this, static_cast<MessageIndexType>(type));
+
+                if (type == kMessageIndexEvict)
+                {
+                    list = &priorityQueue->GetEvictionIndex(aPriority);
+                }
+
+                list->Add(*this, static_cast<MessageIndexType>(type));
+            }
+        }
+#endif
     }
 
 exit:
@@ -374,7 +548,7 @@ otError Message::PrependBytes(const void *aBuf, uint16_t aLength)
 
     while (aLength > GetReserved())
     {
-        VerifyOrExit((newBuffer = GetMessagePool()->NewBuffer(GetPriority())) != nullptr, error = OT_ERROR_NO_BUFS);
+        VerifyOrExit((newBuffer = GetMessagePool()->NewBuffers(1, GetPriority())) != nullptr, error = OT_ERROR_NO_BUFS);
 
         newBuffer->SetNextBuffer(GetNextBuffer());
         SetNextBuffer(newBuffer);
@@ -503,10 +677,57 @@ exit:
     return;
 }
 
+otError Message::GetSegments(uint16_t aOffset, uint16_t aLength, Segment *aSegments, uint8_t &aNumSegments)
+{
+    otError       error = OT_ERROR_NONE;
+    uint8_t       count = 0;
+    WritableChunk chunk;
+
+    for (GetFirstChunk(aOffset, aLength, chunk); chunk.GetLength() > 0; GetNextChunk(aLength, chunk))
+    {
+        VerifyOrExit(count < aNumSegments, error = OT_ERROR_NO_BUFS);
+        aSegments[count].mData   = chunk.GetData();
+        aSegments[count].mLength = chunk.GetLength();
+        count++;
+    }
+
+exit:
+    aNumSegments = count;
+    return error;
+}
+
+const uint8_t *Message::GetContiguous(uint16_t aOffset, uint16_t aLength) const
+{
+    const uint8_t *data   = GetFirstBufferRange(aOffset, aLength);
+    uint16_t       length = aLength;
+    Chunk          chunk;
+
+    VerifyOrExit(data == nullptr);
+    VerifyOrExit(aLength > 0 && static_cast<uint32_t>(aOffset) + aLength <= GetLength());
+
+    GetFirstChunk(aOffset, length, chunk);
+
+    if (chunk.GetLength() == aLength)
+    {
+        data = chunk.GetData();
+    }
+
+exit:
+    return data;
+}
+
 uint16_t Message::ReadBytes(uint16_t aOffset, void *aBuf, uint16_t aLength) const
 {
-    uint8_t *bufPtr = reinterpret_cast<uint8_t *>(aBuf);
-    Chunk    chunk;
+    const uint8_t *data   = GetFirstBufferRange(aOffset, aLength);
+    uint8_t *      bufPtr = reinterpret_cast<uint8_t *>(aBuf);
+    Chunk          chunk;
+
+    if (data != nullptr)
+    {
+        memcpy(bufPtr, data, aLength);
+        bufPtr += aLength;
+        ExitNow();
+    }
 
     GetFirstChunk(aOffset, aLength, chunk);
 
@@ -517,6 +738,7 @@ uint16_t Message::ReadBytes(uint16_t aOffset, void *aBuf, uint16_t aLength) cons
         GetNextChunk(aLength, chunk);
     }
 
+exit:
     return static_cast<uint16_t>(bufPtr - reinterpret_cast<uint8_t *>(aBuf));
 }
 
@@ -529,8 +751,15 @@ bool Message::CompareBytes(uint16_t aOffset, const void *aBuf, uint16_t aLength)
 {
     uint16_t       bytesToCompare = aLength;
     const uint8_t *bufPtr         = reinterpret_cast<const uint8_t *>(aBuf);
+    const uint8_t *data           = GetFirstBufferRange(aOffset, aLength);
     Chunk          chunk;
 
+    if (data != nullptr)
+    {
+        VerifyOrExit(memcmp(bufPtr, data, aLength) == 0);
+        ExitNow(bytesToCompare = 0);
+    }
+
     GetFirstChunk(aOffset, aLength, chunk);
 
     while (chunk.GetLength() > 0)
@@ -570,10 +799,17 @@ exit:
 void Message::WriteBytes(uint16_t aOffset, const void *aBuf, uint16_t aLength)
 {
     const uint8_t *bufPtr = reinterpret_cast<const uint8_t *>(aBuf);
+    const uint8_t *data   = GetFirstBufferRange(aOffset, aLength);
     WritableChunk  chunk;
 
     OT_ASSERT(aOffset + aLength <= GetLength());
 
+    if (data != nullptr)
+    {
+        memmove(const_cast<uint8_t *>(data), bufPtr, aLength);
+        ExitNow();
+    }
+
     GetFirstChunk(aOffset, aLength, chunk);
 
     while (chunk.GetLength() > 0)
@@ -582,6 +818,9 @@ void Message::WriteBytes(uint16_t aOffset, const void *aBuf, uint16_t aLength)
         bufPtr += chunk.GetLength();
         GetNextChunk(aLength, chunk);
     }
+
+exit:
+    return;
 }
 
 uint16_t Message::CopyTo(uint16_t aSourceOffset, uint16_t aDestinationOffset, uint16_t aLength, Message &aMessage) const
@@ -655,6 +894,11 @@ bool Message::IsChildPending(void) const
     return GetMetadata().mChildMask.HasAny();
 }
 
+bool Message::GetNextChildIndex(uint16_t &aChildIndex) const
+{
+    return GetMetadata().mChildMask.FindNextSet(aChildIndex);
+}
+
 void Message::SetLinkInfo(const ThreadLinkInfo &aLinkInfo)
 {
     SetLinkSecurityEnabled(aLinkInfo.mLinkSecurity);
@@ -771,6 +1015,9 @@ void MessageQueue::GetInfo(uint16_t &aMessageCount, uint16_t &aBufferCount) cons
 }
 
 PriorityQueue::PriorityQueue(void)
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_SEND_QUEUE_INDEX_ENABLE
+    : mIndexSequence(0)
+#endif
 {
     for (Message *&tail : mTails)
     {
@@ -843,6 +1090,9 @@ void PriorityQueue::Enqueue(Message &aMessage)
     OT_ASSERT(!aMessage.IsInAQueue());
 
     aMessage.SetPriorityQueue(this);
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_SEND_QUEUE_INDEX_ENABLE
+    aMessage.SetIndexSequence(mIndexSequence++);
+#endif
 
     priority = aMessage.GetPriority();
 
@@ -909,5 +1159,130 @@ void PriorityQueue::GetInfo(uint16_t &aMessageCount, uint16_t &aBufferCount) con
     }
 }
 
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_SEND_QUEUE_INDEX_ENABLE
+
+bool MessageIndexList::IsAhead(const Message &aFirst, const Message &aSecond)
+{
+    bool isAhead;
+
+    if (aFirst.GetPriority() != aSecond.GetPriority())
+    {
+        isAhead = (aFirst.GetPriority() > aSecond.GetPriority());
+    }
+    else
+    {
+        isAhead = (static_cast<int32_t>(aFirst.GetIndexSequence() - aSecond.GetIndexSequence()) < 0);
+    }
+
+    return isAhead;
+}
+
+void MessageIndexList::Add(Message &aMessage, MessageIndexType aType)
+{
+    Message *prev = mTail;
+
+    OT_ASSERT(aMessage.IndexList(aType) == nullptr);
+
+    // Messages are mostly added in priority order, so searching
+    // backwards from the tail is typically a single step.
+
+    while ((prev != nullptr) && IsAhead(aMessage, *prev))
+    {
+        prev = prev->IndexPrev(aType);
+    }
+
+    aMessage.IndexPrev(aType) = prev;
+    aMessage.IndexNext(aType) = (prev == nullptr) ? mHead : prev->IndexNext(aType);
+    aMessage.IndexList(aType) = this;
+
+    if (prev == nullptr)
+    {
+        mHead = &aMessage;
+    }
+    else
+    {
+        prev->IndexNext(aType) = &aMessage;
+    }
+
+    if (aMessage.IndexNext(aType) == nullptr)
+    {
+        mTail = &aMessage;
+    }
+    else
+    {
+        aMessage.IndexNext(aType)->IndexPrev(aType) = &aMessage;
+    }
+}
+
+void MessageIndexList::Remove(Message &aMessage, MessageIndexType aType)
+{
+    OT_ASSERT(aMessage.IndexList(aType) == this);
+
+    if (aMessage.IndexPrev(aType) == nullptr)
+    {
+        mHead = aMessage.IndexNext(aType);
+    }
+    else
+    {
+        aMessage.IndexPrev(aType)->IndexNext(aType) = aMessage.IndexNext(aType);
+    }
+
+    if (aMessage.IndexNext(aType) == nullptr)
+    {
+        mTail = aMessage.IndexPrev(aType);
+    }
+    else
+    {
+        aMessage.IndexNext(aType)->IndexPrev(aType) = aMessage.IndexPrev(aType);
+    }
+
+    aMessage.IndexNext(aType) = nullptr;
+    aMessage.IndexPrev(aType) = nullptr;
+    aMessage.IndexList(aType) = nullptr;
+}
+
+#endif // OPENTHREAD_CONFIG_MESH_FORWARDER_SEND_QUEUE_INDEX_ENABLE
+
 } // namespace ot
+
+#if OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT
+
+//---------------------------------------------------------------------------------------------------------------------
+// Default/weak implementation of message pool platform APIs
+
+OT_TOOL_WEAK otMessage *otPlatMessagePoolNewBuffers(otInstance *aInstance, uint16_t aNumBuffers)
+{
+    otMessage *buffers = nullptr;
+
+    for (; aNumBuffers > 0; aNumBuffers--)
+    {
+        otMessage *buffer = otPlatMessagePoolNew(aInstance);
+
+        if (buffer == nullptr)
+        {
+            otPlatMessagePoolFreeBuffers(aInstance, buffers);
+            buffers = nullptr;
+            break;
+        }
+
+        buffer->mNext = buffers;
+        buffers       = buffer;
+    }
+
+    return buffers;
+}
+
+OT_TOOL_WEAK void otPlatMessagePoolFreeBuffers(otInstance *aInstance, otMessage *aBuffers)
+{
+    while (aBuffers != nullptr)
+    {
+        otMessage *next = aBuffers->mNext;
+
+        otPlatMessagePoolFree(aInstance, aBuffers);
+        aBuffers = next;
+    }
+}
+
+#endif // OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT
+
 #endif // OPENTHREAD_MTD || OPENTHREAD_FTD
@@ -56,6 +56,7 @@ namespace ot {
 
 namespace Crypto {
 
+class AesCcm;
 class Sha256;
 class HmacSha256;
 
@@ -136,8 +137,23 @@ class Message;
 class MessagePool;
 class MessageQueue;
 class PriorityQueue;
+class MessageIndexList;
 class ThreadLinkInfo;
 
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_SEND_QUEUE_INDEX_ENABLE
+/**
+ * This enumeration specifies the index lists a queued message can be linked in (in addition to its queue).
+ *
+ */
+enum MessageIndexType : uint8_t
+{
+    kMessageIndexDirect   = 0, ///< Index of messages pending direct transmission.
+    kMessageIndexIndirect = 1, ///< Index of messages pending indirect transmission.
+    kMessageIndexEvict    = 2, ///< Index of messages that may be evicted, by priority level.
+    kNumMessageIndexTypes = 3, ///< Number of index types.
+};
+#endif
+
 /**
  * This structure contains metadata about a Message.
  *
@@ -163,6 +179,13 @@ struct MessageMetadata
     LqiAverager mLqiAverager; ///< The averager maintaining the Link quality indicator (LQI) average.
 #endif
 
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_SEND_QUEUE_INDEX_ENABLE
+    Message *         mIndexNext[kNumMessageIndexTypes]; ///< The next message in each index list.
+    Message *         mIndexPrev[kNumMessageIndexTypes]; ///< The previous message in each index list.
+    MessageIndexList *mIndexList[kNumMessageIndexTypes]; ///< The index list (if any) the message is linked in.
+    uint32_t          mIndexSequence;                    ///< The enqueue order, for ties in index lists.
+#endif
+
     ChildMask mChildMask; ///< A ChildMask to indicate which sleepy children need to receive this.
     uint16_t  mMeshDest;  ///< Used for unicast non-link-local messages.
     uint8_t   mTimeout;   ///< Seconds remaining before dropping the message.
@@ -282,6 +305,12 @@ private:
         kHeadBufferDataSize = kBufferDataSize - sizeof(MessageMetadata),
     };
 
+#if OPENTHREAD_CONFIG_MESSAGE_LARGE_BUFFER_ENABLE
+    static_assert(kHeadBufferDataSize >=
+                      OPENTHREAD_CONFIG_IP6_MAX_DATAGRAM_LENGTH + OPENTHREAD_CONFIG_MESSAGE_LARGE_BUFFER_HEADROOM,
+                  "OPENTHREAD_CONFIG_MESSAGE_BUFFER_SIZE is too small for a full IPv6 datagram in the first buffer");
+#endif
+
 protected:
     union
     {
@@ -301,11 +330,13 @@ protected:
 class Message : public Buffer
 {
     friend class Checksum;
+    friend class Crypto::AesCcm;
     friend class Crypto::HmacSha256;
     friend class Crypto::Sha256;
     friend class MessagePool;
     friend class MessageQueue;
     friend class PriorityQueue;
+    friend class MessageIndexList;
 
 public:
     /**
@@ -455,6 +486,28 @@ public:
      */
     Message *GetNext(void) const;
 
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_SEND_QUEUE_INDEX_ENABLE
+    /**
+     * This method returns a pointer to the next message in a given index list.
+     *
+     * @param[in]  aType  The index type.
+     *
+     * @returns A pointer to the next message in the index list or nullptr if at the end of the list.
+     *
+     */
+    Message *GetNextInIndex(MessageIndexType aType) const { return GetMetadata().mIndexNext[aType]; }
+
+    /**
+     * This method returns the index list of a given type in which the message is linked.
+     *
+     * @param[in]  aType  The index type.
+     *
+     * @returns A pointer to the index list, or nullptr if the message is not linked in an index list of @p aType.
+     *
+     */
+    MessageIndexList *GetIndexList(MessageIndexType aType) const { return GetMetadata().mIndexList[aType]; }
+#endif
+
     /**
      * This method returns the number of bytes in the message.
      *
@@ -474,12 +527,32 @@ public:
      */
     otError SetLength(uint16_t aLength);
 
+    /**
+     * This method returns the number of bytes the first buffer of the message can hold.
+     *
+     * Setting the length of the message up to this number does not take any more buffers.
+     *
+     * @returns The number of bytes the first buffer can hold.
+     *
+     */
+    uint16_t GetFirstBufferCapacity(void) const { return static_cast<uint16_t>(kHeadBufferDataSize - GetReserved()); }
+
     /**
      * This method returns the number of buffers in the message.
      *
      */
     uint8_t GetBufferCount(void) const;
 
+    /**
+     * This static method returns the number of buffers a message of a given length (with no reserved header) uses.
+     *
+     * @param[in]  aLength  The message length in bytes.
+     *
+     * @returns The number of buffers.
+     *
+     */
+    static uint16_t GetBufferCountFor(uint16_t aLength);
+
     /**
      * This method returns the byte offset within the message.
      *
@@ -710,6 +783,67 @@ public:
         return Read(aOffset, &aObject, sizeof(ObjectType));
     }
 
+    /**
+     * This method returns a pointer to a range of bytes in the message if the range is stored contiguously.
+     *
+     * The bytes can then be accessed in place without copying. The pointer remains valid until the message length
+     * or its reserved header space changes, or the message is freed.
+     *
+     * @param[in]  aOffset  Byte offset within the message of the first byte.
+     * @param[in]  aLength  Number of bytes.
+     *
+     * @returns A pointer to the byte at @p aOffset, or nullptr if the range goes past the end of the message or spans
+     *          more than one buffer.
+     *
+     */
+    uint8_t *GetContiguous(uint16_t aOffset, uint16_t aLength)
+    {
+        return const_cast<uint8_t *>(const_cast<const Message *>(this)->GetContiguous(aOffset, aLength));
+    }
+
+    /**
+     * This method returns a pointer to a range of bytes in the message if the range is stored contiguously.
+     *
+     * The bytes can then be read in place without copying. The pointer remains valid until the message length or
+     * its reserved header space changes, or the message is freed.
+     *
+     * @param[in]  aOffset  Byte offset within the message of the first byte.
+     * @param[in]  aLength  Number of bytes.
+     *
+     * @returns A pointer to the byte at @p aOffset, or nullptr if the range goes past the end of the message or spans
+     *          more than one buffer.
+     *
+     */
+    const uint8_t *GetContiguous(uint16_t aOffset, uint16_t aLength) const;
+
+    /**
+     * This method gives read access to an object in the message, in place if it is stored contiguously.
+     *
+     * When the object spans more than one buffer, it is read into @p aCopy and a pointer to @p aCopy is returned.
+     *
+     * @tparam     ObjectType   The object type, which must be packed (byte aligned).
+     *
+     * @param[in]  aOffset      Byte offset within the message of the object.
+     * @param[out] aCopy        A reference to an object to read into if the object is not contiguous.
+     *
+     * @returns A pointer to the object, or nullptr if there are not enough bytes remaining in the message.
+     *
+     */
+    template <typename ObjectType> const ObjectType *GetContiguous(uint16_t aOffset, ObjectType &aCopy) const
+    {
+        static_assert(!TypeTraits::IsPointer<ObjectType>::kValue, "ObjectType must not be a pointer");
+        static_assert(alignof(ObjectType) == 1, "ObjectType must be packed");
+
+        const ObjectType *object = reinterpret_cast<const ObjectType *>(GetContiguous(aOffset, sizeof(ObjectType)));
+
+        if (object == nullptr)
+        {
+            object = (Read(aOffset, aCopy) == OT_ERROR_NONE) ? &aCopy : nullptr;
+        }
+
+        return object;
+    }
+
     /**
      * This method compares the bytes in the message at a given offset with a given byte array.
      *
@@ -892,6 +1026,18 @@ public:
      */
     bool IsChildPending(void) const;
 
+    /**
+     * This method finds the next child the message is scheduled to be forwarded to.
+     *
+     * @param[inout] aChildIndex  On input, the child index to start from. On output, the index of the next child the
+     *                            message is scheduled to be forwarded to (if found).
+     *
+     * @retval TRUE   If a child was found and its index returned in @p aChildIndex.
+     * @retval FALSE  If the message is not scheduled to be forwarded to any child at or after @p aChildIndex.
+     *
+     */
+    bool GetNextChildIndex(uint16_t &aChildIndex) const;
+
     /**
      * This method returns the RLOC16 of the mesh destination.
      *
@@ -1227,7 +1373,53 @@ public:
 
 #endif // #if OPENTHREAD_CONFIG_MULTI_RADIO
 
+    /**
+     * This structure represents a segment of the message content that is contiguous in memory.
+     *
+     */
+    struct Segment
+    {
+        uint8_t *mData;   ///< A pointer to the start of the segment.
+        uint16_t mLength; ///< The length of the segment (in bytes).
+    };
+
+    /**
+     * This method gets the contiguous segments making up a range of the message content.
+     *
+     * This allows the content to be read or written in place (e.g., by scatter/gather I/O) rather than copied.
+     *
+     * @param[in]     aOffset       The offset in bytes of the range.
+     * @param[in]     aLength       The length in bytes of the range.
+     * @param[out]    aSegments     A pointer to an array of segments to output.
+     * @param[inout]  aNumSegments  On entry, the number of entries in @p aSegments. On exit, the number of segments
+     *                              output.
+     *
+     * @retval OT_ERROR_NONE     Successfully got the segments of the range.
+     * @retval OT_ERROR_NO_BUFS  The range is split in more segments than there are entries in @p aSegments.
+     *
+     */
+    otError GetSegments(uint16_t aOffset, uint16_t aLength, Segment *aSegments, uint8_t &aNumSegments);
+
 private:
+    /**
+     * This method returns a pointer to a range of bytes in the message if the range lies in the first buffer.
+     *
+     * @param[in]  aOffset  Byte offset within the message of the first byte.
+     * @param[in]  aLength  Number of bytes.
+     *
+     * @returns A pointer to the byte at @p aOffset, or nullptr if the range goes past the end of the message or the
+     *          first buffer.
+     *
+     */
+    const uint8_t *GetFirstBufferRange(uint16_t aOffset, uint16_t aLength) const
+    {
+        uint32_t end = static_cast<uint32_t>(aOffset) + aLength;
+
+        return (end <= GetLength() && end + GetReserved() <= kHeadBufferDataSize)
+                   ? GetFirstData() + GetReserved() + aOffset
+                   : nullptr;
+    }
+
     /**
      * This method returns a pointer to the message pool to which this message belongs
      *
@@ -1293,6 +1485,54 @@ private:
      */
     Message *&Prev(void) { return GetMetadata().mPrev; }
 
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_SEND_QUEUE_INDEX_ENABLE
+    /**
+     * This method returns a reference to the `mIndexNext` pointer for a given index type.
+     *
+     * @param[in]  aType  The index type.
+     *
+     * @returns A reference to the mIndexNext pointer.
+     *
+     */
+    Message *&IndexNext(MessageIndexType aType) { return GetMetadata().mIndexNext[aType]; }
+
+    /**
+     * This method returns a reference to the `mIndexPrev` pointer for a given index type.
+     *
+     * @param[in]  aType  The index type.
+     *
+     * @returns A reference to the mIndexPrev pointer.
+     *
+     */
+    Message *&IndexPrev(MessageIndexType aType) { return GetMetadata().mIndexPrev[aType]; }
+
+    /**
+     * This method returns a reference to the `mIndexList` pointer for a given index type.
+     *
+     * @param[in]  aType  The index type.
+     *
+     * @returns A reference to the mIndexList pointer.
+     *
+     */
+    MessageIndexList *&IndexList(MessageIndexType aType) { return GetMetadata().mIndexList[aType]; }
+
+    /**
+     * This method returns the index sequence number of the message, set when it is added to a priority queue.
+     *
+     * @returns The index sequence number.
+     *
+     */
+    uint32_t GetIndexSequence(void) const { return GetMetadata().mIndexSequence; }
+
+    /**
+     * This method sets the index sequence number of the message.
+     *
+     * @param[in]  aSequence  The index sequence number.
+     *
+     */
+    void SetIndexSequence(uint32_t aSequence) { GetMetadata().mIndexSequence = aSequence; }
+#endif
+
     /**
      * This method returns the number of reserved header bytes.
      *
@@ -1336,7 +1576,7 @@ private:
         uint8_t *GetData(void) const { return const_cast<uint8_t *>(mData); }
     };
 
-    void GetFirstChunk(uint16_t aOffset, uint16_t &aLength, Chunk &chunk) const;
+    void GetFirstChunk(uint16_t aOffset, uint16_t &aLength, Chunk &aChunk) const;
     void GetNextChunk(uint16_t &aLength, Chunk &aChunk) const;
 
     void GetFirstChunk(uint16_t aOffset, uint16_t &aLength, WritableChunk &aChunk)
@@ -1437,6 +1677,86 @@ private:
     void SetTail(Message *aMessage) { mData = aMessage; }
 };
 
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_SEND_QUEUE_INDEX_ENABLE
+/**
+ * This class implements an index list over messages in a priority queue.
+ *
+ * An index list links a subset of the messages of a queue (e.g., those pending transmission to the same destination)
+ * from higher to lower priority, and first-in first-out (in the order they were added to the list) within a priority
+ * level. A message can be in at most one index list of each `MessageIndexType` at a time.
+ *
+ */
+class MessageIndexList
+{
+public:
+    /**
+     * This constructor initializes the index list.
+     *
+     */
+    MessageIndexList(void)
+        : mHead(nullptr)
+        , mTail(nullptr)
+    {
+    }
+
+    /**
+     * This method returns a pointer to the first message in the index list.
+     *
+     * @returns A pointer to the first message, or nullptr if the list is empty.
+     *
+     */
+    Message *GetHead(void) const { return mHead; }
+
+    /**
+     * This method indicates whether or not the index list is empty.
+     *
+     * @retval TRUE   The list is empty.
+     * @retval FALSE  The list is not empty.
+     *
+     */
+    bool IsEmpty(void) const { return (mHead == nullptr); }
+
+    /**
+     * This static method indicates whether a message is ordered ahead of another one in the index lists.
+     *
+     * A message with a higher priority is ahead. On equal priority, the message enqueued first in its priority queue
+     * is ahead, so the index lists keep the order of the queue.
+     *
+     * @param[in]  aFirst   The first message.
+     * @param[in]  aSecond  The second message.
+     *
+     * @retval TRUE   If @p aFirst is ahead of @p aSecond.
+     * @retval FALSE  If @p aFirst is not ahead of @p aSecond.
+     *
+     */
+    static bool IsAhead(const Message &aFirst, const Message &aSecond);
+
+    /**
+     * This method adds a message to the index list after all messages ahead of it (see `IsAhead()`).
+     *
+     * The message MUST NOT already be in an index list of the same type.
+     *
+     * @param[in]  aMessage  The message to add.
+     * @param[in]  aType     The index type of the list.
+     *
+     */
+    void Add(Message &aMessage, MessageIndexType aType);
+
+    /**
+     * This method removes a message from the index list.
+     *
+     * @param[in]  aMessage  The message to remove.
+     * @param[in]  aType     The index type of the list.
+     *
+     */
+    void Remove(Message &aMessage, MessageIndexType aType);
+
+private:
+    Message *mHead;
+    Message *mTail;
+};
+#endif // OPENTHREAD_CONFIG_MESH_FORWARDER_SEND_QUEUE_INDEX_ENABLE
+
 /**
  * This class implements a priority queue.
  *
@@ -1506,6 +1826,32 @@ public:
      */
     Message *GetTail(void) const;
 
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_SEND_QUEUE_INDEX_ENABLE
+    /**
+     * This method returns the eviction index list of a given priority level.
+     *
+     * The eviction index lists hold the queued messages that may be evicted, one list per priority level. The owner
+     * of the queue decides which messages are in them, and `Message::SetPriority()` moves a message to the list of its
+     * new priority level.
+     *
+     * @param[in] aPriority   Priority level.
+     *
+     * @returns A reference to the eviction index list of @p aPriority.
+     *
+     */
+    MessageIndexList &GetEvictionIndex(Message::Priority aPriority) { return mEvictionIndex[aPriority]; }
+
+    /**
+     * This method returns the eviction index list of a given priority level.
+     *
+     * @param[in] aPriority   Priority level.
+     *
+     * @returns A reference to the eviction index list of @p aPriority.
+     *
+     */
+    const MessageIndexList &GetEvictionIndex(Message::Priority aPriority) const { return mEvictionIndex[aPriority]; }
+#endif
+
 private:
     /**
      * This method increases (moves forward) the given priority while ensuring to wrap from
@@ -1533,6 +1879,10 @@ private:
 
 private:
     Message *mTails[Message::kNumPriorities]; ///< Tail pointers associated with different priority levels.
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_SEND_QUEUE_INDEX_ENABLE
+    MessageIndexList mEvictionIndex[Message::kNumPriorities]; ///< Messages that may be evicted, by priority level.
+    uint32_t         mIndexSequence;                          ///< The index sequence number of the next message.
+#endif
 };
 
 /**
@@ -1605,14 +1955,35 @@ public:
      */
     uint16_t GetTotalBufferCount(void) const;
 
+    /**
+     * This method releases the buffers kept in the buffer magazine back to the heap or the platform.
+     *
+     * It is called when the instance is finalized, after all messages are freed.
+     *
+     */
+    void Deinit(void);
+
 private:
-    Buffer *NewBuffer(Message::Priority aPriority);
-    void    FreeBuffers(Buffer *aBuffer);
+    // Allocates a list of buffers (linked through `GetNextBuffer()`)
+    // all at once, evicting messages with a lower priority than
+    // `aPriority` if needed. Either all buffers are allocated, or
+    // none.
+    Buffer *NewBuffers(uint16_t aNumBuffers, Message::Priority aPriority);
+    Buffer *AllocateBuffers(uint16_t aNumBuffers);
+    void    FreeBuffers(Buffer *aBuffers);
     otError ReclaimBuffers(Message::Priority aPriority);
+#if OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT || OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE
+    // Returns a list of buffers to the heap or the platform,
+    // bypassing the magazine.
+    void ReleaseBuffers(Buffer *aBuffers);
+#endif
 
 #if !OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT && !OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE
     uint16_t                  mNumFreeBuffers;
     Pool<Buffer, kNumBuffers> mBufferPool;
+#elif OPENTHREAD_CONFIG_MESSAGE_BUFFER_MAGAZINE_SIZE > 0
+    LinkedList<Buffer> mMagazine;
+    uint16_t           mMagazineSize;
 #endif
 };
 
@@ -143,7 +143,7 @@ void Notifier::EmitEvents(void)
 #if OPENTHREAD_CONFIG_BACKBONE_ROUTER_ENABLE
     Get<BackboneRouter::Manager>().HandleNotifierEvents(events);
 #endif
-#if OPENTHREAD_CONFIG_CHILD_SUPERVISION_ENABLE
+#if OPENTHREAD_CONFIG_CHILD_SUPERVISION_ENABLE && !OPENTHREAD_CONFIG_MLE_CHILD_TIMEOUT_INDEX_ENABLE
     Get<Utils::ChildSupervisor>().HandleNotifierEvents(events);
 #endif
 #if OPENTHREAD_CONFIG_DATASET_UPDATER_ENABLE || OPENTHREAD_CONFIG_CHANNEL_MANAGER_ENABLE
@@ -0,0 +1,297 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for a generic intrusive pairing heap.
+ */
+
+#ifndef PAIRING_HEAP_HPP_
+#define PAIRING_HEAP_HPP_
+
+#include "openthread-core-config.h"
+
+namespace ot {
+
+/**
+ * @addtogroup core-pairing-heap
+ *
+ * @brief
+ *   This module includes definitions for OpenThread Pairing Heap.
+ *
+ * @{
+ *
+ */
+
+template <typename Type, typename Key> class PairingHeap;
+
+/**
+ * This template class represents a pairing heap entry.
+ *
+ * This class holds the key the entry is ordered by and the links of the entry in the heap.
+ *
+ * Users of this class should follow CRTP-style inheritance, i.e., the `Type` class itself should publicly inherit
+ * from `PairingHeapEntry<Type, Key>`.
+ *
+ */
+template <typename Type, typename Key> class PairingHeapEntry
+{
+    friend class PairingHeap<Type, Key>;
+
+public:
+    /**
+     * This method returns the key the entry is ordered by in the heap.
+     *
+     * @returns The key of the entry.
+     *
+     */
+    const Key &GetHeapKey(void) const { return mHeapKey; }
+
+protected:
+    /**
+     * This constructor initializes the entry (not in a heap).
+     *
+     */
+    PairingHeapEntry(void)
+        : mHeapKey()
+        , mHeapChild(nullptr)
+        , mHeapNext(nullptr)
+        , mHeapPrev(nullptr)
+    {
+    }
+
+private:
+    Key   mHeapKey;
+    Type *mHeapChild; // First child.
+    Type *mHeapNext;  // Next sibling.
+    Type *mHeapPrev;  // Previous sibling, or the parent for a first child.
+};
+
+/**
+ * This template class represents a pairing heap, a min-heap of entries ordered by their keys.
+ *
+ * The entry with the smallest key is found in O(1), and adding or removing an entry takes O(log n) amortized. The
+ * order of entries with equal keys is unspecified.
+ *
+ * The template type `Type` should inherit from `PairingHeapEntry<Type, Key>` class, and `Key` should provide
+ * `operator<`.
+ *
+ */
+template <typename Type, typename Key> class PairingHeap
+{
+public:
+    /**
+     * This constructor initializes the pairing heap.
+     *
+     */
+    PairingHeap(void)
+        : mRoot(nullptr)
+    {
+    }
+
+    /**
+     * This method indicates whether the heap is empty or not.
+     *
+     * @retval TRUE   If the heap is empty.
+     * @retval FALSE  If the heap is not empty.
+     *
+     */
+    bool IsEmpty(void) const { return (mRoot == nullptr); }
+
+    /**
+     * This method returns the entry with the smallest key.
+     *
+     * @returns A pointer to the entry with the smallest key, or nullptr if the heap is empty.
+     *
+     */
+    Type *GetTop(void) { return mRoot; }
+
+    /**
+     * This method returns the entry with the smallest key.
+     *
+     * @returns A pointer to the entry with the smallest key, or nullptr if the heap is empty.
+     *
+     */
+    const Type *GetTop(void) const { return mRoot; }
+
+    /**
+     * This method indicates whether the heap contains a given entry.
+     *
+     * @param[in] aEntry   A reference to an entry.
+     *
+     * @retval TRUE   If the heap contains @p aEntry.
+     * @retval FALSE  If the heap does not contain @p aEntry.
+     *
+     */
+    bool Contains(const Type &aEntry) const { return (aEntry.mHeapPrev != nullptr) || (mRoot == &aEntry); }
+
+    /**
+     * This method adds an entry to the heap with a given key, or moves it if it is already in the heap.
+     *
+     * @param[in] aEntry   A reference to the entry.
+     * @param[in] aKey     The key to order @p aEntry by.
+     *
+     */
+    void Update(Type &aEntry, const Key &aKey)
+    {
+        Remove(aEntry);
+
+        aEntry.mHeapKey   = aKey;
+        aEntry.mHeapChild = nullptr;
+        aEntry.mHeapNext  = nullptr;
+        aEntry.mHeapPrev  = nullptr;
+
+        mRoot = (mRoot == nullptr) ? &aEntry : Meld(*mRoot, aEntry);
+    }
+
+    /**
+     * This method removes an entry from the heap.
+     *
+     * @param[in] aEntry   A reference to the entry. It is ignored if it is not in the heap.
+     *
+     */
+    void Remove(Type &aEntry)
+    {
+        if (mRoot == &aEntry)
+        {
+            mRoot = (aEntry.mHeapChild != nullptr) ? MeldSiblings(*aEntry.mHeapChild) : nullptr;
+        }
+        else if (aEntry.mHeapPrev != nullptr)
+        {
+            // Unlink the entry from its siblings, then meld its children back into the heap.
+
+            if (aEntry.mHeapPrev->mHeapChild == &aEntry)
+            {
+                aEntry.mHeapPrev->mHeapChild = aEntry.mHeapNext;
+            }
+            else
+            {
+                aEntry.mHeapPrev->mHeapNext = aEntry.mHeapNext;
+            }
+
+            if (aEntry.mHeapNext != nullptr)
+            {
+                aEntry.mHeapNext->mHeapPrev = aEntry.mHeapPrev;
+            }
+
+            if (aEntry.mHeapChild != nullptr)
+            {
+                mRoot = Meld(*mRoot, *MeldSiblings(*aEntry.mHeapChild));
+            }
+        }
+
+        aEntry.mHeapChild = nullptr;
+        aEntry.mHeapNext  = nullptr;
+        aEntry.mHeapPrev  = nullptr;
+    }
+
+    /**
+     * This method clears the heap.
+     *
+     * The entries are not updated, so they must be re-initialized before they are used with the heap again.
+     *
+     */
+    void Clear(void) { mRoot = nullptr; }
+
+private:
+    static Type *Meld(Type &aFirst, Type &aSecond)
+    {
+        // Links the later of two heap roots as the first child of the other one, and returns the new root.
+
+        Type *root  = &aFirst;
+        Type *child = &aSecond;
+
+        if (aSecond.mHeapKey < aFirst.mHeapKey)
+        {
+            root  = &aSecond;
+            child = &aFirst;
+        }
+
+        child->mHeapPrev = root;
+        child->mHeapNext = root->mHeapChild;
+
+        if (root->mHeapChild != nullptr)
+        {
+            root->mHeapChild->mHeapPrev = child;
+        }
+
+        root->mHeapChild = child;
+        root->mHeapNext  = nullptr;
+        root->mHeapPrev  = nullptr;
+
+        return root;
+    }
+
+    static Type *MeldSiblings(Type &aFirst)
+    {
+        // Melds a list of sibling sub-heaps into one, using the two-pass pairing: first meld the siblings in pairs
+        // from left to right, then meld the pairs from right to left.
+
+        Type *pairs = nullptr;
+        Type *cur   = &aFirst;
+        Type *root;
+
+        while (cur != nullptr)
+        {
+            Type *second = cur->mHeapNext;
+            Type *next   = (second != nullptr) ? second->mHeapNext : nullptr;
+            Type *pair   = (second != nullptr) ? Meld(*cur, *second) : cur;
+
+            pair->mHeapNext = pairs;
+            pairs           = pair;
+            cur             = next;
+        }
+
+        root  = pairs;
+        pairs = pairs->mHeapNext;
+
+        while (pairs != nullptr)
+        {
+            Type *next = pairs->mHeapNext;
+
+            root  = Meld(*root, *pairs);
+            pairs = next;
+        }
+
+        root->mHeapNext = nullptr;
+        root->mHeapPrev = nullptr;
+
+        return root;
+    }
+
+    Type *mRoot;
+};
+
+/**
+ * @}
+ *
+ */
+
+} // namespace ot
+
+#endif // PAIRING_HEAP_HPP_
@@ -104,6 +104,40 @@ public:
      */
     Type *Allocate(void) { return mFreeList.Pop(); }
 
+    /**
+     * This method allocates a number of objects from the pool at once.
+     *
+     * The allocated objects are returned as a list linked through their `GetNext()` and terminated by nullptr.
+     *
+     * @param[in]  aCount  The number of objects to allocate (MUST NOT be zero).
+     *
+     * @returns A pointer to the first allocated object, or nullptr if fewer than @p aCount objects are available from
+     *          the pool (in which case no object is allocated).
+     *
+     */
+    Type *Allocate(uint16_t aCount)
+    {
+        Type *head = mFreeList.GetHead();
+        Type *tail = head;
+
+        for (uint16_t count = 1; (tail != nullptr) && (count < aCount); count++)
+        {
+            tail = tail->GetNext();
+        }
+
+        if (tail == nullptr)
+        {
+            head = nullptr;
+        }
+        else
+        {
+            mFreeList.SetHead(tail->GetNext());
+            tail->SetNext(nullptr);
+        }
+
+        return head;
+    }
+
     /**
      * This method frees a previously allocated object.
      *
@@ -115,6 +149,22 @@ public:
      */
     void Free(Type &aEntry) { mFreeList.Push(aEntry); }
 
+    /**
+     * This method frees a list of previously allocated objects at once.
+     *
+     * The objects from @p aFirst to @p aLast MUST be linked through their `GetNext()` and all be entries from the pool
+     * previously allocated and not yet freed.
+     *
+     * @param[in]  aFirst  The first object of the list to free.
+     * @param[in]  aLast   The last object of the list to free.
+     *
+     */
+    void Free(Type &aFirst, Type &aLast)
+    {
+        aLast.SetNext(mFreeList.GetHead());
+        mFreeList.SetHead(&aFirst);
+    }
+
     /**
      * This method returns the pool size.
      *
@@ -94,7 +94,7 @@ void TimeTicker::HandleTimer(void)
         Get<AddressResolver>().HandleTimeTick();
     }
 
-#if OPENTHREAD_CONFIG_CHILD_SUPERVISION_ENABLE
+#if OPENTHREAD_CONFIG_CHILD_SUPERVISION_ENABLE && !OPENTHREAD_CONFIG_MLE_CHILD_TIMEOUT_INDEX_ENABLE
     if (mReceivers & Mask(kChildSupervisor))
     {
         Get<Utils::ChildSupervisor>().HandleTimeTick();
@@ -98,6 +98,57 @@ void TimerMilli::Stop(void)
     Get<TimerMilliScheduler>().Remove(*this);
 }
 
+#if OPENTHREAD_CONFIG_TIMER_HEAP_ENABLE
+
+void TimerScheduler::Add(Timer &aTimer, const AlarmApi &aAlarmApi)
+{
+    Time now(aAlarmApi.AlarmGetNow());
+
+    Remove(aTimer, aAlarmApi);
+    UpdateNow(now);
+
+    // The fire time is within `kMaxDelay` of `now` (or is past), so its signed offset from `now` is exact. Timers
+    // with the same fire time fire in the order they were started, as they do with the sorted list.
+
+    aTimer.mNext = nullptr;
+    mHeap.Update(aTimer, TimerHeapKey(mNow + static_cast<int32_t>(aTimer.mFireTime - now), mSequence++));
+
+    if (mHeap.GetTop() == &aTimer)
+    {
+        SetAlarm(aAlarmApi);
+    }
+}
+
+void TimerScheduler::Remove(Timer &aTimer, const AlarmApi &aAlarmApi)
+{
+    bool wasHead;
+
+    VerifyOrExit(aTimer.IsRunning());
+
+    wasHead = (mHeap.GetTop() == &aTimer);
+    mHeap.Remove(aTimer);
+    aTimer.mNext = &aTimer;
+
+    if (wasHead)
+    {
+        SetAlarm(aAlarmApi);
+    }
+
+exit:
+    return;
+}
+
+void TimerScheduler::UpdateNow(Time aNow)
+{
+    // `mNow` extends the time to 64 bits, so the heap keys of the running timers keep their order when the time
+    // wraps. The time is read at least once per alarm, so far less than a full wrap passes between two updates.
+
+    mNow += (aNow - mLastNow);
+    mLastNow = aNow;
+}
+
+#else // OPENTHREAD_CONFIG_TIMER_HEAP_ENABLE
+
 void TimerScheduler::Add(Timer &aTimer, const AlarmApi &aAlarmApi)
 {
     Timer *prev = nullptr;
@@ -144,15 +195,18 @@ exit:
     return;
 }
 
+#endif // OPENTHREAD_CONFIG_TIMER_HEAP_ENABLE
+
 void TimerScheduler::SetAlarm(const AlarmApi &aAlarmApi)
 {
-    if (mTimerList.IsEmpty())
+    Timer *timer = GetHead();
+
+    if (timer == nullptr)
     {
         aAlarmApi.AlarmStop(&GetInstance());
     }
     else
     {
-        Timer *  timer = mTimerList.GetHead();
         Time     now(aAlarmApi.AlarmGetNow());
         uint32_t remaining;
 
@@ -164,12 +218,16 @@ void TimerScheduler::SetAlarm(const AlarmApi &aAlarmApi)
 
 void TimerScheduler::ProcessTimers(const AlarmApi &aAlarmApi)
 {
-    Timer *timer = mTimerList.GetHead();
+    Timer *timer = GetHead();
 
     if (timer)
     {
         Time now(aAlarmApi.AlarmGetNow());
 
+#if OPENTHREAD_CONFIG_TIMER_HEAP_ENABLE
+        UpdateNow(now);
+#endif
+
         if (now >= timer->mFireTime)
         {
             Remove(*timer, aAlarmApi); // `Remove()` will `SetAlarm` for next timer if there is any.
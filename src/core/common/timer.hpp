@@ -46,6 +46,7 @@
 #include "common/linked_list.hpp"
 #include "common/locator.hpp"
 #include "common/non_copyable.hpp"
+#include "common/pairing_heap.hpp"
 #include "common/tasklet.hpp"
 #include "common/time.hpp"
 
@@ -63,11 +64,71 @@ class TimerMilliScheduler;
  *
  */
 
+#if OPENTHREAD_CONFIG_TIMER_HEAP_ENABLE
+/**
+ * This class represents the key of a running timer in the timer heap.
+ *
+ * The key is the fire time extended to 64 bits by the `TimerScheduler`, followed by the order in which the timer was
+ * started.
+ *
+ */
+class TimerHeapKey
+{
+public:
+    /**
+     * This constructor initializes the key.
+     *
+     */
+    TimerHeapKey(void)
+        : mFireTime(0)
+        , mSequence(0)
+    {
+    }
+
+    /**
+     * This constructor initializes the key.
+     *
+     * @param[in]  aFireTime   The fire time extended to 64 bits.
+     * @param[in]  aSequence   The start sequence number of the timer.
+     *
+     */
+    TimerHeapKey(uint64_t aFireTime, uint32_t aSequence)
+        : mFireTime(aFireTime)
+        , mSequence(aSequence)
+    {
+    }
+
+    /**
+     * This method indicates whether this key is ordered before another one.
+     *
+     * @param[in]  aOther  The other key.
+     *
+     * @retval TRUE   If this key is ordered before @p aOther.
+     * @retval FALSE  If this key is not ordered before @p aOther.
+     *
+     */
+    bool operator<(const TimerHeapKey &aOther) const
+    {
+        return (mFireTime < aOther.mFireTime) ||
+               ((mFireTime == aOther.mFireTime) && (static_cast<int32_t>(mSequence - aOther.mSequence) < 0));
+    }
+
+private:
+    uint64_t mFireTime;
+    uint32_t mSequence;
+};
+#endif
+
 /**
  * This class implements a timer.
  *
  */
-class Timer : public InstanceLocator, public LinkedListEntry<Timer>
+class Timer : public InstanceLocator,
+              public LinkedListEntry<Timer>
+#if OPENTHREAD_CONFIG_TIMER_HEAP_ENABLE
+    ,
+              public PairingHeapEntry<Timer, TimerHeapKey>
+#endif
 {
     friend class TimerScheduler;
     friend class LinkedListEntry<Timer>;
@@ -273,6 +334,11 @@ protected:
      */
     explicit TimerScheduler(Instance &aInstance)
         : InstanceLocator(aInstance)
+#if OPENTHREAD_CONFIG_TIMER_HEAP_ENABLE
+        , mNow(kNowStart)
+        , mLastNow()
+        , mSequence(0)
+#endif
     {
     }
 
@@ -310,7 +376,26 @@ protected:
      */
     void SetAlarm(const AlarmApi &aAlarmApi);
 
+#if OPENTHREAD_CONFIG_TIMER_HEAP_ENABLE
+    // The running timers are kept in a pairing heap. A running timer has a null `mNext`.
+
+    enum : uint64_t
+    {
+        kNowStart = (1ULL << 32), // Keeps the extended fire time of a past timer from going below zero.
+    };
+
+    Timer *GetHead(void) { return mHeap.GetTop(); }
+    void   UpdateNow(Time aNow);
+
+    PairingHeap<Timer, TimerHeapKey> mHeap;
+    uint64_t                         mNow;
+    Time                             mLastNow;
+    uint32_t                         mSequence;
+#else
+    Timer *GetHead(void) { return mTimerList.GetHead(); }
+
     LinkedList<Timer> mTimerList;
+#endif
 };
 
 /**
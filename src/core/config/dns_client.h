@@ -110,4 +110,49 @@
 #define OPENTHREAD_CONFIG_DNS_CLIENT_DEFAULT_RECURSION_DESIRED_FLAG 1
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+ *
+ * Define to 1 to enable the DNS client response cache.
+ *
+ * Responses (including negative ones) are kept for the smallest TTL of their records, and a query identical to an
+ * in-flight one waits for its response instead of being sent again.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+#define OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_MAX_ENTRIES
+ *
+ * Specifies the maximum number of responses in the DNS client cache.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_MAX_ENTRIES
+#define OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_MAX_ENTRIES 8
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_MAX_BYTES
+ *
+ * Specifies the maximum total number of bytes of the responses in the DNS client cache.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_MAX_BYTES
+#define OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_MAX_BYTES 2048
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_NEGATIVE_TTL
+ *
+ * Specifies the maximum time (in seconds) a negative response (name error, or no answer record) is cached.
+ *
+ * A negative response is cached for the smaller of this value and the TTL of its records (e.g., the SOA record).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_NEGATIVE_TTL
+#define OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_NEGATIVE_TTL 30
+#endif
+
 #endif // CONFIG_DNS_CLIENT_H_
@@ -55,4 +55,20 @@
 #define OPENTHREAD_CONFIG_DNSSD_SERVER_PORT 53
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_DNSSD_SERVER_NAME_COMPRESS_TABLE_SIZE
+ *
+ * The number of slots (a power of two) in the table of name suffixes used to compress the names in a DNS-SD Server
+ * response. Up to three quarters of them are used, names appended after the table is full are not used for
+ * compressing later names.
+ *
+ * The table is a member of the DNS-SD Server (cleared for each response), so it permanently takes about 18 bytes of
+ * RAM per slot (a table entry and room for the label text) in each OpenThread instance, i.e. about 1.2 KB with the
+ * default 64 slots.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_DNSSD_SERVER_NAME_COMPRESS_TABLE_SIZE
+#define OPENTHREAD_CONFIG_DNSSD_SERVER_NAME_COMPRESS_TABLE_SIZE 64
+#endif
+
 #endif // CONFIG_DNSSD_SERVER_H_
@@ -417,4 +417,22 @@
 #define OPENTHREAD_CONFIG_MAC_SCAN_DURATION 300
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_MAC_TX_PIPELINE_ENABLE
+ *
+ * Define as 1 to prepare the next direct frame (the next fragment of the message being sent, or the next queued mesh
+ * frame to forward) while the current frame is on air, and to start its transmission directly from the transmit done
+ * event. The sequence number, frame counter and security of the prepared frame are only applied when it is sent.
+ *
+ * This is supported only when IEEE 802.15.4 is the only radio link.
+ *
+ * This only shortens the time from a transmit done event to the start of the next transmission (about 0.16 us out of
+ * 1.9 us on a x86-64 host), which is negligible against the frame air time. It is meant for slow processors where
+ * building a frame takes a noticeable part of the inter-frame gap.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MAC_TX_PIPELINE_ENABLE
+#define OPENTHREAD_CONFIG_MAC_TX_PIPELINE_ENABLE 0
+#endif
+
 #endif // CONFIG_MAC_H_
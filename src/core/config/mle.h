@@ -214,6 +214,36 @@
 #define OPENTHREAD_CONFIG_MLE_LONG_ROUTES_ENABLE 0
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_MLE_ROUTE_TABLE_ENABLE
+ *
+ * Define as 1 to keep the next hop and path cost toward every router ID in a table indexed by router ID.
+ *
+ * The table is updated incrementally as MLE Advertisements are processed and rebuilt when a link to a neighboring
+ * router changes, so `MleRouter::GetNextHop()` and `MleRouter::GetCost()` become an indexed load instead of walking the
+ * Router Table for the destination, its next hop and their link costs on every forwarded frame. Router entries are
+ * also located by router ID through an index map instead of a linear search.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MLE_ROUTE_TABLE_ENABLE
+#define OPENTHREAD_CONFIG_MLE_ROUTE_TABLE_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MLE_CHILD_TIMEOUT_INDEX_ENABLE
+ *
+ * Define as 1 to process child timeouts from a timer set to the next child deadline instead of checking every child
+ * on each one-second MLE time tick.
+ *
+ * The children are kept in an index ordered by the earliest of their child timeout, CSL synchronization timeout and
+ * supervision deadlines, so only the children that are due are processed. Child supervision then uses the same timer
+ * instead of its own time tick.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MLE_CHILD_TIMEOUT_INDEX_ENABLE
+#define OPENTHREAD_CONFIG_MLE_CHILD_TIMEOUT_INDEX_ENABLE 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_MLE_SEND_UNICAST_ANNOUNCE_RESPONSE
  *
@@ -128,6 +128,19 @@
 #define OPENTHREAD_CONFIG_UDP_FORWARD_ENABLE 0
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_TIMER_HEAP_ENABLE
+ *
+ * Define to 1 to keep the running timers in a pairing heap instead of a sorted list.
+ *
+ * Starting and stopping a timer is then logarithmic instead of linear in the number of running timers, at the cost
+ * of three more words per timer.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_TIMER_HEAP_ENABLE
+#define OPENTHREAD_CONFIG_TIMER_HEAP_ENABLE 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE
  *
@@ -140,6 +153,20 @@
 #define OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE 0
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_MESSAGE_BUFFER_MAGAZINE_SIZE
+ *
+ * The maximum number of freed message buffers kept in a cache (magazine) in front of the heap or platform message
+ * pool, so that they can be reused without calling into the allocator. Define as 0 to disable the magazine.
+ *
+ * This only applies when `OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE` or `OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT`
+ * is set. The static buffer pool is a free list already.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MESSAGE_BUFFER_MAGAZINE_SIZE
+#define OPENTHREAD_CONFIG_MESSAGE_BUFFER_MAGAZINE_SIZE 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS
  *
@@ -150,6 +177,34 @@
 #define OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS 44
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_MESSAGE_LARGE_BUFFER_ENABLE
+ *
+ * Define as 1 to size message buffers so that a full IPv6 datagram (`OPENTHREAD_CONFIG_IP6_MAX_DATAGRAM_LENGTH`), along
+ * with the headers reserved in front of it, fits in the first buffer of a message.
+ *
+ * Every message then occupies a single contiguous buffer, so reading and writing at an offset is plain pointer
+ * arithmetic and `Message::GetContiguous()` always succeeds. This trades RAM for speed and is intended for hosts such
+ * as a Linux border router. `OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS` should be sized accordingly since each message,
+ * however small, takes a whole buffer.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MESSAGE_LARGE_BUFFER_ENABLE
+#define OPENTHREAD_CONFIG_MESSAGE_LARGE_BUFFER_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MESSAGE_LARGE_BUFFER_HEADROOM
+ *
+ * The number of bytes in addition to a full IPv6 datagram that fit in the first buffer of a message when
+ * `OPENTHREAD_CONFIG_MESSAGE_LARGE_BUFFER_ENABLE` is set. It covers the headers reserved by `Ip6::NewMessage()`, the
+ * TUN packet information header and IPv6-in-IPv6 encapsulation.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MESSAGE_LARGE_BUFFER_HEADROOM
+#define OPENTHREAD_CONFIG_MESSAGE_LARGE_BUFFER_HEADROOM 128
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_MESSAGE_BUFFER_SIZE
  *
@@ -163,8 +218,13 @@
  *
  */
 #ifndef OPENTHREAD_CONFIG_MESSAGE_BUFFER_SIZE
+#if OPENTHREAD_CONFIG_MESSAGE_LARGE_BUFFER_ENABLE
+#define OPENTHREAD_CONFIG_MESSAGE_BUFFER_SIZE \
+    (sizeof(void *) * 32 + OPENTHREAD_CONFIG_IP6_MAX_DATAGRAM_LENGTH + OPENTHREAD_CONFIG_MESSAGE_LARGE_BUFFER_HEADROOM)
+#else
 #define OPENTHREAD_CONFIG_MESSAGE_BUFFER_SIZE (sizeof(void *) * 32)
 #endif
+#endif
 
 /**
  * @def OPENTHREAD_CONFIG_DEFAULT_TRANSMIT_POWER
@@ -192,6 +252,68 @@
 #define OPENTHREAD_CONFIG_DROP_MESSAGE_ON_FRAGMENT_TX_FAILURE 1
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_MESH_FORWARDER_SEND_QUEUE_INDEX_ENABLE
+ *
+ * Define as 1 to maintain per-destination indices over the mesh forwarder send queue.
+ *
+ * When enabled, messages pending direct transmission and messages pending indirect transmission to each sleepy child
+ * are additionally linked in separate lists, so that selecting the next message to send does not require scanning
+ * the whole send queue. Messages pending indirect transmission are also linked per priority level, so that finding
+ * one to evict does not require scanning either. This adds a few pointers to the metadata of every message, so it is
+ * mainly intended for platforms with a large message pool and child table.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MESH_FORWARDER_SEND_QUEUE_INDEX_ENABLE
+#define OPENTHREAD_CONFIG_MESH_FORWARDER_SEND_QUEUE_INDEX_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_NETDATA_FIB_ENABLE
+ *
+ * Define as 1 to compile the Leader Network Data into a forwarding table each time it changes.
+ *
+ * Route lookups, on-mesh checks and 6LoWPAN context lookups then scan flat arrays of prefixes (matched as two 64-bit
+ * words) and next hops, instead of parsing the Network Data TLVs and sub-TLVs on every forwarded or compressed packet.
+ * The table is sized for the largest possible Network Data, which takes about 2 KB of RAM.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_NETDATA_FIB_ENABLE
+#define OPENTHREAD_CONFIG_NETDATA_FIB_ENABLE 0
+#endif
+
+/**
+ * Mesh forwarder eviction policies, used with `OPENTHREAD_CONFIG_MESH_FORWARDER_EVICTION_POLICY`.
+ *
+ */
+#define OPENTHREAD_CONFIG_MESH_FORWARDER_EVICTION_POLICY_OLDEST 0           ///< Oldest message first.
+#define OPENTHREAD_CONFIG_MESH_FORWARDER_EVICTION_POLICY_LARGEST 1          ///< Largest message first.
+#define OPENTHREAD_CONFIG_MESH_FORWARDER_EVICTION_POLICY_SLEEPY_CHILD_AGE 2 ///< Least recently heard children first.
+
+/**
+ * @def OPENTHREAD_CONFIG_MESH_FORWARDER_EVICTION_POLICY
+ *
+ * Selects which message the mesh forwarder evicts among the candidates of the same priority level when a message
+ * buffer cannot be allocated.
+ *
+ * - `OPENTHREAD_CONFIG_MESH_FORWARDER_EVICTION_POLICY_OLDEST` evicts the message queued first. The candidate is
+ *   found in constant time.
+ * - `OPENTHREAD_CONFIG_MESH_FORWARDER_EVICTION_POLICY_LARGEST` evicts the message using the most buffers.
+ * - `OPENTHREAD_CONFIG_MESH_FORWARDER_EVICTION_POLICY_SLEEPY_CHILD_AGE` evicts the message pending indirect
+ *   transmission whose sleepy children were heard from least recently, falling back to the oldest message.
+ *
+ * The last two policies walk all the candidates of the priority level. This option only applies to FTD builds.
+ *
+ * The candidates pending indirect transmission are looked up through the per priority level eviction index. This
+ * index is one of the send queue indices, so it is only maintained with
+ * `OPENTHREAD_CONFIG_MESH_FORWARDER_SEND_QUEUE_INDEX_ENABLE`. Without it, all the messages of the priority level are
+ * walked to find them.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MESH_FORWARDER_EVICTION_POLICY
+#define OPENTHREAD_CONFIG_MESH_FORWARDER_EVICTION_POLICY OPENTHREAD_CONFIG_MESH_FORWARDER_EVICTION_POLICY_OLDEST
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_TIMEOUT
  *
@@ -202,6 +324,33 @@
 #define OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_TIMEOUT 2
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_MAX_ENTRIES
+ *
+ * The maximum number of 6LoWPAN datagrams being reassembled at the same time.
+ *
+ * When a first fragment is received while this many datagrams are being reassembled, the oldest one is evicted.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_MAX_ENTRIES
+#define OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_MAX_ENTRIES 16
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_MAX_BUFFERS_PER_SOURCE
+ *
+ * The maximum number of message buffers used by datagrams being reassembled from the same link-layer source, or 0 to
+ * not limit them.
+ *
+ * When a first fragment would exceed this limit, older datagrams from the same source are evicted. A datagram which
+ * alone requires more buffers is dropped. For example, `(OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS / 2)` keeps a single
+ * source from using more than half of the message pool for reassembly.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_MAX_BUFFERS_PER_SOURCE
+#define OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_MAX_BUFFERS_PER_SOURCE 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_JOINER_UDP_PORT
  *
@@ -232,6 +381,18 @@
 #define OPENTHREAD_CONFIG_STORE_FRAME_COUNTER_AHEAD 1000
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_KEY_SCHEDULE_CACHE_ENABLE
+ *
+ * Define as 1 for the key manager to keep the expanded AES key schedules of the MAC and MLE keys of the previous,
+ * current and next key sequence, and of the TREL key and KEK, so that securing a MAC frame or an MLE message does not
+ * run the AES key expansion again. This takes about 2.5 KB of RAM.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_KEY_SCHEDULE_CACHE_ENABLE
+#define OPENTHREAD_CONFIG_KEY_SCHEDULE_CACHE_ENABLE 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_ENABLE_BUILTIN_MBEDTLS
  *
@@ -259,6 +420,19 @@
 #define OPENTHREAD_CONFIG_ENABLE_BUILTIN_MBEDTLS_MANAGEMENT OPENTHREAD_CONFIG_ENABLE_BUILTIN_MBEDTLS
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_MBEDTLS_AESNI_ENABLE
+ *
+ * Define as 1 to let the builtin mbedTLS use the x86-64 AES-NI instructions for AES block encryption.
+ *
+ * Support is detected at run-time and the software implementation is used on CPUs without AES-NI. The setting has no
+ * effect on other architectures.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MBEDTLS_AESNI_ENABLE
+#define OPENTHREAD_CONFIG_MBEDTLS_AESNI_ENABLE 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_HEAP_INTERNAL_SIZE
  *
@@ -367,6 +541,37 @@
 #define OPENTHREAD_CONFIG_PLATFORM_FLASH_API_ENABLE 0
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_SIZE
+ *
+ * The number of records the flash settings driver keeps in a RAM index.
+ *
+ * With the index, lookups read only the value from flash instead of every record header in the active swap area.
+ * While more records are stored than fit in the index, the driver falls back to reading record headers from flash
+ * until a swap brings the number of records back within the index.
+ *
+ * Define to 0 to disable the index.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_SIZE
+#define OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_SIZE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_PLATFORM_FLASH_SWAP_WATERMARK
+ *
+ * The free space in bytes the flash settings driver keeps in the active swap area.
+ *
+ * When adding a record would leave less free space than this, the driver swaps early, but only if the swap would
+ * restore the watermark. Whatever the watermark, the driver never swaps when the swap cannot make room for the new
+ * record. The watermark only applies while the RAM index (OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_SIZE) is in use,
+ * since the index is needed to know how much space a swap reclaims.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_PLATFORM_FLASH_SWAP_WATERMARK
+#define OPENTHREAD_CONFIG_PLATFORM_FLASH_SWAP_WATERMARK 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_FAILED_CHILD_TRANSMISSIONS
  *
@@ -80,4 +80,18 @@
 #define OPENTHREAD_CONFIG_SRP_SERVER_MAX_ADDRESSES_NUM 2
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_SRP_SERVER_NAME_INDEX_SIZE
+ *
+ * Specifies the number of buckets in each of the SRP server name hash indices (host names, service instance names
+ * and service names).
+ *
+ * Each index costs one pointer per bucket. Lookups stay O(1) as long as the number of registered hosts and services
+ * is in the order of this value.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_SRP_SERVER_NAME_INDEX_SIZE
+#define OPENTHREAD_CONFIG_SRP_SERVER_NAME_INDEX_SIZE 16
+#endif
+
 #endif // CONFIG_SRP_SERVER_H_
@@ -38,6 +38,7 @@
 #include "common/code_utils.hpp"
 #include "common/debug.hpp"
 #include "common/encoding.hpp"
+#include "common/message.hpp"
 
 namespace ot {
 namespace Crypto {
@@ -45,6 +46,7 @@ namespace Crypto {
 void AesCcm::SetKey(const uint8_t *aKey, uint16_t aKeyLength)
 {
     mEcb.SetKey(aKey, CHAR_BIT * aKeyLength);
+    mKeySchedule = &mEcb;
 }
 
 void AesCcm::SetKey(const Mac::Key &aMacKey)
@@ -52,6 +54,11 @@ void AesCcm::SetKey(const Mac::Key &aMacKey)
     SetKey(aMacKey.GetKey(), Mac::Key::kSize);
 }
 
+void AesCcm::SetKey(AesEcb &aKeySchedule)
+{
+    mKeySchedule = &aKeySchedule;
+}
+
 void AesCcm::Init(uint32_t    aHeaderLength,
                   uint32_t    aPlainTextLength,
                   uint8_t     aTagLength,
@@ -114,8 +121,10 @@ void AesCcm::Init(uint32_t    aHeaderLength,
         len >>= 8;
     }
 
+    OT_ASSERT(mKeySchedule != nullptr);
+
     // encrypt initial block
-    mEcb.Encrypt(mBlock, mBlock);
+    mKeySchedule->Encrypt(mBlock, mBlock);
 
     // process header
     if (aHeaderLength > 0)
@@ -158,26 +167,36 @@ void AesCcm::Header(const void *aHeader, uint32_t aHeaderLength)
 
     OT_ASSERT(mHeaderCur + aHeaderLength <= mHeaderLength);
 
-    // process header
-    for (unsigned i = 0; i < aHeaderLength; i++)
+    // process header, XOR-ing up to a whole block at a time
+    while (aHeaderLength > 0)
     {
+        uint16_t length;
+
         if (mBlockLength == sizeof(mBlock))
         {
-            mEcb.Encrypt(mBlock, mBlock);
+            mKeySchedule->Encrypt(mBlock, mBlock);
             mBlockLength = 0;
         }
 
-        mBlock[mBlockLength++] ^= headerBytes[i];
-    }
+        length = static_cast<uint16_t>(OT_MIN(aHeaderLength, sizeof(mBlock) - mBlockLength));
 
-    mHeaderCur += aHeaderLength;
+        for (uint16_t i = 0; i < length; i++)
+        {
+            mBlock[mBlockLength + i] ^= headerBytes[i];
+        }
+
+        mBlockLength += length;
+        headerBytes += length;
+        aHeaderLength -= length;
+        mHeaderCur += length;
+    }
 
     if (mHeaderCur == mHeaderLength)
     {
         // process remainder
         if (mBlockLength != 0)
         {
-            mEcb.Encrypt(mBlock, mBlock);
+            mKeySchedule->Encrypt(mBlock, mBlock);
         }
 
         mBlockLength = 0;
@@ -188,13 +207,17 @@ void AesCcm::Payload(void *aPlainText, void *aCipherText, uint32_t aLength, Mode
 {
     uint8_t *plaintextBytes  = reinterpret_cast<uint8_t *>(aPlainText);
     uint8_t *ciphertextBytes = reinterpret_cast<uint8_t *>(aCipherText);
-    uint8_t  byte;
+    uint32_t remaining       = aLength;
 
     OT_ASSERT(mPlainTextCur + aLength <= mPlainTextLength);
 
-    for (unsigned i = 0; i < aLength; i++)
+    // The counter pad and the CBC-MAC block advance in lockstep over the payload, so each step covers the rest of
+    // the current block (a whole block when aligned) with one counter encryption and one CBC-MAC encryption.
+    while (remaining > 0)
     {
-        if (mCtrLength == 16)
+        uint16_t length;
+
+        if (mCtrLength == sizeof(mCtrPad))
         {
             for (int j = sizeof(mCtr) - 1; j > mNonceLength; j--)
             {
@@ -204,28 +227,33 @@ void AesCcm::Payload(void *aPlainText, void *aCipherText, uint32_t aLength, Mode
                 }
             }
 
-            mEcb.Encrypt(mCtr, mCtrPad);
+            mKeySchedule->Encrypt(mCtr, mCtrPad);
             mCtrLength = 0;
         }
 
-        if (aMode == kEncrypt)
+        if (mBlockLength == sizeof(mBlock))
         {
-            byte               = plaintextBytes[i];
-            ciphertextBytes[i] = byte ^ mCtrPad[mCtrLength++];
+            mKeySchedule->Encrypt(mBlock, mBlock);
+            mBlockLength = 0;
         }
-        else
+
+        length = static_cast<uint16_t>(OT_MIN(remaining, sizeof(mCtrPad) - mCtrLength));
+        length = OT_MIN(length, static_cast<uint16_t>(sizeof(mBlock) - mBlockLength));
+
+        if (aMode == kEncrypt)
         {
-            byte              = ciphertextBytes[i] ^ mCtrPad[mCtrLength++];
-            plaintextBytes[i] = byte;
+            EncryptSpan(plaintextBytes, ciphertextBytes, length);
         }
-
-        if (mBlockLength == sizeof(mBlock))
+        else
         {
-            mEcb.Encrypt(mBlock, mBlock);
-            mBlockLength = 0;
+            DecryptSpan(ciphertextBytes, plaintextBytes, length);
         }
 
-        mBlock[mBlockLength++] ^= byte;
+        mCtrLength += length;
+        mBlockLength += length;
+        plaintextBytes += length;
+        ciphertextBytes += length;
+        remaining -= length;
     }
 
     mPlainTextCur += aLength;
@@ -234,7 +262,7 @@ void AesCcm::Payload(void *aPlainText, void *aCipherText, uint32_t aLength, Mode
     {
         if (mBlockLength != 0)
         {
-            mEcb.Encrypt(mBlock, mBlock);
+            mKeySchedule->Encrypt(mBlock, mBlock);
         }
 
         // reset counter
@@ -242,13 +270,56 @@ void AesCcm::Payload(void *aPlainText, void *aCipherText, uint32_t aLength, Mode
     }
 }
 
+#if !OPENTHREAD_RADIO
+void AesCcm::Payload(Message &aMessage, uint16_t aOffset, uint16_t aLength, Mode aMode)
+{
+    Message::WritableChunk chunk;
+
+    aMessage.GetFirstChunk(aOffset, aLength, chunk);
+
+    while (chunk.GetLength() > 0)
+    {
+        Payload(chunk.GetData(), chunk.GetData(), chunk.GetLength(), aMode);
+        aMessage.GetNextChunk(aLength, chunk);
+    }
+}
+#endif
+
+void AesCcm::EncryptSpan(const uint8_t *aPlainText, uint8_t *aCipherText, uint16_t aLength)
+{
+    const uint8_t *pad   = &mCtrPad[mCtrLength];
+    uint8_t *      block = &mBlock[mBlockLength];
+
+    for (uint16_t i = 0; i < aLength; i++)
+    {
+        uint8_t byte = aPlainText[i];
+
+        aCipherText[i] = byte ^ pad[i];
+        block[i] ^= byte;
+    }
+}
+
+void AesCcm::DecryptSpan(const uint8_t *aCipherText, uint8_t *aPlainText, uint16_t aLength)
+{
+    const uint8_t *pad   = &mCtrPad[mCtrLength];
+    uint8_t *      block = &mBlock[mBlockLength];
+
+    for (uint16_t i = 0; i < aLength; i++)
+    {
+        uint8_t byte = aCipherText[i] ^ pad[i];
+
+        aPlainText[i] = byte;
+        block[i] ^= byte;
+    }
+}
+
 void AesCcm::Finalize(void *aTag)
 {
     uint8_t *tagBytes = reinterpret_cast<uint8_t *>(aTag);
 
     OT_ASSERT(mPlainTextCur == mPlainTextLength);
 
-    mEcb.Encrypt(mCtr, mCtrPad);
+    mKeySchedule->Encrypt(mCtr, mCtrPad);
 
     for (int i = 0; i < mTagLength; i++)
     {
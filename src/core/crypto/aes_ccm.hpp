@@ -44,6 +44,9 @@
 #include "mac/mac_types.hpp"
 
 namespace ot {
+
+class Message;
+
 namespace Crypto {
 
 /**
@@ -77,6 +80,15 @@ public:
         kDecrypt, // Decryption mode.
     };
 
+    /**
+     * This constructor initializes the object.
+     *
+     */
+    AesCcm(void)
+        : mKeySchedule(nullptr)
+    {
+    }
+
     /**
      * This method sets the key.
      *
@@ -94,6 +106,16 @@ public:
      */
     void SetKey(const Mac::Key &aMacKey);
 
+    /**
+     * This method sets the key from an already expanded AES key schedule.
+     *
+     * The schedule is used in place (not copied), so it MUST stay unchanged until the computation is finalized.
+     *
+     * @param[in]  aKeySchedule  An expanded AES key schedule.
+     *
+     */
+    void SetKey(AesEcb &aKeySchedule);
+
     /**
      * This method initializes the AES CCM computation.
      *
@@ -130,6 +152,21 @@ public:
      */
     void Payload(void *aPlainText, void *aCipherText, uint32_t aLength, Mode aMode);
 
+#if !OPENTHREAD_RADIO
+    /**
+     * This method processes the payload in place within a message.
+     *
+     * The message content is encrypted or decrypted chunk by chunk directly in the message buffers.
+     *
+     * @param[inout]  aMessage  The message containing the payload.
+     * @param[in]     aOffset   The offset into @p aMessage of the payload.
+     * @param[in]     aLength   Payload length in bytes.
+     * @param[in]     aMode     Mode to indicate whether to encrypt (`kEncrypt`) or decrypt (`kDecrypt`).
+     *
+     */
+    void Payload(Message &aMessage, uint16_t aOffset, uint16_t aLength, Mode aMode);
+#endif
+
     /**
      * This method returns the tag length in bytes.
      *
@@ -161,7 +198,11 @@ public:
                               uint8_t *              aNonce);
 
 private:
+    void EncryptSpan(const uint8_t *aPlainText, uint8_t *aCipherText, uint16_t aLength);
+    void DecryptSpan(const uint8_t *aCipherText, uint8_t *aPlainText, uint16_t aLength);
+
     AesEcb   mEcb;
+    AesEcb * mKeySchedule;
     uint8_t  mBlock[AesEcb::kBlockSize];
     uint8_t  mCtr[AesEcb::kBlockSize];
     uint8_t  mCtrPad[AesEcb::kBlockSize];
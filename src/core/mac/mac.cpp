@@ -97,6 +97,9 @@ Mac::Mac(Instance &aInstance)
 #if OPENTHREAD_CONFIG_MAC_STAY_AWAKE_BETWEEN_FRAGMENTS
     , mShouldDelaySleep(false)
     , mDelayingSleep(false)
+#endif
+#if OPENTHREAD_CONFIG_MAC_TX_PIPELINE_ENABLE
+    , mPipelineFrameReady(false)
 #endif
     , mOperation(kOperationIdle)
     , mBeaconSequence(Random::NonCrypto::GetUint8())
@@ -123,6 +126,8 @@ Mac::Mac(Instance &aInstance)
     , mOobFrame(nullptr)
     , mKeyIdMode2FrameCounter(0)
     , mCcaSampleCount(0)
+#if OPENTHREAD_CONFIG_MAC_TX_PIPELINE_ENABLE
+#endif
 #if OPENTHREAD_CONFIG_MULTI_RADIO
     , mTxError(OT_ERROR_NONE)
 #endif
@@ -131,6 +136,14 @@ Mac::Mac(Instance &aInstance)
 
     randomExtAddress.GenerateRandom();
 
+#if OPENTHREAD_CONFIG_MAC_TX_PIPELINE_ENABLE
+    memset(&mPipelineFrame, 0, sizeof(mPipelineFrame));
+    mPipelineFrame.mPsdu = mPipelinePsdu;
+#if OPENTHREAD_CONFIG_TIME_SYNC_ENABLE
+    mPipelineFrame.mInfo.mTxInfo.mIeInfo = &mPipelineIeInfo;
+#endif
+#endif
+
     mCcaSuccessRateTracker.Clear();
     ResetCounters();
     mExtendedPanId.Clear();
@@ -547,11 +560,25 @@ otError Mac::SetDomainName(const NameData &aNameData)
 }
 #endif // (OPENTHREAD_CONFIG_THREAD_VERSION >= OT_THREAD_VERSION_1_2)
 
+void Mac::SetExtAddress(const ExtAddress &aExtAddress)
+{
+    mLinks.SetExtAddress(aExtAddress);
+
+#if OPENTHREAD_CONFIG_MAC_TX_PIPELINE_ENABLE
+    // The pipelined frame carries the previous address.
+    mPipelineFrameReady = false;
+#endif
+}
+
 void Mac::SetPanId(PanId aPanId)
 {
     SuccessOrExit(Get<Notifier>().Update(mPanId, aPanId, kEventThreadPanIdChanged));
     mLinks.SetPanId(mPanId);
 
+#if OPENTHREAD_CONFIG_MAC_TX_PIPELINE_ENABLE
+    mPipelineFrameReady = false;
+#endif
+
 exit:
     return;
 }
@@ -1046,7 +1073,8 @@ void Mac::ProcessTransmitSecurity(TxFrame &aFrame)
 {
     KeyManager &      keyManager = Get<KeyManager>();
     uint8_t           keyIdMode;
-    const ExtAddress *extAddress = nullptr;
+    const ExtAddress *extAddress  = nullptr;
+    Crypto::AesEcb *  keySchedule = nullptr;
 
     VerifyOrExit(aFrame.GetSecurityEnabled());
 
@@ -1056,7 +1084,8 @@ void Mac::ProcessTransmitSecurity(TxFrame &aFrame)
     {
     case Frame::kKeyIdMode0:
         aFrame.SetAesKey(keyManager.GetKek());
-        extAddress = &GetExtAddress();
+        keySchedule = &keyManager.GetAesKeySchedule(KeyManager::kKeyTypeKek, 0);
+        extAddress  = &GetExtAddress();
 
         if (!aFrame.IsARetransmission())
         {
@@ -1080,7 +1109,8 @@ void Mac::ProcessTransmitSecurity(TxFrame &aFrame)
 
 #if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
         aFrame.SetAesKey(*mLinks.GetCurrentMacKey(aFrame));
-        extAddress = &GetExtAddress();
+        keySchedule = &mLinks.GetMacKeySchedule(aFrame, keyManager.GetCurrentKeySequence());
+        extAddress  = &GetExtAddress();
 
         // If the frame is marked as a retransmission, `MeshForwarder` which
         // prepared the frame should set the frame counter and key id to the
@@ -1123,7 +1153,14 @@ void Mac::ProcessTransmitSecurity(TxFrame &aFrame)
     VerifyOrExit(aFrame.mInfo.mTxInfo.mCslPresent == 0);
 #endif
 
-    aFrame.ProcessTransmitAesCcm(*extAddress);
+    if (keySchedule != nullptr)
+    {
+        aFrame.ProcessTransmitAesCcm(*extAddress, *keySchedule);
+    }
+    else
+    {
+        aFrame.ProcessTransmitAesCcm(*extAddress);
+    }
 
 exit:
     return;
@@ -1134,6 +1171,15 @@ void Mac::BeginTransmit(void)
     TxFrame * frame    = nullptr;
     TxFrames &txFrames = mLinks.GetTxFrames();
     Address   dstAddr;
+#if OPENTHREAD_CONFIG_MAC_TX_PIPELINE_ENABLE
+    // A pipelined frame may only be used by the transmission which
+    // directly follows the one it was prepared along with. Otherwise
+    // it is discarded (it has no sequence number or frame counter
+    // assigned yet, so none is consumed).
+    bool pipelineFrameReady = mPipelineFrameReady;
+
+    mPipelineFrameReady = false;
+#endif
 
     txFrames.Clear();
 
@@ -1181,6 +1227,17 @@ void Mac::BeginTransmit(void)
         txFrames.SetChannel(mRadioChannel);
         txFrames.SetMaxCsmaBackoffs(kMaxCsmaBackoffsDirect);
         txFrames.SetMaxFrameRetries(mMaxFrameRetriesDirect);
+#if OPENTHREAD_CONFIG_MAC_TX_PIPELINE_ENABLE
+        if (pipelineFrameReady)
+        {
+            frame = HandlePipelinedFrameRequest(txFrames);
+
+            if (frame != nullptr)
+            {
+                break;
+            }
+        }
+#endif
         frame = Get<MeshForwarder>().HandleFrameRequest(txFrames);
         VerifyOrExit(frame != nullptr);
         frame->SetSequence(mDataSequence++);
@@ -1316,6 +1373,13 @@ void Mac::BeginTransmit(void)
     mLinks.Send();
 #endif
 
+#if OPENTHREAD_CONFIG_MAC_TX_PIPELINE_ENABLE
+    if (mOperation == kOperationTransmitDataDirect)
+    {
+        PrepareNextDirectFrame();
+    }
+#endif
+
 exit:
 
     if (frame == nullptr)
@@ -1332,6 +1396,54 @@ exit:
     }
 }
 
+#if OPENTHREAD_CONFIG_MAC_TX_PIPELINE_ENABLE
+void Mac::PrepareNextDirectFrame(void)
+{
+    mPipelineFrame.SetLength(0);
+    mPipelineFrame.SetIsARetransmission(false);
+    mPipelineFrame.SetIsSecurityProcessed(false);
+    mPipelineFrame.SetCsmaCaEnabled(true);
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MAC_CSL_TRANSMITTER_ENABLE
+    mPipelineFrame.SetTxDelay(0);
+    mPipelineFrame.SetTxDelayBaseTime(0);
+#endif
+    mPipelineFrame.SetChannel(mRadioChannel);
+
+#if OPENTHREAD_CONFIG_MAC_CSL_RECEIVER_ENABLE
+    // The CSL IE content is only known when the frame is sent.
+    VerifyOrExit(!IsCslEnabled());
+#endif
+
+    SuccessOrExit(Get<MeshForwarder>().HandleNextFrameRequest(mPipelineFrame));
+
+    // The sequence number, the frame counter and the security are
+    // only applied by `BeginTransmit()` once the frame is handed to
+    // `SubMac`, so a discarded frame consumes none of them.
+
+    mPipelineFrameReady = true;
+
+exit:
+    return;
+}
+
+TxFrame *Mac::HandlePipelinedFrameRequest(TxFrames &aTxFrames)
+{
+    TxFrame *frame = nullptr;
+
+    SuccessOrExit(Get<MeshForwarder>().HandlePipelinedFrameRequest());
+
+    frame = &aTxFrames.GetTxFrame();
+    frame->CopyFrom(mPipelineFrame);
+    frame->SetSequence(mDataSequence++);
+    frame->SetChannel(mRadioChannel);
+    frame->SetMaxCsmaBackoffs(kMaxCsmaBackoffsDirect);
+    frame->SetMaxFrameRetries(mMaxFrameRetriesDirect);
+
+exit:
+    return frame;
+}
+#endif // OPENTHREAD_CONFIG_MAC_TX_PIPELINE_ENABLE
+
 void Mac::RecordCcaStatus(bool aCcaSuccess, uint8_t aChannel)
 {
     if (!aCcaSuccess)
@@ -1728,7 +1840,10 @@ void Mac::HandleTimer(void)
     }
 }
 
-otError Mac::ProcessReceiveSecurity(RxFrame &aFrame, const Address &aSrcAddr, Neighbor *aNeighbor)
+otError Mac::ProcessReceiveSecurity(RxFrame &          aFrame,
+                                   const ParsedFrame &aParsedFrame,
+                                   const Address &    aSrcAddr,
+                                   Neighbor *         aNeighbor)
 {
     KeyManager &      keyManager = Get<KeyManager>();
     otError           error      = OT_ERROR_SECURITY;
@@ -1737,46 +1852,44 @@ otError Mac::ProcessReceiveSecurity(RxFrame &aFrame, const Address &aSrcAddr, Ne
     uint32_t          frameCounter;
     uint8_t           keyid;
     uint32_t          keySequence = 0;
-    const Key *       macKey;
+    const Key *       macKey      = nullptr;
+    Crypto::AesEcb *  keySchedule = nullptr;
     const ExtAddress *extAddress;
 
-    VerifyOrExit(aFrame.GetSecurityEnabled(), error = OT_ERROR_NONE);
+    VerifyOrExit(aParsedFrame.GetSecurityEnabled(), error = OT_ERROR_NONE);
 
-    IgnoreError(aFrame.GetSecurityLevel(securityLevel));
+    IgnoreError(aParsedFrame.GetSecurityLevel(securityLevel));
     VerifyOrExit(securityLevel == Frame::kSecEncMic32);
 
-    IgnoreError(aFrame.GetFrameCounter(frameCounter));
+    IgnoreError(aParsedFrame.GetFrameCounter(frameCounter));
     otLogDebgMac("Rx security - frame counter %u", frameCounter);
 
-    IgnoreError(aFrame.GetKeyIdMode(keyIdMode));
+    IgnoreError(aParsedFrame.GetKeyIdMode(keyIdMode));
 
     switch (keyIdMode)
     {
     case Frame::kKeyIdMode0:
-        macKey     = &keyManager.GetKek();
-        extAddress = &aSrcAddr.GetExtended();
+        keySchedule = &keyManager.GetAesKeySchedule(KeyManager::kKeyTypeKek, 0);
+        extAddress  = &aSrcAddr.GetExtended();
         break;
 
     case Frame::kKeyIdMode1:
         VerifyOrExit(aNeighbor != nullptr);
 
-        IgnoreError(aFrame.GetKeyId(keyid));
+        IgnoreError(aParsedFrame.GetKeyId(keyid));
         keyid--;
 
         if (keyid == (keyManager.GetCurrentKeySequence() & 0x7f))
         {
             keySequence = keyManager.GetCurrentKeySequence();
-            macKey      = mLinks.GetCurrentMacKey(aFrame);
         }
         else if (keyid == ((keyManager.GetCurrentKeySequence() - 1) & 0x7f))
         {
             keySequence = keyManager.GetCurrentKeySequence() - 1;
-            macKey      = mLinks.GetTemporaryMacKey(aFrame, keySequence);
         }
         else if (keyid == ((keyManager.GetCurrentKeySequence() + 1) & 0x7f))
         {
             keySequence = keyManager.GetCurrentKeySequence() + 1;
-            macKey      = mLinks.GetTemporaryMacKey(aFrame, keySequence);
         }
         else
         {
@@ -1809,7 +1922,8 @@ otError Mac::ProcessReceiveSecurity(RxFrame &aFrame, const Address &aSrcAddr, Ne
             }
         }
 
-        extAddress = &aSrcAddr.GetExtended();
+        keySchedule = &mLinks.GetMacKeySchedule(aFrame, keySequence);
+        extAddress  = &aSrcAddr.GetExtended();
 
         break;
 
@@ -1823,7 +1937,14 @@ otError Mac::ProcessReceiveSecurity(RxFrame &aFrame, const Address &aSrcAddr, Ne
         OT_UNREACHABLE_CODE(break);
     }
 
-    SuccessOrExit(aFrame.ProcessReceiveAesCcm(*extAddress, *macKey));
+    if (keySchedule != nullptr)
+    {
+        SuccessOrExit(aFrame.ProcessReceiveAesCcm(aParsedFrame, *extAddress, *keySchedule));
+    }
+    else
+    {
+        SuccessOrExit(aFrame.ProcessReceiveAesCcm(aParsedFrame, *extAddress, *macKey));
+    }
 
     if ((keyIdMode == Frame::kKeyIdMode1) && aNeighbor->IsStateValid())
     {
@@ -1867,6 +1988,7 @@ exit:
 otError Mac::ProcessEnhAckSecurity(TxFrame &aTxFrame, RxFrame &aAckFrame)
 {
     otError     error = OT_ERROR_SECURITY;
+    ParsedFrame parsedAckFrame;
     uint8_t     securityLevel;
     uint8_t     txKeyId;
     uint8_t     ackKeyId;
@@ -1876,26 +1998,27 @@ otError Mac::ProcessEnhAckSecurity(TxFrame &aTxFrame, RxFrame &aAckFrame)
     Address     dstAddr;
     Neighbor *  neighbor   = nullptr;
     KeyManager &keyManager = Get<KeyManager>();
-    const Key * macKey;
+    uint32_t    keySequence;
 
     VerifyOrExit(aAckFrame.GetSecurityEnabled(), error = OT_ERROR_NONE);
     VerifyOrExit(aAckFrame.IsVersion2015());
+    SuccessOrExit(parsedAckFrame.Parse(aAckFrame));
 
-    IgnoreError(aAckFrame.GetSecurityLevel(securityLevel));
+    IgnoreError(parsedAckFrame.GetSecurityLevel(securityLevel));
     VerifyOrExit(securityLevel == Frame::kSecEncMic32);
 
-    IgnoreError(aAckFrame.GetKeyIdMode(keyIdMode));
+    IgnoreError(parsedAckFrame.GetKeyIdMode(keyIdMode));
     VerifyOrExit(keyIdMode == Frame::kKeyIdMode1, error = OT_ERROR_NONE);
 
     IgnoreError(aTxFrame.GetKeyId(txKeyId));
-    IgnoreError(aAckFrame.GetKeyId(ackKeyId));
+    IgnoreError(parsedAckFrame.GetKeyId(ackKeyId));
 
     VerifyOrExit(txKeyId == ackKeyId);
 
-    IgnoreError(aAckFrame.GetFrameCounter(frameCounter));
+    IgnoreError(parsedAckFrame.GetFrameCounter(frameCounter));
     otLogDebgMac("Rx security - Ack frame counter %u", frameCounter);
 
-    IgnoreError(aAckFrame.GetSrcAddr(srcAddr));
+    IgnoreError(parsedAckFrame.GetSrcAddr(srcAddr));
 
     if (!srcAddr.IsNone())
     {
@@ -1923,15 +2046,15 @@ otError Mac::ProcessEnhAckSecurity(TxFrame &aTxFrame, RxFrame &aAckFrame)
 
     if (ackKeyId == (keyManager.GetCurrentKeySequence() & 0x7f))
     {
-        macKey = &mLinks.GetSubMac().GetCurrentMacKey();
+        keySequence = keyManager.GetCurrentKeySequence();
     }
     else if (ackKeyId == ((keyManager.GetCurrentKeySequence() - 1) & 0x7f))
     {
-        macKey = &mLinks.GetSubMac().GetPreviousMacKey();
+        keySequence = keyManager.GetCurrentKeySequence() - 1;
     }
     else if (ackKeyId == ((keyManager.GetCurrentKeySequence() + 1) & 0x7f))
     {
-        macKey = &mLinks.GetSubMac().GetNextMacKey();
+        keySequence = keyManager.GetCurrentKeySequence() + 1;
     }
     else
     {
@@ -1943,7 +2066,8 @@ otError Mac::ProcessEnhAckSecurity(TxFrame &aTxFrame, RxFrame &aAckFrame)
         VerifyOrExit(frameCounter >= neighbor->GetLinkAckFrameCounter());
     }
 
-    error = aAckFrame.ProcessReceiveAesCcm(srcAddr.GetExtended(), *macKey);
+    error = aAckFrame.ProcessReceiveAesCcm(parsedAckFrame, srcAddr.GetExtended(),
+                                           keyManager.GetAesKeySchedule(KeyManager::kKeyTypeMac, keySequence));
     SuccessOrExit(error);
 
     if (neighbor->IsStateValid())
@@ -1963,11 +2087,12 @@ exit:
 
 void Mac::HandleReceivedFrame(RxFrame *aFrame, otError aError)
 {
-    Address   srcaddr;
-    Address   dstaddr;
-    PanId     panid;
-    Neighbor *neighbor;
-    otError   error = aError;
+    ParsedFrame parsedFrame;
+    Address     srcaddr;
+    Address     dstaddr;
+    PanId       panid;
+    Neighbor *  neighbor;
+    otError     error = aError;
 
     mCounters.mRxTotal++;
 
@@ -1976,11 +2101,12 @@ void Mac::HandleReceivedFrame(RxFrame *aFrame, otError aError)
     VerifyOrExit(IsEnabled(), error = OT_ERROR_INVALID_STATE);
 
     // Ensure we have a valid frame before attempting to read any contents of
-    // the buffer received from the radio.
-    SuccessOrExit(error = aFrame->ValidatePsdu());
+    // the buffer received from the radio. The field offsets found while
+    // validating are kept in `parsedFrame` for the rest of the processing.
+    SuccessOrExit(error = parsedFrame.Parse(*aFrame));
 
-    IgnoreError(aFrame->GetSrcAddr(srcaddr));
-    IgnoreError(aFrame->GetDstAddr(dstaddr));
+    IgnoreError(parsedFrame.GetSrcAddr(srcaddr));
+    IgnoreError(parsedFrame.GetDstAddr(dstaddr));
     neighbor = Get<NeighborTable>().FindNeighbor(srcaddr);
 
     // Destination Address Filtering
@@ -2009,7 +2135,7 @@ void Mac::HandleReceivedFrame(RxFrame *aFrame, otError aError)
     }
 
     // Verify destination PAN ID if present
-    if (OT_ERROR_NONE == aFrame->GetDstPanId(panid))
+    if (OT_ERROR_NONE == parsedFrame.GetDstPanId(panid))
     {
         VerifyOrExit(panid == kShortAddrBroadcast || panid == mPanId, error = OT_ERROR_DESTINATION_ADDRESS_FILTERED);
     }
@@ -2066,7 +2192,7 @@ void Mac::HandleReceivedFrame(RxFrame *aFrame, otError aError)
         mCounters.mRxUnicast++;
     }
 
-    error = ProcessReceiveSecurity(*aFrame, srcaddr, neighbor);
+    error = ProcessReceiveSecurity(*aFrame, parsedFrame, srcaddr, neighbor);
 
     switch (error)
     {
@@ -2112,11 +2238,11 @@ void Mac::HandleReceivedFrame(RxFrame *aFrame, otError aError)
         neighbor->AggregateLinkMetrics(/* aSeriesId */ 0, aFrame->GetType(), aFrame->GetLqi(), aFrame->GetRssi());
 #endif
 
-        if (aFrame->GetSecurityEnabled())
+        if (parsedFrame.GetSecurityEnabled())
         {
             uint8_t keyIdMode;
 
-            IgnoreError(aFrame->GetKeyIdMode(keyIdMode));
+            IgnoreError(parsedFrame.GetKeyIdMode(keyIdMode));
 
             if (keyIdMode == Frame::kKeyIdMode1)
             {
@@ -2129,7 +2255,7 @@ void Mac::HandleReceivedFrame(RxFrame *aFrame, otError aError)
                 case Neighbor::kStateChildUpdateRequest:
 
                     // Only accept a "MAC Data Request" frame from a child being restored.
-                    VerifyOrExit(aFrame->IsDataRequestCommand(), error = OT_ERROR_DROP);
+                    VerifyOrExit(parsedFrame.IsDataRequestCommand(), error = OT_ERROR_DROP);
                     break;
 
                 default:
@@ -2223,7 +2349,7 @@ void Mac::HandleReceivedFrame(RxFrame *aFrame, otError aError)
     }
 
     otDumpDebgMac("RX", aFrame->GetHeader(), aFrame->GetLength());
-    Get<MeshForwarder>().HandleReceivedFrame(*aFrame);
+    Get<MeshForwarder>().HandleReceivedFrame(*aFrame, parsedFrame);
 
     UpdateIdleMode();
 
@@ -2568,16 +2694,31 @@ void Mac::ProcessCsl(const RxFrame &aFrame, const Address &aSrcAddr)
     const uint8_t *cur   = aFrame.GetHeaderIe(Frame::kHeaderIeCsl);
     Child *        child = Get<ChildTable>().FindChild(aSrcAddr, Child::kInStateAnyExceptInvalid);
     const CslIe *  csl;
+#if OPENTHREAD_CONFIG_MLE_CHILD_TIMEOUT_INDEX_ENABLE
+    bool wasSynchronized;
+#endif
 
     VerifyOrExit(cur != nullptr && child != nullptr && aFrame.GetSecurityEnabled());
 
     csl = reinterpret_cast<const CslIe *>(cur + sizeof(HeaderIe));
 
+#if OPENTHREAD_CONFIG_MLE_CHILD_TIMEOUT_INDEX_ENABLE
+    wasSynchronized = child->IsCslSynchronized();
+#endif
+
     child->SetCslPeriod(csl->GetPeriod());
     // Use ceiling to ensure the the time diff will be within kUsPerTenSymbols
     child->SetCslPhase(csl->GetPhase());
     child->SetCslSynchronized(true);
     child->SetCslLastHeard(TimerMilli::GetNow());
+
+#if OPENTHREAD_CONFIG_MLE_CHILD_TIMEOUT_INDEX_ENABLE
+    if (!wasSynchronized)
+    {
+        // A newly synchronized child adds a CSL timeout deadline.
+        Get<Mle::MleRouter>().ScheduleChildTimeout(*child);
+    }
+#endif
     child->SetLastRxTimestamp(aFrame.GetTimestamp());
     otLogDebgMac("Timestamp=%u Sequence=%u CslPeriod=%hu CslPhase=%hu TransmitPhase=%hu",
                  static_cast<uint32_t>(aFrame.GetTimestamp()), aFrame.GetSequence(), csl->GetPeriod(), csl->GetPhase(),
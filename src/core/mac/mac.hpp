@@ -54,6 +54,11 @@
 #include "thread/key_manager.hpp"
 #include "thread/link_quality.hpp"
 
+#if OPENTHREAD_CONFIG_MAC_TX_PIPELINE_ENABLE && \
+    (!OPENTHREAD_CONFIG_RADIO_LINK_IEEE_802_15_4_ENABLE || OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE)
+#error "OPENTHREAD_CONFIG_MAC_TX_PIPELINE_ENABLE requires IEEE 802.15.4 to be the only radio link"
+#endif
+
 namespace ot {
 
 class Neighbor;
@@ -272,7 +277,7 @@ public:
      * @param[in]  aExtAddress  A reference to the IEEE 802.15.4 Extended Address.
      *
      */
-    void SetExtAddress(const ExtAddress &aExtAddress) { mLinks.SetExtAddress(aExtAddress); }
+    void SetExtAddress(const ExtAddress &aExtAddress);
 
     /**
      * This method returns the IEEE 802.15.4 Short Address.
@@ -824,7 +829,10 @@ private:
     };
 #endif // OPENTHREAD_CONFIG_MAC_RETRY_SUCCESS_HISTOGRAM_ENABLE
 
-    otError ProcessReceiveSecurity(RxFrame &aFrame, const Address &aSrcAddr, Neighbor *aNeighbor);
+    otError ProcessReceiveSecurity(RxFrame &          aFrame,
+                                   const ParsedFrame &aParsedFrame,
+                                   const Address &    aSrcAddr,
+                                   Neighbor *         aNeighbor);
     void    ProcessTransmitSecurity(TxFrame &aFrame);
 #if OPENTHREAD_CONFIG_THREAD_VERSION >= OT_THREAD_VERSION_1_2
     otError ProcessEnhAckSecurity(TxFrame &aTxFrame, RxFrame &aAckFrame);
@@ -841,6 +849,10 @@ private:
     bool     IsJoinable(void) const;
     void     BeginTransmit(void);
     bool     HandleMacCommand(RxFrame &aFrame);
+#if OPENTHREAD_CONFIG_MAC_TX_PIPELINE_ENABLE
+    void     PrepareNextDirectFrame(void);
+    TxFrame *HandlePipelinedFrameRequest(TxFrames &aTxFrames);
+#endif
 
     static void HandleTimer(Timer &aTimer);
     void        HandleTimer(void);
@@ -899,6 +911,9 @@ private:
     bool mShouldDelaySleep : 1;
     bool mDelayingSleep : 1;
 #endif
+#if OPENTHREAD_CONFIG_MAC_TX_PIPELINE_ENABLE
+    bool mPipelineFrameReady : 1;
+#endif
 
     Operation     mOperation;
     uint8_t       mBeaconSequence;
@@ -944,6 +959,16 @@ private:
     RetryHistogram mRetryHistogram;
 #endif
 
+#if OPENTHREAD_CONFIG_MAC_TX_PIPELINE_ENABLE
+    // The next direct frame, prepared while the current one is
+    // being sent (and secured only when it is sent).
+    TxFrame mPipelineFrame;
+    uint8_t mPipelinePsdu[OT_RADIO_FRAME_MAX_SIZE];
+#if OPENTHREAD_CONFIG_TIME_SYNC_ENABLE
+    otRadioIeInfo mPipelineIeInfo;
+#endif
+#endif
+
 #if OPENTHREAD_CONFIG_MULTI_RADIO
     RadioTypes mTxPendingRadioLinks;
     otError    mTxError;
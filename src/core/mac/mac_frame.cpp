@@ -1079,6 +1079,292 @@ uint8_t Frame::GetFcsSize(void) const
 }
 #endif
 
+otError ParsedFrame::Parse(Frame &aFrame)
+{
+    // This method walks the MAC header once, applying the same checks
+    // as `Frame::ValidatePsdu()`, and records the offset of each field.
+    // We use `uint16_t` for `index` to handle its potential roll-over
+    // while parsing and verifying Header IE(s).
+
+    otError        error  = OT_ERROR_PARSE;
+    const uint8_t *psdu   = aFrame.GetPsdu();
+    uint16_t       length = aFrame.GetPsduLength();
+    uint16_t       index  = Frame::kFcfSize + Frame::kDsnSize;
+
+    mFrame        = &aFrame;
+    mFooterLength = aFrame.GetFcsSize();
+
+    VerifyOrExit(index + mFooterLength <= length);
+
+    mFcf           = aFrame.GetFrameControlField();
+    mDstPanIdIndex = Frame::kInvalidIndex;
+    mSrcPanIdIndex = Frame::kInvalidIndex;
+    mSecurityIndex = Frame::kInvalidIndex;
+
+    if (Frame::IsDstPanIdPresent(mFcf))
+    {
+        mDstPanIdIndex = static_cast<uint8_t>(index);
+        index += sizeof(PanId);
+    }
+
+    mDstAddrIndex = static_cast<uint8_t>(index);
+
+    switch (mFcf & Frame::kFcfDstAddrMask)
+    {
+    case Frame::kFcfDstAddrNone:
+        break;
+
+    case Frame::kFcfDstAddrShort:
+        index += sizeof(ShortAddress);
+        break;
+
+    case Frame::kFcfDstAddrExt:
+        index += sizeof(ExtAddress);
+        break;
+
+    default:
+        ExitNow();
+    }
+
+    if (Frame::IsSrcPanIdPresent(mFcf))
+    {
+        mSrcPanIdIndex = static_cast<uint8_t>(index);
+        index += sizeof(PanId);
+    }
+
+    mSrcAddrIndex = static_cast<uint8_t>(index);
+
+    switch (mFcf & Frame::kFcfSrcAddrMask)
+    {
+    case Frame::kFcfSrcAddrNone:
+        break;
+
+    case Frame::kFcfSrcAddrShort:
+        index += sizeof(ShortAddress);
+        break;
+
+    case Frame::kFcfSrcAddrExt:
+        index += sizeof(ExtAddress);
+        break;
+
+    default:
+        ExitNow();
+    }
+
+    if (mFcf & Frame::kFcfSecurityEnabled)
+    {
+        uint8_t headerSize;
+
+        VerifyOrExit(index < length);
+
+        headerSize = Frame::CalculateSecurityHeaderSize(psdu[index]);
+        VerifyOrExit(headerSize != Frame::kInvalidSize);
+
+        mSecurityIndex = static_cast<uint8_t>(index);
+        mFooterLength += Frame::CalculateMicSize(psdu[index]);
+
+        index += headerSize;
+        VerifyOrExit(index <= length);
+    }
+
+#if OPENTHREAD_CONFIG_MAC_HEADER_IE_SUPPORT
+    mHeaderIeIndex = Frame::kInvalidIndex;
+
+    if (mFcf & Frame::kFcfIePresent)
+    {
+        mHeaderIeIndex = static_cast<uint8_t>(index);
+
+        do
+        {
+            const HeaderIe *ie = reinterpret_cast<const HeaderIe *>(&psdu[index]);
+
+            index += sizeof(HeaderIe);
+            VerifyOrExit(index + mFooterLength <= length);
+
+            index += ie->GetLength();
+            VerifyOrExit(index + mFooterLength <= length);
+
+            if (ie->GetId() == Frame::kHeaderIeTermination2)
+            {
+                break;
+            }
+
+        } while (index + mFooterLength < length);
+    }
+#endif
+
+    if (!Frame::IsVersion2015(mFcf) && (mFcf & Frame::kFcfFrameTypeMask) == Frame::kFcfFrameMacCmd)
+    {
+        index += Frame::kCommandIdSize;
+    }
+
+    VerifyOrExit(index < Frame::kInvalidIndex);
+    VerifyOrExit(index + mFooterLength <= length);
+
+    mPayloadIndex = static_cast<uint8_t>(index);
+    error         = OT_ERROR_NONE;
+
+exit:
+    return error;
+}
+
+otError ParsedFrame::GetDstPanId(PanId &aPanId) const
+{
+    otError error = OT_ERROR_NONE;
+
+    VerifyOrExit(mDstPanIdIndex != Frame::kInvalidIndex, error = OT_ERROR_PARSE);
+    aPanId = ReadUint16(&GetPsdu()[mDstPanIdIndex]);
+
+exit:
+    return error;
+}
+
+otError ParsedFrame::GetDstAddr(Address &aAddress) const
+{
+    switch (mFcf & Frame::kFcfDstAddrMask)
+    {
+    case Frame::kFcfDstAddrShort:
+        aAddress.SetShort(ReadUint16(&GetPsdu()[mDstAddrIndex]));
+        break;
+
+    case Frame::kFcfDstAddrExt:
+        aAddress.SetExtended(&GetPsdu()[mDstAddrIndex], ExtAddress::kReverseByteOrder);
+        break;
+
+    default:
+        aAddress.SetNone();
+        break;
+    }
+
+    return OT_ERROR_NONE;
+}
+
+otError ParsedFrame::GetSrcPanId(PanId &aPanId) const
+{
+    otError error = OT_ERROR_NONE;
+
+    VerifyOrExit(mSrcPanIdIndex != Frame::kInvalidIndex, error = OT_ERROR_PARSE);
+    aPanId = ReadUint16(&GetPsdu()[mSrcPanIdIndex]);
+
+exit:
+    return error;
+}
+
+otError ParsedFrame::GetSrcAddr(Address &aAddress) const
+{
+    switch (mFcf & Frame::kFcfSrcAddrMask)
+    {
+    case Frame::kFcfSrcAddrShort:
+        aAddress.SetShort(ReadUint16(&GetPsdu()[mSrcAddrIndex]));
+        break;
+
+    case Frame::kFcfSrcAddrExt:
+        aAddress.SetExtended(&GetPsdu()[mSrcAddrIndex], ExtAddress::kReverseByteOrder);
+        break;
+
+    default:
+        aAddress.SetNone();
+        break;
+    }
+
+    return OT_ERROR_NONE;
+}
+
+otError ParsedFrame::GetSecurityLevel(uint8_t &aSecurityLevel) const
+{
+    otError error = OT_ERROR_NONE;
+
+    VerifyOrExit(GetSecurityEnabled(), error = OT_ERROR_PARSE);
+    aSecurityLevel = GetPsdu()[mSecurityIndex] & Frame::kSecLevelMask;
+
+exit:
+    return error;
+}
+
+otError ParsedFrame::GetKeyIdMode(uint8_t &aKeyIdMode) const
+{
+    otError error = OT_ERROR_NONE;
+
+    VerifyOrExit(GetSecurityEnabled(), error = OT_ERROR_PARSE);
+    aKeyIdMode = GetPsdu()[mSecurityIndex] & Frame::kKeyIdModeMask;
+
+exit:
+    return error;
+}
+
+otError ParsedFrame::GetFrameCounter(uint32_t &aFrameCounter) const
+{
+    otError error = OT_ERROR_NONE;
+
+    VerifyOrExit(GetSecurityEnabled(), error = OT_ERROR_PARSE);
+    aFrameCounter = ReadUint32(&GetPsdu()[mSecurityIndex + Frame::kSecurityControlSize]);
+
+exit:
+    return error;
+}
+
+otError ParsedFrame::GetKeyId(uint8_t &aKeyId) const
+{
+    uint8_t keySourceLength;
+
+    VerifyOrExit(GetSecurityEnabled());
+
+    keySourceLength = Frame::GetKeySourceLength(GetPsdu()[mSecurityIndex] & Frame::kKeyIdModeMask);
+    aKeyId = GetPsdu()[mSecurityIndex + Frame::kSecurityControlSize + Frame::kFrameCounterSize + keySourceLength];
+
+exit:
+    return OT_ERROR_NONE;
+}
+
+otError ParsedFrame::GetCommandId(uint8_t &aCommandId) const
+{
+    aCommandId = GetPsdu()[Frame::IsVersion2015(mFcf) ? mPayloadIndex : (mPayloadIndex - 1)];
+
+    return OT_ERROR_NONE;
+}
+
+bool ParsedFrame::IsDataRequestCommand(void) const
+{
+    bool    isDataRequest = false;
+    uint8_t commandId;
+
+    VerifyOrExit(GetType() == Frame::kFcfFrameMacCmd);
+    IgnoreError(GetCommandId(commandId));
+    isDataRequest = (commandId == Frame::kMacCmdDataRequest);
+
+exit:
+    return isDataRequest;
+}
+
+#if OPENTHREAD_CONFIG_MAC_HEADER_IE_SUPPORT
+const uint8_t *ParsedFrame::GetHeaderIe(uint8_t aIeId) const
+{
+    uint8_t        index  = mHeaderIeIndex;
+    const uint8_t *header = nullptr;
+
+    // `Parse()` verified that Header IE(s) in frame (if present)
+    // are well-formed.
+
+    VerifyOrExit(index != Frame::kInvalidIndex);
+
+    while (index <= mPayloadIndex)
+    {
+        const HeaderIe *ie = reinterpret_cast<const HeaderIe *>(&GetPsdu()[index]);
+
+        if (ie->GetId() == aIeId)
+        {
+            header = &GetPsdu()[index];
+            ExitNow();
+        }
+
+        index += sizeof(HeaderIe) + ie->GetLength();
+    }
+
+exit:
+    return header;
+}
+#endif // OPENTHREAD_CONFIG_MAC_HEADER_IE_SUPPORT
+
 void TxFrame::CopyFrom(const TxFrame &aFromFrame)
 {
     uint8_t *      psduBuffer   = mPsdu;
@@ -1123,33 +1409,71 @@ void TxFrame::ProcessTransmitAesCcm(const ExtAddress &aExtAddress)
 #if OPENTHREAD_RADIO && !OPENTHREAD_CONFIG_MAC_SOFTWARE_TX_SECURITY_ENABLE
     OT_UNUSED_VARIABLE(aExtAddress);
 #else
-    uint32_t       frameCounter = 0;
-    uint8_t        securityLevel;
-    uint8_t        nonce[Crypto::AesCcm::kNonceSize];
-    uint8_t        tagLength;
     Crypto::AesCcm aesCcm;
 
     VerifyOrExit(GetSecurityEnabled());
 
-    SuccessOrExit(GetSecurityLevel(securityLevel));
-    SuccessOrExit(GetFrameCounter(frameCounter));
+    aesCcm.SetKey(GetAesKey());
+    ProcessTransmitAesCcm(aExtAddress, aesCcm);
+
+exit:
+    return;
+#endif
+}
+
+void TxFrame::ProcessTransmitAesCcm(const ExtAddress &aExtAddress, Crypto::AesEcb &aKeySchedule)
+{
+#if OPENTHREAD_RADIO && !OPENTHREAD_CONFIG_MAC_SOFTWARE_TX_SECURITY_ENABLE
+    OT_UNUSED_VARIABLE(aExtAddress);
+    OT_UNUSED_VARIABLE(aKeySchedule);
+#else
+    Crypto::AesCcm aesCcm;
+
+    VerifyOrExit(GetSecurityEnabled());
+
+    aesCcm.SetKey(aKeySchedule);
+    ProcessTransmitAesCcm(aExtAddress, aesCcm);
+
+exit:
+    return;
+#endif
+}
+
+#if !OPENTHREAD_RADIO || OPENTHREAD_CONFIG_MAC_SOFTWARE_TX_SECURITY_ENABLE
+void TxFrame::ProcessTransmitAesCcm(const ExtAddress &aExtAddress, Crypto::AesCcm &aAesCcm)
+{
+    otError     error;
+    ParsedFrame parsedFrame;
+    uint32_t    frameCounter = 0;
+    uint8_t     securityLevel;
+    uint8_t     nonce[Crypto::AesCcm::kNonceSize];
+    uint8_t     tagLength;
+
+    VerifyOrExit(GetSecurityEnabled());
+
+    error = parsedFrame.Parse(*this);
+    OT_ASSERT(error == OT_ERROR_NONE);
+    SuccessOrExit(error);
+
+    SuccessOrExit(parsedFrame.GetSecurityLevel(securityLevel));
+    SuccessOrExit(parsedFrame.GetFrameCounter(frameCounter));
 
     Crypto::AesCcm::GenerateNonce(aExtAddress, frameCounter, securityLevel, nonce);
 
-    aesCcm.SetKey(GetAesKey());
-    tagLength = GetFooterLength() - GetFcsSize();
+    tagLength = parsedFrame.GetFooterLength() - GetFcsSize();
 
-    aesCcm.Init(GetHeaderLength(), GetPayloadLength(), tagLength, nonce, sizeof(nonce));
-    aesCcm.Header(GetHeader(), GetHeaderLength());
-    aesCcm.Payload(GetPayload(), GetPayload(), GetPayloadLength(), Crypto::AesCcm::kEncrypt);
-    aesCcm.Finalize(GetFooter());
+    aAesCcm.Init(parsedFrame.GetHeaderLength(), parsedFrame.GetPayloadLength(), tagLength, nonce, sizeof(nonce));
+    aAesCcm.Header(GetHeader(), parsedFrame.GetHeaderLength());
+    aAesCcm.Payload(parsedFrame.GetPayload(), parsedFrame.GetPayload(), parsedFrame.GetPayloadLength(),
+                    Crypto::AesCcm::kEncrypt);
+    aAesCcm.Finalize(parsedFrame.GetFooter());
 
     SetIsSecurityProcessed(true);
 
 exit:
     return;
-#endif // OPENTHREAD_RADIO && !OPENTHREAD_CONFIG_MAC_SOFTWARE_TX_SECURITY_ENABLE
 }
+#endif // !OPENTHREAD_RADIO || OPENTHREAD_CONFIG_MAC_SOFTWARE_TX_SECURITY_ENABLE
 
 void TxFrame::GenerateImmAck(const RxFrame &aFrame, bool aIsFramePending)
 {
@@ -1280,53 +1604,89 @@ exit:
 }
 #endif // OPENTHREAD_CONFIG_THREAD_VERSION >= OT_THREAD_VERSION_1_2
 
-otError RxFrame::ProcessReceiveAesCcm(const ExtAddress &aExtAddress, const Key &aMacKey)
+otError RxFrame::ProcessReceiveAesCcm(const ParsedFrame &aParsedFrame,
+                                      const ExtAddress & aExtAddress,
+                                      const Key &        aMacKey)
 {
 #if OPENTHREAD_RADIO
+    OT_UNUSED_VARIABLE(aParsedFrame);
     OT_UNUSED_VARIABLE(aExtAddress);
     OT_UNUSED_VARIABLE(aMacKey);
 
     return OT_ERROR_NONE;
 #else
-    otError        error        = OT_ERROR_SECURITY;
-    uint32_t       frameCounter = 0;
-    uint8_t        securityLevel;
-    uint8_t        nonce[Crypto::AesCcm::kNonceSize];
-    uint8_t        tag[kMaxMicSize];
-    uint8_t        tagLength;
     Crypto::AesCcm aesCcm;
 
-    VerifyOrExit(GetSecurityEnabled(), error = OT_ERROR_NONE);
+    aesCcm.SetKey(aMacKey);
+
+    return ProcessReceiveAesCcm(aParsedFrame, aExtAddress, aesCcm);
+#endif
+}
+
+otError RxFrame::ProcessReceiveAesCcm(const ParsedFrame &aParsedFrame,
+                                      const ExtAddress & aExtAddress,
+                                      Crypto::AesEcb &   aKeySchedule)
+{
+#if OPENTHREAD_RADIO
+    OT_UNUSED_VARIABLE(aParsedFrame);
+    OT_UNUSED_VARIABLE(aExtAddress);
+    OT_UNUSED_VARIABLE(aKeySchedule);
+
+    return OT_ERROR_NONE;
+#else
+    Crypto::AesCcm aesCcm;
+
+    aesCcm.SetKey(aKeySchedule);
 
-    SuccessOrExit(GetSecurityLevel(securityLevel));
-    SuccessOrExit(GetFrameCounter(frameCounter));
+    return ProcessReceiveAesCcm(aParsedFrame, aExtAddress, aesCcm);
+#endif
+}
+
+#if !OPENTHREAD_RADIO
+otError RxFrame::ProcessReceiveAesCcm(const ParsedFrame &aParsedFrame,
+                                      const ExtAddress & aExtAddress,
+                                      Crypto::AesCcm &   aAesCcm)
+{
+    otError  error        = OT_ERROR_SECURITY;
+    uint32_t frameCounter = 0;
+    uint8_t  securityLevel;
+    uint8_t  nonce[Crypto::AesCcm::kNonceSize];
+    uint8_t  tag[kMaxMicSize];
+    uint8_t  tagLength;
+    uint8_t *payload = GetPsdu() + aParsedFrame.GetHeaderLength();
+
+    OT_ASSERT(&aParsedFrame.GetFrame() == this);
+
+    VerifyOrExit(aParsedFrame.GetSecurityEnabled(), error = OT_ERROR_NONE);
+
+    SuccessOrExit(aParsedFrame.GetSecurityLevel(securityLevel));
+    SuccessOrExit(aParsedFrame.GetFrameCounter(frameCounter));
 
     Crypto::AesCcm::GenerateNonce(aExtAddress, frameCounter, securityLevel, nonce);
 
-    aesCcm.SetKey(aMacKey);
-    tagLength = GetFooterLength() - GetFcsSize();
+    tagLength = aParsedFrame.GetFooterLength() - GetFcsSize();
 
-    aesCcm.Init(GetHeaderLength(), GetPayloadLength(), tagLength, nonce, sizeof(nonce));
-    aesCcm.Header(GetHeader(), GetHeaderLength());
+    aAesCcm.Init(aParsedFrame.GetHeaderLength(), aParsedFrame.GetPayloadLength(), tagLength, nonce, sizeof(nonce));
+    aAesCcm.Header(GetHeader(), aParsedFrame.GetHeaderLength());
 #ifndef FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION
-    aesCcm.Payload(GetPayload(), GetPayload(), GetPayloadLength(), Crypto::AesCcm::kDecrypt);
+    aAesCcm.Payload(payload, payload, aParsedFrame.GetPayloadLength(), Crypto::AesCcm::kDecrypt);
 #else
     // For fuzz tests, execute AES but do not alter the payload
     uint8_t fuzz[OT_RADIO_FRAME_MAX_SIZE];
-    aesCcm.Payload(fuzz, GetPayload(), GetPayloadLength(), Crypto::AesCcm::kDecrypt);
+    aAesCcm.Payload(fuzz, payload, aParsedFrame.GetPayloadLength(), Crypto::AesCcm::kDecrypt);
 #endif
-    aesCcm.Finalize(tag);
+    aAesCcm.Finalize(tag);
 
 #ifndef FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION
-    VerifyOrExit(memcmp(tag, GetFooter(), tagLength) == 0);
+    VerifyOrExit(memcmp(tag, aParsedFrame.GetFooter(), tagLength) == 0);
 #endif
 
     error = OT_ERROR_NONE;
 
 exit:
     return error;
-#endif // OPENTHREAD_RADIO
 }
+#endif // !OPENTHREAD_RADIO
 
 // LCOV_EXCL_START
 
@@ -43,6 +43,12 @@
 #include "mac/mac_types.hpp"
 
 namespace ot {
+
+namespace Crypto {
+class AesCcm;
+class AesEcb;
+} // namespace Crypto
+
 namespace Mac {
 
 using ot::Encoding::LittleEndian::HostSwap16;
@@ -278,6 +284,8 @@ public:
 class Frame : public otRadioFrame
 {
 public:
+    friend class ParsedFrame;
+
     enum
     {
         kFcfSize             = sizeof(uint16_t),
@@ -1106,6 +1114,262 @@ protected:
     static uint8_t CalculateMicSize(uint8_t aSecurityControl);
 };
 
+/**
+ * This class represents the positions of the header fields of an IEEE 802.15.4 MAC frame.
+ *
+ * The `Frame` accessors locate a field by parsing the Frame Control, Addressing, Auxiliary Security Header and Header
+ * IE fields on every call. A `ParsedFrame` walks the MAC header once in `Parse()` and records the field offsets, so its
+ * accessors read a field directly. It remains valid only while the MAC header and length of the parsed frame are not
+ * changed (its payload may be modified, e.g., decrypted in place).
+ *
+ */
+class ParsedFrame
+{
+public:
+    /**
+     * This method parses the MAC header of a given frame and validates it.
+     *
+     * The checks are the same as `Frame::ValidatePsdu()`.
+     *
+     * @param[in]  aFrame  The frame to parse.
+     *
+     * @retval OT_ERROR_NONE    Successfully parsed the MAC header.
+     * @retval OT_ERROR_PARSE   Failed to parse through the MAC header.
+     *
+     */
+    otError Parse(Frame &aFrame);
+
+    /**
+     * This method returns the parsed frame.
+     *
+     * @returns A reference to the parsed frame.
+     *
+     */
+    Frame &GetFrame(void) { return *mFrame; }
+
+    /**
+     * This method returns the parsed frame.
+     *
+     * @returns A reference to the parsed frame.
+     *
+     */
+    const Frame &GetFrame(void) const { return *mFrame; }
+
+    /**
+     * This method returns the Frame Control field of the frame.
+     *
+     * @returns The Frame Control field.
+     *
+     */
+    uint16_t GetFrameControlField(void) const { return mFcf; }
+
+    /**
+     * This method returns the IEEE 802.15.4 Frame Type.
+     *
+     * @returns The IEEE 802.15.4 Frame Type.
+     *
+     */
+    uint8_t GetType(void) const { return mFcf & Frame::kFcfFrameTypeMask; }
+
+    /**
+     * This method indicates whether or not security is enabled.
+     *
+     * @retval TRUE   If security is enabled.
+     * @retval FALSE  If security is not enabled.
+     *
+     */
+    bool GetSecurityEnabled(void) const { return mSecurityIndex != Frame::kInvalidIndex; }
+
+    /**
+     * This method gets the Destination PAN Identifier.
+     *
+     * @param[out]  aPanId  The Destination PAN Identifier.
+     *
+     * @retval OT_ERROR_NONE   Successfully retrieved the Destination PAN Identifier.
+     * @retval OT_ERROR_PARSE  The frame does not include a Destination PAN Identifier.
+     *
+     */
+    otError GetDstPanId(PanId &aPanId) const;
+
+    /**
+     * This method gets the Destination Address.
+     *
+     * @param[out]  aAddress  The Destination Address.
+     *
+     * @retval OT_ERROR_NONE  Successfully retrieved the Destination Address.
+     *
+     */
+    otError GetDstAddr(Address &aAddress) const;
+
+    /**
+     * This method gets the Source PAN Identifier.
+     *
+     * @param[out]  aPanId  The Source PAN Identifier.
+     *
+     * @retval OT_ERROR_NONE   Successfully retrieved the Source PAN Identifier.
+     * @retval OT_ERROR_PARSE  The frame does not include a Source PAN Identifier.
+     *
+     */
+    otError GetSrcPanId(PanId &aPanId) const;
+
+    /**
+     * This method gets the Source Address.
+     *
+     * @param[out]  aAddress  The Source Address.
+     *
+     * @retval OT_ERROR_NONE  Successfully retrieved the Source Address.
+     *
+     */
+    otError GetSrcAddr(Address &aAddress) const;
+
+    /**
+     * This method gets the Security Level Identifier.
+     *
+     * @param[out]  aSecurityLevel  The Security Level Identifier.
+     *
+     * @retval OT_ERROR_NONE   Successfully retrieved the Security Level Identifier.
+     * @retval OT_ERROR_PARSE  Security is not enabled.
+     *
+     */
+    otError GetSecurityLevel(uint8_t &aSecurityLevel) const;
+
+    /**
+     * This method gets the Key Identifier Mode.
+     *
+     * @param[out]  aKeyIdMode  The Key Identifier Mode.
+     *
+     * @retval OT_ERROR_NONE   Successfully retrieved the Key Identifier Mode.
+     * @retval OT_ERROR_PARSE  Security is not enabled.
+     *
+     */
+    otError GetKeyIdMode(uint8_t &aKeyIdMode) const;
+
+    /**
+     * This method gets the Frame Counter.
+     *
+     * @param[out]  aFrameCounter  The Frame Counter.
+     *
+     * @retval OT_ERROR_NONE   Successfully retrieved the Frame Counter.
+     * @retval OT_ERROR_PARSE  Security is not enabled.
+     *
+     */
+    otError GetFrameCounter(uint32_t &aFrameCounter) const;
+
+    /**
+     * This method gets the Key Identifier.
+     *
+     * As with `Frame::GetKeyId()`, @p aKeyId is left unchanged when security is not enabled.
+     *
+     * @param[out]  aKeyId  The Key Identifier.
+     *
+     * @retval OT_ERROR_NONE  Successfully retrieved the Key Identifier.
+     *
+     */
+    otError GetKeyId(uint8_t &aKeyId) const;
+
+    /**
+     * This method gets the Command ID.
+     *
+     * @param[out]  aCommandId  The Command ID.
+     *
+     * @retval OT_ERROR_NONE  Successfully retrieved the Command ID.
+     *
+     */
+    otError GetCommandId(uint8_t &aCommandId) const;
+
+    /**
+     * This method indicates whether the frame is a MAC Data Request command (data poll).
+     *
+     * @returns TRUE if frame is a MAC Data Request command, FALSE otherwise.
+     *
+     */
+    bool IsDataRequestCommand(void) const;
+
+    /**
+     * This method returns the MAC header size.
+     *
+     * @returns The MAC header size.
+     *
+     */
+    uint8_t GetHeaderLength(void) const { return mPayloadIndex; }
+
+    /**
+     * This method returns the MAC footer size.
+     *
+     * @returns The MAC footer size.
+     *
+     */
+    uint8_t GetFooterLength(void) const { return mFooterLength; }
+
+    /**
+     * This method returns the MAC Payload length.
+     *
+     * @returns The MAC Payload length.
+     *
+     */
+    uint16_t GetPayloadLength(void) const { return mFrame->GetPsduLength() - (mPayloadIndex + mFooterLength); }
+
+    /**
+     * This method returns a pointer to the MAC Payload.
+     *
+     * @returns A pointer to the MAC Payload.
+     *
+     */
+    uint8_t *GetPayload(void) { return mFrame->GetPsdu() + mPayloadIndex; }
+
+    /**
+     * This method returns a pointer to the MAC Payload.
+     *
+     * @returns A pointer to the MAC Payload.
+     *
+     */
+    const uint8_t *GetPayload(void) const { return mFrame->GetPsdu() + mPayloadIndex; }
+
+    /**
+     * This method returns a pointer to the MAC Footer.
+     *
+     * @returns A pointer to the MAC Footer.
+     *
+     */
+    uint8_t *GetFooter(void) { return mFrame->GetPsdu() + mFrame->GetPsduLength() - mFooterLength; }
+
+    /**
+     * This method returns a pointer to the MAC Footer.
+     *
+     * @returns A pointer to the MAC Footer.
+     *
+     */
+    const uint8_t *GetFooter(void) const { return mFrame->GetPsdu() + mFrame->GetPsduLength() - mFooterLength; }
+
+#if OPENTHREAD_CONFIG_MAC_HEADER_IE_SUPPORT
+    /**
+     * This method returns a pointer to a specific Header IE.
+     *
+     * @param[in]  aIeId  The Element Id of the Header IE.
+     *
+     * @returns A pointer to the Header IE, or nullptr if not found.
+     *
+     */
+    const uint8_t *GetHeaderIe(uint8_t aIeId) const;
+#endif
+
+private:
+    const uint8_t *GetPsdu(void) const { return mFrame->GetPsdu(); }
+
+    Frame *  mFrame;
+    uint16_t mFcf;
+    uint8_t  mDstPanIdIndex;
+    uint8_t  mDstAddrIndex;
+    uint8_t  mSrcPanIdIndex;
+    uint8_t  mSrcAddrIndex;
+    uint8_t  mSecurityIndex;
+#if OPENTHREAD_CONFIG_MAC_HEADER_IE_SUPPORT
+    uint8_t mHeaderIeIndex;
+#endif
+    uint8_t mPayloadIndex;
+    uint8_t mFooterLength;
+};
+
 /**
  * This class supports received IEEE 802.15.4 MAC frame processing.
  *
@@ -1167,15 +1431,32 @@ public:
     /**
      * This method performs AES CCM on the frame which is received.
      *
-     * @param[in]  aExtAddress  A reference to the extended address, which will be used to generate nonce
-     *                          for AES CCM computation.
-     * @param[in]  aMacKey      A reference to the MAC key to decrypt the received frame.
+     * @param[in]  aParsedFrame  The parsed MAC header of this frame.
+     * @param[in]  aExtAddress   A reference to the extended address, which will be used to generate nonce
+     *                           for AES CCM computation.
+     * @param[in]  aMacKey       A reference to the MAC key to decrypt the received frame.
+     *
+     * @retval OT_ERROR_NONE      Process of received frame AES CCM succeeded.
+     * @retval OT_ERROR_SECURITY  Received frame MIC check failed.
+     *
+     */
+    otError ProcessReceiveAesCcm(const ParsedFrame &aParsedFrame, const ExtAddress &aExtAddress, const Key &aMacKey);
+
+    /**
+     * This method performs AES CCM on the frame which is received, using an expanded AES key schedule.
+     *
+     * @param[in]  aParsedFrame   The parsed MAC header of this frame.
+     * @param[in]  aExtAddress    A reference to the extended address, which will be used to generate nonce
+     *                            for AES CCM computation.
+     * @param[in]  aKeySchedule   A reference to the expanded AES key schedule of the MAC key.
      *
      * @retval OT_ERROR_NONE      Process of received frame AES CCM succeeded.
      * @retval OT_ERROR_SECURITY  Received frame MIC check failed.
      *
      */
-    otError ProcessReceiveAesCcm(const ExtAddress &aExtAddress, const Key &aMacKey);
+    otError ProcessReceiveAesCcm(const ParsedFrame &aParsedFrame,
+                                 const ExtAddress & aExtAddress,
+                                 Crypto::AesEcb &   aKeySchedule);
 
 #if OPENTHREAD_CONFIG_TIME_SYNC_ENABLE
     /**
@@ -1197,6 +1478,11 @@ public:
      */
     uint8_t ReadTimeSyncSeq(void) const { return GetTimeIe()->GetSequence(); }
 #endif // OPENTHREAD_CONFIG_TIME_SYNC_ENABLE
+
+private:
+    otError ProcessReceiveAesCcm(const ParsedFrame &aParsedFrame,
+                                 const ExtAddress & aExtAddress,
+                                 Crypto::AesCcm &   aAesCcm);
 };
 
 /**
@@ -1320,6 +1606,17 @@ public:
      */
     void ProcessTransmitAesCcm(const ExtAddress &aExtAddress);
 
+    /**
+     * This method performs AES CCM on the frame which is going to be sent, using an expanded AES key schedule instead
+     * of the frame's AES key.
+     *
+     * @param[in]  aExtAddress   A reference to the extended address, which will be used to generate nonce
+     *                           for AES CCM computation.
+     * @param[in]  aKeySchedule  A reference to the expanded AES key schedule of the frame's AES key.
+     *
+     */
+    void ProcessTransmitAesCcm(const ExtAddress &aExtAddress, Crypto::AesEcb &aKeySchedule);
+
     /**
      * This method indicates whether or not the frame has security processed.
      *
@@ -1417,6 +1714,9 @@ public:
      */
     void SetTxDelayBaseTime(uint32_t aTxDelayBaseTime) { mInfo.mTxInfo.mTxDelayBaseTime = aTxDelayBaseTime; }
 #endif
+
+private:
+    void ProcessTransmitAesCcm(const ExtAddress &aExtAddress, Crypto::AesCcm &aAesCcm);
 };
 
 OT_TOOL_PACKED_BEGIN
@@ -208,49 +208,25 @@ exit:
     return key;
 }
 
-const Key *Links::GetTemporaryMacKey(const Frame &aFrame, uint32_t aKeySequence) const
+Crypto::AesEcb &Links::GetMacKeySchedule(const Frame &aFrame, uint32_t aKeySequence) const
 {
-    // Gets the security MAC key (for Key Mode 1) based on radio link
-    // type of `aFrame` and given Key Sequence.
+    // Gets the expanded AES key schedule of the security MAC key (for Key Mode 1) based on radio link type of
+    // `aFrame` and given Key Sequence.
 
-    const Key *key = nullptr;
-#if OPENTHREAD_CONFIG_MULTI_RADIO
-    RadioType radioType = aFrame.GetRadioType();
-#endif
-
-#if OPENTHREAD_CONFIG_RADIO_LINK_IEEE_802_15_4_ENABLE
-#if OPENTHREAD_CONFIG_MULTI_RADIO
-    if (radioType == kRadioTypeIeee802154)
-#endif
-    {
-        if (aKeySequence == Get<KeyManager>().GetCurrentKeySequence() - 1)
-        {
-            ExitNow(key = &Get<SubMac>().GetPreviousMacKey());
-        }
-        else if (aKeySequence == Get<KeyManager>().GetCurrentKeySequence() + 1)
-        {
-            ExitNow(key = &Get<SubMac>().GetNextMacKey());
-        }
-        else
-        {
-            OT_ASSERT(false);
-        }
-    }
-#endif
+    KeyManager::KeyType keyType = KeyManager::kKeyTypeMac;
 
 #if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
 #if OPENTHREAD_CONFIG_MULTI_RADIO
-    if (radioType == kRadioTypeTrel)
+    if (aFrame.GetRadioType() == kRadioTypeTrel)
 #endif
     {
-        ExitNow(key = &Get<KeyManager>().GetTemporaryTrelMacKey(aKeySequence));
+        keyType = KeyManager::kKeyTypeTrel;
     }
 #endif
 
     OT_UNUSED_VARIABLE(aFrame);
 
-exit:
-    return key;
+    return Get<KeyManager>().GetAesKeySchedule(keyType, aKeySequence);
 }
 
 #if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
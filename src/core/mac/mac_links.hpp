@@ -38,6 +38,7 @@
 
 #include "common/debug.hpp"
 #include "common/locator.hpp"
+#include "crypto/aes_ecb.hpp"
 #include "mac/mac_frame.hpp"
 #include "mac/mac_types.hpp"
 #include "mac/sub_mac.hpp"
@@ -637,16 +638,16 @@ public:
     const Key *GetCurrentMacKey(const Frame &aFrame) const;
 
     /**
-     * This method returns a reference to the temporary MAC key (for Key Mode 1) for a given Frame based on a given
-     * Key Sequence.
+     * This method returns the expanded AES key schedule of the MAC key (for Key Mode 1) for a given Frame based on a
+     * given Key Sequence.
      *
-     * @param[in] aFrame        The frame for which to get the MAC key.
-     * @param[in] aKeySequence  The Key Sequence number (MUST be one off (+1 or -1) from current key sequence number).
+     * @param[in] aFrame        The frame for which to get the MAC key schedule.
+     * @param[in] aKeySequence  The Key Sequence number.
      *
-     * @returns A reference to the temporary MAC key.
+     * @returns A reference to the expanded AES key schedule (see `KeyManager::GetAesKeySchedule()`).
      *
      */
-    const Key *GetTemporaryMacKey(const Frame &aFrame, uint32_t aKeySequence) const;
+    Crypto::AesEcb &GetMacKeySchedule(const Frame &aFrame, uint32_t aKeySequence) const;
 
 #if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
     /**
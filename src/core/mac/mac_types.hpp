@@ -398,6 +398,30 @@ public:
      */
     bool IsShortAddrInvalid(void) const { return ((mType == kTypeShort) && (GetShort() == kShortAddrInvalid)); }
 
+    /**
+     * This method overloads operator `==` to evaluate whether or not two addresses are equal.
+     *
+     * Two addresses are equal when they have the same type and the same Short or Extended Address value.
+     *
+     * @param[in]  aOther  The other address to compare with.
+     *
+     * @retval TRUE   If the two addresses are equal.
+     * @retval FALSE  If the two addresses are not equal.
+     *
+     */
+    bool operator==(const Address &aOther) const;
+
+    /**
+     * This method overloads operator `!=` to evaluate whether or not two addresses are not equal.
+     *
+     * @param[in]  aOther  The other address to compare with.
+     *
+     * @retval TRUE   If the two addresses are not equal.
+     * @retval FALSE  If the two addresses are equal.
+     *
+     */
+    bool operator!=(const Address &aOther) const { return !(*this == aOther); }
+
     /**
      * This method converts an address to a null-terminated string
      *
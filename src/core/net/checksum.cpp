@@ -33,7 +33,10 @@
 
 #include "checksum.hpp"
 
+#include <string.h>
+
 #include "common/code_utils.hpp"
+#include "common/encoding.hpp"
 #include "common/message.hpp"
 #include "net/icmp6.hpp"
 #include "net/udp6.hpp"
@@ -68,10 +71,68 @@ void Checksum::AddUint16(uint16_t aUint16)
 
 void Checksum::AddData(const uint8_t *aBuffer, uint16_t aLength)
 {
-    for (uint16_t i = 0; i < aLength; i++)
+    // The one's complement sum is independent of byte order (RFC 1071
+    // section 2(B)), so the data is summed as native 32-bit words into a
+    // 64-bit accumulator and the carries are folded back only once at
+    // the end. The 16-bit result is then swapped to network byte order.
+
+    uint64_t sum = 0;
+    uint16_t value;
+
+    if (aLength == 0)
+    {
+        ExitNow();
+    }
+
+    if (mAtOddIndex)
+    {
+        // Align to an even index so that the wide words below line up
+        // with 16-bit boundaries of the checksummed data.
+
+        AddUint8(*aBuffer++);
+        aLength--;
+    }
+
+    for (; aLength >= sizeof(uint32_t); aLength -= sizeof(uint32_t), aBuffer += sizeof(uint32_t))
+    {
+        uint32_t word;
+
+        memcpy(&word, aBuffer, sizeof(word));
+        sum += word;
+    }
+
+    if (aLength >= sizeof(uint16_t))
     {
-        AddUint8(aBuffer[i]);
+        uint16_t halfWord;
+
+        memcpy(&halfWord, aBuffer, sizeof(halfWord));
+        sum += halfWord;
+        aBuffer += sizeof(uint16_t);
+        aLength -= sizeof(uint16_t);
+    }
+
+    while ((sum >> 16) != 0)
+    {
+        sum = (sum & 0xffff) + (sum >> 16);
+    }
+
+    value = Encoding::BigEndian::HostSwap16(static_cast<uint16_t>(sum));
+    value += mValue;
+
+    if (value < mValue)
+    {
+        value++;
     }
+
+    mValue = value;
+
+    if (aLength > 0)
+    {
+        AddUint8(*aBuffer);
+    }
+
+exit:
+    return;
 }
 
 void Checksum::WriteToMessage(uint16_t aOffset, Message &aMessage) const
@@ -157,7 +157,7 @@ otError Client::Response::FindHostAddress(Section       aSection,
     SelectSection(aSection, offset, numRecords);
     SuccessOrExit(error = ResourceRecord::FindRecord(*mMessage, offset, numRecords, aIndex, name, aaaaRecord));
     aAddress = aaaaRecord.GetAddress();
-    aTtl     = aaaaRecord.GetTtl();
+    aTtl     = GetRemainingTtl(aaaaRecord.GetTtl());
 
 exit:
     return error;
@@ -188,7 +188,7 @@ otError Client::Response::FindServiceInfo(Section aSection, const Name &aName, S
     SelectSection(aSection, offset, numRecords);
     SuccessOrExit(error = ResourceRecord::FindRecord(*mMessage, offset, numRecords, /* aIndex */ 0, aName, srvRecord));
 
-    aServiceInfo.mTtl      = srvRecord.GetTtl();
+    aServiceInfo.mTtl      = GetRemainingTtl(srvRecord.GetTtl());
     aServiceInfo.mPort     = srvRecord.GetPort();
     aServiceInfo.mPriority = srvRecord.GetPriority();
     aServiceInfo.mWeight   = srvRecord.GetWeight();
@@ -234,7 +234,7 @@ otError Client::Response::FindServiceInfo(Section aSection, const Name &aName, S
     case OT_ERROR_NONE:
         SuccessOrExit(error =
                           txtRecord.ReadTxtData(*mMessage, offset, aServiceInfo.mTxtData, aServiceInfo.mTxtDataSize));
-        aServiceInfo.mTxtDataTtl = txtRecord.GetTtl();
+        aServiceInfo.mTxtDataTtl = GetRemainingTtl(txtRecord.GetTtl());
         break;
 
     case OT_ERROR_NOT_FOUND:
@@ -437,12 +437,20 @@ Client::Client(Instance &aInstance)
     , mSocket(aInstance)
     , mTimer(aInstance, Client::HandleTimer)
     , mDefaultConfig(QueryConfig::kInitFromDefaults)
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    , mAnswerEntry(nullptr)
+    , mCacheBytes(0)
+#endif
 {
     static_assert(kAddressQuery == 0, "kAddressQuery value is not correct");
 #if OPENTHREAD_CONFIG_DNS_CLIENT_SERVICE_DISCOVERY_ENABLE
     static_assert(kBrowseQuery == 1, "kBrowseQuery value is not correct");
     static_assert(kServiceQuery == 2, "kServiceQuery value is not correct");
 #endif
+
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    ResetCacheCounters();
+#endif
 }
 
 otError Client::Start(void)
@@ -465,6 +473,10 @@ void Client::Stop(void)
         FinalizeQuery(*query, OT_ERROR_ABORT);
     }
 
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    ClearCache();
+#endif
+
     IgnoreError(mSocket.Close());
 }
 
@@ -564,6 +576,45 @@ otError Client::StartQuery(QueryInfo &        aInfo,
     SuccessOrExit(error = AllocateQuery(aInfo, aLabel, aName, query));
     mQueries.Enqueue(*query);
 
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    {
+        Query *identicalQuery;
+
+        if (FindCacheEntry(*query, aInfo) != nullptr)
+        {
+            // The callback is invoked from the timer, as it would for
+            // a response from the server, and not from within this call.
+
+            mCacheCounters.mHits++;
+            aInfo.mSource             = kSourceCache;
+            aInfo.mRetransmissionTime = TimerMilli::GetNow();
+            UpdateQuery(*query, aInfo);
+            mTimer.FireAtIfEarlier(aInfo.mRetransmissionTime);
+            ExitNow();
+        }
+
+        identicalQuery = FindIdenticalQuery(*query, aInfo);
+
+        if (identicalQuery != nullptr)
+        {
+            QueryInfo identicalInfo;
+
+            // Share the message ID so that the response to the
+            // identical query also finalizes this one.
+
+            identicalInfo.ReadFrom(*identicalQuery);
+
+            mCacheCounters.mCoalesced++;
+            aInfo.mSource    = kSourceOtherQuery;
+            aInfo.mMessageId = identicalInfo.mMessageId;
+            UpdateQuery(*query, aInfo);
+            ExitNow();
+        }
+
+        mCacheCounters.mMisses++;
+    }
+#endif
+
     SendQuery(*query);
 
 exit:
@@ -591,12 +642,6 @@ exit:
     return error;
 }
 
-void Client::FreeQuery(Query &aQuery)
-{
-    mQueries.Dequeue(aQuery);
-    aQuery.Free();
-}
-
 void Client::SendQuery(Query &aQuery)
 {
     QueryInfo info;
@@ -716,6 +761,12 @@ void Client::FinalizeQuery(Response &aResponse, QueryType aType, otError aError)
 
     GetCallback(*aResponse.mQuery, callback, context);
 
+    // Take the query out of the list before the callback runs, so
+    // that the callback can stop the client without finalizing the
+    // query again.
+
+    mQueries.Dequeue(*aResponse.mQuery);
+
     switch (aType)
     {
     case kAddressQuery:
@@ -742,7 +793,25 @@ void Client::FinalizeQuery(Response &aResponse, QueryType aType, otError aError)
 #endif
     }
 
-    FreeQuery(*aResponse.mQuery);
+    aResponse.mQuery->Free();
+}
+
+void Client::FinalizeQueries(Response &aResponse, QueryType aType, otError aError)
+{
+    // This method finalizes the query in `aResponse` along with any
+    // other query waiting for the response to it (sharing its
+    // message ID).
+
+    QueryInfo info;
+
+    info.ReadFrom(*aResponse.mQuery);
+
+    FinalizeQuery(aResponse, aType, aError);
+
+    while ((aResponse.mQuery = FindQueryById(info.mMessageId)) != nullptr)
+    {
+        FinalizeQuery(aResponse, aType, aError);
+    }
 }
 
 void Client::GetCallback(const Query &aQuery, Callback &aCallback, void *&aContext)
@@ -764,7 +833,7 @@ Client::Query *Client::FindQueryById(uint16_t aMessageId)
     {
         info.ReadFrom(*query);
 
-        if (info.mMessageId == aMessageId)
+        if ((info.mMessageId == aMessageId) && (info.mSource != kSourceCache))
         {
             break;
         }
@@ -789,7 +858,12 @@ void Client::ProcessResponse(const Message &aMessage)
     response.mMessage = &aMessage;
 
     SuccessOrExit(ParseResponse(response, type, responseError));
-    FinalizeQuery(response, type, responseError);
+
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    AddCacheEntry(response, type, responseError);
+#endif
+
+    FinalizeQueries(response, type, responseError);
 
 exit:
     return;
@@ -869,11 +943,33 @@ void Client::HandleTimer(void)
 
         info.ReadFrom(*query);
 
+        if (info.mSource == kSourceOtherQuery)
+        {
+            continue;
+        }
+
         if (now >= info.mRetransmissionTime)
         {
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+            if (info.mSource == kSourceCache)
+            {
+                AnswerFromCache(*query, info);
+
+                // The callbacks may have changed the query list, start over.
+                nextQuery = mQueries.GetHead();
+                continue;
+            }
+#endif
+
             if (info.mTransmissionCount >= info.mConfig.GetMaxTxAttempts())
             {
-                FinalizeQuery(*query, OT_ERROR_RESPONSE_TIMEOUT);
+                Response response;
+
+                response.mQuery = query;
+                FinalizeQueries(response, info.mQueryType, OT_ERROR_RESPONSE_TIMEOUT);
+
+                // The callbacks may have changed the query list, start over.
+                nextQuery = mQueries.GetHead();
                 continue;
             }
 
@@ -892,6 +988,290 @@ void Client::HandleTimer(void)
     }
 }
 
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+
+void Client::ClearCache(void)
+{
+    CacheEntry *entry;
+
+    while ((entry = mCache.GetHead()) != nullptr)
+    {
+        RemoveCacheEntry(*entry);
+    }
+
+    // An entry answering a query is freed once the callback returns.
+    mAnswerEntry = nullptr;
+}
+
+otError Client::EvictCacheEntry(void)
+{
+    otError     error = OT_ERROR_NONE;
+    CacheEntry *entry = mCache.GetHead();
+
+    VerifyOrExit(entry != nullptr, error = OT_ERROR_NOT_FOUND);
+
+    mCacheCounters.mEvictions++;
+    RemoveCacheEntry(*entry);
+
+exit:
+    return error;
+}
+
+Client::Query *Client::FindIdenticalQuery(const Query &aQuery, const QueryInfo &aInfo)
+{
+    // This method searches for a query sent to the server for the
+    // same name and type as `aQuery`, and with the same config
+    // (server, response timeout, max attempts and recursion flag).
+
+    Query *   query;
+    QueryInfo info;
+
+    for (query = mQueries.GetHead(); query != nullptr; query = query->GetNext())
+    {
+        uint16_t offset = kNameOffsetInQuery;
+
+        if (query == &aQuery)
+        {
+            continue;
+        }
+
+        info.ReadFrom(*query);
+
+        if ((info.mSource == kSourceServer) && (info.mQueryType == aInfo.mQueryType) &&
+            (info.mConfig.GetServerSockAddr() == aInfo.mConfig.GetServerSockAddr()) &&
+            (info.mConfig.GetResponseTimeout() == aInfo.mConfig.GetResponseTimeout()) &&
+            (info.mConfig.GetMaxTxAttempts() == aInfo.mConfig.GetMaxTxAttempts()) &&
+            (info.mConfig.GetRecursionFlag() == aInfo.mConfig.GetRecursionFlag()) &&
+            (Name::CompareName(*query, offset, aQuery, kNameOffsetInQuery) == OT_ERROR_NONE))
+        {
+            break;
+        }
+    }
+
+    return query;
+}
+
+Client::CacheEntry *Client::FindCacheEntry(const Query &aQuery, const QueryInfo &aInfo)
+{
+    // This method searches for an unexpired cached response matching
+    // the name, type and server of `aQuery`. Expired entries are
+    // removed along the way.
+
+    TimeMilli   now = TimerMilli::GetNow();
+    CacheEntry *entry;
+    CacheEntry *nextEntry;
+    CacheInfo   info;
+
+    for (entry = mCache.GetHead(); entry != nullptr; entry = nextEntry)
+    {
+        uint16_t offset = kNameOffsetInCacheEntry;
+
+        nextEntry = entry->GetNext();
+
+        info.ReadFrom(*entry);
+
+        if (now >= info.mExpireTime)
+        {
+            RemoveCacheEntry(*entry);
+            continue;
+        }
+
+        if ((info.mQueryType == aInfo.mQueryType) && (info.mServerSockAddr == aInfo.mConfig.GetServerSockAddr()) &&
+            (Name::CompareName(*entry, offset, aQuery, kNameOffsetInQuery) == OT_ERROR_NONE))
+        {
+            break;
+        }
+    }
+
+    return entry;
+}
+
+void Client::AnswerFromCache(Query &aQuery, QueryInfo &aInfo)
+{
+    CacheEntry *entry = FindCacheEntry(aQuery, aInfo);
+    Response    response;
+    CacheInfo   cacheInfo;
+
+    if (entry == nullptr)
+    {
+        // The response expired since the query was started, so send
+        // the query to the server instead.
+
+        aInfo.mSource = kSourceServer;
+        SendQuery(aQuery, aInfo, /* aUpdateTimer */ true);
+        ExitNow();
+    }
+
+    cacheInfo.ReadFrom(*entry);
+
+    // Take the entry out of the cache while the callback runs, so
+    // that it is not evicted (to reclaim message buffers) or freed
+    // while `response` refers to it. It is then added back at the
+    // tail, the cache is kept in least recently used order, unless
+    // the callback cleared the cache (e.g. by stopping the client).
+
+    mCache.Dequeue(*entry);
+    mCacheBytes -= entry->GetLength();
+    mAnswerEntry = entry;
+
+    response.mQuery                 = &aQuery;
+    response.mMessage               = entry;
+    response.mAnswerOffset          = cacheInfo.mAnswerOffset;
+    response.mAnswerRecordCount     = cacheInfo.mAnswerRecordCount;
+    response.mAdditionalOffset      = cacheInfo.mAdditionalOffset;
+    response.mAdditionalRecordCount = cacheInfo.mAdditionalRecordCount;
+    response.mTtlAge                = Time::MsecToSec(TimerMilli::GetNow() - cacheInfo.mCacheTime);
+
+    FinalizeQuery(response, aInfo.mQueryType, cacheInfo.mResponseError);
+
+    if (mAnswerEntry == nullptr)
+    {
+        entry->Free();
+        ExitNow();
+    }
+
+    mAnswerEntry = nullptr;
+    mCache.Enqueue(*entry);
+    mCacheBytes += entry->GetLength();
+
+exit:
+    return;
+}
+
+void Client::AddCacheEntry(const Response &aResponse, QueryType aType, otError aResponseError)
+{
+    // This method caches the response (as parsed by `ParseResponse()`)
+    // for the query in `aResponse`. Successful and "name error"
+    // responses are cached for the smallest TTL of their records. A
+    // negative response (name error or no answer record) is cached
+    // for at most `kCacheNegativeTtl`.
+
+    const Message &message    = *aResponse.mMessage;
+    CacheEntry *   entry      = nullptr;
+    otError        error      = OT_ERROR_NONE;
+    uint16_t       nameLength = aResponse.mQuery->GetLength() - kNameOffsetInQuery;
+    uint16_t       dataLength = message.GetLength() - message.GetOffset();
+    uint16_t       dataOffset = kNameOffsetInCacheEntry + nameLength;
+    uint32_t       ttl        = kCacheMaxTtl;
+    Header         header;
+    QueryInfo      queryInfo;
+    CacheInfo      info;
+
+    VerifyOrExit((aResponseError == OT_ERROR_NONE) || (aResponseError == OT_ERROR_NOT_FOUND));
+    VerifyOrExit(dataOffset + dataLength <= kCacheMaxBytes);
+
+    IgnoreError(message.Read(message.GetOffset(), header));
+    SuccessOrExit(GetMinTtl(message, aResponse.mAnswerOffset,
+                            header.GetAnswerCount() + header.GetAuthorityRecordCount() +
+                                header.GetAdditionalRecordCount(),
+                            ttl));
+
+    if ((aResponseError != OT_ERROR_NONE) || (aResponse.mAnswerRecordCount == 0))
+    {
+        ttl = OT_MIN(ttl, static_cast<uint32_t>(kCacheNegativeTtl));
+    }
+
+    VerifyOrExit(ttl > 0);
+
+    queryInfo.ReadFrom(*aResponse.mQuery);
+
+    // Replace any older response for the same query, then make room
+    // by evicting the least recently used entries.
+
+    entry = FindCacheEntry(*aResponse.mQuery, queryInfo);
+
+    if (entry != nullptr)
+    {
+        RemoveCacheEntry(*entry);
+    }
+
+    while ((entry = mCache.GetHead()) != nullptr)
+    {
+        uint16_t numEntries;
+        uint16_t numBuffers;
+
+        mCache.GetInfo(numEntries, numBuffers);
+
+        if ((numEntries < kCacheMaxEntries) && (mCacheBytes + dataOffset + dataLength <= kCacheMaxBytes))
+        {
+            break;
+        }
+
+        mCacheCounters.mEvictions++;
+        RemoveCacheEntry(*entry);
+    }
+
+    // A response is only cached with buffers to spare. The entry
+    // is allocated at low priority and never makes the pool evict a
+    // queued message.
+
+    VerifyOrExit(Get<MessagePool>().GetFreeBufferCount() >= Message::GetBufferCountFor(dataOffset + dataLength));
+
+    entry = Get<MessagePool>().New(Message::kTypeOther, /* aReserveHeader */ 0,
+                                   Message::Settings(Message::kWithLinkSecurity, Message::kPriorityLow));
+    VerifyOrExit(entry != nullptr, error = OT_ERROR_NO_BUFS);
+
+    info.Clear();
+    info.mQueryType             = aType;
+    info.mResponseError         = aResponseError;
+    info.mServerSockAddr        = queryInfo.mConfig.GetServerSockAddr();
+    info.mCacheTime             = TimerMilli::GetNow();
+    info.mExpireTime            = info.mCacheTime + Time::SecToMsec(ttl);
+    info.mAnswerOffset          = aResponse.mAnswerOffset - message.GetOffset() + dataOffset;
+    info.mAnswerRecordCount     = aResponse.mAnswerRecordCount;
+    info.mAdditionalOffset      = aResponse.mAdditionalOffset - message.GetOffset() + dataOffset;
+    info.mAdditionalRecordCount = aResponse.mAdditionalRecordCount;
+
+    SuccessOrExit(error = entry->Append(info));
+    SuccessOrExit(error = entry->SetLength(dataOffset + dataLength));
+    aResponse.mQuery->CopyTo(kNameOffsetInQuery, kNameOffsetInCacheEntry, nameLength, *entry);
+    message.CopyTo(message.GetOffset(), dataOffset, dataLength, *entry);
+
+    // Compressed names in the response are relative to its DNS
+    // header, so the entry offset points to the header.
+    entry->SetOffset(dataOffset);
+
+    mCache.Enqueue(*entry);
+    mCacheBytes += entry->GetLength();
+
+exit:
+    FreeMessageOnError(entry, error);
+}
+
+void Client::RemoveCacheEntry(CacheEntry &aEntry)
+{
+    mCacheBytes -= aEntry.GetLength();
+    mCache.Dequeue(aEntry);
+    aEntry.Free();
+}
+
+otError Client::GetMinTtl(const Message &aMessage, uint16_t aOffset, uint16_t aNumRecords, uint32_t &aMinTtl) const
+{
+    // This method updates `aMinTtl` to the smallest TTL of the
+    // records starting at `aOffset`, skipping the OPT pseudo record
+    // (whose TTL field holds EDNS flags).
+
+    otError        error = OT_ERROR_NONE;
+    ResourceRecord record;
+
+    for (; aNumRecords > 0; aNumRecords--)
+    {
+        SuccessOrExit(error = Name::ParseName(aMessage, aOffset));
+        SuccessOrExit(error = aMessage.Read(aOffset, record));
+        aOffset += static_cast<uint16_t>(record.GetSize());
+
+        if (record.GetType() != ResourceRecord::kTypeOpt)
+        {
+            aMinTtl = OT_MIN(aMinTtl, record.GetTtl());
+        }
+    }
+
+exit:
+    return error;
+}
+
+#endif // OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+
 } // namespace Dns
 } // namespace ot
 
@@ -83,7 +83,12 @@ namespace Dns {
  */
 class Client : public InstanceLocator, private NonCopyable
 {
+    friend class ClientTester;
+
     typedef Message Query; // `Message` is used to save `Query` related info.
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    typedef Message CacheEntry; // `Message` is used to save a cached response and its info.
+#endif
 
 public:
     /**
@@ -218,13 +223,14 @@ public:
 
         Response(void) { Clear(); }
 
-        otError GetName(char *aNameBuffer, uint16_t aNameBufferSize) const;
-        void    SelectSection(Section aSection, uint16_t &aOffset, uint16_t &aNumRecord) const;
-        otError FindHostAddress(Section       aSection,
-                                const Name &  aHostName,
-                                uint16_t      aIndex,
-                                Ip6::Address &aAddress,
-                                uint32_t &    aTtl) const;
+        uint32_t GetRemainingTtl(uint32_t aTtl) const { return (aTtl > mTtlAge) ? aTtl - mTtlAge : 0; }
+        otError  GetName(char *aNameBuffer, uint16_t aNameBufferSize) const;
+        void     SelectSection(Section aSection, uint16_t &aOffset, uint16_t &aNumRecord) const;
+        otError  FindHostAddress(Section       aSection,
+                                 const Name &  aHostName,
+                                 uint16_t      aIndex,
+                                 Ip6::Address &aAddress,
+                                 uint32_t &    aTtl) const;
 
 #if OPENTHREAD_CONFIG_DNS_CLIENT_SERVICE_DISCOVERY_ENABLE
         otError FindServiceInfo(Section aSection, const Name &aName, ServiceInfo &aServiceInfo) const;
@@ -236,6 +242,7 @@ public:
         uint16_t       mAnswerRecordCount;     // Number of records in answer section.
         uint16_t       mAdditionalOffset;      // Additional data section offset in `mMessage`.
         uint16_t       mAdditionalRecordCount; // Number of records in additional data section.
+        uint32_t       mTtlAge;                // Seconds to subtract from the TTLs (age of a cached response).
     };
 
     /**
@@ -607,6 +614,47 @@ public:
 
 #endif // OPENTHREAD_CONFIG_DNS_CLIENT_SERVICE_DISCOVERY_ENABLE
 
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+
+    /**
+     * This type represents the DNS client cache counters.
+     *
+     */
+    typedef otDnsCacheCounters CacheCounters;
+
+    /**
+     * This method gets the DNS client cache counters.
+     *
+     * @returns A reference to the cache counters.
+     *
+     */
+    const CacheCounters &GetCacheCounters(void) const { return mCacheCounters; }
+
+    /**
+     * This method resets the DNS client cache counters.
+     *
+     */
+    void ResetCacheCounters(void) { memset(&mCacheCounters, 0, sizeof(mCacheCounters)); }
+
+    /**
+     * This method removes all the responses from the DNS client cache.
+     *
+     */
+    void ClearCache(void);
+
+    /**
+     * This method evicts the least recently used response from the DNS client cache.
+     *
+     * This method is used by `MessagePool` to reclaim message buffers when it runs out of them.
+     *
+     * @retval OT_ERROR_NONE       A response was evicted and its buffers were freed.
+     * @retval OT_ERROR_NOT_FOUND  The cache is empty.
+     *
+     */
+    otError EvictCacheEntry(void);
+
+#endif // OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+
 private:
     enum QueryType : uint8_t
     {
@@ -626,6 +674,13 @@ private:
 #endif
     };
 
+    enum QuerySource : uint8_t
+    {
+        kSourceServer,     // The query is sent to the server.
+        kSourceCache,      // The query is answered from the cache.
+        kSourceOtherQuery, // The query waits for the response to an identical query (with same `mMessageId`).
+    };
+
     typedef MessageQueue QueryList; // List of queries.
 
     struct QueryInfo : public Clearable<QueryInfo> // Query related Info
@@ -633,6 +688,7 @@ private:
         void ReadFrom(const Query &aQuery) { IgnoreError(aQuery.Read(0, *this)); }
 
         QueryType   mQueryType;
+        QuerySource mSource;
         uint16_t    mMessageId;
         Callback    mCallback;
         void *      mCallbackContext;
@@ -647,13 +703,44 @@ private:
         kNameOffsetInQuery = sizeof(QueryInfo),
     };
 
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    struct CacheInfo : public Clearable<CacheInfo> // Cached response related info
+    {
+        void ReadFrom(const CacheEntry &aEntry) { IgnoreError(aEntry.Read(0, *this)); }
+
+        QueryType     mQueryType;
+        otError       mResponseError;
+        Ip6::SockAddr mServerSockAddr;
+        TimeMilli     mCacheTime;
+        TimeMilli     mExpireTime;
+        uint16_t      mAnswerOffset;
+        uint16_t      mAnswerRecordCount;
+        uint16_t      mAdditionalOffset;
+        uint16_t      mAdditionalRecordCount;
+        // Followed by the query name as in `Query`, then by the response starting from its DNS header (the entry
+        // offset points to the header).
+    };
+
+    enum : uint16_t
+    {
+        kNameOffsetInCacheEntry = sizeof(CacheInfo),
+        kCacheMaxEntries        = OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_MAX_ENTRIES,
+        kCacheMaxBytes          = OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_MAX_BYTES,
+    };
+
+    enum : uint32_t
+    {
+        kCacheNegativeTtl = OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_NEGATIVE_TTL, // in sec
+        kCacheMaxTtl      = 24 * 3600,                                      // in sec
+    };
+#endif
+
     otError     StartQuery(QueryInfo &        aInfo,
                            const QueryConfig *aConfig,
                            const char *       aLabel,
                            const char *       aName,
                            void *             aContext);
     otError     AllocateQuery(const QueryInfo &aInfo, const char *aLabel, const char *aName, Query *&aQuery);
-    void        FreeQuery(Query &aQuery);
     void        UpdateQuery(Query &aQuery, const QueryInfo &aInfo) { aQuery.Write(0, aInfo); }
     void        SendQuery(Query &aQuery);
     void        SendQuery(Query &aQuery, QueryInfo &aInfo, bool aUpdateTimer);
@@ -665,8 +752,17 @@ private:
     static void HandleUdpReceive(void *aContext, otMessage *aMessage, const otMessageInfo *aMsgInfo);
     void        ProcessResponse(const Message &aMessage);
     otError     ParseResponse(Response &aResponse, QueryType &aType, otError &aResponseError);
+    void        FinalizeQueries(Response &aResponse, QueryType aType, otError aError);
     static void HandleTimer(Timer &aTimer);
     void        HandleTimer(void);
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    Query *     FindIdenticalQuery(const Query &aQuery, const QueryInfo &aInfo);
+    CacheEntry *FindCacheEntry(const Query &aQuery, const QueryInfo &aInfo);
+    void        AnswerFromCache(Query &aQuery, QueryInfo &aInfo);
+    void        AddCacheEntry(const Response &aResponse, QueryType aType, otError aResponseError);
+    void        RemoveCacheEntry(CacheEntry &aEntry);
+    otError     GetMinTtl(const Message &aMessage, uint16_t aOffset, uint16_t aNumRecords, uint32_t &aMinTtl) const;
+#endif
 
     static const uint8_t   kQuestionCount[];
     static const uint16_t *kQuestionRecordTypes[];
@@ -681,6 +777,12 @@ private:
     QueryList        mQueries;
     TimerMilli       mTimer;
     QueryConfig      mDefaultConfig;
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    MessageQueue  mCache;       // Cached responses, the least recently used first.
+    CacheEntry *  mAnswerEntry; // The entry taken out of `mCache` to answer a query, if any.
+    uint16_t      mCacheBytes;
+    CacheCounters mCacheCounters;
+#endif
 };
 
 } // namespace Dns
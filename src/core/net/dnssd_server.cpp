@@ -56,6 +56,7 @@ const char Server::kDefaultDomainName[] = "default.service.arpa.";
 Server::Server(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mSocket(aInstance)
+    , mCompressInfo(kDefaultDomainName)
 {
 }
 
@@ -112,14 +113,16 @@ exit:
 
 void Server::ProcessQuery(Message &aMessage, Message &aResponse, const Header &aRequestHeader)
 {
-    Header           responseHeader;
-    uint16_t         readOffset;
-    Question         question;
-    char             name[Dns::Name::kMaxNameSize];
-    NameCompressInfo compressInfo(kDefaultDomainName);
-    Header::Response response          = Header::Response::kResponseSuccess;
-    otError          error             = OT_ERROR_NONE;
-    uint8_t          resolveAdditional = kResolveAdditionalAll;
+    Header            responseHeader;
+    uint16_t          readOffset;
+    Question          question;
+    char              name[Dns::Name::kMaxNameSize];
+    NameCompressInfo &compressInfo      = mCompressInfo;
+    Header::Response  response          = Header::Response::kResponseSuccess;
+    otError           error             = OT_ERROR_NONE;
+    uint8_t           resolveAdditional = kResolveAdditionalAll;
+
+    compressInfo.Clear();
 
     // Setup initial DNS response header
     responseHeader.Clear();
@@ -363,7 +366,7 @@ exit:
 otError Server::AppendServiceName(Message &aMessage, const char *aName, NameCompressInfo &aCompressInfo)
 {
     otError  error;
-    uint16_t serviceCompressOffset = aCompressInfo.GetServiceNameOffset(aName);
+    uint16_t serviceCompressOffset = aCompressInfo.GetNameOffset(aName);
 
     if (serviceCompressOffset != NameCompressInfo::kUnknownOffset)
     {
@@ -371,34 +374,16 @@ otError Server::AppendServiceName(Message &aMessage, const char *aName, NameComp
     }
     else
     {
-        uint8_t  domainStart          = static_cast<uint8_t>(StringLength(aName, Name::kMaxNameSize - 1) -
-                                                   StringLength(aCompressInfo.GetDomainName(), Name::kMaxNameSize - 1));
-        uint16_t domainCompressOffset = aCompressInfo.GetDomainNameOffset();
-
-        serviceCompressOffset = aMessage.GetLength();
-        aCompressInfo.SetServiceNameOffset(serviceCompressOffset, aName);
-
-        if (domainCompressOffset == NameCompressInfo::kUnknownOffset)
-        {
-            aCompressInfo.SetDomainNameOffset(serviceCompressOffset + domainStart);
-            error = Dns::Name::AppendName(aName, aMessage);
-        }
-        else
-        {
-            SuccessOrExit(error = Dns::Name::AppendMultipleLabels(aName, domainStart, aMessage));
-            error = Dns::Name::AppendPointerLabel(domainCompressOffset, aMessage);
-        }
+        error = aCompressInfo.AppendName(aName, /* aFirstLabelLength */ 0, aMessage);
     }
 
-exit:
     return error;
 }
 
 otError Server::AppendInstanceName(Message &aMessage, const char *aName, NameCompressInfo &aCompressInfo)
 {
-    otError error;
-
-    uint16_t instanceCompressOffset = aCompressInfo.GetInstanceNameOffset(aName);
+    otError  error;
+    uint16_t instanceCompressOffset = aCompressInfo.GetNameOffset(aName);
 
     if (instanceCompressOffset != NameCompressInfo::kUnknownOffset)
     {
@@ -411,35 +396,17 @@ otError Server::AppendInstanceName(Message &aMessage, const char *aName, NameCom
         IgnoreError(FindNameComponents(aName, aCompressInfo.GetDomainName(), nameComponentsInfo));
         OT_ASSERT(nameComponentsInfo.IsServiceInstanceName());
 
-        aCompressInfo.SetInstanceNameOffset(aMessage.GetLength(), aName);
-
         // Append the instance name as one label
-        SuccessOrExit(error = Dns::Name::AppendLabel(aName, nameComponentsInfo.mServiceOffset - 1, aMessage));
-
-        {
-            const char *serviceName           = aName + nameComponentsInfo.mServiceOffset;
-            uint16_t    serviceCompressOffset = aCompressInfo.GetServiceNameOffset(serviceName);
-
-            if (serviceCompressOffset != NameCompressInfo::kUnknownOffset)
-            {
-                error = Dns::Name::AppendPointerLabel(serviceCompressOffset, aMessage);
-            }
-            else
-            {
-                aCompressInfo.SetServiceNameOffset(aMessage.GetLength(), serviceName);
-                error = Dns::Name::AppendName(serviceName, aMessage);
-            }
-        }
+        error = aCompressInfo.AppendName(aName, nameComponentsInfo.mServiceOffset - 1, aMessage);
     }
 
-exit:
     return error;
 }
 
 otError Server::AppendHostName(Message &aMessage, const char *aName, NameCompressInfo &aCompressInfo)
 {
     otError  error;
-    uint16_t hostCompressOffset = aCompressInfo.GetHostNameOffset(aName);
+    uint16_t hostCompressOffset = aCompressInfo.GetNameOffset(aName);
 
     if (hostCompressOffset != NameCompressInfo::kUnknownOffset)
     {
@@ -447,26 +414,9 @@ otError Server::AppendHostName(Message &aMessage, const char *aName, NameCompres
     }
     else
     {
-        uint8_t  domainStart          = static_cast<uint8_t>(StringLength(aName, Name::kMaxNameLength) -
-                                                   StringLength(aCompressInfo.GetDomainName(), Name::kMaxNameSize - 1));
-        uint16_t domainCompressOffset = aCompressInfo.GetDomainNameOffset();
-
-        hostCompressOffset = aMessage.GetLength();
-        aCompressInfo.SetHostNameOffset(hostCompressOffset, aName);
-
-        if (domainCompressOffset == NameCompressInfo::kUnknownOffset)
-        {
-            aCompressInfo.SetDomainNameOffset(hostCompressOffset + domainStart);
-            error = Dns::Name::AppendName(aName, aMessage);
-        }
-        else
-        {
-            SuccessOrExit(error = Dns::Name::AppendMultipleLabels(aName, domainStart, aMessage));
-            error = Dns::Name::AppendPointerLabel(domainCompressOffset, aMessage);
-        }
+        error = aCompressInfo.AppendName(aName, /* aFirstLabelLength */ 0, aMessage);
     }
 
-exit:
     return error;
 }
 
@@ -562,98 +512,142 @@ Header::Response Server::ResolveQuestionBySrp(const char *      aName,
                                               uint8_t           aResolveKind,
                                               NameCompressInfo &aCompressInfo)
 {
-    otError                  error    = OT_ERROR_NONE;
-    const Srp::Server::Host *host     = nullptr;
-    TimeMilli                now      = TimerMilli::GetNow();
-    uint16_t                 qtype    = aQuestion.GetType();
-    Header::Response         response = Header::kResponseNameError;
+    otError            error     = OT_ERROR_NONE;
+    const Srp::Server &srpServer = Get<Srp::Server>();
+    uint16_t           qtype     = aQuestion.GetType();
+    Header::Response   response  = Header::kResponseNameError;
+
+    // Only the hosts owning the queried name are visited, found through the SRP server name indices.
 
-    while ((host = GetNextSrpHost(host)) != nullptr)
+    if (qtype == ResourceRecord::kTypeAaaa)
     {
-        bool        needAdditionalAaaaRecord = false;
-        const char *hostName                 = host->GetFullName();
+        const Srp::Server::Host *host = srpServer.FindHost(aName);
 
-        // Handle PTR/SRV/TXT query
-        if (qtype == ResourceRecord::kTypePtr || qtype == ResourceRecord::kTypeSrv || qtype == ResourceRecord::kTypeTxt)
+        if (host != nullptr && !host->IsDeleted())
         {
-            const Srp::Server::Service *service = nullptr;
+            SuccessOrExit(error = ResolveQuestionBySrpHost(*host, aName, aQuestion, aResponseHeader, aResponseMessage,
+                                                           aResolveKind, aCompressInfo, response));
+        }
+    }
+    else
+    {
+        const Srp::Server::Service *service = nullptr;
 
-            while ((service = GetNextSrpService(*host, service)) != nullptr)
+        while ((service = FindNextSrpService(service, aName, qtype)) != nullptr)
+        {
+            // A host with several matching services is resolved once, through the first of them.
+            if (IsFirstSrpServiceOfHost(*service, aName, qtype))
             {
-                uint32_t    instanceTtl         = TimeMilli::MsecToSec(service->GetExpireTime() - TimerMilli::GetNow());
-                const char *instanceName        = service->GetFullName();
-                bool        serviceNameMatched  = service->MatchesServiceName(aName);
-                bool        instanceNameMatched = service->Matches(aName);
-                bool        ptrQueryMatched     = qtype == ResourceRecord::kTypePtr && serviceNameMatched;
-                bool        srvQueryMatched     = qtype == ResourceRecord::kTypeSrv && instanceNameMatched;
-                bool        txtQueryMatched     = qtype == ResourceRecord::kTypeTxt && instanceNameMatched;
-
-                if (ptrQueryMatched || srvQueryMatched)
-                {
-                    needAdditionalAaaaRecord = true;
-                }
-
-                if (aResolveKind == kResolveAnswer && ptrQueryMatched)
-                {
-                    SuccessOrExit(
-                        error = AppendPtrRecord(aResponseMessage, aName, instanceName, instanceTtl, aCompressInfo));
-                    IncResourceRecordCount(aResponseHeader, aResolveKind != kResolveAnswer);
-                    response = Header::Response::kResponseSuccess;
-                }
-
-                if ((aResolveKind == kResolveAnswer && srvQueryMatched) ||
-                    ((aResolveKind & kResolveAdditionalSrv) && ptrQueryMatched))
-                {
-                    SuccessOrExit(error = AppendSrvRecord(aResponseMessage, instanceName, hostName, instanceTtl,
-                                                          service->GetPriority(), service->GetWeight(),
-                                                          service->GetPort(), aCompressInfo));
-                    IncResourceRecordCount(aResponseHeader, aResolveKind != kResolveAnswer);
-                    response = Header::Response::kResponseSuccess;
-                }
-
-                if ((aResolveKind == kResolveAnswer && txtQueryMatched) ||
-                    ((aResolveKind & kResolveAdditionalTxt) && ptrQueryMatched))
-                {
-                    SuccessOrExit(
-                        error = AppendTxtRecord(aResponseMessage, instanceName, *service, instanceTtl, aCompressInfo));
-                    IncResourceRecordCount(aResponseHeader, aResolveKind != kResolveAnswer);
-                    response = Header::Response::kResponseSuccess;
-                }
+                SuccessOrExit(error = ResolveQuestionBySrpHost(service->GetHost(), aName, aQuestion, aResponseHeader,
+                                                               aResponseMessage, aResolveKind, aCompressInfo,
+                                                               response));
             }
         }
+    }
+
+exit:
+    return error == OT_ERROR_NONE ? response : Header::Response::kResponseServerFailure;
+}
+
+otError Server::ResolveQuestionBySrpHost(const Srp::Server::Host &aHost,
+                                         const char *             aName,
+                                         const Question &         aQuestion,
+                                         Header &                 aResponseHeader,
+                                         Message &                aResponseMessage,
+                                         uint8_t                  aResolveKind,
+                                         NameCompressInfo &       aCompressInfo,
+                                         Header::Response &       aResponse)
+{
+    otError     error                    = OT_ERROR_NONE;
+    TimeMilli   now                      = TimerMilli::GetNow();
+    uint16_t    qtype                    = aQuestion.GetType();
+    bool        needAdditionalAaaaRecord = false;
+    const char *hostName                 = aHost.GetFullName();
+
+    // Handle PTR/SRV/TXT query
+    if (qtype == ResourceRecord::kTypePtr || qtype == ResourceRecord::kTypeSrv || qtype == ResourceRecord::kTypeTxt)
+    {
+        const Srp::Server::Service *service = nullptr;
 
-        // Handle AAAA query
-        if ((aResolveKind == kResolveAnswer && qtype == ResourceRecord::kTypeAaaa && host->Matches(aName)) ||
-            ((aResolveKind & kResolveAdditionalAaaa) && needAdditionalAaaaRecord))
+        while ((service = GetNextSrpService(aHost, service)) != nullptr)
         {
-            uint8_t             addrNum;
-            const Ip6::Address *addrs   = host->GetAddresses(addrNum);
-            uint32_t            hostTtl = TimeMilli::MsecToSec(host->GetExpireTime() - now);
+            uint32_t    instanceTtl         = TimeMilli::MsecToSec(service->GetExpireTime() - TimerMilli::GetNow());
+            const char *instanceName        = service->GetFullName();
+            bool        serviceNameMatched  = service->MatchesServiceName(aName);
+            bool        instanceNameMatched = service->Matches(aName);
+            bool        ptrQueryMatched     = qtype == ResourceRecord::kTypePtr && serviceNameMatched;
+            bool        srvQueryMatched     = qtype == ResourceRecord::kTypeSrv && instanceNameMatched;
+            bool        txtQueryMatched     = qtype == ResourceRecord::kTypeTxt && instanceNameMatched;
+
+            if (ptrQueryMatched || srvQueryMatched)
+            {
+                needAdditionalAaaaRecord = true;
+            }
+
+            if (aResolveKind == kResolveAnswer && ptrQueryMatched)
+            {
+                SuccessOrExit(error =
+                                  AppendPtrRecord(aResponseMessage, aName, instanceName, instanceTtl, aCompressInfo));
+                IncResourceRecordCount(aResponseHeader, aResolveKind != kResolveAnswer);
+                aResponse = Header::Response::kResponseSuccess;
+            }
+
+            if ((aResolveKind == kResolveAnswer && srvQueryMatched) ||
+                ((aResolveKind & kResolveAdditionalSrv) && ptrQueryMatched))
+            {
+                SuccessOrExit(error = AppendSrvRecord(aResponseMessage, instanceName, hostName, instanceTtl,
+                                                      service->GetPriority(), service->GetWeight(), service->GetPort(),
+                                                      aCompressInfo));
+                IncResourceRecordCount(aResponseHeader, aResolveKind != kResolveAnswer);
+                aResponse = Header::Response::kResponseSuccess;
+            }
 
-            for (uint8_t i = 0; i < addrNum; i++)
+            if ((aResolveKind == kResolveAnswer && txtQueryMatched) ||
+                ((aResolveKind & kResolveAdditionalTxt) && ptrQueryMatched))
             {
-                SuccessOrExit(error = AppendAaaaRecord(aResponseMessage, hostName, addrs[i], hostTtl, aCompressInfo));
+                SuccessOrExit(
+                    error = AppendTxtRecord(aResponseMessage, instanceName, *service, instanceTtl, aCompressInfo));
                 IncResourceRecordCount(aResponseHeader, aResolveKind != kResolveAnswer);
+                aResponse = Header::Response::kResponseSuccess;
             }
+        }
+    }
 
-            response = Header::Response::kResponseSuccess;
+    // Handle AAAA query
+    if ((aResolveKind == kResolveAnswer && qtype == ResourceRecord::kTypeAaaa && aHost.Matches(aName)) ||
+        ((aResolveKind & kResolveAdditionalAaaa) && needAdditionalAaaaRecord))
+    {
+        uint8_t             addrNum;
+        const Ip6::Address *addrs   = aHost.GetAddresses(addrNum);
+        uint32_t            hostTtl = TimeMilli::MsecToSec(aHost.GetExpireTime() - now);
+
+        for (uint8_t i = 0; i < addrNum; i++)
+        {
+            SuccessOrExit(error = AppendAaaaRecord(aResponseMessage, hostName, addrs[i], hostTtl, aCompressInfo));
+            IncResourceRecordCount(aResponseHeader, aResolveKind != kResolveAnswer);
         }
+
+        aResponse = Header::Response::kResponseSuccess;
     }
 
 exit:
-    return error == OT_ERROR_NONE ? response : Header::Response::kResponseServerFailure;
+    return error;
 }
 
-const Srp::Server::Host *Server::GetNextSrpHost(const Srp::Server::Host *aHost)
+const Srp::Server::Service *Server::FindNextSrpService(const Srp::Server::Service *aService,
+                                                       const char *                aName,
+                                                       uint16_t                    aQueryType)
 {
-    const Srp::Server::Host *host = Get<Srp::Server>().GetNextHost(aHost);
+    const Srp::Server &         srpServer = Get<Srp::Server>();
+    const Srp::Server::Service *service   = aService;
 
-    while (host != nullptr && host->IsDeleted())
+    do
     {
-        host = Get<Srp::Server>().GetNextHost(host);
-    }
+        service = (aQueryType == ResourceRecord::kTypePtr) ? srpServer.FindNextServiceOfType(service, aName)
+                                                            : srpServer.FindNextService(service, aName);
+    } while (service != nullptr && (service->IsDeleted() || service->GetHost().IsDeleted()));
 
-    return host;
+    return service;
 }
 
 const Srp::Server::Service *Server::GetNextSrpService(const Srp::Server::Host &   aHost,
@@ -669,6 +663,23 @@ const Srp::Server::Service *Server::GetNextSrpService(const Srp::Server::Host &
     return service;
 }
 
+bool Server::IsFirstSrpServiceOfHost(const Srp::Server::Service &aService, const char *aName, uint16_t aQueryType)
+{
+    const Srp::Server::Service *service = nullptr;
+
+    while ((service = GetNextSrpService(aService.GetHost(), service)) != &aService)
+    {
+        OT_ASSERT(service != nullptr);
+
+        if ((aQueryType == ResourceRecord::kTypePtr) ? service->MatchesServiceName(aName) : service->Matches(aName))
+        {
+            break;
+        }
+    }
+
+    return service == &aService;
+}
+
 otError Server::AppendTxtRecord(Message &                   aMessage,
                                 const char *                aInstanceName,
                                 const Srp::Server::Service &aService,
@@ -697,6 +708,278 @@ exit:
 }
 #endif // OPENTHREAD_CONFIG_SRP_SERVER_ENABLE
 
+Server::NameCompressInfo::NameCompressInfo(const char *aDomainName)
+    : mDomainName(aDomainName)
+{
+    Clear();
+}
+
+void Server::NameCompressInfo::Clear(void)
+{
+    mNumEntries   = 0;
+    mLabelsLength = 0;
+    memset(mEntries, 0, sizeof(mEntries));
+}
+
+uint16_t Server::NameCompressInfo::GetNameOffset(const char *aName) const
+{
+    uint8_t  length;
+    uint16_t hash   = HashName(aName, length);
+    uint16_t offset = kUnknownOffset;
+
+    for (uint16_t index = hash & (kTableSize - 1); mEntries[index].mLength != 0; index = (index + 1) & (kTableSize - 1))
+    {
+        if ((mEntries[index].mHash == hash) && MatchesSuffix(index, aName, length))
+        {
+            offset = mEntries[index].mOffset;
+            break;
+        }
+    }
+
+    return offset;
+}
+
+otError Server::NameCompressInfo::AppendName(const char *aName, uint8_t aFirstLabelLength, Message &aMessage)
+{
+    otError  error  = OT_ERROR_NONE;
+    uint16_t offset = aMessage.GetLength();
+    uint32_t hash   = 0;
+    uint32_t factor = 1;
+    uint16_t entry  = kNoEntry;
+    uint16_t start  = 0;
+    uint8_t  numLabels;
+    uint8_t  numNewLabels;
+    uint8_t  labelStarts[kMaxLabels + 1];
+    uint16_t hashes[kMaxLabels];
+    uint8_t  encoded[kMaxEncodedBytes];
+    uint16_t encodedLength = 0;
+
+    // Split the name in labels. The end of the name (without its
+    // trailing dot) is recorded as the start of an extra label, so
+    // that the label `i` spans from `labelStarts[i]` to
+    // `labelStarts[i + 1] - 1`.
+
+    for (numLabels = 0; aName[start] != '\0'; numLabels++)
+    {
+        uint16_t labelLength = (numLabels == 0) ? aFirstLabelLength : 0;
+
+        while ((aName[start + labelLength] != '\0') && (aName[start + labelLength] != Name::kLabelSeperatorChar))
+        {
+            labelLength++;
+        }
+
+        VerifyOrExit((labelLength > 0) && (labelLength <= Name::kMaxLabelLength) &&
+                         (start + labelLength <= Name::kMaxNameLength),
+                     error = OT_ERROR_INVALID_ARGS);
+
+        labelStarts[numLabels] = static_cast<uint8_t>(start);
+        start += labelLength;
+        labelStarts[numLabels + 1] = static_cast<uint8_t>(start + 1);
+
+        if (aName[start] == Name::kLabelSeperatorChar)
+        {
+            start++;
+        }
+    }
+
+    // Find the longest suffix already in the message, matching the
+    // labels from the last one, and hash the suffixes of the new
+    // labels on the way.
+
+    for (numNewLabels = numLabels; numNewLabels > 0; numNewLabels--)
+    {
+        uint8_t index       = numNewLabels - 1;
+        uint8_t labelStart  = labelStarts[index];
+        uint8_t labelLength = labelStarts[index + 1] - labelStart - 1;
+
+        // Include the dot separating the label from the rest of the suffix.
+        hash = HashChars(hash, factor, aName + labelStart, (index == numLabels - 1) ? labelLength : labelLength + 1);
+
+        hashes[index] = FoldHash(hash);
+
+        uint16_t match = FindEntry(hashes[index], aName + labelStart, labelLength, entry);
+
+        if (match == kNoEntry)
+        {
+            break;
+        }
+
+        entry = match;
+    }
+
+    for (uint8_t index = numNewLabels; index > 1; index--)
+    {
+        uint8_t labelStart = labelStarts[index - 2];
+
+        hash = HashChars(hash, factor, aName + labelStart, labelStarts[index - 1] - labelStart);
+
+        hashes[index - 2] = FoldHash(hash);
+    }
+
+    // Encode the new labels followed by a pointer to the matched
+    // suffix, or by the root label. Since labels are separated by a
+    // single dot, a label is encoded at its offset in `aName`.
+
+    for (uint8_t index = 0; index < numNewLabels; index++)
+    {
+        uint8_t labelStart  = labelStarts[index];
+        uint8_t labelLength = labelStarts[index + 1] - labelStart - 1;
+
+        encoded[labelStart] = labelLength;
+        memcpy(&encoded[labelStart + 1], aName + labelStart, labelLength);
+        encodedLength = labelStart + labelLength + 1;
+    }
+
+    if (entry != kNoEntry)
+    {
+        encoded[encodedLength++] = static_cast<uint8_t>(0xc0 | (mEntries[entry].mOffset >> 8));
+        encoded[encodedLength++] = static_cast<uint8_t>(mEntries[entry].mOffset & 0xff);
+    }
+    else
+    {
+        encoded[encodedLength++] = 0;
+    }
+
+    SuccessOrExit(error = aMessage.AppendBytes(encoded, encodedLength));
+
+    // Add the new suffixes, from the shortest one as each entry
+    // refers to the entry of the rest of its suffix.
+
+    for (uint8_t index = numNewLabels; index > 0; index--)
+    {
+        uint8_t labelStart = labelStarts[index - 1];
+
+        VerifyOrExit(offset + labelStart <= kMaxOffset);
+
+        entry = AddEntry(hashes[index - 1], aName + labelStart, labelStarts[index] - labelStart - 1, entry,
+                         offset + labelStart);
+        VerifyOrExit(entry != kNoEntry);
+    }
+
+exit:
+    return error;
+}
+
+uint16_t Server::NameCompressInfo::HashName(const char *aName, uint8_t &aLength)
+{
+    // Hashes `aName` (without its trailing dot) going forward, and
+    // returns its length in `aLength`.
+
+    uint32_t hash     = 0;
+    uint32_t prevHash = 0;
+    uint8_t  length;
+
+    for (length = 0; (length < Name::kMaxNameLength) && (aName[length] != '\0'); length++)
+    {
+        prevHash = hash;
+        hash     = hash * kHashMultiplier + static_cast<uint8_t>(aName[length]);
+    }
+
+    if ((length > 0) && (aName[length - 1] == Name::kLabelSeperatorChar))
+    {
+        hash = prevHash;
+        length--;
+    }
+
+    aLength = length;
+
+    return FoldHash(hash);
+}
+
+uint32_t Server::NameCompressInfo::HashChars(uint32_t aHash, uint32_t &aFactor, const char *aChars, uint8_t aLength)
+{
+    // Prepends `aChars` to the text hashed in `aHash`, going backward
+    // from the last char. `aFactor` tracks the multiplier power of
+    // the first hashed char.
+
+    while (aLength > 0)
+    {
+        aHash += static_cast<uint8_t>(aChars[--aLength]) * aFactor;
+        aFactor *= kHashMultiplier;
+    }
+
+    return aHash;
+}
+
+uint16_t Server::NameCompressInfo::FindEntry(uint16_t aHash, const char *aLabel, uint8_t aLength, uint16_t aNext) const
+{
+    uint16_t index;
+
+    for (index = aHash & (kTableSize - 1); mEntries[index].mLength != 0; index = (index + 1) & (kTableSize - 1))
+    {
+        const Entry &entry = mEntries[index];
+
+        if ((entry.mHash == aHash) && (entry.mNext == aNext) && (entry.mLength == aLength) &&
+            (memcmp(&mLabels[entry.mLabel], aLabel, aLength) == 0))
+        {
+            ExitNow();
+        }
+    }
+
+    index = kNoEntry;
+
+exit:
+    return index;
+}
+
+uint16_t Server::NameCompressInfo::AddEntry(uint16_t    aHash,
+                                            const char *aLabel,
+                                            uint8_t     aLength,
+                                            uint16_t    aNext,
+                                            uint16_t    aOffset)
+{
+    uint16_t index = kNoEntry;
+
+    VerifyOrExit((mNumEntries < kMaxEntries) && (mLabelsLength + aLength <= kLabelsSize));
+
+    for (index = aHash & (kTableSize - 1); mEntries[index].mLength != 0; index = (index + 1) & (kTableSize - 1))
+    {
+    }
+
+    mEntries[index].mHash   = aHash;
+    mEntries[index].mOffset = aOffset;
+    mEntries[index].mNext   = aNext;
+    mEntries[index].mLabel  = mLabelsLength;
+    mEntries[index].mLength = aLength;
+    mNumEntries++;
+
+    memcpy(&mLabels[mLabelsLength], aLabel, aLength);
+    mLabelsLength += aLength;
+
+exit:
+    return index;
+}
+
+bool Server::NameCompressInfo::MatchesSuffix(uint16_t aEntry, const char *aName, uint8_t aLength) const
+{
+    // This method checks whether the suffix of entry `aEntry` spells
+    // out the first `aLength` chars of `aName`.
+
+    bool matches = false;
+
+    while (aEntry != kNoEntry)
+    {
+        const Entry &entry = mEntries[aEntry];
+
+        VerifyOrExit(entry.mLength <= aLength && memcmp(&mLabels[entry.mLabel], aName, entry.mLength) == 0);
+        aName += entry.mLength;
+        aLength -= entry.mLength;
+        aEntry = entry.mNext;
+
+        if (aEntry != kNoEntry)
+        {
+            VerifyOrExit(aLength > 0 && *aName == Name::kLabelSeperatorChar);
+            aName++;
+            aLength--;
+        }
+    }
+
+    matches = (aLength == 0);
+
+exit:
+    return matches;
+}
+
 } // namespace ServiceDiscovery
 } // namespace Dns
 } // namespace ot
@@ -58,6 +58,8 @@ namespace ServiceDiscovery {
  */
 class Server : public InstanceLocator, private NonCopyable
 {
+    friend class ServerTester;
+
 public:
     /**
      * This constructor initializes the object.
@@ -99,106 +101,75 @@ private:
         kResolveAdditionalAll  = kResolveAdditionalSrv | kResolveAdditionalTxt | kResolveAdditionalAaaa,
     };
 
-    class NameCompressInfo : public Clearable<NameCompressInfo>
+    // This class maps the names (and each of their suffixes) appended to the response message to their offsets,
+    // so that any later name sharing a suffix with them is compressed into a pointer (RFC 1035 - section 4.1.4).
+    class NameCompressInfo
     {
     public:
         enum : uint16_t
         {
-            kUnknownOffset = 0, // Unknown offset value (used when offset is not yet set).
+            kUnknownOffset = 0, // Unknown offset value (used when the name is not in the message).
         };
 
-        explicit NameCompressInfo(const char *aDomainName)
-            : mDomainName(aDomainName)
-            , mServiceName(nullptr)
-            , mInstanceName(nullptr)
-            , mHostName(nullptr)
-            , mDomainNameOffset(kUnknownOffset)
-            , mServiceNameOffset(kUnknownOffset)
-            , mInstanceNameOffset(kUnknownOffset)
-            , mHostNameOffset(kUnknownOffset)
-        {
-        }
-
-        uint16_t GetDomainNameOffset(void) const { return mDomainNameOffset; }
+        explicit NameCompressInfo(const char *aDomainName);
 
-        void SetDomainNameOffset(uint16_t aOffset) { mDomainNameOffset = aOffset; }
+        // Forgets all the names, to start a new response message.
+        void Clear(void);
 
         const char *GetDomainName(void) const { return mDomainName; }
 
-        uint16_t GetServiceNameOffset(const char *aServiceName) const
-        {
-            uint16_t offset = mServiceNameOffset;
-
-            if (offset != kUnknownOffset && strcmp(aServiceName, mServiceName) != 0)
-            {
-                offset = kUnknownOffset;
-            }
-
-            return offset;
-        };
-
-        void SetServiceNameOffset(uint16_t aOffset, const char *aName)
-        {
-            if (mServiceName == nullptr)
-            {
-                mServiceName       = aName;
-                mServiceNameOffset = aOffset;
-            }
-        }
-
-        const char *GetServiceName() const { return mServiceName; }
-
-        uint16_t GetInstanceNameOffset(const char *aName) const
-        {
-            uint16_t offset = mInstanceNameOffset;
-
-            if (offset != kUnknownOffset && strcmp(aName, mInstanceName) != 0)
-            {
-                offset = kUnknownOffset;
-            }
+        // Returns the offset of `aName` in the message, or `kUnknownOffset` if it was not appended yet.
+        uint16_t GetNameOffset(const char *aName) const;
 
-            return offset;
-        }
+        // Appends `aName` to `aMessage`, replacing its longest suffix already in `aMessage` by a pointer. The first
+        // `aFirstLabelLength` chars of `aName` form a single label (which may contain dots), or the labels are all
+        // separated by dots when it is zero. The labels are encoded in a buffer and appended to `aMessage` at once.
+        otError AppendName(const char *aName, uint8_t aFirstLabelLength, Message &aMessage);
 
-        void SetInstanceNameOffset(uint16_t aOffset, const char *aName)
+    private:
+        enum : uint16_t
         {
-            if (mInstanceName == nullptr)
-            {
-                mInstanceName       = aName;
-                mInstanceNameOffset = aOffset;
-            }
-        }
+            kTableSize       = OPENTHREAD_CONFIG_DNSSD_SERVER_NAME_COMPRESS_TABLE_SIZE,
+            kMaxEntries      = kTableSize * 3 / 4,     // Keep some empty slots to bound the probe sequences.
+            kLabelsSize      = kTableSize * 8,         // Room for the labels text (8 chars per slot on average).
+            kNoEntry         = 0xffff,                 // No entry (end of name, or not found).
+            kMaxOffset       = 0x3fff,                 // Max offset of a pointer label (14 bits).
+            kMaxLabels       = Name::kMaxNameSize / 2, // Max number of labels in a name.
+            kMaxEncodedBytes = Name::kMaxNameSize + 2, // Max encoded name length (labels and a pointer).
+        };
 
-        uint16_t GetHostNameOffset(const char *aName) const
+        enum : uint32_t
         {
-            uint16_t offset = mHostNameOffset;
-
-            if (offset != kUnknownOffset && strcmp(aName, mHostName) != 0)
-            {
-                offset = kUnknownOffset;
-            }
+            kHashMultiplier = 33,
+        };
 
-            return offset;
-        }
+        static_assert((kTableSize & (kTableSize - 1)) == 0, "NAME_COMPRESS_TABLE_SIZE must be a power of two");
 
-        void SetHostNameOffset(uint16_t aOffset, const char *aName)
+        // An entry represents a name suffix in the message by its first label, and the entry of the rest of the
+        // suffix. The label text is copied in `mLabels`, so the names need not outlive the call and the message is
+        // never read back. The hash is a polynomial hash of the whole suffix text, so that it is computed either
+        // forward (looking up a name in a single pass), or backward (hashing all the suffixes of a name at once).
+        struct Entry
         {
-            if (mHostName == nullptr)
-            {
-                mHostName       = aName;
-                mHostNameOffset = aOffset;
-            }
-        }
+            uint16_t mHash;   // Hash of the suffix.
+            uint16_t mOffset; // Offset of the suffix in the message.
+            uint16_t mNext;   // Entry of the rest of the suffix, or `kNoEntry` for the last label.
+            uint16_t mLabel;  // Offset of the first label text in `mLabels`.
+            uint8_t  mLength; // First label length (zero for an empty slot).
+        };
 
-    private:
-        const char *const mDomainName;   // The serialized domain name.
-        const char *      mServiceName;  // The serialized service name (only support one service name).
-        const char *      mInstanceName; // The serialized instance name or nullptr (only support one instance name).
-        const char *      mHostName;     // The serialized host name or nullptr (only support one host name).
-        uint16_t          mDomainNameOffset;   // Offset of domain name serialization into the response message.
-        uint16_t          mServiceNameOffset;  // Offset of service name serialization into the response message.
-        uint16_t          mInstanceNameOffset; // Offset of instance name serialization into the response message.
-        uint16_t          mHostNameOffset;     // Offset of host name serialization into the response message.
+        static uint16_t HashName(const char *aName, uint8_t &aLength);
+        static uint32_t HashChars(uint32_t aHash, uint32_t &aFactor, const char *aChars, uint8_t aLength);
+        static uint16_t FoldHash(uint32_t aHash) { return static_cast<uint16_t>(aHash ^ (aHash >> 16)); }
+        uint16_t        FindEntry(uint16_t aHash, const char *aLabel, uint8_t aLength, uint16_t aNext) const;
+        uint16_t        AddEntry(uint16_t aHash, const char *aLabel, uint8_t aLength, uint16_t aNext, uint16_t aOffset);
+        bool            MatchesSuffix(uint16_t aEntry, const char *aName, uint8_t aLength) const;
+
+        const char *const mDomainName; // The serialized domain name.
+        uint16_t          mNumEntries;
+        uint16_t          mLabelsLength;
+        Entry             mEntries[kTableSize]; // Open addressing hash table.
+        char              mLabels[kLabelsSize];
     };
 
     // This structure represents the splitting information of a full name.
@@ -278,9 +249,22 @@ private:
                                                             Message &         aResponseMessage,
                                                             uint8_t           aResolveKind,
                                                             NameCompressInfo &aCompressInfo);
-    const Srp::Server::Host *          GetNextSrpHost(const Srp::Server::Host *aHost);
+    otError                            ResolveQuestionBySrpHost(const Srp::Server::Host &aHost,
+                                                                const char *             aName,
+                                                                const Question &         aQuestion,
+                                                                Header &                 aResponseHeader,
+                                                                Message &                aResponseMessage,
+                                                                uint8_t                  aResolveKind,
+                                                                NameCompressInfo &       aCompressInfo,
+                                                                Header::Response &       aResponse);
+    const Srp::Server::Service *       FindNextSrpService(const Srp::Server::Service *aService,
+                                                          const char *                aName,
+                                                          uint16_t                    aQueryType);
     static const Srp::Server::Service *GetNextSrpService(const Srp::Server::Host &   aHost,
                                                          const Srp::Server::Service *aService);
+    static bool                        IsFirstSrpServiceOfHost(const Srp::Server::Service &aService,
+                                                               const char *                aName,
+                                                               uint16_t                    aQueryType);
     static otError                     AppendTxtRecord(Message &                   aMessage,
                                                        const char *                aInstanceName,
                                                        const Srp::Server::Service &aService,
@@ -293,6 +277,7 @@ private:
     static const char kDefaultDomainName[];
 
     Ip6::Udp::Socket mSocket;
+    NameCompressInfo mCompressInfo; // Kept off the stack (its table can be large), and cleared for each response.
 };
 
 } // namespace ServiceDiscovery
@@ -88,6 +88,7 @@ Server::Server(Instance &aInstance)
     , mOutstandingUpdatesTimer(aInstance, HandleOutstandingUpdatesTimer)
     , mEnabled(false)
 {
+    ClearNameIndex();
     IgnoreError(SetDomain(kDefaultDomain));
 }
 
@@ -210,38 +211,241 @@ const Server::Host *Server::GetNextHost(const Server::Host *aHost)
 // The caller MUST make sure that there is no existing host with the same hostname.
 void Server::AddHost(Host *aHost)
 {
-    OT_ASSERT(mHosts.FindMatching(aHost->GetFullName()) == nullptr);
+    Service *service = nullptr;
+
+    OT_ASSERT(FindHost(aHost->GetFullName()) == nullptr);
     IgnoreError(mHosts.Add(*aHost));
+
+    AddToNameIndex(*aHost);
+
+    while ((service = aHost->GetNextService(service)) != nullptr)
+    {
+        AddToNameIndex(*service);
+    }
 }
 
 void Server::RemoveAndFreeHost(Host *aHost)
 {
+    Service *service = nullptr;
+
     otLogInfoSrp("[server] fully remove host %s", aHost->GetFullName());
+
+    mLeaseIndex.Remove(*aHost);
+    RemoveFromNameIndex(*aHost);
+
+    while ((service = aHost->GetNextService(service)) != nullptr)
+    {
+        mLeaseIndex.Remove(*service);
+        RemoveFromNameIndex(*service);
+    }
+
     IgnoreError(mHosts.Remove(*aHost));
     aHost->Free();
 }
 
+void Server::RemoveAndFreeService(Host &aHost, Service &aService)
+{
+    mLeaseIndex.Remove(aService);
+    RemoveFromNameIndex(aService);
+    aHost.RemoveAndFreeService(&aService);
+}
+
+// This method re-keys a host and all its services in the lease index after their leases or state changed.
+void Server::UpdateLeaseIndex(Host &aHost)
+{
+    Service *service = nullptr;
+
+    mLeaseIndex.Update(aHost, aHost.GetNextExpireTime());
+
+    while ((service = aHost.GetNextService(service)) != nullptr)
+    {
+        mLeaseIndex.Update(*service, service->GetNextExpireTime());
+    }
+}
+
+const Server::Host *Server::FindHost(const char *aFullName) const
+{
+    uint32_t    hash = HashName(aFullName);
+    const Host *host = mHostNameIndex[hash % kNameIndexSize];
+
+    while (host != nullptr && !(host->mNameHash == hash && host->Matches(aFullName)))
+    {
+        host = host->mNameIndexNext;
+    }
+
+    return host;
+}
+
+Server::Host *Server::FindHost(const char *aFullName)
+{
+    return const_cast<Host *>(const_cast<const Server *>(this)->FindHost(aFullName));
+}
+
 const Server::Service *Server::FindService(const char *aFullName) const
 {
-    const Service *service = nullptr;
+    return FindNextService(nullptr, aFullName);
+}
+
+const Server::Service *Server::FindNextService(const Service *aPrevService, const char *aInstanceName) const
+{
+    uint32_t       hash = HashName(aInstanceName);
+    const Service *service;
 
-    for (const Host *host = mHosts.GetHead(); host != nullptr; host = host->GetNext())
+    service = (aPrevService == nullptr) ? mServiceNameIndex[hash % kNameIndexSize] : aPrevService->mNameIndexNext;
+
+    while (service != nullptr && !(service->mNameHash == hash && service->Matches(aInstanceName)))
     {
-        service = host->FindService(aFullName);
-        if (service != nullptr)
+        service = service->mNameIndexNext;
+    }
+
+    return service;
+}
+
+const Server::Service *Server::FindNextServiceOfType(const Service *aPrevService, const char *aServiceName) const
+{
+    uint32_t       hash = HashName(aServiceName);
+    const Service *service;
+
+    service = (aPrevService == nullptr) ? mServiceTypeIndex[hash % kNameIndexSize] : aPrevService->mTypeIndexNext;
+
+    while (service != nullptr && !(service->mTypeHash == hash && service->MatchesServiceName(aServiceName)))
+    {
+        service = service->mTypeIndexNext;
+    }
+
+    return service;
+}
+
+// DNS names compare case-insensitively, so the hash folds ASCII letters to lower case (FNV-1a).
+uint32_t Server::HashName(const char *aName)
+{
+    uint32_t hash = 2166136261u;
+
+    for (; *aName != '\0'; aName++)
+    {
+        char c = *aName;
+
+        if (c >= 'A' && c <= 'Z')
         {
-            break;
+            c = static_cast<char>(c - 'A' + 'a');
         }
+
+        hash = (hash ^ static_cast<uint8_t>(c)) * 16777619u;
     }
 
-    return service;
+    return hash;
+}
+
+// This method returns the <Service>.<Domain> suffix of a service instance name <Instance>.<Service>.<Domain>. The
+// <Instance> label may itself contain dots, so the two <Service> labels are counted back from the domain.
+const char *Server::GetServiceName(const char *aInstanceName) const
+{
+    const char *serviceName  = aInstanceName;
+    size_t      nameLength   = strlen(aInstanceName);
+    size_t      domainLength = strlen(GetDomain());
+    uint8_t     numLabels    = 0;
+
+    VerifyOrExit(nameLength > domainLength);
+
+    for (size_t i = nameLength - domainLength - 1; i > 0; i--)
+    {
+        if (aInstanceName[i - 1] == '.' && ++numLabels == 2)
+        {
+            ExitNow(serviceName = &aInstanceName[i]);
+        }
+    }
+
+exit:
+    return serviceName;
+}
+
+void Server::AddToNameIndex(Host &aHost)
+{
+    Host **head;
+
+    aHost.mNameHash = HashName(aHost.mFullName);
+    head            = &mHostNameIndex[aHost.mNameHash % kNameIndexSize];
+
+    aHost.mNameIndexNext = *head;
+    *head                = &aHost;
+}
+
+void Server::AddToNameIndex(Service &aService)
+{
+    Service **head;
+
+    aService.mNameHash = HashName(aService.mFullName);
+    head               = &mServiceNameIndex[aService.mNameHash % kNameIndexSize];
+
+    aService.mNameIndexNext = *head;
+    *head                   = &aService;
+
+    aService.mTypeHash = HashName(GetServiceName(aService.mFullName));
+    head               = &mServiceTypeIndex[aService.mTypeHash % kNameIndexSize];
+
+    aService.mTypeIndexNext = *head;
+    *head                   = &aService;
+}
+
+void Server::RemoveFromNameIndex(Host &aHost)
+{
+    Host **link = &mHostNameIndex[aHost.mNameHash % kNameIndexSize];
+
+    while (*link != nullptr && *link != &aHost)
+    {
+        link = &(*link)->mNameIndexNext;
+    }
+
+    if (*link != nullptr)
+    {
+        *link = aHost.mNameIndexNext;
+    }
+
+    aHost.mNameIndexNext = nullptr;
+}
+
+void Server::RemoveFromNameIndex(Service &aService)
+{
+    Service **link = &mServiceNameIndex[aService.mNameHash % kNameIndexSize];
+
+    while (*link != nullptr && *link != &aService)
+    {
+        link = &(*link)->mNameIndexNext;
+    }
+
+    if (*link != nullptr)
+    {
+        *link = aService.mNameIndexNext;
+    }
+
+    link = &mServiceTypeIndex[aService.mTypeHash % kNameIndexSize];
+
+    while (*link != nullptr && *link != &aService)
+    {
+        link = &(*link)->mTypeIndexNext;
+    }
+
+    if (*link != nullptr)
+    {
+        *link = aService.mTypeIndexNext;
+    }
+
+    aService.mNameIndexNext = nullptr;
+    aService.mTypeIndexNext = nullptr;
+}
+
+void Server::ClearNameIndex(void)
+{
+    memset(mHostNameIndex, 0, sizeof(mHostNameIndex));
+    memset(mServiceNameIndex, 0, sizeof(mServiceNameIndex));
+    memset(mServiceTypeIndex, 0, sizeof(mServiceTypeIndex));
 }
 
 bool Server::HasNameConflictsWith(Host &aHost) const
 {
     bool           hasConflicts = false;
     const Service *service      = nullptr;
-    const Host *   existingHost = mHosts.FindMatching(aHost.GetFullName());
+    const Host *   existingHost = FindHost(aHost.GetFullName());
 
     if (existingHost != nullptr && *aHost.GetKey() != *existingHost->GetKey())
     {
@@ -298,7 +502,8 @@ void Server::HandleSrpUpdateResult(otError                  aError,
                                    Host &                   aHost,
                                    const Ip6::MessageInfo & aMessageInfo)
 {
-    Host *   existingHost;
+    Host *   existingHost = nullptr;
+    Host *   updatedHost  = nullptr;
     uint32_t hostLease;
     uint32_t hostKeyLease;
     uint32_t grantedLease;
@@ -314,7 +519,7 @@ void Server::HandleSrpUpdateResult(otError                  aError,
     aHost.SetLease(grantedLease);
     aHost.SetKeyLease(grantedKeyLease);
 
-    existingHost = mHosts.FindMatching(aHost.GetFullName());
+    existingHost = FindHost(aHost.GetFullName());
 
     if (aHost.GetLease() == 0)
     {
@@ -333,6 +538,7 @@ void Server::HandleSrpUpdateResult(otError                  aError,
 
             existingHost->SetLease(aHost.GetLease());
             existingHost->SetKeyLease(aHost.GetKeyLease());
+            updatedHost = existingHost;
 
             // Clear all resources associated to this host and its services.
             existingHost->ClearResources();
@@ -354,6 +560,7 @@ void Server::HandleSrpUpdateResult(otError                  aError,
         otLogInfoSrp("[server] update host %s", existingHost->GetFullName());
 
         existingHost->CopyResourcesFrom(aHost);
+        updatedHost = existingHost;
         while ((service = aHost.GetNextService(service)) != nullptr)
         {
             Service *existingService = existingHost->FindService(service->mFullName);
@@ -370,6 +577,12 @@ void Server::HandleSrpUpdateResult(otError                  aError,
                 Service *newService = existingHost->AddService(service->mFullName);
 
                 VerifyOrExit(newService != nullptr, aError = OT_ERROR_NO_BUFS);
+
+                if (existingService == nullptr)
+                {
+                    AddToNameIndex(*newService);
+                }
+
                 SuccessOrExit(aError = newService->CopyResourcesFrom(*service));
                 otLogInfoSrp("[server] %s service %s", (existingService != nullptr) ? "update existing" : "add new",
                              service->mFullName);
@@ -382,12 +595,17 @@ void Server::HandleSrpUpdateResult(otError                  aError,
     {
         otLogInfoSrp("[server] add new host %s", aHost.GetFullName());
         AddHost(&aHost);
+        updatedHost = &aHost;
     }
 
-    // Re-schedule the lease timer.
-    HandleLeaseTimer();
-
 exit:
+    if (updatedHost != nullptr)
+    {
+        UpdateLeaseIndex(*updatedHost);
+    }
+
+    UpdateLeaseTimer();
+
     if (aError == OT_ERROR_NONE && !(grantedLease == hostLease && grantedKeyLease == hostKeyLease))
     {
         SendResponse(aDnsHeader, grantedLease, grantedKeyLease, aMessageInfo);
@@ -426,6 +644,9 @@ void Server::Stop(void)
 
     UnpublishServerData();
 
+    mLeaseIndex.Clear();
+    ClearNameIndex();
+
     while (!mHosts.IsEmpty())
     {
         mHosts.Pop()->Free();
@@ -967,7 +1188,7 @@ void Server::HandleUpdate(const Dns::UpdateHeader &aDnsHeader, Host *aHost, cons
 
     if (aHost->GetLease() == 0)
     {
-        Host *existingHost = mHosts.FindMatching(aHost->GetFullName());
+        Host *existingHost = FindHost(aHost->GetFullName());
 
         aHost->ClearResources();
 
@@ -1134,113 +1355,87 @@ void Server::HandleLeaseTimer(Timer &aTimer)
 
 void Server::HandleLeaseTimer(void)
 {
-    TimeMilli now                = TimerMilli::GetNow();
-    TimeMilli earliestExpireTime = now.GetDistantFuture();
-    Host *    host               = mHosts.GetHead();
+    TimeMilli   now = TimerMilli::GetNow();
+    LeaseEntry *entry;
 
-    while (host != nullptr)
-    {
-        Host *nextHost = host->GetNext();
+    // Only the hosts and services whose LEASE or KEY-LEASE expired are visited, in the order they expired.
 
-        if (host->GetKeyExpireTime() <= now)
+    while ((entry = mLeaseIndex.GetTop()) != nullptr && entry->GetHeapKey() <= now)
+    {
+        if (entry->mIsHost)
         {
-            otLogInfoSrp("[server] KEY LEASE of host %s expired", host->GetFullName());
-
-            // Removes the whole host and all services if the KEY RR expired.
-            RemoveAndFreeHost(host);
+            HandleHostLeaseExpiry(*static_cast<Host *>(entry), now);
         }
-        else if (host->IsDeleted())
+        else
         {
-            // The host has been deleted, but the hostname & service instance names retain.
-
-            Service *service;
-
-            earliestExpireTime = OT_MIN(earliestExpireTime, host->GetKeyExpireTime());
-
-            // Check if any service instance name expired.
-            service = host->GetNextService(nullptr);
-            while (service != nullptr)
-            {
-                OT_ASSERT(service->mIsDeleted);
-
-                Service *nextService = service->GetNext();
-
-                if (service->GetKeyExpireTime() <= now)
-                {
-                    otLogInfoSrp("[server] KEY LEASE of service %s expired", service->mFullName);
-                    host->RemoveAndFreeService(service);
-                }
-                else
-                {
-                    earliestExpireTime = OT_MIN(earliestExpireTime, service->GetKeyExpireTime());
-                }
-
-                service = nextService;
-            }
+            HandleServiceLeaseExpiry(*static_cast<Service *>(entry), now);
         }
-        else if (host->GetExpireTime() <= now)
-        {
-            Service *service = nullptr;
+    }
 
-            otLogInfoSrp("[server] LEASE of host %s expired", host->GetFullName());
+    UpdateLeaseTimer();
+}
 
-            // If the host expired, delete all resources of this host and its services.
-            host->DeleteResourcesButRetainName();
-            while ((service = host->GetNextService(service)) != nullptr)
-            {
-                service->DeleteResourcesButRetainName();
-            }
+void Server::HandleHostLeaseExpiry(Host &aHost, TimeMilli aNow)
+{
+    Service *service = nullptr;
 
-            earliestExpireTime = OT_MIN(earliestExpireTime, host->GetKeyExpireTime());
-        }
-        else
-        {
-            // The host doesn't expire, check if any service expired or is explicitly removed.
+    if (aHost.GetKeyExpireTime() <= aNow)
+    {
+        otLogInfoSrp("[server] KEY LEASE of host %s expired", aHost.GetFullName());
 
-            OT_ASSERT(!host->IsDeleted());
+        // Removes the whole host and all services if the KEY RR expired.
+        RemoveAndFreeHost(&aHost);
+        ExitNow();
+    }
 
-            Service *service = host->GetNextService(nullptr);
+    OT_ASSERT(!aHost.IsDeleted());
 
-            earliestExpireTime = OT_MIN(earliestExpireTime, host->GetExpireTime());
+    otLogInfoSrp("[server] LEASE of host %s expired", aHost.GetFullName());
 
-            while (service != nullptr)
-            {
-                Service *nextService = service->GetNext();
+    // If the host expired, delete all resources of this host and its services.
+    aHost.DeleteResourcesButRetainName();
+    while ((service = aHost.GetNextService(service)) != nullptr)
+    {
+        service->DeleteResourcesButRetainName();
+    }
 
-                if (service->mIsDeleted)
-                {
-                    // The service has been deleted but the name retains.
-                    earliestExpireTime = OT_MIN(earliestExpireTime, service->GetKeyExpireTime());
-                }
-                else if (service->GetExpireTime() <= now)
-                {
-                    otLogInfoSrp("[server] LEASE of service %s expired", service->mFullName);
+    UpdateLeaseIndex(aHost);
 
-                    // The service gets expired, delete it.
-                    service->DeleteResourcesButRetainName();
-                    earliestExpireTime = OT_MIN(earliestExpireTime, service->GetKeyExpireTime());
-                }
-                else
-                {
-                    earliestExpireTime = OT_MIN(earliestExpireTime, service->GetExpireTime());
-                }
+exit:
+    return;
+}
 
-                service = nextService;
-            }
-        }
+void Server::HandleServiceLeaseExpiry(Service &aService, TimeMilli aNow)
+{
+    if (aService.GetKeyExpireTime() <= aNow)
+    {
+        otLogInfoSrp("[server] KEY LEASE of service %s expired", aService.mFullName);
+        RemoveAndFreeService(*static_cast<Host *>(aService.mHost), aService);
+    }
+    else
+    {
+        otLogInfoSrp("[server] LEASE of service %s expired", aService.mFullName);
 
-        host = nextHost;
+        // The service gets expired, delete it.
+        aService.DeleteResourcesButRetainName();
+        mLeaseIndex.Update(aService, aService.GetNextExpireTime());
     }
+}
 
-    if (earliestExpireTime != now.GetDistantFuture())
+void Server::UpdateLeaseTimer(void)
+{
+    if (!mLeaseIndex.IsEmpty())
     {
-        if (!mLeaseTimer.IsRunning() || earliestExpireTime <= mLeaseTimer.GetFireTime())
+        TimeMilli earliestExpireTime = mLeaseIndex.GetTop()->GetHeapKey();
+
+        if (!mLeaseTimer.IsRunning() || earliestExpireTime != mLeaseTimer.GetFireTime())
         {
-            otLogInfoSrp("[server] lease timer is scheduled for %u seconds", (earliestExpireTime - now) / 1000);
+            otLogInfoSrp("[server] lease timer is scheduled for %u seconds",
+                         (earliestExpireTime - TimerMilli::GetNow()) / 1000);
             mLeaseTimer.StartAt(earliestExpireTime, 0);
         }
     }
-    else
+    else if (mLeaseTimer.IsRunning())
     {
         otLogInfoSrp("[server] lease timer is stopped");
         mLeaseTimer.Stop();
@@ -1288,7 +1483,8 @@ void Server::Service::Free(void)
 }
 
 Server::Service::Service(void)
-    : mFullName(nullptr)
+    : LeaseEntry(/* aIsHost */ false)
+    , mFullName(nullptr)
     , mPriority(0)
     , mWeight(0)
     , mPort(0)
@@ -1296,6 +1492,10 @@ Server::Service::Service(void)
     , mTxtData(nullptr)
     , mHost(nullptr)
     , mNext(nullptr)
+    , mNameIndexNext(nullptr)
+    , mTypeIndexNext(nullptr)
+    , mNameHash(0)
+    , mTypeHash(0)
     , mTimeLastUpdate(TimerMilli::GetNow())
 {
 }
@@ -1330,6 +1530,18 @@ TimeMilli Server::Service::GetKeyExpireTime(void) const
     return mTimeLastUpdate + Time::SecToMsec(GetHost().GetKeyLease());
 }
 
+TimeMilli Server::Service::GetNextExpireTime(void) const
+{
+    TimeMilli expireTime = GetKeyExpireTime();
+
+    if (!mIsDeleted && !GetHost().IsDeleted())
+    {
+        expireTime = OT_MIN(expireTime, GetExpireTime());
+    }
+
+    return expireTime;
+}
+
 otError Server::Service::SetTxtData(const uint8_t *aTxtData, uint16_t aTxtDataLength)
 {
     otError  error = OT_ERROR_NONE;
@@ -1448,9 +1660,12 @@ void Server::Host::Free(void)
 }
 
 Server::Host::Host(void)
-    : mFullName(nullptr)
+    : LeaseEntry(/* aIsHost */ true)
+    , mFullName(nullptr)
     , mAddressesNum(0)
     , mNext(nullptr)
+    , mNameIndexNext(nullptr)
+    , mNameHash(0)
     , mLease(0)
     , mKeyLease(0)
     , mTimeLastUpdate(TimerMilli::GetNow())
@@ -1507,6 +1722,11 @@ TimeMilli Server::Host::GetKeyExpireTime(void) const
     return mTimeLastUpdate + Time::SecToMsec(mKeyLease);
 }
 
+TimeMilli Server::Host::GetNextExpireTime(void) const
+{
+    return IsDeleted() ? GetKeyExpireTime() : OT_MIN(GetKeyExpireTime(), GetExpireTime());
+}
+
 // Add a new service entry to the host, do nothing if there is already
 // such services with the same name.
 Server::Service *Server::Host::AddService(const char *aFullName)
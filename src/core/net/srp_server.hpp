@@ -54,6 +54,7 @@
 #include "common/locator.hpp"
 #include "common/non_copyable.hpp"
 #include "common/notifier.hpp"
+#include "common/pairing_heap.hpp"
 #include "common/timer.hpp"
 #include "crypto/ecdsa.hpp"
 #include "net/dns_types.hpp"
@@ -71,6 +72,26 @@ namespace Srp {
 class Server : public InstanceLocator, private NonCopyable
 {
     friend class ot::Notifier;
+    friend class ServerTester;
+
+    /**
+     * This class represents an entry in the lease index, i.e., a host or a service keyed by the next time its LEASE
+     * or KEY-LEASE expires.
+     *
+     */
+    class LeaseEntry : public PairingHeapEntry<LeaseEntry, TimeMilli>
+    {
+        friend class Server;
+
+    protected:
+        explicit LeaseEntry(bool aIsHost)
+            : mIsHost(aIsHost)
+        {
+        }
+
+    private:
+        bool mIsHost; // Whether the entry is a `Host` or a `Service`.
+    };
 
 public:
     class Host;
@@ -80,10 +101,11 @@ public:
      * This class implements a server-side SRP service.
      *
      */
-    class Service : public LinkedListEntry<Service>, private NonCopyable
+    class Service : public LinkedListEntry<Service>, public LeaseEntry, private NonCopyable
     {
         friend class LinkedListEntry<Service>;
         friend class Server;
+        friend class ServerTester;
 
     public:
         /**
@@ -212,12 +234,13 @@ public:
 
     private:
         explicit Service(void);
-        otError SetFullName(const char *aFullName);
-        otError SetTxtData(const uint8_t *aTxtData, uint16_t aTxtDataLength);
-        otError SetTxtDataFromMessage(const Message &aMessage, uint16_t aOffset, uint16_t aLength);
-        otError CopyResourcesFrom(const Service &aService);
-        void    ClearResources(void);
-        void    DeleteResourcesButRetainName(void);
+        otError   SetFullName(const char *aFullName);
+        otError   SetTxtData(const uint8_t *aTxtData, uint16_t aTxtDataLength);
+        otError   SetTxtDataFromMessage(const Message &aMessage, uint16_t aOffset, uint16_t aLength);
+        otError   CopyResourcesFrom(const Service &aService);
+        void      ClearResources(void);
+        void      DeleteResourcesButRetainName(void);
+        TimeMilli GetNextExpireTime(void) const;
 
         char *           mFullName;
         uint16_t         mPriority;
@@ -227,6 +250,10 @@ public:
         uint8_t *        mTxtData;
         otSrpServerHost *mHost;
         Service *        mNext;
+        Service *        mNameIndexNext; // Next service in the same bucket of the service instance name index.
+        Service *        mTypeIndexNext; // Next service in the same bucket of the service name index.
+        uint32_t         mNameHash;
+        uint32_t         mTypeHash;
         TimeMilli        mTimeLastUpdate;
         bool             mIsDeleted;
     };
@@ -235,10 +262,11 @@ public:
      * This class implements the Host which registers services on the SRP server.
      *
      */
-    class Host : public LinkedListEntry<Host>, private NonCopyable
+    class Host : public LinkedListEntry<Host>, public LeaseEntry, private NonCopyable
     {
         friend class LinkedListEntry<Host>;
         friend class Server;
+        friend class ServerTester;
 
     public:
         /**
@@ -374,11 +402,14 @@ public:
         Service *FindService(const char *aFullName);
         const Service *FindService(const char *aFullName) const;
         otError        AddIp6Address(const Ip6::Address &aIp6Address);
+        TimeMilli      GetNextExpireTime(void) const;
 
         char *       mFullName;
         Ip6::Address mAddresses[kMaxAddressesNum];
         uint8_t      mAddressesNum;
         Host *       mNext;
+        Host *       mNameIndexNext; // Next host in the same bucket of the host name index.
+        uint32_t     mNameHash;
 
         Dns::Ecdsa256KeyRecord mKey;
         uint32_t               mLease;    // The LEASE time in seconds.
@@ -481,6 +512,57 @@ public:
      */
     const Host *GetNextHost(const Host *aHost);
 
+    /**
+     * This method finds a registered SRP host by its full name.
+     *
+     * A host which has been deleted but retains its name is also found.
+     *
+     * @param[in]  aFullName  The full name of the host.
+     *
+     * @returns  A pointer to the SRP host or nullptr if no host is registered with @p aFullName.
+     *
+     */
+    const Host *FindHost(const char *aFullName) const;
+
+    /**
+     * This method finds a registered SRP host by its full name.
+     *
+     * A host which has been deleted but retains its name is also found.
+     *
+     * @param[in]  aFullName  The full name of the host.
+     *
+     * @returns  A pointer to the SRP host or nullptr if no host is registered with @p aFullName.
+     *
+     */
+    Host *FindHost(const char *aFullName);
+
+    /**
+     * This method finds the next registered SRP service with a given service instance full name.
+     *
+     * Services which have been deleted but retain their name are also found.
+     *
+     * @param[in]  aPrevService   The previously found SRP service; use nullptr to find the first one.
+     * @param[in]  aInstanceName  The full service instance name <Instance>.<Service>.<Domain>.
+     *
+     * @returns  A pointer to the next SRP service or nullptr if no more SRP services can be found.
+     *
+     */
+    const Service *FindNextService(const Service *aPrevService, const char *aInstanceName) const;
+
+    /**
+     * This method finds the next registered SRP service of a given service name, i.e., the services a PTR query for
+     * @p aServiceName browses.
+     *
+     * Services which have been deleted but retain their name are also found.
+     *
+     * @param[in]  aPrevService  The previously found SRP service; use nullptr to find the first one.
+     * @param[in]  aServiceName  The full service name <Service>.<Domain>.
+     *
+     * @returns  A pointer to the next SRP service or nullptr if no more SRP services can be found.
+     *
+     */
+    const Service *FindNextServiceOfType(const Service *aPrevService, const char *aServiceName) const;
+
     /**
      * This method receives the service advertising result.
      *
@@ -494,6 +576,7 @@ private:
     enum : uint16_t
     {
         kUdpPayloadSize = Ip6::Ip6::kMaxDatagramLength - sizeof(Ip6::Udp::Header), // Max UDP payload size
+        kNameIndexSize  = OPENTHREAD_CONFIG_SRP_SERVER_NAME_INDEX_SIZE,              // Buckets per name index.
     };
 
     enum : uint32_t
@@ -594,9 +677,22 @@ private:
     static bool    IsValidDeleteAllRecord(const Dns::ResourceRecord &aRecord);
     const Service *FindService(const char *aFullName) const;
 
+    static uint32_t HashName(const char *aName);
+    const char *    GetServiceName(const char *aInstanceName) const;
+    void            AddToNameIndex(Host &aHost);
+    void            AddToNameIndex(Service &aService);
+    void            RemoveFromNameIndex(Host &aHost);
+    void            RemoveFromNameIndex(Service &aService);
+    void            ClearNameIndex(void);
+
     void        HandleUpdate(const Dns::UpdateHeader &aDnsHeader, Host *aHost, const Ip6::MessageInfo &aMessageInfo);
     void        AddHost(Host *aHost);
     void        RemoveAndFreeHost(Host *aHost);
+    void        RemoveAndFreeService(Host &aHost, Service &aService);
+    void        UpdateLeaseIndex(Host &aHost);
+    void        UpdateLeaseTimer(void);
+    void        HandleHostLeaseExpiry(Host &aHost, TimeMilli aNow);
+    void        HandleServiceLeaseExpiry(Service &aService, TimeMilli aNow);
     bool        HasNameConflictsWith(Host &aHost) const;
     void        SendResponse(const Dns::UpdateHeader &   aHeader,
                              Dns::UpdateHeader::Response aResponseCode,
@@ -626,8 +722,15 @@ private:
     uint32_t mMinKeyLease; // The minimum key-lease time in seconds.
     uint32_t mMaxKeyLease; // The maximum key-lease time in seconds.
 
-    LinkedList<Host> mHosts;
-    TimerMilli       mLeaseTimer;
+    LinkedList<Host>                   mHosts;
+    PairingHeap<LeaseEntry, TimeMilli> mLeaseIndex;
+    TimerMilli                         mLeaseTimer;
+
+    // Hash indices of the registered hosts by full name, and of their services by instance full name and by service
+    // name. Each bucket holds the first entry of a chain linked through the hosts and services themselves.
+    Host *   mHostNameIndex[kNameIndexSize];
+    Service *mServiceNameIndex[kNameIndexSize];
+    Service *mServiceTypeIndex[kNameIndexSize];
 
     TimerMilli                 mOutstandingUpdatesTimer;
     LinkedList<UpdateMetadata> mOutstandingUpdates;
@@ -57,8 +57,23 @@ AddressResolver::AddressResolver(Instance &aInstance)
     , mAddressQuery(UriPath::kAddressQuery, &AddressResolver::HandleAddressQuery, this)
     , mAddressNotification(UriPath::kAddressNotify, &AddressResolver::HandleAddressNotification, this)
     , mCacheEntryPool(aInstance)
+    , mCachedList(kListCached)
+    , mSnoopedList(kListSnooped)
+    , mQueryList(kListQuery)
+    , mQueryRetryList(kListQueryRetry)
+    , mNumNonEvictableSnooped(0)
     , mIcmpHandler(&AddressResolver::HandleIcmpReceive, this)
 {
+    for (uint16_t &head : mEidIndex)
+    {
+        head = kNoIndex;
+    }
+
+    for (uint16_t &head : mRouterIndex)
+    {
+        head = kNoIndex;
+    }
+
     Get<Tmf::TmfAgent>().AddResource(mAddressError);
     Get<Tmf::TmfAgent>().AddResource(mAddressQuery);
     Get<Tmf::TmfAgent>().AddResource(mAddressNotification);
@@ -81,9 +96,12 @@ void AddressResolver::Clear(void)
                 Get<MeshForwarder>().HandleResolved(entry->GetTarget(), OT_ERROR_DROP);
             }
 
+            RemoveFromIndex(*entry);
             mCacheEntryPool.Free(*entry);
         }
     }
+
+    mNumNonEvictableSnooped = 0;
 }
 
 otError AddressResolver::GetNextCacheEntry(EntryInfo &aInfo, Iterator &aIterator) const
@@ -176,55 +194,159 @@ void AddressResolver::Remove(uint16_t aRloc16)
     Remove(aRloc16, /* aMatchRouterId */ false);
 }
 
-AddressResolver::CacheEntry *AddressResolver::GetEntryAfter(CacheEntry *aPrev, CacheEntryList &aList)
+void AddressResolver::Remove(Mac::ShortAddress aRloc16, bool aMatchRouterId)
 {
-    return (aPrev == nullptr) ? aList.GetHead() : aPrev->GetNext();
+    CacheEntry *next;
+
+    // All entries whose RLOC16 belongs to the same router (the router
+    // itself or any of its children) share one chain in the router
+    // index, so only that chain needs to be checked.
+
+    for (CacheEntry *entry = GetCacheEntry(GetRouterIndexHead(aRloc16)); entry != nullptr; entry = next)
+    {
+        CacheEntryList &list = GetList(entry->GetListId());
+
+        next = entry->GetNextInRouterIndex();
+
+        if ((&list != &mCachedList) && (&list != &mSnoopedList))
+        {
+            continue;
+        }
+
+        if ((aMatchRouterId && Mle::Mle::RouterIdMatch(entry->GetRloc16(), aRloc16)) ||
+            (!aMatchRouterId && (entry->GetRloc16() == aRloc16)))
+        {
+            RemoveCacheEntry(*entry, list, aMatchRouterId ? kReasonRemovingRouterId : kReasonRemovingRloc16);
+            mCacheEntryPool.Free(*entry);
+        }
+    }
 }
 
-void AddressResolver::Remove(Mac::ShortAddress aRloc16, bool aMatchRouterId)
+AddressResolver::CacheEntry *AddressResolver::FindCacheEntry(const Ip6::Address &aEid, CacheEntryList *&aList)
 {
-    CacheEntryList *lists[] = {&mCachedList, &mSnoopedList};
+    CacheEntry *entry;
 
-    for (CacheEntryList *list : lists)
+    for (entry = GetCacheEntry(GetEidIndexHead(aEid)); entry != nullptr; entry = entry->GetNextInEidIndex())
     {
-        CacheEntry *prev = nullptr;
-        CacheEntry *entry;
+        if (entry->Matches(aEid))
+        {
+            aList = &GetList(entry->GetListId());
+            break;
+        }
+    }
 
-        while ((entry = GetEntryAfter(prev, *list)) != nullptr)
+    return entry;
+}
+
+AddressResolver::CacheEntryList &AddressResolver::GetList(ListId aListId)
+{
+    CacheEntryList *lists[] = {&mCachedList, &mSnoopedList, &mQueryList, &mQueryRetryList};
+
+    OT_ASSERT(aListId < kListNone);
+
+    return *lists[aListId];
+}
+
+AddressResolver::CacheEntry *AddressResolver::GetCacheEntry(uint16_t aIndex)
+{
+    return (aIndex == kNoIndex) ? nullptr : &mCacheEntryPool.GetEntryAt(aIndex);
+}
+
+uint16_t AddressResolver::GetCacheEntryIndex(const CacheEntry *aEntry) const
+{
+    return (aEntry == nullptr) ? static_cast<uint16_t>(kNoIndex) : mCacheEntryPool.GetIndexOf(*aEntry);
+}
+
+uint16_t &AddressResolver::GetEidIndexHead(const Ip6::Address &aEid)
+{
+    // EIDs in a Thread network mostly share their prefix, so only the
+    // IID bytes are mixed into the hash.
+
+    const uint8_t *iid  = aEid.GetIid().GetBytes();
+    uint32_t       hash = 0;
+
+    for (uint8_t i = 0; i < Ip6::InterfaceIdentifier::kSize; i++)
+    {
+        hash = (hash * 31) + iid[i];
+    }
+
+    return mEidIndex[hash % kEidIndexSize];
+}
+
+uint16_t &AddressResolver::GetRouterIndexHead(Mac::ShortAddress aRloc16)
+{
+    return mRouterIndex[Mle::Mle::RouterIdFromRloc16(aRloc16)];
+}
+
+void AddressResolver::AddToIndex(CacheEntry &aEntry)
+{
+    uint16_t &eidHead    = GetEidIndexHead(aEntry.GetTarget());
+    uint16_t &routerHead = GetRouterIndexHead(aEntry.GetRloc16());
+
+    aEntry.SetNextInEidIndex(GetCacheEntry(eidHead));
+    eidHead = GetCacheEntryIndex(&aEntry);
+
+    aEntry.SetNextInRouterIndex(GetCacheEntry(routerHead));
+    routerHead = GetCacheEntryIndex(&aEntry);
+}
+
+void AddressResolver::RemoveFromIndex(CacheEntry &aEntry)
+{
+    uint16_t &  eidHead    = GetEidIndexHead(aEntry.GetTarget());
+    uint16_t &  routerHead = GetRouterIndexHead(aEntry.GetRloc16());
+    CacheEntry *prev;
+
+    prev = nullptr;
+
+    for (CacheEntry *entry = GetCacheEntry(eidHead); entry != nullptr; entry = entry->GetNextInEidIndex())
+    {
+        if (entry == &aEntry)
         {
-            if ((aMatchRouterId && Mle::Mle::RouterIdMatch(entry->GetRloc16(), aRloc16)) ||
-                (!aMatchRouterId && (entry->GetRloc16() == aRloc16)))
+            if (prev == nullptr)
             {
-                RemoveCacheEntry(*entry, *list, prev, aMatchRouterId ? kReasonRemovingRouterId : kReasonRemovingRloc16);
-                mCacheEntryPool.Free(*entry);
-
-                // If the entry is removed from list, we keep the same
-                // `prev` pointer.
+                eidHead = GetCacheEntryIndex(aEntry.GetNextInEidIndex());
             }
             else
             {
-                prev = entry;
+                prev->SetNextInEidIndex(aEntry.GetNextInEidIndex());
             }
+
+            break;
         }
+
+        prev = entry;
     }
-}
 
-AddressResolver::CacheEntry *AddressResolver::FindCacheEntry(const Ip6::Address &aEid,
-                                                             CacheEntryList *&   aList,
-                                                             CacheEntry *&       aPrevEntry)
-{
-    CacheEntry *    entry   = nullptr;
-    CacheEntryList *lists[] = {&mCachedList, &mSnoopedList, &mQueryList, &mQueryRetryList};
+    prev = nullptr;
 
-    for (CacheEntryList *list : lists)
+    for (CacheEntry *entry = GetCacheEntry(routerHead); entry != nullptr; entry = entry->GetNextInRouterIndex())
     {
-        aList = list;
-        entry = aList->FindMatching(aEid, aPrevEntry);
-        VerifyOrExit(entry == nullptr);
+        if (entry == &aEntry)
+        {
+            if (prev == nullptr)
+            {
+                routerHead = GetCacheEntryIndex(aEntry.GetNextInRouterIndex());
+            }
+            else
+            {
+                prev->SetNextInRouterIndex(aEntry.GetNextInRouterIndex());
+            }
+
+            break;
+        }
+
+        prev = entry;
     }
+}
 
-exit:
-    return entry;
+void AddressResolver::UpdateRloc16(CacheEntry &aEntry, Mac::ShortAddress aRloc16)
+{
+    // The entry is re-linked in the router index since the new RLOC16
+    // may belong to a different router.
+
+    RemoveFromIndex(aEntry);
+    aEntry.SetRloc16(aRloc16);
+    AddToIndex(aEntry);
 }
 
 void AddressResolver::Remove(const Ip6::Address &aEid)
@@ -235,13 +357,12 @@ void AddressResolver::Remove(const Ip6::Address &aEid)
 void AddressResolver::Remove(const Ip6::Address &aEid, Reason aReason)
 {
     CacheEntry *    entry;
-    CacheEntry *    prev;
     CacheEntryList *list;
 
-    entry = FindCacheEntry(aEid, list, prev);
+    entry = FindCacheEntry(aEid, list);
     VerifyOrExit(entry != nullptr);
 
-    RemoveCacheEntry(*entry, *list, prev, aReason);
+    RemoveCacheEntry(*entry, *list, aReason);
     mCacheEntryPool.Free(*entry);
 
 exit:
@@ -250,9 +371,8 @@ exit:
 
 AddressResolver::CacheEntry *AddressResolver::NewCacheEntry(bool aSnoopedEntry)
 {
-    CacheEntry *    newEntry  = nullptr;
-    CacheEntry *    prevEntry = nullptr;
-    CacheEntryList *lists[]   = {&mSnoopedList, &mQueryRetryList, &mQueryList, &mCachedList};
+    CacheEntry *    newEntry = nullptr;
+    CacheEntryList *lists[]  = {&mSnoopedList, &mQueryRetryList, &mQueryList, &mCachedList};
 
     // The following order is used when trying to allocate a new cache
     // entry: First the cache pool is checked, followed by the list
@@ -270,11 +390,12 @@ AddressResolver::CacheEntry *AddressResolver::NewCacheEntry(bool aSnoopedEntry)
 
     for (CacheEntryList *list : lists)
     {
-        CacheEntry *prev;
-        CacheEntry *entry;
-        uint16_t    numNonEvictable = 0;
+        uint16_t numNonEvictable = 0;
+
+        // The list is searched backwards from its tail so the search
+        // stops at the oldest evictable entry.
 
-        for (prev = nullptr; (entry = GetEntryAfter(prev, *list)) != nullptr; prev = entry)
+        for (CacheEntry *entry = list->GetTail(); entry != nullptr; entry = entry->GetPrev())
         {
             if ((list != &mCachedList) && !entry->CanEvict())
             {
@@ -282,13 +403,13 @@ AddressResolver::CacheEntry *AddressResolver::NewCacheEntry(bool aSnoopedEntry)
                 continue;
             }
 
-            newEntry  = entry;
-            prevEntry = prev;
+            newEntry = entry;
+            break;
         }
 
         if (newEntry != nullptr)
         {
-            RemoveCacheEntry(*newEntry, *list, prevEntry, kReasonEvictingForNewEntry);
+            RemoveCacheEntry(*newEntry, *list, kReasonEvictingForNewEntry);
             ExitNow();
         }
 
@@ -314,12 +435,10 @@ exit:
     return newEntry;
 }
 
-void AddressResolver::RemoveCacheEntry(CacheEntry &    aEntry,
-                                       CacheEntryList &aList,
-                                       CacheEntry *    aPrevEntry,
-                                       Reason          aReason)
+void AddressResolver::RemoveCacheEntry(CacheEntry &aEntry, CacheEntryList &aList, Reason aReason)
 {
-    aList.PopAfter(aPrevEntry);
+    UnlinkCacheEntry(aEntry, aList);
+    RemoveFromIndex(aEntry);
 
     if (&aList == &mQueryList)
     {
@@ -329,20 +448,29 @@ void AddressResolver::RemoveCacheEntry(CacheEntry &    aEntry,
     LogCacheEntryChange(kEntryRemoved, aReason, aEntry, &aList);
 }
 
+void AddressResolver::UnlinkCacheEntry(CacheEntry &aEntry, CacheEntryList &aList)
+{
+    aList.Remove(aEntry);
+
+    if ((&aList == &mSnoopedList) && !aEntry.CanEvict())
+    {
+        mNumNonEvictableSnooped--;
+    }
+}
+
 otError AddressResolver::UpdateCacheEntry(const Ip6::Address &aEid, Mac::ShortAddress aRloc16)
 {
     otError         error = OT_ERROR_NONE;
     CacheEntryList *list;
     CacheEntry *    entry;
-    CacheEntry *    prev;
 
-    entry = FindCacheEntry(aEid, list, prev);
+    entry = FindCacheEntry(aEid, list);
     VerifyOrExit(entry != nullptr, error = OT_ERROR_NOT_FOUND);
 
     if ((list == &mCachedList) || (list == &mSnoopedList))
     {
         VerifyOrExit(entry->GetRloc16() != aRloc16);
-        entry->SetRloc16(aRloc16);
+        UpdateRloc16(*entry, aRloc16);
     }
     else
     {
@@ -350,9 +478,9 @@ otError AddressResolver::UpdateCacheEntry(const Ip6::Address &aEid, Mac::ShortAd
         // from its current list, update it, and then add it to the
         // `mCachedList`.
 
-        list->PopAfter(prev);
+        UnlinkCacheEntry(*entry, *list);
 
-        entry->SetRloc16(aRloc16);
+        UpdateRloc16(*entry, aRloc16);
         entry->MarkLastTransactionTimeAsInvalid();
         mCachedList.Push(*entry);
 
@@ -367,27 +495,20 @@ exit:
 
 void AddressResolver::AddSnoopedCacheEntry(const Ip6::Address &aEid, Mac::ShortAddress aRloc16)
 {
-    uint16_t    numNonEvictable = 0;
     CacheEntry *entry;
 
     entry = NewCacheEntry(/* aSnoopedEntry */ true);
     VerifyOrExit(entry != nullptr);
 
-    for (CacheEntry *snooped = mSnoopedList.GetHead(); snooped != nullptr; snooped = snooped->GetNext())
-    {
-        if (!snooped->CanEvict())
-        {
-            numNonEvictable++;
-        }
-    }
-
     entry->SetTarget(aEid);
     entry->SetRloc16(aRloc16);
+    AddToIndex(*entry);
 
-    if (numNonEvictable < kMaxNonEvictableSnoopedEntries)
+    if (mNumNonEvictableSnooped < kMaxNonEvictableSnoopedEntries)
     {
         entry->SetCanEvict(false);
         entry->SetTimeout(kSnoopBlockEvictionTimeout);
+        mNumNonEvictableSnooped++;
 
         Get<TimeTicker>().RegisterReceiver(TimeTicker::kAddressResolver);
     }
@@ -407,25 +528,17 @@ exit:
 
 void AddressResolver::RestartAddressQueries(void)
 {
-    CacheEntry *tail;
+    CacheEntry *retryEntry;
 
     // We move all entries from `mQueryRetryList` at the tail of
     // `mQueryList` and then (re)send Address Query for all entries in
     // the updated `mQueryList`.
 
-    tail = mQueryList.GetTail();
-
-    if (tail == nullptr)
-    {
-        mQueryList.SetHead(mQueryRetryList.GetHead());
-    }
-    else
+    while ((retryEntry = mQueryRetryList.Pop()) != nullptr)
     {
-        tail->SetNext(mQueryRetryList.GetHead());
+        mQueryList.PushTail(*retryEntry);
     }
 
-    mQueryRetryList.Clear();
-
     for (CacheEntry *entry = mQueryList.GetHead(); entry != nullptr; entry = entry->GetNext())
     {
         IgnoreError(SendAddressQuery(entry->GetTarget()));
@@ -440,10 +553,9 @@ otError AddressResolver::Resolve(const Ip6::Address &aEid, Mac::ShortAddress &aR
 {
     otError         error = OT_ERROR_NONE;
     CacheEntry *    entry;
-    CacheEntry *    prev = nullptr;
-    CacheEntryList *list;
+    CacheEntryList *list = nullptr;
 
-    entry = FindCacheEntry(aEid, list, prev);
+    entry = FindCacheEntry(aEid, list);
 
     if (entry == nullptr)
     {
@@ -460,6 +572,7 @@ otError AddressResolver::Resolve(const Ip6::Address &aEid, Mac::ShortAddress &aR
         entry->SetRloc16(Mac::kShortAddrInvalid);
         entry->SetRetryDelay(kAddressQueryInitialRetryDelay);
         entry->SetCanEvict(false);
+        AddToIndex(*entry);
         list = nullptr;
     }
 
@@ -468,7 +581,7 @@ otError AddressResolver::Resolve(const Ip6::Address &aEid, Mac::ShortAddress &aR
         // Remove the entry from its current list and push it at the
         // head of cached list.
 
-        list->PopAfter(prev);
+        UnlinkCacheEntry(*entry, *list);
 
         if (list == &mSnoopedList)
         {
@@ -497,13 +610,19 @@ otError AddressResolver::Resolve(const Ip6::Address &aEid, Mac::ShortAddress &aR
         // expired.
 
         VerifyOrExit(entry->IsTimeoutZero(), error = OT_ERROR_DROP);
-        mQueryRetryList.PopAfter(prev);
+        UnlinkCacheEntry(*entry, mQueryRetryList);
     }
 
     entry->SetTimeout(kAddressQueryTimeout);
 
     error = SendAddressQuery(aEid);
-    VerifyOrExit(error == OT_ERROR_NONE, mCacheEntryPool.Free(*entry));
+
+    if (error != OT_ERROR_NONE)
+    {
+        RemoveFromIndex(*entry);
+        mCacheEntryPool.Free(*entry);
+        ExitNow();
+    }
 
     if (list == nullptr)
     {
@@ -573,7 +692,6 @@ void AddressResolver::HandleAddressNotification(Coap::Message &aMessage, const I
     uint32_t                 lastTransactionTime;
     CacheEntryList *         list;
     CacheEntry *             entry;
-    CacheEntry *             prev;
 
     VerifyOrExit(aMessage.IsConfirmablePostRequest());
 
@@ -595,7 +713,7 @@ void AddressResolver::HandleAddressNotification(Coap::Message &aMessage, const I
     otLogInfoArp("Received address notification from 0x%04x for %s to 0x%04x",
                  aMessageInfo.GetPeerAddr().GetIid().GetLocator(), target.ToString().AsCString(), rloc16);
 
-    entry = FindCacheEntry(target, list, prev);
+    entry = FindCacheEntry(target, list);
     VerifyOrExit(entry != nullptr);
 
     if (list == &mCachedList)
@@ -613,11 +731,12 @@ void AddressResolver::HandleAddressNotification(Coap::Message &aMessage, const I
         }
     }
 
-    entry->SetRloc16(rloc16);
+    UnlinkCacheEntry(*entry, *list);
+
+    UpdateRloc16(*entry, rloc16);
     entry->SetMeshLocalIid(meshLocalIid);
     entry->SetLastTransactionTime(lastTransactionTime);
 
-    list->PopAfter(prev);
     mCachedList.Push(*entry);
 
     LogCacheEntryChange(kEntryUpdated, kReasonReceivedNotification, *entry);
@@ -850,7 +969,7 @@ exit:
 void AddressResolver::HandleTimeTick(void)
 {
     bool        continueRxingTicks = false;
-    CacheEntry *prev;
+    CacheEntry *next;
     CacheEntry *entry;
 
     for (entry = mSnoopedList.GetHead(); entry != nullptr; entry = entry->GetNext())
@@ -866,6 +985,7 @@ void AddressResolver::HandleTimeTick(void)
         if (entry->IsTimeoutZero())
         {
             entry->SetCanEvict(true);
+            mNumNonEvictableSnooped--;
         }
     }
 
@@ -880,10 +1000,10 @@ void AddressResolver::HandleTimeTick(void)
         entry->DecrementTimeout();
     }
 
-    prev = nullptr;
-
-    while ((entry = GetEntryAfter(prev, mQueryList)) != nullptr)
+    for (entry = mQueryList.GetHead(); entry != nullptr; entry = next)
     {
+        next = entry->GetNext();
+
         OT_ASSERT(!entry->IsTimeoutZero());
 
         continueRxingTicks = true;
@@ -906,20 +1026,13 @@ void AddressResolver::HandleTimeTick(void)
             entry->SetCanEvict(true);
 
             // Move the entry from `mQueryList` to `mQueryRetryList`
-            mQueryList.PopAfter(prev);
+            UnlinkCacheEntry(*entry, mQueryList);
             mQueryRetryList.Push(*entry);
 
             otLogInfoArp("Timed out waiting for address notification for %s, retry: %d",
                          entry->GetTarget().ToString().AsCString(), entry->GetTimeout());
 
             Get<MeshForwarder>().HandleResolved(entry->GetTarget(), OT_ERROR_DROP);
-
-            // When the entry is removed from `mQueryList`
-            // we keep the `prev` pointer same as before.
-        }
-        else
-        {
-            prev = entry;
         }
     }
 
@@ -1045,26 +1158,102 @@ void AddressResolver::LogCacheEntryChange(EntryChange, Reason, const CacheEntry
 void AddressResolver::CacheEntry::Init(Instance &aInstance)
 {
     InstanceLocatorInit::Init(aInstance);
-    mNextIndex = kNoNextIndex;
+    mNextIndex       = kNoIndex;
+    mPrevIndex       = kNoIndex;
+    mEidIndexNext    = kNoIndex;
+    mRouterIndexNext = kNoIndex;
+    mListId          = kListNone;
 }
 
-AddressResolver::CacheEntry *AddressResolver::CacheEntry::GetNext(void)
+AddressResolver::CacheEntry *AddressResolver::CacheEntry::EntryAt(uint16_t aIndex) const
 {
-    return (mNextIndex == kNoNextIndex) ? nullptr : &Get<AddressResolver>().GetCacheEntryPool().GetEntryAt(mNextIndex);
+    return Get<AddressResolver>().GetCacheEntry(aIndex);
 }
 
-const AddressResolver::CacheEntry *AddressResolver::CacheEntry::GetNext(void) const
+uint16_t AddressResolver::CacheEntry::IndexOf(const CacheEntry *aEntry) const
 {
-    return (mNextIndex == kNoNextIndex) ? nullptr : &Get<AddressResolver>().GetCacheEntryPool().GetEntryAt(mNextIndex);
+    return Get<AddressResolver>().GetCacheEntryIndex(aEntry);
 }
 
-void AddressResolver::CacheEntry::SetNext(CacheEntry *aEntry)
+//---------------------------------------------------------------------------------------------------------------------
+// AddressResolver::CacheEntryList
+
+void AddressResolver::CacheEntryList::Push(CacheEntry &aEntry)
 {
-    VerifyOrExit(aEntry != nullptr, mNextIndex = kNoNextIndex);
-    mNextIndex = Get<AddressResolver>().GetCacheEntryPool().GetIndexOf(*aEntry);
+    aEntry.SetNext(mHead);
+    aEntry.SetPrev(nullptr);
+    aEntry.SetListId(mListId);
 
-exit:
-    return;
+    if (mHead == nullptr)
+    {
+        mTail = &aEntry;
+    }
+    else
+    {
+        mHead->SetPrev(&aEntry);
+    }
+
+    mHead = &aEntry;
+}
+
+void AddressResolver::CacheEntryList::PushTail(CacheEntry &aEntry)
+{
+    aEntry.SetNext(nullptr);
+    aEntry.SetPrev(mTail);
+    aEntry.SetListId(mListId);
+
+    if (mTail == nullptr)
+    {
+        mHead = &aEntry;
+    }
+    else
+    {
+        mTail->SetNext(&aEntry);
+    }
+
+    mTail = &aEntry;
+}
+
+void AddressResolver::CacheEntryList::Remove(CacheEntry &aEntry)
+{
+    CacheEntry *prev = aEntry.GetPrev();
+    CacheEntry *next = aEntry.GetNext();
+
+    OT_ASSERT(aEntry.GetListId() == mListId);
+
+    if (prev == nullptr)
+    {
+        mHead = next;
+    }
+    else
+    {
+        prev->SetNext(next);
+    }
+
+    if (next == nullptr)
+    {
+        mTail = prev;
+    }
+    else
+    {
+        next->SetPrev(prev);
+    }
+
+    aEntry.SetNext(nullptr);
+    aEntry.SetPrev(nullptr);
+    aEntry.SetListId(kListNone);
+}
+
+AddressResolver::CacheEntry *AddressResolver::CacheEntryList::Pop(void)
+{
+    CacheEntry *entry = mHead;
+
+    if (entry != nullptr)
+    {
+        Remove(*entry);
+    }
+
+    return entry;
 }
 
 } // namespace ot
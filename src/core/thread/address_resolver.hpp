@@ -37,14 +37,15 @@
 #include "openthread-core-config.h"
 
 #include "coap/coap.hpp"
-#include "common/linked_list.hpp"
 #include "common/locator.hpp"
 #include "common/non_copyable.hpp"
+#include "common/pool.hpp"
 #include "common/time_ticker.hpp"
 #include "common/timer.hpp"
 #include "mac/mac.hpp"
 #include "net/icmp6.hpp"
 #include "net/udp6.hpp"
+#include "thread/mle_types.hpp"
 #include "thread/thread_tlvs.hpp"
 
 namespace ot {
@@ -216,6 +217,18 @@ private:
         kSnoopBlockEvictionTimeout     = OPENTHREAD_CONFIG_TMF_SNOOP_CACHE_ENTRY_TIMEOUT,         // in seconds
         kIteratorListIndex             = 0,
         kIteratorEntryIndex            = 1,
+        kEidIndexSize                  = kCacheEntries,         // Number of buckets in EID hash index.
+        kRouterIndexSize               = Mle::kMaxRouterId + 2, // Includes a bucket for invalid RLOC16.
+        kNoIndex                       = 0xffff,                // Index value indicating no entry.
+    };
+
+    enum ListId : uint8_t
+    {
+        kListCached,
+        kListSnooped,
+        kListQuery,
+        kListQueryRetry,
+        kListNone,
     };
 
     class CacheEntry : public InstanceLocatorInit
@@ -223,9 +236,21 @@ private:
     public:
         void Init(Instance &aInstance);
 
-        CacheEntry *      GetNext(void);
-        const CacheEntry *GetNext(void) const;
-        void              SetNext(CacheEntry *aEntry);
+        CacheEntry *      GetNext(void) { return EntryAt(mNextIndex); }
+        const CacheEntry *GetNext(void) const { return EntryAt(mNextIndex); }
+        void              SetNext(CacheEntry *aEntry) { mNextIndex = IndexOf(aEntry); }
+
+        CacheEntry *GetPrev(void) { return EntryAt(mPrevIndex); }
+        void        SetPrev(CacheEntry *aEntry) { mPrevIndex = IndexOf(aEntry); }
+
+        CacheEntry *GetNextInEidIndex(void) { return EntryAt(mEidIndexNext); }
+        void        SetNextInEidIndex(CacheEntry *aEntry) { mEidIndexNext = IndexOf(aEntry); }
+
+        CacheEntry *GetNextInRouterIndex(void) { return EntryAt(mRouterIndexNext); }
+        void        SetNextInRouterIndex(CacheEntry *aEntry) { mRouterIndexNext = IndexOf(aEntry); }
+
+        ListId GetListId(void) const { return static_cast<ListId>(mListId); }
+        void   SetListId(ListId aListId) { mListId = aListId; }
 
         const Ip6::Address &GetTarget(void) const { return mTarget; }
         void                SetTarget(const Ip6::Address &aTarget) { mTarget = aTarget; }
@@ -257,13 +282,19 @@ private:
     private:
         enum
         {
-            kNoNextIndex          = 0xffff,     // mNextIndex value when at end of list.
             kInvalidLastTransTime = 0xffffffff, // Value indicating mLastTransactionTime is invalid.
         };
 
+        CacheEntry *EntryAt(uint16_t aIndex) const;
+        uint16_t    IndexOf(const CacheEntry *aEntry) const;
+
         Ip6::Address      mTarget;
         Mac::ShortAddress mRloc16;
         uint16_t          mNextIndex;
+        uint16_t          mPrevIndex;
+        uint16_t          mEidIndexNext;
+        uint16_t          mRouterIndexNext;
+        uint8_t           mListId;
         union
         {
             struct
@@ -282,8 +313,36 @@ private:
         } mInfo;
     };
 
+    // Doubly-linked list of cache entries (linked through their pool
+    // indices) so that an entry can be removed from anywhere in the
+    // list in O(1) and eviction candidates can be searched from tail.
+    class CacheEntryList
+    {
+    public:
+        explicit CacheEntryList(ListId aListId)
+            : mHead(nullptr)
+            , mTail(nullptr)
+            , mListId(aListId)
+        {
+        }
+
+        CacheEntry *      GetHead(void) { return mHead; }
+        const CacheEntry *GetHead(void) const { return mHead; }
+        CacheEntry *      GetTail(void) { return mTail; }
+        ListId            GetListId(void) const { return mListId; }
+
+        void        Push(CacheEntry &aEntry);
+        void        PushTail(CacheEntry &aEntry);
+        void        Remove(CacheEntry &aEntry);
+        CacheEntry *Pop(void);
+
+    private:
+        CacheEntry *mHead;
+        CacheEntry *mTail;
+        ListId      mListId;
+    };
+
     typedef Pool<CacheEntry, kCacheEntries> CacheEntryPool;
-    typedef LinkedList<CacheEntry>          CacheEntryList;
 
     enum EntryChange
     {
@@ -306,11 +365,21 @@ private:
 
     CacheEntryPool &GetCacheEntryPool(void) { return mCacheEntryPool; }
 
-    void        Remove(Mac::ShortAddress aRloc16, bool aMatchRouterId);
-    void        Remove(const Ip6::Address &aEid, Reason aReason);
-    CacheEntry *FindCacheEntry(const Ip6::Address &aEid, CacheEntryList *&aList, CacheEntry *&aPrevEntry);
-    CacheEntry *NewCacheEntry(bool aSnoopedEntry);
-    void        RemoveCacheEntry(CacheEntry &aEntry, CacheEntryList &aList, CacheEntry *aPrevEntry, Reason aReason);
+    void            Remove(Mac::ShortAddress aRloc16, bool aMatchRouterId);
+    void            Remove(const Ip6::Address &aEid, Reason aReason);
+    CacheEntry *    FindCacheEntry(const Ip6::Address &aEid, CacheEntryList *&aList);
+    CacheEntry *    NewCacheEntry(bool aSnoopedEntry);
+    void            RemoveCacheEntry(CacheEntry &aEntry, CacheEntryList &aList, Reason aReason);
+    void            UnlinkCacheEntry(CacheEntry &aEntry, CacheEntryList &aList);
+    CacheEntryList &GetList(ListId aListId);
+
+    CacheEntry *GetCacheEntry(uint16_t aIndex);
+    uint16_t    GetCacheEntryIndex(const CacheEntry *aEntry) const;
+    void        AddToIndex(CacheEntry &aEntry);
+    void        RemoveFromIndex(CacheEntry &aEntry);
+    void        UpdateRloc16(CacheEntry &aEntry, Mac::ShortAddress aRloc16);
+    uint16_t &  GetEidIndexHead(const Ip6::Address &aEid);
+    uint16_t &  GetRouterIndexHead(Mac::ShortAddress aRloc16);
 
     otError SendAddressQuery(const Ip6::Address &aEid);
 
@@ -342,8 +411,6 @@ private:
 
     const char *ListToString(const CacheEntryList *aList) const;
 
-    static AddressResolver::CacheEntry *GetEntryAfter(CacheEntry *aPrev, CacheEntryList &aList);
-
     Coap::Resource mAddressError;
     Coap::Resource mAddressQuery;
     Coap::Resource mAddressNotification;
@@ -354,6 +421,13 @@ private:
     CacheEntryList mQueryList;
     CacheEntryList mQueryRetryList;
 
+    // Hash index of all entries by EID and by router ID of their
+    // RLOC16. Each bucket holds the pool index of the first entry
+    // in a chain linked through the entries themselves.
+    uint16_t mEidIndex[kEidIndexSize];
+    uint16_t mRouterIndex[kRouterIndexSize];
+    uint16_t mNumNonEvictableSnooped;
+
     Ip6::Icmp::Handler mIcmpHandler;
 };
 
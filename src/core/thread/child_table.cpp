@@ -86,6 +86,10 @@ ChildTable::ChildTable(Instance &aInstance)
 
 void ChildTable::Clear(void)
 {
+#if OPENTHREAD_CONFIG_MLE_CHILD_TIMEOUT_INDEX_ENABLE
+    mTimeoutIndex.Clear();
+#endif
+
     for (Child &child : mChildren)
     {
         child.Clear();
@@ -108,6 +112,9 @@ Child *ChildTable::GetNewChild(void)
     Child *child = FindChild(Child::AddressMatcher(Child::kInStateInvalid));
 
     VerifyOrExit(child != nullptr);
+#if OPENTHREAD_CONFIG_MLE_CHILD_TIMEOUT_INDEX_ENABLE
+    mTimeoutIndex.Remove(*child);
+#endif
     child->Clear();
 
 exit:
@@ -237,6 +244,9 @@ void ChildTable::Restore(void)
             foundDuplicate = true;
         }
 
+#if OPENTHREAD_CONFIG_MLE_CHILD_TIMEOUT_INDEX_ENABLE
+        mTimeoutIndex.Remove(*child);
+#endif
         child->Clear();
 
         child->SetExtAddress(childInfo.GetExtAddress());
@@ -248,6 +258,9 @@ void ChildTable::Restore(void)
         child->SetLastHeard(TimerMilli::GetNow());
         child->SetVersion(static_cast<uint8_t>(childInfo.GetVersion()));
         Get<IndirectSender>().SetChildUseShortAddress(*child, true);
+#if OPENTHREAD_CONFIG_MLE_CHILD_TIMEOUT_INDEX_ENABLE
+        Get<Mle::MleRouter>().ScheduleChildTimeout(*child);
+#endif
         numChildren++;
     }
 
@@ -330,6 +343,29 @@ bool ChildTable::HasSleepyChildWithAddress(const Ip6::Address &aIp6Address) cons
     return hasChild;
 }
 
+#if OPENTHREAD_CONFIG_MLE_CHILD_TIMEOUT_INDEX_ENABLE
+
+void ChildTable::UpdateTimeoutIndex(Child &aChild, TimeMilli aTime)
+{
+    OT_ASSERT(GetChildIndex(aChild) < kMaxChildren);
+
+    mTimeoutIndex.Update(aChild, aTime);
+}
+
+Child *ChildTable::GetNextTimeout(TimeMilli &aTime) const
+{
+    const Child *child = mTimeoutIndex.GetTop();
+
+    if (child != nullptr)
+    {
+        aTime = child->GetHeapKey();
+    }
+
+    return const_cast<Child *>(child);
+}
+
+#endif // OPENTHREAD_CONFIG_MLE_CHILD_TIMEOUT_INDEX_ENABLE
+
 #endif // OPENTHREAD_FTD
 
 } // namespace ot
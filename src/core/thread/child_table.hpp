@@ -41,6 +41,7 @@
 #include "common/iterator_utils.hpp"
 #include "common/locator.hpp"
 #include "common/non_copyable.hpp"
+#include "common/pairing_heap.hpp"
 #include "thread/topology.hpp"
 
 namespace ot {
@@ -303,6 +304,37 @@ public:
      */
     bool HasSleepyChildWithAddress(const Ip6::Address &aIp6Address) const;
 
+#if OPENTHREAD_CONFIG_MLE_CHILD_TIMEOUT_INDEX_ENABLE
+    /**
+     * This method adds a child to the timeout index, or moves it if it is already there.
+     *
+     * The timeout index orders the children by the next time their timeouts should be processed.
+     *
+     * @param[in]  aChild  A reference to the child.
+     * @param[in]  aTime   The next time the timeouts of @p aChild should be processed.
+     *
+     */
+    void UpdateTimeoutIndex(Child &aChild, TimeMilli aTime);
+
+    /**
+     * This method removes a child from the timeout index.
+     *
+     * @param[in]  aChild  A reference to the child. It is ignored if it is not in the timeout index.
+     *
+     */
+    void RemoveFromTimeoutIndex(Child &aChild) { mTimeoutIndex.Remove(aChild); }
+
+    /**
+     * This method returns the child with the earliest time in the timeout index.
+     *
+     * @param[out] aTime   A reference to output the time of the returned child.
+     *
+     * @returns A pointer to the child with the earliest time, or `nullptr` if the timeout index is empty.
+     *
+     */
+    Child *GetNextTimeout(TimeMilli &aTime) const;
+#endif
+
 private:
     enum
     {
@@ -335,6 +367,9 @@ private:
 
     uint16_t mMaxChildrenAllowed;
     Child    mChildren[kMaxChildren];
+#if OPENTHREAD_CONFIG_MLE_CHILD_TIMEOUT_INDEX_ENABLE
+    PairingHeap<Child, TimeMilli> mTimeoutIndex;
+#endif
 };
 
 } // namespace ot
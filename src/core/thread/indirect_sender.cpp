@@ -99,7 +99,7 @@ void IndirectSender::AddMessageForSleepyChild(Message &aMessage, Child &aChild)
     childIndex = Get<ChildTable>().GetChildIndex(aChild);
     VerifyOrExit(!aMessage.GetChildMask(childIndex));
 
-    aMessage.SetChildMask(childIndex);
+    SetChildMask(aMessage, childIndex);
     mSourceMatchController.IncrementMessageCount(aChild);
 
     if ((aMessage.GetType() != Message::kTypeSupervision) && (aChild.GetIndirectMessageCount() > 1))
@@ -125,7 +125,7 @@ otError IndirectSender::RemoveMessageFromSleepyChild(Message &aMessage, Child &a
 
     VerifyOrExit(aMessage.GetChildMask(childIndex), error = OT_ERROR_NOT_FOUND);
 
-    aMessage.ClearChildMask(childIndex);
+    ClearChildMask(aMessage, childIndex);
     mSourceMatchController.DecrementMessageCount(aChild);
 
     RequestMessageUpdate(aChild);
@@ -136,16 +136,17 @@ exit:
 
 void IndirectSender::ClearAllMessagesForSleepyChild(Child &aChild)
 {
+    uint16_t childIndex = Get<ChildTable>().GetChildIndex(aChild);
     Message *message;
     Message *nextMessage;
 
     VerifyOrExit(aChild.GetIndirectMessageCount() > 0);
 
-    for (message = Get<MeshForwarder>().mSendQueue.GetHead(); message; message = nextMessage)
+    for (message = GetHeadForChild(childIndex); message; message = nextMessage)
     {
-        nextMessage = message->GetNext();
+        nextMessage = GetNextForChild(*message);
 
-        message->ClearChildMask(Get<ChildTable>().GetChildIndex(aChild));
+        ClearChildMask(*message, childIndex);
 
         if (!message->IsChildPending() && !message->GetDirectTransmission())
         {
@@ -194,13 +195,17 @@ void IndirectSender::HandleChildModeChange(Child &aChild, Mle::DeviceMode aOldMo
     if (!aOldMode.IsRxOnWhenIdle() && aChild.IsRxOnWhenIdle() && (aChild.GetIndirectMessageCount() > 0))
     {
         uint16_t childIndex = Get<ChildTable>().GetChildIndex(aChild);
+        Message *nextMessage;
 
-        for (Message *message = Get<MeshForwarder>().mSendQueue.GetHead(); message; message = message->GetNext())
+        for (Message *message = GetHeadForChild(childIndex); message; message = nextMessage)
         {
+            nextMessage = GetNextForChild(*message);
+
             if (message->GetChildMask(childIndex))
             {
-                message->ClearChildMask(childIndex);
+                ClearChildMask(*message, childIndex);
                 message->SetDirectTransmission();
+                Get<MeshForwarder>().mSendQueue.UpdateDirectIndex(*message);
             }
         }
 
@@ -221,11 +226,116 @@ void IndirectSender::HandleChildModeChange(Child &aChild, Mle::DeviceMode aOldMo
     // case.
 }
 
+void IndirectSender::SetChildMask(Message &aMessage, uint16_t aChildIndex)
+{
+    aMessage.SetChildMask(aChildIndex);
+
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_SEND_QUEUE_INDEX_ENABLE
+    {
+        MessageIndexList *list = aMessage.GetIndexList(kMessageIndexIndirect);
+
+        if (list == nullptr)
+        {
+            mChildIndexLists[aChildIndex].Add(aMessage, kMessageIndexIndirect);
+        }
+        else if ((list != &mSharedIndexList) && (list != &mChildIndexLists[aChildIndex]))
+        {
+            // The message is now pending for more than one child.
+            list->Remove(aMessage, kMessageIndexIndirect);
+            mSharedIndexList.Add(aMessage, kMessageIndexIndirect);
+        }
+    }
+#endif
+
+    Get<MeshForwarder>().mSendQueue.UpdateEvictionIndex(aMessage);
+}
+
+void IndirectSender::ClearChildMask(Message &aMessage, uint16_t aChildIndex)
+{
+    aMessage.ClearChildMask(aChildIndex);
+
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_SEND_QUEUE_INDEX_ENABLE
+    {
+        MessageIndexList *list = aMessage.GetIndexList(kMessageIndexIndirect);
+
+        if ((list != nullptr) && !aMessage.IsChildPending())
+        {
+            list->Remove(aMessage, kMessageIndexIndirect);
+        }
+    }
+#endif
+
+    Get<MeshForwarder>().mSendQueue.UpdateEvictionIndex(aMessage);
+}
+
+Message *IndirectSender::GetHeadForChild(uint16_t aChildIndex) const
+{
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_SEND_QUEUE_INDEX_ENABLE
+    Message *head = mChildIndexLists[aChildIndex].GetHead();
+
+    return (head != nullptr) ? head : mSharedIndexList.GetHead();
+#else
+    OT_UNUSED_VARIABLE(aChildIndex);
+
+    return Get<MeshForwarder>().mSendQueue.GetHead();
+#endif
+}
+
+Message *IndirectSender::GetNextForChild(const Message &aMessage) const
+{
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_SEND_QUEUE_INDEX_ENABLE
+    Message *next = aMessage.GetNextInIndex(kMessageIndexIndirect);
+
+    // Continue from the child's own list into the shared list.
+
+    if ((next == nullptr) && (aMessage.GetIndexList(kMessageIndexIndirect) != &mSharedIndexList))
+    {
+        next = mSharedIndexList.GetHead();
+    }
+
+    return next;
+#else
+    return aMessage.GetNext();
+#endif
+}
+
 Message *IndirectSender::FindIndirectMessage(Child &aChild, bool aSupervisionTypeOnly)
 {
     Message *message;
     uint16_t childIndex = Get<ChildTable>().GetChildIndex(aChild);
 
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_SEND_QUEUE_INDEX_ENABLE
+    Message *sharedMessage;
+
+    // Messages in the child's own list are all pending for the child.
+    // The first match from the child's list and the first match from
+    // the shared list are compared and the one ahead in the send queue
+    // order (higher priority, then older) is selected.
+
+    for (message = mChildIndexLists[childIndex].GetHead(); message;
+         message = message->GetNextInIndex(kMessageIndexIndirect))
+    {
+        if (!aSupervisionTypeOnly || (message->GetType() == Message::kTypeSupervision))
+        {
+            break;
+        }
+    }
+
+    for (sharedMessage = mSharedIndexList.GetHead(); sharedMessage;
+         sharedMessage = sharedMessage->GetNextInIndex(kMessageIndexIndirect))
+    {
+        if (sharedMessage->GetChildMask(childIndex) &&
+            (!aSupervisionTypeOnly || (sharedMessage->GetType() == Message::kTypeSupervision)))
+        {
+            break;
+        }
+    }
+
+    if ((sharedMessage != nullptr) && ((message == nullptr) || MessageIndexList::IsAhead(*sharedMessage, *message)))
+    {
+        message = sharedMessage;
+    }
+#else
     for (message = Get<MeshForwarder>().mSendQueue.GetHead(); message; message = message->GetNext())
     {
         if (message->GetChildMask(childIndex) &&
@@ -234,6 +344,7 @@ Message *IndirectSender::FindIndirectMessage(Child &aChild, bool aSupervisionTyp
             break;
         }
     }
+#endif
 
     return message;
 }
@@ -527,7 +638,7 @@ void IndirectSender::HandleSentFrameToChild(const Mac::TxFrame &aFrame,
 
         if (message->GetChildMask(childIndex))
         {
-            message->ClearChildMask(childIndex);
+            ClearChildMask(*message, childIndex);
             mSourceMatchController.DecrementMessageCount(aChild);
         }
 
@@ -58,6 +58,7 @@ namespace ot {
  */
 
 class Child;
+class MeshForwarder;
 
 /**
  * This class implements indirect transmission.
@@ -66,6 +67,7 @@ class Child;
 class IndirectSender : public InstanceLocator, public IndirectSenderBase, private NonCopyable
 {
     friend class Instance;
+    friend class MeshForwarder;
     friend class DataPollHandler::Callbacks;
 #if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MAC_CSL_TRANSMITTER_ENABLE
     friend class CslTxScheduler::Callbacks;
@@ -84,6 +86,7 @@ public:
         friend class DataPollHandler;
         friend class CslTxScheduler;
         friend class SourceMatchController;
+        friend class IndirectSenderTester;
 
     public:
         /**
@@ -218,6 +221,10 @@ private:
                                    Child &             aChild);
     void    HandleFrameChangeDone(Child &aChild);
 
+    void     SetChildMask(Message &aMessage, uint16_t aChildIndex);
+    void     ClearChildMask(Message &aMessage, uint16_t aChildIndex);
+    Message *GetHeadForChild(uint16_t aChildIndex) const;
+    Message *GetNextForChild(const Message &aMessage) const;
     void     UpdateIndirectMessage(Child &aChild);
     Message *FindIndirectMessage(Child &aChild, bool aSupervisionTypeOnly = false);
     void     RequestMessageUpdate(Child &aChild);
@@ -231,6 +238,13 @@ private:
 #if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MAC_CSL_TRANSMITTER_ENABLE
     CslTxScheduler mCslTxScheduler;
 #endif
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_SEND_QUEUE_INDEX_ENABLE
+    // Queued messages pending indirect tx to a single child are
+    // indexed in that child's list, and those pending to more than
+    // one child in the shared list.
+    MessageIndexList mChildIndexLists[Mle::kMaxChildren];
+    MessageIndexList mSharedIndexList;
+#endif
 };
 
 /**
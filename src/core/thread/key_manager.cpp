@@ -33,6 +33,8 @@
 
 #include "key_manager.hpp"
 
+#include <limits.h>
+
 #include "common/code_utils.hpp"
 #include "common/encoding.hpp"
 #include "common/instance.hpp"
@@ -78,6 +80,12 @@ KeyManager::KeyManager(Instance &aInstance)
 
     mMacFrameCounters.Reset();
     mPskc.Clear();
+    mKek.Clear();
+#if OPENTHREAD_CONFIG_KEY_SCHEDULE_CACHE_ENABLE
+    SetKeySchedule(mKekKeySchedule, mKek.GetKey());
+#endif
+
+    ResetKeyScheduleCacheCounters();
 }
 
 void KeyManager::Start(void)
@@ -171,7 +179,7 @@ void KeyManager::ComputeTrelKey(uint32_t aKeySequence, Mac::Key &aTrelKey)
 void KeyManager::UpdateKeyMaterial(void)
 {
     HashKeys cur;
-#if OPENTHREAD_CONFIG_RADIO_LINK_IEEE_802_15_4_ENABLE
+#if OPENTHREAD_CONFIG_RADIO_LINK_IEEE_802_15_4_ENABLE || OPENTHREAD_CONFIG_KEY_SCHEDULE_CACHE_ENABLE
     HashKeys prev;
     HashKeys next;
 #endif
@@ -179,9 +187,24 @@ void KeyManager::UpdateKeyMaterial(void)
     ComputeKeys(mKeySequence, cur);
     mMleKey = cur.mKeys.mMleKey;
 
-#if OPENTHREAD_CONFIG_RADIO_LINK_IEEE_802_15_4_ENABLE
+#if OPENTHREAD_CONFIG_RADIO_LINK_IEEE_802_15_4_ENABLE || OPENTHREAD_CONFIG_KEY_SCHEDULE_CACHE_ENABLE
+    // The previous and next keys are only needed by the radio and the key schedule cache.
     ComputeKeys(mKeySequence - 1, prev);
     ComputeKeys(mKeySequence + 1, next);
+#endif
+
+#if OPENTHREAD_CONFIG_KEY_SCHEDULE_CACHE_ENABLE
+    SetKeySchedule(mMleKeySchedules[kPreviousKeySchedule], prev.mKeys.mMleKey.GetKey());
+    SetKeySchedule(mMleKeySchedules[kCurrentKeySchedule], cur.mKeys.mMleKey.GetKey());
+    SetKeySchedule(mMleKeySchedules[kNextKeySchedule], next.mKeys.mMleKey.GetKey());
+#endif
+
+#if OPENTHREAD_CONFIG_RADIO_LINK_IEEE_802_15_4_ENABLE
+#if OPENTHREAD_CONFIG_KEY_SCHEDULE_CACHE_ENABLE
+    SetKeySchedule(mMacKeySchedules[kPreviousKeySchedule], prev.mKeys.mMacKey.GetKey());
+    SetKeySchedule(mMacKeySchedules[kCurrentKeySchedule], cur.mKeys.mMacKey.GetKey());
+    SetKeySchedule(mMacKeySchedules[kNextKeySchedule], next.mKeys.mMacKey.GetKey());
+#endif
 
     Get<Mac::SubMac>().SetMacKey(Mac::Frame::kKeyIdMode1, (mKeySequence & 0x7f) + 1, prev.mKeys.mMacKey,
                                  cur.mKeys.mMacKey, next.mKeys.mMacKey);
@@ -189,6 +212,9 @@ void KeyManager::UpdateKeyMaterial(void)
 
 #if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
     ComputeTrelKey(mKeySequence, mTrelKey);
+#if OPENTHREAD_CONFIG_KEY_SCHEDULE_CACHE_ENABLE
+    SetKeySchedule(mTrelKeySchedule, mTrelKey.GetKey());
+#endif
 #endif
 }
 
@@ -220,24 +246,116 @@ exit:
     return;
 }
 
-const Mle::Key &KeyManager::GetTemporaryMleKey(uint32_t aKeySequence)
+Crypto::AesEcb &KeyManager::GetAesKeySchedule(KeyType aKeyType, uint32_t aKeySequence)
 {
-    HashKeys hashKeys;
+    // Only the schedules expanded by `UpdateKeyMaterial()` are kept. Any other key sequence (e.g., one read from a
+    // received message that is not authenticated yet) is expanded into the scratch schedule, so it can never displace
+    // the schedules used by the current key sequence. Without the cache, every key is expanded into the scratch
+    // schedule, and only the keys of other key sequences are derived.
 
-    ComputeKeys(aKeySequence, hashKeys);
-    mTemporaryMleKey = hashKeys.mKeys.mMleKey;
+    Crypto::AesEcb *keySchedule = nullptr;
+    uint8_t         index       = GetKeyScheduleIndex(aKeySequence);
+    HashKeys        hashKeys;
+    const uint8_t * key = nullptr;
 
-    return mTemporaryMleKey;
-}
+    switch (aKeyType)
+    {
+    case kKeyTypeMac:
+#if OPENTHREAD_CONFIG_RADIO_LINK_IEEE_802_15_4_ENABLE
+        if (index < kNumKeySchedules)
+        {
+#if OPENTHREAD_CONFIG_KEY_SCHEDULE_CACHE_ENABLE
+            keySchedule = &mMacKeySchedules[index];
+#else
+            const Mac::SubMac &subMac = Get<Mac::SubMac>();
+
+            key = (index == kPreviousKeySchedule)  ? subMac.GetPreviousMacKey().GetKey()
+                  : (index == kCurrentKeySchedule) ? subMac.GetCurrentMacKey().GetKey()
+                                                   : subMac.GetNextMacKey().GetKey();
+#endif
+            break;
+        }
+#endif
+
+        ComputeKeys(aKeySequence, hashKeys);
+        key = hashKeys.mKeys.mMacKey.GetKey();
+        break;
+
+    case kKeyTypeMle:
+#if OPENTHREAD_CONFIG_KEY_SCHEDULE_CACHE_ENABLE
+        if (index < kNumKeySchedules)
+        {
+            keySchedule = &mMleKeySchedules[index];
+            break;
+        }
+#else
+        if (index == kCurrentKeySchedule)
+        {
+            key = mMleKey.GetKey();
+            break;
+        }
+#endif
+
+        ComputeKeys(aKeySequence, hashKeys);
+        key = hashKeys.mKeys.mMleKey.GetKey();
+        break;
 
 #if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
-const Mac::Key &KeyManager::GetTemporaryTrelMacKey(uint32_t aKeySequence)
+    case kKeyTypeTrel:
+        if (index == kCurrentKeySchedule)
+        {
+#if OPENTHREAD_CONFIG_KEY_SCHEDULE_CACHE_ENABLE
+            keySchedule = &mTrelKeySchedule;
+#else
+            key = mTrelKey.GetKey();
+#endif
+            break;
+        }
+
+        ComputeTrelKey(aKeySequence, hashKeys.mKeys.mMacKey);
+        key = hashKeys.mKeys.mMacKey.GetKey();
+        break;
+#endif
+
+    case kKeyTypeKek:
+#if OPENTHREAD_CONFIG_KEY_SCHEDULE_CACHE_ENABLE
+        keySchedule = &mKekKeySchedule;
+#else
+        key = mKek.GetKey();
+#endif
+        break;
+
+    default:
+        OT_ASSERT(false);
+        OT_UNREACHABLE_CODE(break);
+    }
+
+    if (keySchedule != nullptr)
+    {
+        mKeyScheduleCacheCounters.mHits++;
+    }
+    else
+    {
+        keySchedule = &mOtherKeySchedule;
+        SetKeySchedule(*keySchedule, key);
+        mKeyScheduleCacheCounters.mMisses++;
+    }
+
+    return *keySchedule;
+}
+
+uint8_t KeyManager::GetKeyScheduleIndex(uint32_t aKeySequence) const
 {
-    ComputeTrelKey(aKeySequence, mTemporaryTrelKey);
+    // The subtraction wraps around, so the previous key sequence maps to `kPreviousKeySchedule`.
+    uint32_t index = aKeySequence - mKeySequence + kCurrentKeySchedule;
 
-    return mTemporaryTrelKey;
+    return (index < kNumKeySchedules) ? static_cast<uint8_t>(index) : static_cast<uint8_t>(kNumKeySchedules);
+}
+
+void KeyManager::SetKeySchedule(Crypto::AesEcb &aKeySchedule, const uint8_t *aKey)
+{
+    aKeySchedule.SetKey(aKey, CHAR_BIT * Mac::Key::kSize);
 }
-#endif
 
 void KeyManager::SetAllMacFrameCounters(uint32_t aMacFrameCounter)
 {
@@ -290,12 +408,18 @@ void KeyManager::SetKek(const Kek &aKek)
 {
     mKek             = aKek;
     mKekFrameCounter = 0;
+#if OPENTHREAD_CONFIG_KEY_SCHEDULE_CACHE_ENABLE
+    SetKeySchedule(mKekKeySchedule, mKek.GetKey());
+#endif
 }
 
 void KeyManager::SetKek(const uint8_t *aKek)
 {
     memcpy(mKek.m8, aKek, sizeof(mKek));
     mKekFrameCounter = 0;
+#if OPENTHREAD_CONFIG_KEY_SCHEDULE_CACHE_ENABLE
+    SetKeySchedule(mKekKeySchedule, mKek.GetKey());
+#endif
 }
 
 otError KeyManager::SetKeyRotation(uint32_t aKeyRotation)
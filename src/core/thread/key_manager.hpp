@@ -37,8 +37,10 @@
 #include "openthread-core-config.h"
 
 #include <stdint.h>
+#include <string.h>
 
 #include <openthread/dataset.h>
+#include <openthread/thread.h>
 
 #include "common/clearable.hpp"
 #include "common/equatable.hpp"
@@ -46,6 +48,7 @@
 #include "common/non_copyable.hpp"
 #include "common/random.hpp"
 #include "common/timer.hpp"
+#include "crypto/aes_ecb.hpp"
 #include "crypto/hmac_sha256.hpp"
 #include "mac/mac_types.hpp"
 #include "thread/mle_types.hpp"
@@ -125,6 +128,24 @@ public:
         kDefaultSecurityPolicyFlags = 0xff, ///< Default Security Policy Flags.
     };
 
+    /**
+     * This enumeration defines the types of keys with a cached AES key schedule.
+     *
+     */
+    enum KeyType : uint8_t
+    {
+        kKeyTypeMac,  ///< IEEE 802.15.4 MAC key (key ID mode 1).
+        kKeyTypeMle,  ///< MLE key.
+        kKeyTypeTrel, ///< TREL MAC key (key ID mode 1).
+        kKeyTypeKek,  ///< Key Encryption Key (the key sequence is ignored).
+    };
+
+    /**
+     * This type represents the counters of the AES key schedule cache.
+     *
+     */
+    typedef otKeyScheduleCacheCounters KeyScheduleCacheCounters;
+
     /**
      * This constructor initializes the object.
      *
@@ -217,35 +238,47 @@ public:
      *
      */
     const Mac::Key &GetCurrentTrelMacKey(void) const { return mTrelKey; }
+#endif
 
     /**
-     * This method returns a temporary MAC key for TREL radio link computed from the given key sequence.
-     *
-     * @param[in]  aKeySequence  The key sequence value.
+     * This method returns the current MLE key.
      *
-     * @returns The temporary TREL MAC key.
+     * @returns The current MLE key.
      *
      */
-    const Mac::Key &GetTemporaryTrelMacKey(uint32_t aKeySequence);
-#endif
+    const Mle::Key &GetCurrentMleKey(void) const { return mMleKey; }
 
     /**
-     * This method returns the current MLE key.
+     * This method returns the expanded AES key schedule of a key.
      *
-     * @returns The current MLE key.
+     * With `OPENTHREAD_CONFIG_KEY_SCHEDULE_CACHE_ENABLE`, the schedules of the previous, current and next key sequence
+     * are expanded when the key material is updated. Any other key (or any key, without the cache) is expanded into a
+     * scratch schedule that is never retained, so the returned schedule must be used before the next call.
+     *
+     * @param[in]  aKeyType      The key type.
+     * @param[in]  aKeySequence  The key sequence value (ignored for `kKeyTypeKek`).
+     *
+     * @returns The expanded AES key schedule.
      *
      */
-    const Mle::Key &GetCurrentMleKey(void) const { return mMleKey; }
+    Crypto::AesEcb &GetAesKeySchedule(KeyType aKeyType, uint32_t aKeySequence);
 
     /**
-     * This method returns a temporary MLE key computed from the given key sequence.
+     * This method returns the counters of the AES key schedule cache.
      *
-     * @param[in]  aKeySequence  The key sequence value.
+     * @returns The AES key schedule cache counters.
      *
-     * @returns The temporary MLE key.
+     */
+    const KeyScheduleCacheCounters &GetKeyScheduleCacheCounters(void) const { return mKeyScheduleCacheCounters; }
+
+    /**
+     * This method resets the counters of the AES key schedule cache.
      *
      */
-    const Mle::Key &GetTemporaryMleKey(uint32_t aKeySequence);
+    void ResetKeyScheduleCacheCounters(void)
+    {
+        memset(&mKeyScheduleCacheCounters, 0, sizeof(mKeyScheduleCacheCounters));
+    }
 
 #if OPENTHREAD_CONFIG_RADIO_LINK_IEEE_802_15_4_ENABLE
     /**
@@ -521,7 +554,18 @@ private:
         Keys                     mKeys;
     };
 
-    void ComputeKeys(uint32_t aKeySequence, HashKeys &aHashKeys);
+    enum : uint8_t
+    {
+        kPreviousKeySchedule = 0, ///< Index of the previous key sequence schedule.
+        kCurrentKeySchedule  = 1, ///< Index of the current key sequence schedule.
+        kNextKeySchedule     = 2, ///< Index of the next key sequence schedule.
+        kNumKeySchedules     = 3, ///< Number of key sequences with a pinned schedule.
+    };
+
+    void    ComputeKeys(uint32_t aKeySequence, HashKeys &aHashKeys);
+    uint8_t GetKeyScheduleIndex(uint32_t aKeySequence) const;
+
+    static void SetKeySchedule(Crypto::AesEcb &aKeySchedule, const uint8_t *aKey);
 
 #if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
     void ComputeTrelKey(uint32_t aKeySequence, Mac::Key &aTrelKey);
@@ -542,13 +586,24 @@ private:
 
     uint32_t mKeySequence;
     Mle::Key mMleKey;
-    Mle::Key mTemporaryMleKey;
 
 #if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
     Mac::Key mTrelKey;
-    Mac::Key mTemporaryTrelKey;
 #endif
 
+#if OPENTHREAD_CONFIG_KEY_SCHEDULE_CACHE_ENABLE
+    Crypto::AesEcb mMleKeySchedules[kNumKeySchedules];
+#if OPENTHREAD_CONFIG_RADIO_LINK_IEEE_802_15_4_ENABLE
+    Crypto::AesEcb mMacKeySchedules[kNumKeySchedules];
+#endif
+#if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
+    Crypto::AesEcb mTrelKeySchedule;
+#endif
+    Crypto::AesEcb mKekKeySchedule;
+#endif
+    Crypto::AesEcb           mOtherKeySchedule;
+    KeyScheduleCacheCounters mKeyScheduleCacheCounters;
+
     Mac::LinkFrameCounters mMacFrameCounters;
     uint32_t               mMleFrameCounter;
     uint32_t               mStoredMacFrameCounter;
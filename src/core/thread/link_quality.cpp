@@ -141,6 +141,7 @@ void LinkQualityInfo::Clear(void)
 void LinkQualityInfo::AddRss(int8_t aRss)
 {
     uint8_t oldLinkQuality = kNoLinkQuality;
+    uint8_t linkQuality;
 
     VerifyOrExit(aRss != OT_RADIO_RSSI_INVALID);
 
@@ -153,7 +154,18 @@ void LinkQualityInfo::AddRss(int8_t aRss)
 
     SuccessOrExit(mRssAverager.Add(aRss));
 
-    SetLinkQuality(CalculateLinkQuality(GetLinkMargin(), oldLinkQuality));
+    linkQuality = CalculateLinkQuality(GetLinkMargin(), oldLinkQuality);
+
+#if OPENTHREAD_FTD
+    // Link costs toward neighboring routers follow their link quality. The first sample after `Clear()` is always
+    // reported since there is no previous link quality to compare with.
+    if (linkQuality != oldLinkQuality)
+    {
+        Get<RouterTable>().InvalidateRoutes();
+    }
+#endif
+
+    SetLinkQuality(linkQuality);
 
 exit:
     return;
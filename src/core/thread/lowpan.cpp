@@ -266,8 +266,9 @@ otError Lowpan::Compress(Message &           aMessage,
     uint16_t             startOffset = aMessage.GetOffset();
     BufferWriter         buf         = aBuf;
     uint16_t             hcCtl       = kHcDispatch;
-    Ip6::Header          ip6Header;
-    uint8_t *            ip6HeaderBytes = reinterpret_cast<uint8_t *>(&ip6Header);
+    Ip6::Header          ip6HeaderCopy;
+    const Ip6::Header *  ip6Header;
+    const uint8_t *      ip6HeaderBytes;
     Context              srcContext, dstContext;
     bool                 srcContextValid, dstContextValid;
     uint8_t              nextHeader;
@@ -276,10 +277,12 @@ otError Lowpan::Compress(Message &           aMessage,
     uint8_t              headerDepth    = 0;
     uint8_t              headerMaxDepth = aHeaderDepth;
 
-    SuccessOrExit(error = aMessage.Read(aMessage.GetOffset(), ip6Header));
+    ip6Header = aMessage.GetContiguous(aMessage.GetOffset(), ip6HeaderCopy);
+    VerifyOrExit(ip6Header != nullptr, error = OT_ERROR_PARSE);
+    ip6HeaderBytes = reinterpret_cast<const uint8_t *>(ip6Header);
 
     srcContextValid =
-        (networkData.GetContext(ip6Header.GetSource(), srcContext) == OT_ERROR_NONE && srcContext.mCompressFlag);
+        (networkData.GetContext(ip6Header->GetSource(), srcContext) == OT_ERROR_NONE && srcContext.mCompressFlag);
 
     if (!srcContextValid)
     {
@@ -287,7 +290,7 @@ otError Lowpan::Compress(Message &           aMessage,
     }
 
     dstContextValid =
-        (networkData.GetContext(ip6Header.GetDestination(), dstContext) == OT_ERROR_NONE && dstContext.mCompressFlag);
+        (networkData.GetContext(ip6Header->GetDestination(), dstContext) == OT_ERROR_NONE && dstContext.mCompressFlag);
 
     if (!dstContextValid)
     {
@@ -340,7 +343,7 @@ otError Lowpan::Compress(Message &           aMessage,
     }
 
     // Next Header
-    switch (ip6Header.GetNextHeader())
+    switch (ip6Header->GetNextHeader())
     {
     case Ip6::kProtoHopOpts:
     case Ip6::kProtoUdp:
@@ -353,12 +356,12 @@ otError Lowpan::Compress(Message &           aMessage,
         OT_FALL_THROUGH;
 
     default:
-        SuccessOrExit(error = buf.Write(static_cast<uint8_t>(ip6Header.GetNextHeader())));
+        SuccessOrExit(error = buf.Write(static_cast<uint8_t>(ip6Header->GetNextHeader())));
         break;
     }
 
     // Hop Limit
-    switch (ip6Header.GetHopLimit())
+    switch (ip6Header->GetHopLimit())
     {
     case 1:
         hcCtl |= kHcHopLimit1;
@@ -373,53 +376,53 @@ otError Lowpan::Compress(Message &           aMessage,
         break;
 
     default:
-        SuccessOrExit(error = buf.Write(ip6Header.GetHopLimit()));
+        SuccessOrExit(error = buf.Write(ip6Header->GetHopLimit()));
         break;
     }
 
     // Source Address
-    if (ip6Header.GetSource().IsUnspecified())
+    if (ip6Header->GetSource().IsUnspecified())
     {
         hcCtl |= kHcSrcAddrContext;
     }
-    else if (ip6Header.GetSource().IsLinkLocal())
+    else if (ip6Header->GetSource().IsLinkLocal())
     {
-        SuccessOrExit(error = CompressSourceIid(aMacSource, ip6Header.GetSource(), srcContext, hcCtl, buf));
+        SuccessOrExit(error = CompressSourceIid(aMacSource, ip6Header->GetSource(), srcContext, hcCtl, buf));
     }
     else if (srcContextValid)
     {
         hcCtl |= kHcSrcAddrContext;
-        SuccessOrExit(error = CompressSourceIid(aMacSource, ip6Header.GetSource(), srcContext, hcCtl, buf));
+        SuccessOrExit(error = CompressSourceIid(aMacSource, ip6Header->GetSource(), srcContext, hcCtl, buf));
     }
     else
     {
-        SuccessOrExit(error = buf.Write(ip6Header.GetSource().mFields.m8, sizeof(ip6Header.GetSource())));
+        SuccessOrExit(error = buf.Write(ip6Header->GetSource().mFields.m8, sizeof(ip6Header->GetSource())));
     }
 
     // Destination Address
-    if (ip6Header.GetDestination().IsMulticast())
+    if (ip6Header->GetDestination().IsMulticast())
     {
-        SuccessOrExit(error = CompressMulticast(ip6Header.GetDestination(), hcCtl, buf));
+        SuccessOrExit(error = CompressMulticast(ip6Header->GetDestination(), hcCtl, buf));
     }
-    else if (ip6Header.GetDestination().IsLinkLocal())
+    else if (ip6Header->GetDestination().IsLinkLocal())
     {
-        SuccessOrExit(error = CompressDestinationIid(aMacDest, ip6Header.GetDestination(), dstContext, hcCtl, buf));
+        SuccessOrExit(error = CompressDestinationIid(aMacDest, ip6Header->GetDestination(), dstContext, hcCtl, buf));
     }
     else if (dstContextValid)
     {
         hcCtl |= kHcDstAddrContext;
-        SuccessOrExit(error = CompressDestinationIid(aMacDest, ip6Header.GetDestination(), dstContext, hcCtl, buf));
+        SuccessOrExit(error = CompressDestinationIid(aMacDest, ip6Header->GetDestination(), dstContext, hcCtl, buf));
     }
     else
     {
-        SuccessOrExit(error = buf.Write(&ip6Header.GetDestination(), sizeof(ip6Header.GetDestination())));
+        SuccessOrExit(error = buf.Write(&ip6Header->GetDestination(), sizeof(ip6Header->GetDestination())));
     }
 
     headerDepth++;
 
-    aMessage.MoveOffset(sizeof(ip6Header));
+    aMessage.MoveOffset(sizeof(Ip6::Header));
 
-    nextHeader = static_cast<uint8_t>(ip6Header.GetNextHeader());
+    nextHeader = static_cast<uint8_t>(ip6Header->GetNextHeader());
 
     while (headerDepth < headerMaxDepth)
     {
@@ -559,17 +562,19 @@ exit:
 
 otError Lowpan::CompressUdp(Message &aMessage, BufferWriter &aBuf)
 {
-    otError          error       = OT_ERROR_NONE;
-    BufferWriter     buf         = aBuf;
-    uint16_t         startOffset = aMessage.GetOffset();
-    Ip6::Udp::Header udpHeader;
-    uint16_t         source;
-    uint16_t         destination;
+    otError                 error       = OT_ERROR_NONE;
+    BufferWriter            buf         = aBuf;
+    uint16_t                startOffset = aMessage.GetOffset();
+    Ip6::Udp::Header        udpHeaderCopy;
+    const Ip6::Udp::Header *udpHeader;
+    uint16_t                source;
+    uint16_t                destination;
 
-    SuccessOrExit(error = aMessage.Read(aMessage.GetOffset(), udpHeader));
+    udpHeader = aMessage.GetContiguous(aMessage.GetOffset(), udpHeaderCopy);
+    VerifyOrExit(udpHeader != nullptr, error = OT_ERROR_PARSE);
 
-    source      = udpHeader.GetSourcePort();
-    destination = udpHeader.GetDestinationPort();
+    source      = udpHeader->GetSourcePort();
+    destination = udpHeader->GetDestinationPort();
 
     if ((source & 0xfff0) == 0xf0b0 && (destination & 0xfff0) == 0xf0b0)
     {
@@ -593,13 +598,13 @@ otError Lowpan::CompressUdp(Message &aMessage, BufferWriter &aBuf)
     else
     {
         SuccessOrExit(error = buf.Write(kUdpDispatch));
-        SuccessOrExit(error = buf.Write(&udpHeader, Ip6::Udp::Header::kLengthFieldOffset));
+        SuccessOrExit(error = buf.Write(udpHeader, Ip6::Udp::Header::kLengthFieldOffset));
     }
 
-    SuccessOrExit(error =
-                      buf.Write(reinterpret_cast<uint8_t *>(&udpHeader) + Ip6::Udp::Header::kChecksumFieldOffset, 2));
+    SuccessOrExit(
+        error = buf.Write(reinterpret_cast<const uint8_t *>(udpHeader) + Ip6::Udp::Header::kChecksumFieldOffset, 2));
 
-    aMessage.MoveOffset(sizeof(udpHeader));
+    aMessage.MoveOffset(sizeof(Ip6::Udp::Header));
 
 exit:
     if (error == OT_ERROR_NONE)
@@ -79,6 +79,9 @@ void ThreadLinkInfo::SetFrom(const Mac::RxFrame &aFrame)
 #endif
 }
 
+static_assert(OT_MESSAGE_EVICTION_PRIORITY_LEVELS == Message::kNumPriorities,
+              "OT_MESSAGE_EVICTION_PRIORITY_LEVELS does not match the number of message priority levels");
+
 MeshForwarder::MeshForwarder(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mMessageNextOffset(0)
@@ -98,6 +101,8 @@ MeshForwarder::MeshForwarder(Instance &aInstance)
     mFragTag = Random::NonCrypto::GetUint16();
 
     ResetCounters();
+    ResetReassemblyCounters();
+    ResetEvictionCounters();
 
 #if OPENTHREAD_FTD
     mFragmentPriorityList.Clear();
@@ -139,6 +144,8 @@ void MeshForwarder::Stop(void)
         message->Free();
     }
 
+    mReassemblyTable.Clear();
+
 #if OPENTHREAD_FTD
     mIndirectSender.Stop();
     mFragmentPriorityList.Clear();
@@ -211,13 +218,135 @@ void MeshForwarder::RemoveMessage(Message &aMessage)
         {
             mSendMessage = nullptr;
         }
+
+        mSendQueue.Dequeue(aMessage);
+    }
+    else
+    {
+        queue->Dequeue(aMessage);
     }
 
-    queue->Dequeue(aMessage);
     LogMessage(kMessageEvict, aMessage, nullptr, OT_ERROR_NO_BUFS);
     aMessage.Free();
 }
 
+void MeshForwarder::SendQueue::Enqueue(Message &aMessage)
+{
+    PriorityQueue::Enqueue(aMessage);
+    UpdateDirectIndex(aMessage);
+    UpdateEvictionIndex(aMessage);
+}
+
+void MeshForwarder::SendQueue::Dequeue(Message &aMessage)
+{
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_SEND_QUEUE_INDEX_ENABLE
+    for (uint8_t type = 0; type < kNumMessageIndexTypes; type++)
+    {
+        MessageIndexList *list = aMessage.GetIndexList(static_cast<MessageIndexType>(type));
+
+        if (list != nullptr)
+        {
+            list->Remove(aMessage, static_cast<MessageIndexType>(type));
+        }
+    }
+#endif
+
+#if OPENTHREAD_CONFIG_MAC_TX_PIPELINE_ENABLE
+    if (mPipelinedMessage == &aMessage)
+    {
+        mPipelinedMessage = nullptr;
+    }
+#endif
+
+    PriorityQueue::Dequeue(aMessage);
+}
+
+void MeshForwarder::SendQueue::UpdateDirectIndex(Message &aMessage)
+{
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_SEND_QUEUE_INDEX_ENABLE
+    bool isIndexed = (aMessage.GetIndexList(kMessageIndexDirect) != nullptr);
+
+    if (aMessage.GetDirectTransmission() && !isIndexed)
+    {
+        mDirectIndex.Add(aMessage, kMessageIndexDirect);
+    }
+    else if (!aMessage.GetDirectTransmission() && isIndexed)
+    {
+        mDirectIndex.Remove(aMessage, kMessageIndexDirect);
+    }
+#else
+    OT_UNUSED_VARIABLE(aMessage);
+#endif
+}
+
+Message *MeshForwarder::SendQueue::GetHeadForDirectTx(void) const
+{
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_SEND_QUEUE_INDEX_ENABLE
+    return mDirectIndex.GetHead();
+#else
+    return GetHead();
+#endif
+}
+
+Message *MeshForwarder::SendQueue::GetNextForDirectTx(const Message &aMessage) const
+{
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_SEND_QUEUE_INDEX_ENABLE
+    return aMessage.GetNextInIndex(kMessageIndexDirect);
+#else
+    return aMessage.GetNext();
+#endif
+}
+
+void MeshForwarder::SendQueue::UpdateEvictionIndex(Message &aMessage)
+{
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_SEND_QUEUE_INDEX_ENABLE
+    MessageIndexList *list    = aMessage.GetIndexList(kMessageIndexEvict);
+    MessageIndexList *newList = nullptr;
+
+    if ((aMessage.GetPriorityQueue() == this) && aMessage.IsChildPending())
+    {
+        newList = &GetEvictionIndex(aMessage.GetPriority());
+    }
+
+    VerifyOrExit(list != newList);
+
+    if (list != nullptr)
+    {
+        list->Remove(aMessage, kMessageIndexEvict);
+    }
+
+    if (newList != nullptr)
+    {
+        newList->Add(aMessage, kMessageIndexEvict);
+    }
+
+exit:
+    return;
+#else
+    OT_UNUSED_VARIABLE(aMessage);
+#endif
+}
+
+Message *MeshForwarder::SendQueue::GetHeadForIndirectEviction(Message::Priority aPriority) const
+{
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_SEND_QUEUE_INDEX_ENABLE
+    return GetEvictionIndex(aPriority).GetHead();
+#else
+    return GetHeadForPriority(aPriority);
+#endif
+}
+
+Message *MeshForwarder::SendQueue::GetNextForIndirectEviction(const Message &aMessage) const
+{
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_SEND_QUEUE_INDEX_ENABLE
+    return aMessage.GetNextInIndex(kMessageIndexEvict);
+#else
+    Message *next = aMessage.GetNext();
+
+    return ((next != nullptr) && (next->GetPriority() == aMessage.GetPriority())) ? next : nullptr;
+#endif
+}
+
 void MeshForwarder::ResumeMessageTransmissions(void)
 {
     if (mTxPaused)
@@ -255,11 +384,11 @@ Message *MeshForwarder::GetDirectTransmission(void)
     Message *curMessage, *nextMessage;
     otError  error = OT_ERROR_NONE;
 
-    for (curMessage = mSendQueue.GetHead(); curMessage; curMessage = nextMessage)
+    for (curMessage = mSendQueue.GetHeadForDirectTx(); curMessage; curMessage = nextMessage)
     {
         if (!curMessage->GetDirectTransmission())
         {
-            nextMessage = curMessage->GetNext();
+            nextMessage = mSendQueue.GetNextForDirectTx(*curMessage);
             continue;
         }
 
@@ -293,7 +422,7 @@ Message *MeshForwarder::GetDirectTransmission(void)
         curMessage->SetDoNotEvict(false);
 
         // the next message may have been evicted during processing (e.g. due to Address Solicit)
-        nextMessage = curMessage->GetNext();
+        nextMessage = mSendQueue.GetNextForDirectTx(*curMessage);
 
         switch (error)
         {
@@ -470,6 +599,10 @@ Mac::TxFrame *MeshForwarder::HandleFrameRequest(Mac::TxFrames &aTxFrames)
     Mac::TxFrame *frame         = nullptr;
     bool          addFragHeader = false;
 
+#if OPENTHREAD_CONFIG_MAC_TX_PIPELINE_ENABLE
+    mSendQueue.SetPipelinedMessage(nullptr);
+#endif
+
     VerifyOrExit(mEnabled && (mSendMessage != nullptr));
 
 #if OPENTHREAD_CONFIG_MULTI_RADIO
@@ -556,6 +689,131 @@ exit:
     return frame;
 }
 
+#if OPENTHREAD_CONFIG_MAC_TX_PIPELINE_ENABLE
+otError MeshForwarder::HandleNextFrameRequest(Mac::TxFrame &aFrame)
+{
+    otError            error   = OT_ERROR_NONE;
+    Message *          message = mSendMessage;
+    uint16_t           offset;
+    uint16_t           nextOffset;
+    PipelinedFrameInfo sendInfo;
+
+    // The route of the frame on air is saved and restored on exit
+    // since the look-ahead below updates it for the next message.
+
+    sendInfo.mMacSource     = mMacSource;
+    sendInfo.mMacDest       = mMacDest;
+    sendInfo.mMeshSource    = mMeshSource;
+    sendInfo.mMeshDest      = mMeshDest;
+    sendInfo.mAddMeshHeader = mAddMeshHeader;
+
+    mSendQueue.SetPipelinedMessage(nullptr);
+
+    VerifyOrExit(mEnabled && mSendBusy && (message != nullptr), error = OT_ERROR_INVALID_STATE);
+
+    if (mMessageNextOffset < message->GetLength())
+    {
+        // The next fragment of the message being sent.
+
+        VerifyOrExit(message->GetType() == Message::kTypeIp6, error = OT_ERROR_NOT_CAPABLE);
+        VerifyOrExit(message->GetSubType() != Message::kSubTypeMleDiscoverRequest, error = OT_ERROR_NOT_CAPABLE);
+        offset = mMessageNextOffset;
+    }
+    else
+    {
+#if OPENTHREAD_FTD
+        // The message being sent is done after the current frame, so
+        // look ahead to the next queued message pending direct tx.
+        // Only mesh frames (being forwarded) are prepared ahead since
+        // their route lookup only updates the route fields, which are
+        // restored on exit.
+
+        do
+        {
+            message = mSendQueue.GetNextForDirectTx(*message);
+        } while ((message != nullptr) && !message->GetDirectTransmission());
+
+        VerifyOrExit(message != nullptr, error = OT_ERROR_NOT_FOUND);
+        VerifyOrExit(message->GetType() == Message::kType6lowpan, error = OT_ERROR_NOT_CAPABLE);
+        SuccessOrExit(error = UpdateMeshRoute(*message));
+        offset = 0;
+#else
+        ExitNow(error = OT_ERROR_NOT_FOUND);
+#endif
+    }
+
+    // Prepare the frame as `HandleFrameRequest()` would once the
+    // message offset is moved to `offset`, leaving the message and
+    // the state of the current transmission unchanged.
+
+#if OPENTHREAD_FTD
+    if (message->GetType() == Message::kType6lowpan)
+    {
+        uint16_t messageNextOffset = mMessageNextOffset;
+
+        SendMesh(*message, aFrame);
+        nextOffset         = mMessageNextOffset;
+        mMessageNextOffset = messageNextOffset;
+    }
+    else
+#endif
+    {
+        uint16_t messageOffset = message->GetOffset();
+
+        message->SetOffset(offset);
+        nextOffset = PrepareDataFrame(aFrame, *message, mMacSource, mMacDest, mAddMeshHeader, mMeshSource, mMeshDest);
+        message->SetOffset(messageOffset);
+    }
+
+    aFrame.SetIsARetransmission(false);
+
+    mPipelinedFrameInfo.mOffset        = offset;
+    mPipelinedFrameInfo.mNextOffset    = nextOffset;
+    mPipelinedFrameInfo.mMacSource     = mMacSource;
+    mPipelinedFrameInfo.mMacDest       = mMacDest;
+    mPipelinedFrameInfo.mMeshSource    = mMeshSource;
+    mPipelinedFrameInfo.mMeshDest      = mMeshDest;
+    mPipelinedFrameInfo.mAddMeshHeader = mAddMeshHeader;
+    mSendQueue.SetPipelinedMessage(message);
+
+exit:
+    mMacSource     = sendInfo.mMacSource;
+    mMacDest       = sendInfo.mMacDest;
+    mMeshSource    = sendInfo.mMeshSource;
+    mMeshDest      = sendInfo.mMeshDest;
+    mAddMeshHeader = sendInfo.mAddMeshHeader;
+
+    return error;
+}
+
+otError MeshForwarder::HandlePipelinedFrameRequest(void)
+{
+    otError  error   = OT_ERROR_NONE;
+    Message *message = mSendQueue.GetPipelinedMessage();
+
+    mSendQueue.SetPipelinedMessage(nullptr);
+
+    VerifyOrExit(mEnabled && (message != nullptr) && (message == mSendMessage), error = OT_ERROR_NOT_FOUND);
+    VerifyOrExit(message->GetOffset() == mPipelinedFrameInfo.mOffset, error = OT_ERROR_NOT_FOUND);
+
+    // The route of the message was just updated when it got selected
+    // for direct tx. It must match the one the frame was prepared with.
+
+    VerifyOrExit((mPipelinedFrameInfo.mMacSource == mMacSource) && (mPipelinedFrameInfo.mMacDest == mMacDest) &&
+                     (mPipelinedFrameInfo.mAddMeshHeader == mAddMeshHeader),
+                 error = OT_ERROR_NOT_FOUND);
+    VerifyOrExit(!mAddMeshHeader || ((mPipelinedFrameInfo.mMeshSource == mMeshSource) &&
+                                     (mPipelinedFrameInfo.mMeshDest == mMeshDest)),
+                 error = OT_ERROR_NOT_FOUND);
+
+    mSendBusy          = true;
+    mMessageNextOffset = mPipelinedFrameInfo.mNextOffset;
+
+exit:
+    return error;
+}
+#endif // OPENTHREAD_CONFIG_MAC_TX_PIPELINE_ENABLE
+
 // This method constructs a MAC data from from a given IPv6 message.
 //
 // This method handles generation of MAC header, mesh header (if
@@ -1027,6 +1285,8 @@ void MeshForwarder::UpdateSendMessage(otError aFrameTxError, Mac::Address &aMacD
         Get<Mle::DiscoverScanner>().HandleDiscoveryRequestFrameTxDone(*mSendMessage);
     }
 
+    mSendQueue.UpdateDirectIndex(*mSendMessage);
+
     if (!mSendMessage->GetDirectTransmission() && !mSendMessage->IsChildPending())
     {
         if (mSendMessage->GetSubType() == Message::kSubTypeMleChildIdRequest && mSendMessage->IsLinkSecurityEnabled())
@@ -1048,27 +1308,38 @@ void MeshForwarder::UpdateSendMessage(otError aFrameTxError, Mac::Address &aMacD
     }
 
 exit:
-    mScheduleTransmissionTask.Post();
+#if OPENTHREAD_CONFIG_MAC_TX_PIPELINE_ENABLE
+    // When the next frame is already prepared, request its tx right
+    // away so that `Mac` starts it from the current tx done event.
+    if (mSendQueue.GetPipelinedMessage() != nullptr)
+    {
+        ScheduleTransmissionTask();
+    }
+    else
+#endif
+    {
+        mScheduleTransmissionTask.Post();
+    }
 }
 
-void MeshForwarder::HandleReceivedFrame(Mac::RxFrame &aFrame)
+void MeshForwarder::HandleReceivedFrame(Mac::RxFrame &aFrame, const Mac::ParsedFrame &aParsedFrame)
 {
     ThreadLinkInfo linkInfo;
     Mac::Address   macDest;
     Mac::Address   macSource;
-    uint8_t *      payload;
+    const uint8_t *payload;
     uint16_t       payloadLength;
     otError        error = OT_ERROR_NONE;
 
     VerifyOrExit(mEnabled, error = OT_ERROR_INVALID_STATE);
 
-    SuccessOrExit(error = aFrame.GetSrcAddr(macSource));
-    SuccessOrExit(error = aFrame.GetDstAddr(macDest));
+    SuccessOrExit(error = aParsedFrame.GetSrcAddr(macSource));
+    SuccessOrExit(error = aParsedFrame.GetDstAddr(macDest));
 
     linkInfo.SetFrom(aFrame);
 
-    payload       = aFrame.GetPayload();
-    payloadLength = aFrame.GetPayloadLength();
+    payload       = aParsedFrame.GetPayload();
+    payloadLength = aParsedFrame.GetPayloadLength();
 
     Get<Utils::SupervisionListener>().UpdateOnReceive(macSource, linkInfo.IsLinkSecurityEnabled());
 
@@ -1169,6 +1440,10 @@ void MeshForwarder::HandleFragment(const uint8_t *       aFrame,
     {
         uint16_t datagramSize = fragmentHeader.GetDatagramSize();
 
+        VerifyOrExit(mReassemblyTable.Find(aMacSource, fragmentHeader.GetDatagramTag(), datagramSize,
+                                           aLinkInfo.IsLinkSecurityEnabled()) == nullptr,
+                     error = OT_ERROR_DUPLICATED);
+
         error = FrameToMessage(aFrame, aFrameLength, datagramSize, aMacSource, aMacDest, message);
         SuccessOrExit(error);
 
@@ -1195,23 +1470,32 @@ void MeshForwarder::HandleFragment(const uint8_t *       aFrame,
             ClearReassemblyList();
         }
 
+        SuccessOrExit(error = MakeRoomForReassembly(*message, aMacSource));
+
         mReassemblyList.Enqueue(*message);
+        mReassemblyTable.Add(*message, aMacSource);
 
         Get<TimeTicker>().RegisterReceiver(TimeTicker::kMeshForwarder);
     }
     else // Received frame is a "next fragment".
     {
-        for (message = mReassemblyList.GetHead(); message; message = message->GetNext())
+        // Security Check: only consider reassembly buffers that had the same Security Enabled setting.
+        message = mReassemblyTable.Find(aMacSource, fragmentHeader.GetDatagramTag(), fragmentHeader.GetDatagramSize(),
+                                        aLinkInfo.IsLinkSecurityEnabled());
+
+        if ((message != nullptr) && (fragmentHeader.GetDatagramOffset() < message->GetOffset()))
         {
-            // Security Check: only consider reassembly buffers that had the same Security Enabled setting.
-            if (message->GetLength() == fragmentHeader.GetDatagramSize() &&
-                message->GetDatagramTag() == fragmentHeader.GetDatagramTag() &&
-                message->GetOffset() == fragmentHeader.GetDatagramOffset() &&
-                message->GetOffset() + aFrameLength <= fragmentHeader.GetDatagramSize() &&
-                message->IsLinkSecurityEnabled() == aLinkInfo.IsLinkSecurityEnabled())
-            {
-                break;
-            }
+            // The fragment was already received. Clear `message`
+            // so that it is not freed on exit.
+
+            message = nullptr;
+            ExitNow(error = OT_ERROR_DUPLICATED);
+        }
+
+        if ((message != nullptr) && ((message->GetOffset() != fragmentHeader.GetDatagramOffset()) ||
+                                     (message->GetOffset() + aFrameLength > fragmentHeader.GetDatagramSize())))
+        {
+            message = nullptr;
         }
 
         // For a sleepy-end-device, if we receive a new (secure) next fragment
@@ -1243,11 +1527,17 @@ exit:
         if (message->GetOffset() >= message->GetLength())
         {
             mReassemblyList.Dequeue(*message);
+            mReassemblyTable.Remove(*message);
             IgnoreError(HandleDatagram(*message, aLinkInfo, aMacSource));
         }
     }
     else
     {
+        if (error == OT_ERROR_DUPLICATED)
+        {
+            mReassemblyCounters.mDuplicates++;
+        }
+
         LogFragmentFrameDrop(error, aFrameLength, aMacSource, aMacDest, fragmentHeader,
                              aLinkInfo.IsLinkSecurityEnabled());
         FreeMessage(message);
@@ -1273,6 +1563,8 @@ void MeshForwarder::ClearReassemblyList(void)
 
         message->Free();
     }
+
+    mReassemblyTable.Clear();
 }
 
 void MeshForwarder::HandleTimeTick(void)
@@ -1306,6 +1598,8 @@ bool MeshForwarder::UpdateReassemblyList(void)
         else
         {
             mReassemblyList.Dequeue(*message);
+            mReassemblyTable.Remove(*message);
+            mReassemblyCounters.mTimeouts++;
 
             LogMessage(kMessageReassemblyDrop, *message, nullptr, OT_ERROR_REASSEMBLY_TIMEOUT);
             if (message->GetType() == Message::kTypeIp6)
@@ -1320,6 +1614,222 @@ bool MeshForwarder::UpdateReassemblyList(void)
     return mReassemblyList.GetHead() != nullptr;
 }
 
+otError MeshForwarder::MakeRoomForReassembly(const Message &aMessage, const Mac::Address &aMacSource)
+{
+    otError error = OT_ERROR_NONE;
+
+#if OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_MAX_BUFFERS_PER_SOURCE
+    uint16_t bufferCount = aMessage.GetBufferCount();
+
+    // Limit the buffers used by a single source, evicting its oldest
+    // datagrams first, so that one source cannot exhaust the pool.
+
+    VerifyOrExit(bufferCount <= kReassemblyMaxBuffersPerSource, error = OT_ERROR_NO_BUFS);
+
+    while (mReassemblyTable.GetBufferCount(aMacSource) + bufferCount > kReassemblyMaxBuffersPerSource)
+    {
+        EvictReassembly(*mReassemblyTable.FindOldest(&aMacSource));
+    }
+#else
+    OT_UNUSED_VARIABLE(aMessage);
+    OT_UNUSED_VARIABLE(aMacSource);
+#endif
+
+    if (mReassemblyTable.IsFull())
+    {
+        EvictReassembly(*mReassemblyTable.FindOldest(nullptr));
+    }
+
+#if OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_MAX_BUFFERS_PER_SOURCE
+exit:
+#endif
+    return error;
+}
+
+void MeshForwarder::EvictReassembly(Message &aMessage)
+{
+    mReassemblyList.Dequeue(aMessage);
+    mReassemblyTable.Remove(aMessage);
+    mReassemblyCounters.mEvictions++;
+
+    LogMessage(kMessageReassemblyDrop, aMessage, nullptr, OT_ERROR_NO_BUFS);
+
+    if (aMessage.GetType() == Message::kTypeIp6)
+    {
+        mIpCounters.mRxFailure++;
+    }
+
+    aMessage.Free();
+}
+
+void MeshForwarder::ReassemblyTable::Clear(void)
+{
+    for (Entry &entry : mEntries)
+    {
+        entry.mMessage = nullptr;
+    }
+
+    mNumEntries = 0;
+}
+
+Message *MeshForwarder::ReassemblyTable::Find(const Mac::Address &aSource,
+                                              uint16_t            aTag,
+                                              uint16_t            aSize,
+                                              bool                aLinkSecurity) const
+{
+    Message *message = nullptr;
+
+    for (uint16_t slot = GetHomeSlot(aSource, aTag, aSize); mEntries[slot].mMessage != nullptr;
+         slot          = GetNextSlot(slot))
+    {
+        const Entry &entry = mEntries[slot];
+
+        if ((entry.mTag == aTag) && (entry.mSize == aSize) && (entry.mLinkSecurity == aLinkSecurity) &&
+            SourceMatches(entry.mSource, aSource))
+        {
+            message = entry.mMessage;
+            break;
+        }
+    }
+
+    return message;
+}
+
+void MeshForwarder::ReassemblyTable::Add(Message &aMessage, const Mac::Address &aSource)
+{
+    uint16_t tag  = static_cast<uint16_t>(aMessage.GetDatagramTag());
+    uint16_t slot = GetHomeSlot(aSource, tag, aMessage.GetLength());
+    Entry *  entry;
+
+    OT_ASSERT(!IsFull());
+
+    while (mEntries[slot].mMessage != nullptr)
+    {
+        slot = GetNextSlot(slot);
+    }
+
+    entry                = &mEntries[slot];
+    entry->mSource       = aSource;
+    entry->mMessage      = &aMessage;
+    entry->mTag          = tag;
+    entry->mSize         = aMessage.GetLength();
+    entry->mBufferCount  = aMessage.GetBufferCount();
+    entry->mLinkSecurity = aMessage.IsLinkSecurityEnabled();
+    mNumEntries++;
+}
+
+void MeshForwarder::ReassemblyTable::Remove(const Message &aMessage)
+{
+    uint16_t slot;
+    uint16_t next;
+
+    // Removal happens once per datagram, so the slot is found by
+    // scanning the (small) table rather than requiring the source.
+
+    for (slot = 0; slot < kNumSlots; slot++)
+    {
+        if (mEntries[slot].mMessage == &aMessage)
+        {
+            break;
+        }
+    }
+
+    VerifyOrExit(slot < kNumSlots);
+
+    mEntries[slot].mMessage = nullptr;
+    mNumEntries--;
+
+    // Shift back any following entries of the probe sequence whose
+    // home slot is not between the freed slot and their position.
+
+    for (next = GetNextSlot(slot); mEntries[next].mMessage != nullptr; next = GetNextSlot(next))
+    {
+        const Entry &entry = mEntries[next];
+        uint16_t     home  = GetHomeSlot(entry.mSource, entry.mTag, entry.mSize);
+        bool         stays = (slot <= next) ? ((slot < home) && (home <= next)) : ((slot < home) || (home <= next));
+
+        if (!stays)
+        {
+            mEntries[slot]          = entry;
+            mEntries[next].mMessage = nullptr;
+            slot                    = next;
+        }
+    }
+
+exit:
+    return;
+}
+
+uint16_t MeshForwarder::ReassemblyTable::GetBufferCount(const Mac::Address &aSource) const
+{
+    uint16_t count = 0;
+
+    for (const Entry &entry : mEntries)
+    {
+        if ((entry.mMessage != nullptr) && SourceMatches(entry.mSource, aSource))
+        {
+            count += entry.mBufferCount;
+        }
+    }
+
+    return count;
+}
+
+Message *MeshForwarder::ReassemblyTable::FindOldest(const Mac::Address *aSource) const
+{
+    Message *oldest = nullptr;
+
+    for (const Entry &entry : mEntries)
+    {
+        if ((entry.mMessage == nullptr) || ((aSource != nullptr) && !SourceMatches(entry.mSource, *aSource)))
+        {
+            continue;
+        }
+
+        if ((oldest == nullptr) || (entry.mMessage->GetTimeout() < oldest->GetTimeout()))
+        {
+            oldest = entry.mMessage;
+        }
+    }
+
+    return oldest;
+}
+
+bool MeshForwarder::ReassemblyTable::SourceMatches(const Mac::Address &aFirst, const Mac::Address &aSecond)
+{
+    bool matches = (aFirst.GetType() == aSecond.GetType());
+
+    if (matches && aFirst.IsShort())
+    {
+        matches = (aFirst.GetShort() == aSecond.GetShort());
+    }
+    else if (matches && aFirst.IsExtended())
+    {
+        matches = (aFirst.GetExtended() == aSecond.GetExtended());
+    }
+
+    return matches;
+}
+
+uint16_t MeshForwarder::ReassemblyTable::GetHomeSlot(const Mac::Address &aSource, uint16_t aTag, uint16_t aSize)
+{
+    uint32_t hash = (static_cast<uint32_t>(aTag) << 16) | aSize;
+
+    if (aSource.IsShort())
+    {
+        hash = hash * 31 + aSource.GetShort();
+    }
+    else if (aSource.IsExtended())
+    {
+        for (uint8_t byte : aSource.GetExtended().m8)
+        {
+            hash = hash * 31 + byte;
+        }
+    }
+
+    return static_cast<uint16_t>(hash % kNumSlots);
+}
+
 otError MeshForwarder::FrameToMessage(const uint8_t *     aFrame,
                                       uint16_t            aFrameLength,
                                       uint16_t            aDatagramSize,
@@ -251,12 +251,17 @@ public:
     void RemoveDataResponseMessages(void);
 
     /**
-     * This method evicts the message with lowest priority in the send queue.
+     * This method evicts a queued message to free buffers for a new message.
      *
-     * @param[in]  aPriority  The highest priority level of the evicted message.
+     * A message with a priority lower than @p aPriority is evicted first, from the lowest priority level. Otherwise, a
+     * message of the same or higher priority that is pending indirect transmission to sleepy children is evicted.
+     * Among the candidates of a priority level, the message is selected by the eviction policy (see
+     * `OPENTHREAD_CONFIG_MESH_FORWARDER_EVICTION_POLICY`).
      *
-     * @retval OT_ERROR_NONE       Successfully evicted a low priority message.
-     * @retval OT_ERROR_NOT_FOUND  No low priority messages available to evict.
+     * @param[in]  aPriority  The priority level of the new message.
+     *
+     * @retval OT_ERROR_NONE       Successfully evicted a message.
+     * @retval OT_ERROR_NOT_FOUND  No message available to evict.
      *
      */
     otError EvictMessage(Message::Priority aPriority);
@@ -291,6 +296,34 @@ public:
      */
     void ResetCounters(void) { memset(&mIpCounters, 0, sizeof(mIpCounters)); }
 
+    /**
+     * This method returns a reference to the 6LoWPAN fragment reassembly counters.
+     *
+     * @returns A reference to the reassembly counters.
+     *
+     */
+    const otReassemblyCounters &GetReassemblyCounters(void) const { return mReassemblyCounters; }
+
+    /**
+     * This method resets the 6LoWPAN fragment reassembly counters.
+     *
+     */
+    void ResetReassemblyCounters(void) { memset(&mReassemblyCounters, 0, sizeof(mReassemblyCounters)); }
+
+    /**
+     * This method returns a reference to the message eviction counters.
+     *
+     * @returns A reference to the message eviction counters.
+     *
+     */
+    const otMessageEvictionCounters &GetEvictionCounters(void) const { return mEvictionCounters; }
+
+    /**
+     * This method resets the message eviction counters.
+     *
+     */
+    void ResetEvictionCounters(void) { memset(&mEvictionCounters, 0, sizeof(mEvictionCounters)); }
+
 #if OPENTHREAD_FTD
     /**
      * This method returns a reference to the resolving queue.
@@ -326,6 +359,11 @@ private:
         kMeshHeaderFrameFcsSize = sizeof(uint16_t),        // Frame FCS size for Mesh Header frame.
     };
 
+    enum : uint16_t
+    {
+        kReassemblyMaxBuffersPerSource = OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_MAX_BUFFERS_PER_SOURCE, // Per MAC source.
+    };
+
     enum MessageAction ///< Defines the action parameter in `LogMessageInfo()` method.
     {
         kMessageReceive,         ///< Indicates that the message was received.
@@ -336,6 +374,116 @@ private:
         kMessageEvict,           ///< Indicates that the message was evicted.
     };
 
+    // Indexes the messages in the reassembly list by link-layer
+    // source, datagram tag, datagram size and security, using open
+    // addressing with linear probing.
+    class ReassemblyTable
+    {
+    public:
+        ReassemblyTable(void) { Clear(); }
+
+        void     Clear(void);
+        bool     IsFull(void) const { return (mNumEntries >= kMaxEntries); }
+        Message *Find(const Mac::Address &aSource, uint16_t aTag, uint16_t aSize, bool aLinkSecurity) const;
+        void     Add(Message &aMessage, const Mac::Address &aSource);
+        void     Remove(const Message &aMessage);
+        uint16_t GetBufferCount(const Mac::Address &aSource) const;
+        Message *FindOldest(const Mac::Address *aSource) const;
+
+    private:
+        enum : uint16_t
+        {
+            kMaxEntries = OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_MAX_ENTRIES,
+            kNumSlots   = 2 * kMaxEntries, // Keeps the load factor at or below one half.
+        };
+
+        struct Entry
+        {
+            Mac::Address mSource;
+            Message *    mMessage; // `nullptr` for an unused slot.
+            uint16_t     mTag;
+            uint16_t     mSize;
+            uint16_t     mBufferCount;
+            bool         mLinkSecurity;
+        };
+
+        static bool     SourceMatches(const Mac::Address &aFirst, const Mac::Address &aSecond);
+        static uint16_t GetHomeSlot(const Mac::Address &aSource, uint16_t aTag, uint16_t aSize);
+        static uint16_t GetNextSlot(uint16_t aSlot) { return (aSlot + 1 < kNumSlots) ? (aSlot + 1) : 0; }
+
+        Entry    mEntries[kNumSlots];
+        uint16_t mNumEntries;
+    };
+
+    class SendQueue : public PriorityQueue
+    {
+    public:
+#if OPENTHREAD_CONFIG_MAC_TX_PIPELINE_ENABLE
+        SendQueue(void)
+            : mPipelinedMessage(nullptr)
+        {
+        }
+
+        // Tracks the message whose next frame was prepared ahead of
+        // its transmission. Removing the message from the queue
+        // clears it (the message may then be freed).
+        Message *GetPipelinedMessage(void) const { return mPipelinedMessage; }
+        void     SetPipelinedMessage(Message *aMessage) { mPipelinedMessage = aMessage; }
+#endif
+
+        // Adds a message to the queue (and to the direct tx index if
+        // the message is marked for direct transmission).
+        void Enqueue(Message &aMessage);
+
+        // Removes a message from the queue and from any index list.
+        void Dequeue(Message &aMessage);
+
+        // Updates the direct tx index of a queued message after a
+        // change of its direct transmission flag.
+        void UpdateDirectIndex(Message &aMessage);
+
+        // Iterates over the queued messages pending direct tx. With
+        // the index disabled, this iterates over the whole queue.
+        Message *GetHeadForDirectTx(void) const;
+        Message *GetNextForDirectTx(const Message &aMessage) const;
+
+        // Updates the eviction index of a queued message after a
+        // change of its child mask.
+        void UpdateEvictionIndex(Message &aMessage);
+
+        // Iterates over the queued messages of a priority level that
+        // are pending indirect tx. The eviction index is part of the
+        // send queue indices, so without
+        // `OPENTHREAD_CONFIG_MESH_FORWARDER_SEND_QUEUE_INDEX_ENABLE`
+        // this iterates over all the messages of the priority level.
+        Message *GetHeadForIndirectEviction(Message::Priority aPriority) const;
+        Message *GetNextForIndirectEviction(const Message &aMessage) const;
+
+    private:
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_SEND_QUEUE_INDEX_ENABLE
+        MessageIndexList mDirectIndex;
+#endif
+#if OPENTHREAD_CONFIG_MAC_TX_PIPELINE_ENABLE
+        Message *mPipelinedMessage;
+#endif
+    };
+
+#if OPENTHREAD_CONFIG_MAC_TX_PIPELINE_ENABLE
+    // The message position and route used to prepare the pipelined
+    // frame. The frame can be sent only if the message selected next
+    // for direct tx is at the same position and has the same route.
+    struct PipelinedFrameInfo
+    {
+        uint16_t     mOffset;
+        uint16_t     mNextOffset;
+        Mac::Address mMacSource;
+        Mac::Address mMacDest;
+        uint16_t     mMeshSource;
+        uint16_t     mMeshDest;
+        bool         mAddMeshHeader;
+    };
+#endif
+
 #if OPENTHREAD_FTD
     class FragmentPriorityList : public Clearable<FragmentPriorityList>
     {
@@ -409,7 +557,7 @@ private:
     void     GetMacDestinationAddress(const Ip6::Address &aIp6Addr, Mac::Address &aMacAddr);
     void     GetMacSourceAddress(const Ip6::Address &aIp6Addr, Mac::Address &aMacAddr);
     Message *GetDirectTransmission(void);
-    void     HandleMesh(uint8_t *             aFrame,
+    void     HandleMesh(const uint8_t *       aFrame,
                         uint16_t              aFrameLength,
                         const Mac::Address &  aMacSource,
                         const ThreadLinkInfo &aLinkInfo);
@@ -439,6 +587,8 @@ private:
     otError UpdateIp6RouteFtd(Ip6::Header &ip6Header, Message &aMessage);
     otError UpdateMeshRoute(Message &aMessage);
     bool    UpdateReassemblyList(void);
+    otError MakeRoomForReassembly(const Message &aMessage, const Mac::Address &aMacSource);
+    void    EvictReassembly(Message &aMessage);
     void    UpdateFragmentPriority(Lowpan::FragmentHeader &aFragmentHeader,
                                    uint16_t                aFragmentLength,
                                    uint16_t                aSrcRloc16,
@@ -447,13 +597,25 @@ private:
     void    ClearReassemblyList(void);
     void    RemoveMessage(Message &aMessage);
     void    HandleDiscoverComplete(void);
+#if OPENTHREAD_FTD
+    Message *   SelectEvictionCandidate(const PriorityQueue &aQueue, Message::Priority aPriority, Message *aSelected);
+    Message *   SelectIndirectEvictionCandidate(Message::Priority aPriority);
+    void        RemoveMessageForChild(Message &aMessage, Child &aChild, Message::SubType aSubType);
+    bool        IsPreferredForEviction(const Message &aCandidate, const Message *aSelected);
+    static bool IsEvictionSelectionDone(const Message *aSelected);
+    uint32_t    GetSleepyChildAge(const Message &aMessage);
+#endif
 
-    void          HandleReceivedFrame(Mac::RxFrame &aFrame);
+    void          HandleReceivedFrame(Mac::RxFrame &aFrame, const Mac::ParsedFrame &aParsedFrame);
     Mac::TxFrame *HandleFrameRequest(Mac::TxFrames &aTxFrames);
     Neighbor *    UpdateNeighborOnSentFrame(Mac::TxFrame &aFrame, otError aError, const Mac::Address &aMacDest);
     void          UpdateNeighborLinkFailures(Neighbor &aNeighbor, otError aError, bool aAllowNeighborRemove);
     void          HandleSentFrame(Mac::TxFrame &aFrame, otError aError);
     void          UpdateSendMessage(otError aFrameTxError, Mac::Address &aMacDest, Neighbor *aNeighbor);
+#if OPENTHREAD_CONFIG_MAC_TX_PIPELINE_ENABLE
+    otError       HandleNextFrameRequest(Mac::TxFrame &aFrame);
+    otError       HandlePipelinedFrameRequest(void);
+#endif
 
     void        HandleTimeTick(void);
     static void ScheduleTransmissionTask(Tasklet &aTasklet);
@@ -540,10 +702,11 @@ private:
                        otLogLevel          aLogLevel);
 #endif // #if (OPENTHREAD_CONFIG_LOG_LEVEL >= OT_LOG_LEVEL_NOTE) && (OPENTHREAD_CONFIG_LOG_MAC == 1)
 
-    PriorityQueue mSendQueue;
-    MessageQueue  mReassemblyList;
-    uint16_t      mFragTag;
-    uint16_t      mMessageNextOffset;
+    SendQueue       mSendQueue;
+    MessageQueue    mReassemblyList;
+    ReassemblyTable mReassemblyTable;
+    uint16_t        mFragTag;
+    uint16_t        mMessageNextOffset;
 
     Message *mSendMessage;
 
@@ -558,7 +721,13 @@ private:
 
     Tasklet mScheduleTransmissionTask;
 
-    otIpCounters mIpCounters;
+#if OPENTHREAD_CONFIG_MAC_TX_PIPELINE_ENABLE
+    PipelinedFrameInfo mPipelinedFrameInfo;
+#endif
+
+    otIpCounters              mIpCounters;
+    otReassemblyCounters      mReassemblyCounters;
+    otMessageEvictionCounters mEvictionCounters;
 
 #if OPENTHREAD_FTD
     FragmentPriorityList mFragmentPriorityList;
@@ -37,6 +37,7 @@
 
 #include "common/locator-getters.hpp"
 #include "common/logging.hpp"
+#include "common/numeric_limits.hpp"
 #include "meshcop/meshcop.hpp"
 #include "net/ip6.hpp"
 #include "net/tcp.hpp"
@@ -130,6 +131,7 @@ otError MeshForwarder::SendMessage(Message &aMessage)
         break;
     }
 
+    mSendQueue.UpdateDirectIndex(aMessage);
     mScheduleTransmissionTask.Post();
 
     return error;
@@ -177,134 +179,244 @@ void MeshForwarder::HandleResolved(const Ip6::Address &aEid, otError aError)
 
 otError MeshForwarder::EvictMessage(Message::Priority aPriority)
 {
-    otError        error    = OT_ERROR_NOT_FOUND;
-    PriorityQueue *queues[] = {&mResolvingQueue, &mSendQueue};
-    Message *      evict    = nullptr;
+    otError  error = OT_ERROR_NOT_FOUND;
+    Message *evict = nullptr;
+    uint8_t  priority;
 
-    // search for a lower priority message to evict (choose lowest priority message among all queues)
-    for (PriorityQueue *queue : queues)
+    // Search for a lower priority message to evict, starting from
+    // the lowest priority level. The messages of a priority level
+    // are contiguous in a queue, so the candidates are found from
+    // the head of the level without scanning the queue.
+
+    for (priority = 0; priority < aPriority; priority++)
     {
-        for (uint8_t priority = 0; priority < aPriority; priority++)
+        evict = SelectEvictionCandidate(mResolvingQueue, static_cast<Message::Priority>(priority), nullptr);
+        evict = SelectEvictionCandidate(mSendQueue, static_cast<Message::Priority>(priority), evict);
+
+        if (evict != nullptr)
         {
-            for (Message *message = queue->GetHeadForPriority(static_cast<Message::Priority>(priority)); message;
-                 message          = message->GetNext())
-            {
-                if (message->GetPriority() != priority)
-                {
-                    break;
-                }
+            mEvictionCounters.mLowerPriority[priority]++;
+            ExitNow(error = OT_ERROR_NONE);
+        }
+    }
 
-                if (message->GetDoNotEvict())
-                {
-                    continue;
-                }
+    // Search for an equal or higher priority message pending
+    // indirect transmission to evict.
 
-                evict     = message;
-                aPriority = static_cast<Message::Priority>(priority);
-                break;
-            }
+    for (priority = aPriority; priority < Message::kNumPriorities; priority++)
+    {
+        evict = SelectIndirectEvictionCandidate(static_cast<Message::Priority>(priority));
+
+        if (evict != nullptr)
+        {
+            mEvictionCounters.mPendingIndirect[priority]++;
+            ExitNow(error = OT_ERROR_NONE);
         }
     }
 
-    if (evict != nullptr)
+    mEvictionCounters.mNotFound++;
+
+exit:
+
+    if (error == OT_ERROR_NONE)
     {
-        ExitNow(error = OT_ERROR_NONE);
+        RemoveMessage(*evict);
     }
 
-    for (uint8_t priority = aPriority; priority < Message::kNumPriorities; priority++)
+    return error;
+}
+
+Message *MeshForwarder::SelectEvictionCandidate(const PriorityQueue &aQueue,
+                                                Message::Priority    aPriority,
+                                                Message *            aSelected)
+{
+    for (Message *message = aQueue.GetHeadForPriority(aPriority); message != nullptr; message = message->GetNext())
     {
-        // search for an equal or higher priority indirect message to evict
-        for (Message *message = mSendQueue.GetHeadForPriority(aPriority); message; message = message->GetNext())
+        if ((message->GetPriority() != aPriority) || IsEvictionSelectionDone(aSelected))
         {
-            if (message->GetPriority() != priority)
-            {
-                break;
-            }
+            break;
+        }
 
-            if (message->GetDoNotEvict())
-            {
-                continue;
-            }
+        if (!message->GetDoNotEvict() && IsPreferredForEviction(*message, aSelected))
+        {
+            aSelected = message;
+        }
+    }
 
-            if (message->IsChildPending())
-            {
-                evict = message;
-                ExitNow(error = OT_ERROR_NONE);
-            }
+    return aSelected;
+}
+
+Message *MeshForwarder::SelectIndirectEvictionCandidate(Message::Priority aPriority)
+{
+    Message *selected = nullptr;
+
+    for (Message *message = mSendQueue.GetHeadForIndirectEviction(aPriority); message != nullptr;
+         message          = mSendQueue.GetNextForIndirectEviction(*message))
+    {
+        if (IsEvictionSelectionDone(selected))
+        {
+            break;
+        }
+
+        if (message->IsChildPending() && !message->GetDoNotEvict() && IsPreferredForEviction(*message, selected))
+        {
+            selected = message;
         }
     }
 
+    return selected;
+}
+
+bool MeshForwarder::IsEvictionSelectionDone(const Message *aSelected)
+{
+    // With the oldest-first policy the first candidate is evicted, so
+    // the remaining candidates need not be visited.
+
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_EVICTION_POLICY == OPENTHREAD_CONFIG_MESH_FORWARDER_EVICTION_POLICY_OLDEST
+    return (aSelected != nullptr);
+#else
+    OT_UNUSED_VARIABLE(aSelected);
+
+    return false;
+#endif
+}
+
+bool MeshForwarder::IsPreferredForEviction(const Message &aCandidate, const Message *aSelected)
+{
+    bool preferred = (aSelected == nullptr);
+
+    VerifyOrExit(!preferred);
+
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_EVICTION_POLICY == OPENTHREAD_CONFIG_MESH_FORWARDER_EVICTION_POLICY_LARGEST
+    preferred = (aCandidate.GetBufferCount() > aSelected->GetBufferCount());
+#elif OPENTHREAD_CONFIG_MESH_FORWARDER_EVICTION_POLICY == \
+    OPENTHREAD_CONFIG_MESH_FORWARDER_EVICTION_POLICY_SLEEPY_CHILD_AGE
+    preferred = (GetSleepyChildAge(aCandidate) > GetSleepyChildAge(*aSelected));
+#else
+    OT_UNUSED_VARIABLE(aCandidate);
+#endif
+
 exit:
+    return preferred;
+}
 
-    if (error == OT_ERROR_NONE)
+uint32_t MeshForwarder::GetSleepyChildAge(const Message &aMessage)
+{
+    // The age of a message is the time since the most recently heard
+    // of the sleepy children it is pending for, so a message is only
+    // considered stale once all of its children are. Only the children
+    // set in the message's child mask are visited.
+
+    TimeMilli now = TimerMilli::GetNow();
+    uint32_t  age = NumericLimits<uint32_t>::Max();
+
+    VerifyOrExit(aMessage.IsChildPending(), age = 0);
+
+    for (uint16_t childIndex = 0; aMessage.GetNextChildIndex(childIndex); childIndex++)
     {
-        RemoveMessage(*evict);
+        Child *child = Get<ChildTable>().GetChildAtIndex(childIndex);
+
+        if ((child != nullptr) && !child->IsStateInvalid())
+        {
+            age = OT_MIN(age, now - child->GetLastHeard());
+        }
     }
 
-    return error;
+exit:
+    return age;
 }
 
 void MeshForwarder::RemoveMessages(Child &aChild, Message::SubType aSubType)
 {
     Message *nextMessage;
 
-    for (Message *message = mSendQueue.GetHead(); message; message = nextMessage)
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_SEND_QUEUE_INDEX_ENABLE
+    uint16_t childIndex = Get<ChildTable>().GetChildIndex(aChild);
+
+    // Only direct messages and messages pending indirect tx to the
+    // child are affected, so the direct index and the child's indirect
+    // lists are walked instead of the whole send queue.
+
+    for (Message *message = mSendQueue.GetHeadForDirectTx(); message; message = nextMessage)
     {
-        nextMessage = message->GetNext();
+        nextMessage = mSendQueue.GetNextForDirectTx(*message);
+        RemoveMessageForChild(*message, aChild, aSubType);
+    }
+
+    for (Message *message = mIndirectSender.GetHeadForChild(childIndex); message; message = nextMessage)
+    {
+        nextMessage = mIndirectSender.GetNextForChild(*message);
 
-        if ((aSubType != Message::kSubTypeNone) && (aSubType != message->GetSubType()))
+        if (message->GetChildMask(childIndex))
         {
-            continue;
+            RemoveMessageForChild(*message, aChild, aSubType);
         }
+    }
+#else
+    for (Message *message = mSendQueue.GetHead(); message; message = nextMessage)
+    {
+        nextMessage = message->GetNext();
+        RemoveMessageForChild(*message, aChild, aSubType);
+    }
+#endif
+}
 
-        if (mIndirectSender.RemoveMessageFromSleepyChild(*message, aChild) != OT_ERROR_NONE)
-        {
-            switch (message->GetType())
-            {
-            case Message::kTypeIp6:
-            {
-                Ip6::Header ip6header;
+void MeshForwarder::RemoveMessageForChild(Message &aMessage, Child &aChild, Message::SubType aSubType)
+{
+    VerifyOrExit((aSubType == Message::kSubTypeNone) || (aSubType == aMessage.GetSubType()));
 
-                IgnoreError(message->Read(0, ip6header));
+    if (mIndirectSender.RemoveMessageFromSleepyChild(aMessage, aChild) != OT_ERROR_NONE)
+    {
+        switch (aMessage.GetType())
+        {
+        case Message::kTypeIp6:
+        {
+            Ip6::Header ip6header;
 
-                if (&aChild == static_cast<Child *>(Get<NeighborTable>().FindNeighbor(ip6header.GetDestination())))
-                {
-                    message->ClearDirectTransmission();
-                }
+            IgnoreError(aMessage.Read(0, ip6header));
 
-                break;
+            if (&aChild == static_cast<Child *>(Get<NeighborTable>().FindNeighbor(ip6header.GetDestination())))
+            {
+                aMessage.ClearDirectTransmission();
+                mSendQueue.UpdateDirectIndex(aMessage);
             }
 
-            case Message::kType6lowpan:
-            {
-                Lowpan::MeshHeader meshHeader;
+            break;
+        }
 
-                IgnoreError(meshHeader.ParseFrom(*message));
+        case Message::kType6lowpan:
+        {
+            Lowpan::MeshHeader meshHeader;
 
-                if (&aChild == static_cast<Child *>(Get<NeighborTable>().FindNeighbor(meshHeader.GetDestination())))
-                {
-                    message->ClearDirectTransmission();
-                }
+            IgnoreError(meshHeader.ParseFrom(aMessage));
 
-                break;
+            if (&aChild == static_cast<Child *>(Get<NeighborTable>().FindNeighbor(meshHeader.GetDestination())))
+            {
+                aMessage.ClearDirectTransmission();
+                mSendQueue.UpdateDirectIndex(aMessage);
             }
 
-            default:
-                break;
-            }
+            break;
         }
 
-        if (!message->IsChildPending() && !message->GetDirectTransmission())
-        {
-            if (mSendMessage == message)
-            {
-                mSendMessage = nullptr;
-            }
+        default:
+            break;
+        }
+    }
 
-            mSendQueue.Dequeue(*message);
-            message->Free();
+    if (!aMessage.IsChildPending() && !aMessage.GetDirectTransmission())
+    {
+        if (mSendMessage == &aMessage)
+        {
+            mSendMessage = nullptr;
         }
+
+        mSendQueue.Dequeue(aMessage);
+        aMessage.Free();
     }
+
+exit:
+    return;
 }
 
 void MeshForwarder::RemoveDataResponseMessages(void)
@@ -610,7 +722,7 @@ void MeshForwarder::SendDestinationUnreachable(uint16_t aMeshSource, const Messa
                                            Ip6::Icmp::Header::kCodeDstUnreachNoRoute, messageInfo, aMessage));
 }
 
-void MeshForwarder::HandleMesh(uint8_t *             aFrame,
+void MeshForwarder::HandleMesh(const uint8_t *       aFrame,
                                uint16_t              aFrameLength,
                                const Mac::Address &  aMacSource,
                                const ThreadLinkInfo &aLinkInfo)
@@ -58,11 +58,17 @@ otError MeshForwarder::EvictMessage(Message::Priority aPriority)
 
     if (message->GetPriority() < static_cast<uint8_t>(aPriority))
     {
+        mEvictionCounters.mLowerPriority[message->GetPriority()]++;
         RemoveMessage(*message);
         ExitNow(error = OT_ERROR_NONE);
     }
 
 exit:
+    if (error != OT_ERROR_NONE)
+    {
+        mEvictionCounters.mNotFound++;
+    }
+
     return error;
 }
 
@@ -899,6 +899,11 @@ void Mle::SetRloc16(uint16_t aRloc16)
     Get<Mac::Mac>().SetShortAddress(aRloc16);
     Get<Ip6::Mpl>().SetSeedId(aRloc16);
 
+#if OPENTHREAD_FTD
+    // Link costs exclude the entry of this device, which is found by RLOC16.
+    Get<RouterTable>().InvalidateRoutes();
+#endif
+
     if (aRloc16 != Mac::kShortAddrInvalid)
     {
         // mesh-local 16
@@ -2508,8 +2513,6 @@ otError Mle::SendMessage(Message &aMessage, const Ip6::Address &aDestination)
     uint8_t          nonce[Crypto::AesCcm::kNonceSize];
     uint8_t          tag[kMleSecurityTagSize];
     Crypto::AesCcm   aesCcm;
-    uint8_t          buf[64];
-    uint16_t         length;
     Ip6::MessageInfo messageInfo;
 
     IgnoreError(aMessage.Read(0, header));
@@ -2526,7 +2529,7 @@ otError Mle::SendMessage(Message &aMessage, const Ip6::Address &aDestination)
         Crypto::AesCcm::GenerateNonce(Get<Mac::Mac>().GetExtAddress(), Get<KeyManager>().GetMleFrameCounter(),
                                       Mac::Frame::kSecEncMic32, nonce);
 
-        aesCcm.SetKey(Get<KeyManager>().GetCurrentMleKey());
+        aesCcm.SetKey(Get<KeyManager>().GetAesKeySchedule(KeyManager::kKeyTypeMle, keySequence));
         aesCcm.Init(16 + 16 + header.GetHeaderLength(), aMessage.GetLength() - (header.GetLength() - 1), sizeof(tag),
                     nonce, sizeof(nonce));
 
@@ -2535,14 +2538,9 @@ otError Mle::SendMessage(Message &aMessage, const Ip6::Address &aDestination)
         aesCcm.Header(header.GetBytes() + 1, header.GetHeaderLength());
 
         aMessage.SetOffset(header.GetLength() - 1);
-
-        while (aMessage.GetOffset() < aMessage.GetLength())
-        {
-            length = aMessage.ReadBytes(aMessage.GetOffset(), buf, sizeof(buf));
-            aesCcm.Payload(buf, buf, length, Crypto::AesCcm::kEncrypt);
-            aMessage.WriteBytes(aMessage.GetOffset(), buf, length);
-            aMessage.MoveOffset(length);
-        }
+        aesCcm.Payload(aMessage, aMessage.GetOffset(), aMessage.GetLength() - aMessage.GetOffset(),
+                       Crypto::AesCcm::kEncrypt);
+        aMessage.SetOffset(aMessage.GetLength());
 
         aesCcm.Finalize(tag);
         SuccessOrExit(error = aMessage.AppendBytes(tag, sizeof(tag)));
@@ -2589,14 +2587,12 @@ void Mle::HandleUdpReceive(Message &aMessage, const Ip6::MessageInfo &aMessageIn
     otError         error = OT_ERROR_NONE;
     Header          header;
     uint32_t        keySequence;
-    const Key *     mleKey;
     uint32_t        frameCounter;
     uint8_t         messageTag[kMleSecurityTagSize];
     uint8_t         nonce[Crypto::AesCcm::kNonceSize];
     Mac::ExtAddress extAddr;
     Crypto::AesCcm  aesCcm;
     uint16_t        mleOffset;
-    uint8_t         buf[64];
     uint16_t        length;
     uint8_t         tag[kMleSecurityTagSize];
     uint8_t         command;
@@ -2638,15 +2634,6 @@ void Mle::HandleUdpReceive(Message &aMessage, const Ip6::MessageInfo &aMessageIn
 
     keySequence = header.GetKeyId();
 
-    if (keySequence == Get<KeyManager>().GetCurrentKeySequence())
-    {
-        mleKey = &Get<KeyManager>().GetCurrentMleKey();
-    }
-    else
-    {
-        mleKey = &Get<KeyManager>().GetTemporaryMleKey(keySequence);
-    }
-
     VerifyOrExit(aMessage.GetOffset() + header.GetLength() + sizeof(messageTag) <= aMessage.GetLength(),
                  error = OT_ERROR_PARSE);
     aMessage.MoveOffset(header.GetLength() - 1);
@@ -2659,7 +2646,7 @@ void Mle::HandleUdpReceive(Message &aMessage, const Ip6::MessageInfo &aMessageIn
     frameCounter = header.GetFrameCounter();
     Crypto::AesCcm::GenerateNonce(extAddr, frameCounter, Mac::Frame::kSecEncMic32, nonce);
 
-    aesCcm.SetKey(*mleKey);
+    aesCcm.SetKey(Get<KeyManager>().GetAesKeySchedule(KeyManager::kKeyTypeMle, keySequence));
     aesCcm.Init(sizeof(aMessageInfo.GetPeerAddr()) + sizeof(aMessageInfo.GetSockAddr()) + header.GetHeaderLength(),
                 aMessage.GetLength() - aMessage.GetOffset(), sizeof(messageTag), nonce, sizeof(nonce));
 
@@ -2669,15 +2656,18 @@ void Mle::HandleUdpReceive(Message &aMessage, const Ip6::MessageInfo &aMessageIn
 
     mleOffset = aMessage.GetOffset();
 
+#ifndef FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION
+    aesCcm.Payload(aMessage, mleOffset, aMessage.GetLength() - mleOffset, Crypto::AesCcm::kDecrypt);
+#else
     while (aMessage.GetOffset() < aMessage.GetLength())
     {
+        uint8_t buf[64];
+
         length = aMessage.ReadBytes(aMessage.GetOffset(), buf, sizeof(buf));
         aesCcm.Payload(buf, buf, length, Crypto::AesCcm::kDecrypt);
-#ifndef FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION
-        aMessage.WriteBytes(aMessage.GetOffset(), buf, length);
-#endif
         aMessage.MoveOffset(length);
     }
+#endif
 
     aesCcm.Finalize(tag);
 #ifndef FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION
@@ -57,6 +57,9 @@ namespace Mle {
 MleRouter::MleRouter(Instance &aInstance)
     : Mle(aInstance)
     , mAdvertiseTimer(aInstance, MleRouter::HandleAdvertiseTimer, nullptr)
+#if OPENTHREAD_CONFIG_MLE_CHILD_TIMEOUT_INDEX_ENABLE
+    , mChildTimer(aInstance, MleRouter::HandleChildTimer)
+#endif
     , mAddressSolicit(UriPath::kAddressSolicit, &MleRouter::HandleAddressSolicit, this)
     , mAddressRelease(UriPath::kAddressRelease, &MleRouter::HandleAddressRelease, this)
     , mChildTable(aInstance)
@@ -73,6 +76,11 @@ MleRouter::MleRouter(Instance &aInstance)
     , mRouterEligible(true)
     , mAddressSolicitPending(false)
     , mAddressSolicitRejected(false)
+#if OPENTHREAD_CONFIG_MLE_CHILD_TIMEOUT_INDEX_ENABLE
+    , mChildNetworkDataSynced(false)
+    , mSyncedNetworkDataVersion(0)
+    , mSyncedStableNetworkDataVersion(0)
+#endif
     , mPreviousPartitionIdRouter(0)
     , mPreviousPartitionId(0)
     , mPreviousPartitionRouterIdSequence(0)
@@ -235,6 +243,9 @@ void MleRouter::HandleDetachStart(void)
     mRouterTable.ClearNeighbors();
     StopLeader();
     Get<TimeTicker>().UnregisterReceiver(TimeTicker::kMleRouter);
+#if OPENTHREAD_CONFIG_MLE_CHILD_TIMEOUT_INDEX_ENABLE
+    mChildTimer.Stop();
+#endif
 }
 
 void MleRouter::HandleChildStart(AttachMode aMode)
@@ -246,6 +257,9 @@ void MleRouter::HandleChildStart(AttachMode aMode)
 
     StopLeader();
     Get<TimeTicker>().RegisterReceiver(TimeTicker::kMleRouter);
+#if OPENTHREAD_CONFIG_MLE_CHILD_TIMEOUT_INDEX_ENABLE
+    ScheduleAllChildTimeouts();
+#endif
 
     if (mRouterEligible)
     {
@@ -342,6 +356,10 @@ void MleRouter::SetStateRouter(uint16_t aRloc16)
             RemoveNeighbor(child);
         }
     }
+
+#if OPENTHREAD_CONFIG_MLE_CHILD_TIMEOUT_INDEX_ENABLE
+    ScheduleAllChildTimeouts();
+#endif
 }
 
 void MleRouter::SetStateLeader(uint16_t aRloc16)
@@ -383,6 +401,10 @@ void MleRouter::SetStateLeader(uint16_t aRloc16)
         }
     }
 
+#if OPENTHREAD_CONFIG_MLE_CHILD_TIMEOUT_INDEX_ENABLE
+    ScheduleAllChildTimeouts();
+#endif
+
     otLogNoteMle("Leader partition id 0x%x", mLeaderData.GetPartitionId());
 }
 
@@ -616,6 +638,7 @@ void MleRouter::HandleLinkRequest(const Message &aMessage, const Ip6::MessageInf
                 neighbor->ResetLinkFailures();
                 neighbor->SetLastHeard(TimerMilli::GetNow());
                 neighbor->SetState(Neighbor::kStateLinkRequest);
+                mRouterTable.InvalidateRoutes();
             }
             else
             {
@@ -729,6 +752,7 @@ otError MleRouter::SendLinkAccept(const Ip6::MessageInfo &aMessageInfo,
         SuccessOrExit(error = AppendTlvRequest(*message, routerTlvs, sizeof(routerTlvs)));
         aNeighbor->SetLastHeard(TimerMilli::GetNow());
         aNeighbor->SetState(Neighbor::kStateLinkRequest);
+        mRouterTable.InvalidateRoutes();
     }
 
 #if OPENTHREAD_CONFIG_TIME_SYNC_ENABLE
@@ -957,6 +981,7 @@ otError MleRouter::HandleLinkAccept(const Message &         aMessage,
     router->ResetLinkFailures();
     router->SetState(Neighbor::kStateValid);
     router->SetKeySequence(aKeySequence);
+    mRouterTable.InvalidateRoutes();
 
     mNeighborTable.Signal(OT_NEIGHBOR_TABLE_EVENT_ROUTER_ADDED, *router);
 
@@ -1313,6 +1338,7 @@ otError MleRouter::HandleAdvertisement(const Message &         aMessage,
                             leader->SetCost(0);
                         }
 
+                        mRouterTable.InvalidateRoutes();
                         break;
                     }
                 }
@@ -1333,6 +1359,7 @@ otError MleRouter::HandleAdvertisement(const Message &         aMessage,
                 router->ResetLinkFailures();
                 router->SetLastHeard(TimerMilli::GetNow());
                 router->SetState(Neighbor::kStateLinkRequest);
+                mRouterTable.InvalidateRoutes();
                 IgnoreError(SendLinkRequest(router));
                 ExitNow(error = OT_ERROR_NO_ROUTE);
             }
@@ -1380,6 +1407,7 @@ otError MleRouter::HandleAdvertisement(const Message &         aMessage,
             router->ResetLinkFailures();
             router->SetLastHeard(TimerMilli::GetNow());
             router->SetState(Neighbor::kStateLinkRequest);
+            mRouterTable.InvalidateRoutes();
             IgnoreError(SendLinkRequest(router));
             ExitNow(error = OT_ERROR_NO_ROUTE);
         }
@@ -1454,9 +1482,7 @@ void MleRouter::UpdateRoutes(const RouteTlv &aRoute, uint8_t aRouterId)
                     resetAdvInterval = true;
                 }
 
-                router->SetNextHop(aRouterId);
-                router->SetCost(cost);
-                changed = true;
+                changed |= UpdateRoute(*router, aRouterId, cost);
             }
             else if (nextHop == neighbor)
             {
@@ -1465,10 +1491,8 @@ void MleRouter::UpdateRoutes(const RouteTlv &aRoute, uint8_t aRouterId)
                     resetAdvInterval = true;
                 }
 
-                router->SetNextHop(kInvalidRouterId);
-                router->SetCost(0);
+                changed |= UpdateRoute(*router, kInvalidRouterId, 0);
                 router->SetLastHeard(TimerMilli::GetNow());
-                changed = true;
             }
         }
         else
@@ -1478,9 +1502,7 @@ void MleRouter::UpdateRoutes(const RouteTlv &aRoute, uint8_t aRouterId)
 
             if (newCost < curCost)
             {
-                router->SetNextHop(aRouterId);
-                router->SetCost(cost);
-                changed = true;
+                changed |= UpdateRoute(*router, aRouterId, cost);
             }
         }
 
@@ -1514,6 +1536,21 @@ exit:
     return;
 }
 
+bool MleRouter::UpdateRoute(Router &aRouter, uint8_t aNextHop, uint8_t aCost)
+{
+    bool changed = (aRouter.GetNextHop() != aNextHop) || (aRouter.GetCost() != aCost);
+
+    aRouter.SetNextHop(aNextHop);
+    aRouter.SetCost(aCost);
+
+#if OPENTHREAD_CONFIG_MLE_ROUTE_TABLE_ENABLE
+    // A new next hop or route cost may still leave the selected route unchanged (e.g. the direct link is cheaper).
+    changed = changed && mRouterTable.UpdateRoute(aRouter.GetRouterId());
+#endif
+
+    return changed;
+}
+
 bool MleRouter::UpdateLinkQualityOut(const RouteTlv &aRoute, Router &aNeighbor, bool &aResetAdvInterval)
 {
     bool    changed = false;
@@ -1538,6 +1575,7 @@ bool MleRouter::UpdateLinkQualityOut(const RouteTlv &aRoute, Router &aNeighbor,
     oldLinkCost = mRouterTable.GetLinkCost(aNeighbor);
 
     aNeighbor.SetLinkQualityOut(linkQuality);
+    mRouterTable.InvalidateRoutes();
     nextHop = mRouterTable.GetRouter(aNeighbor.GetNextHop());
 
     // reset MLE advertisement timer if neighbor route cost changed to or from infinite
@@ -1646,6 +1684,9 @@ void MleRouter::HandleParentRequest(const Message &aMessage, const Ip6::MessageI
     {
         child->SetLastHeard(TimerMilli::GetNow());
         child->SetTimeout(Time::MsecToSec(kMaxChildIdRequestTimeout));
+#if OPENTHREAD_CONFIG_MLE_CHILD_TIMEOUT_INDEX_ENABLE
+        ScheduleChildTimeout(*child);
+#endif
     }
 
     SendParentResponse(child, challenge, !ScanMaskTlv::IsEndDeviceFlagSet(scanMask));
@@ -1766,6 +1807,7 @@ void MleRouter::HandleTimeTick(void)
         break;
     }
 
+#if !OPENTHREAD_CONFIG_MLE_CHILD_TIMEOUT_INDEX_ENABLE
     // update children state
     for (Child &child : Get<ChildTable>().Iterate(Child::kInStateAnyExceptInvalid))
     {
@@ -1810,6 +1852,7 @@ void MleRouter::HandleTimeTick(void)
             IgnoreError(SendChildUpdateRequest(child));
         }
     }
+#endif // !OPENTHREAD_CONFIG_MLE_CHILD_TIMEOUT_INDEX_ENABLE
 
     // update router state
     for (Router &router : Get<RouterTable>().Iterate())
@@ -1889,6 +1932,170 @@ exit:
     return;
 }
 
+#if OPENTHREAD_CONFIG_MLE_CHILD_TIMEOUT_INDEX_ENABLE
+
+void MleRouter::ScheduleChildTimeout(Child &aChild)
+{
+    // A changed child may also need a Network Data update.
+    mChildNetworkDataSynced = false;
+
+    UpdateChildTimeout(aChild, TimerMilli::GetNow(), 0);
+    StartChildTimer();
+}
+
+void MleRouter::ScheduleAllChildTimeouts(void)
+{
+    TimeMilli now = TimerMilli::GetNow();
+
+    mChildNetworkDataSynced = false;
+
+    for (Child &child : Get<ChildTable>().Iterate(Child::kInStateAnyExceptInvalid))
+    {
+        UpdateChildTimeout(child, now, 0);
+    }
+
+    StartChildTimer();
+}
+
+otError MleRouter::GetNextChildTimeout(const Child &aChild, TimeMilli aNow, uint32_t &aDelay) const
+{
+    otError   error = OT_ERROR_NONE;
+    uint32_t  elapsed;
+    uint32_t  timeout;
+    TimeMilli supervisionTime;
+
+    switch (aChild.GetState())
+    {
+    case Neighbor::kStateParentRequest:
+    case Neighbor::kStateValid:
+    case Neighbor::kStateRestored:
+    case Neighbor::kStateChildUpdateRequest:
+        break;
+
+    default:
+        ExitNow(error = OT_ERROR_NOT_FOUND);
+    }
+
+    elapsed = aNow - aChild.GetLastHeard();
+    timeout = Time::SecToMsec(aChild.GetTimeout());
+    aDelay  = (elapsed < timeout) ? (timeout - elapsed) : 0;
+
+#if OPENTHREAD_CONFIG_MAC_CSL_TRANSMITTER_ENABLE
+    if (aChild.IsCslSynchronized())
+    {
+        elapsed = aNow - aChild.GetCslLastHeard();
+        timeout = Time::SecToMsec(aChild.GetCslTimeout());
+        aDelay  = OT_MIN(aDelay, (elapsed < timeout) ? (timeout - elapsed) : 0);
+    }
+#endif
+
+    if (IsRouterOrLeader() && aChild.IsStateRestored())
+    {
+        aDelay = 0;
+    }
+
+    if (Get<Utils::ChildSupervisor>().GetNextSupervisionTime(aChild, supervisionTime) == OT_ERROR_NONE)
+    {
+        aDelay = OT_MIN(aDelay, (supervisionTime > aNow) ? (supervisionTime - aNow) : 0);
+    }
+
+    aDelay = OT_MIN(aDelay, Timer::kMaxDelay);
+
+exit:
+    return error;
+}
+
+void MleRouter::UpdateChildTimeout(Child &aChild, TimeMilli aNow, uint32_t aMinDelay)
+{
+    uint32_t delay;
+
+    if (GetNextChildTimeout(aChild, aNow, delay) == OT_ERROR_NONE)
+    {
+        mChildTable.UpdateTimeoutIndex(aChild, aNow + OT_MAX(delay, aMinDelay));
+    }
+    else
+    {
+        mChildTable.RemoveFromTimeoutIndex(aChild);
+    }
+}
+
+void MleRouter::HandleChildTimeout(Child &aChild, TimeMilli aNow)
+{
+#if OPENTHREAD_CONFIG_MAC_CSL_TRANSMITTER_ENABLE
+    if (aChild.IsCslSynchronized() && aNow - aChild.GetCslLastHeard() >= Time::SecToMsec(aChild.GetCslTimeout()))
+    {
+        otLogInfoMle("Child CSL synchronization expired");
+        aChild.SetCslSynchronized(false);
+        Get<CslTxScheduler>().Update();
+    }
+#endif
+
+    if (aNow - aChild.GetLastHeard() >= Time::SecToMsec(aChild.GetTimeout()))
+    {
+        otLogInfoMle("Child timeout expired");
+        RemoveNeighbor(aChild);
+        ExitNow();
+    }
+
+    if (IsRouterOrLeader() && aChild.IsStateRestored())
+    {
+        IgnoreError(SendChildUpdateRequest(aChild));
+    }
+
+    Get<Utils::ChildSupervisor>().SuperviseChild(aChild);
+
+exit:
+    return;
+}
+
+void MleRouter::StartChildTimer(void)
+{
+    TimeMilli time;
+
+    if (IsAttached() && (mChildTable.GetNextTimeout(time) != nullptr))
+    {
+        mChildTimer.FireAt(time);
+    }
+    else
+    {
+        mChildTimer.Stop();
+    }
+}
+
+void MleRouter::HandleChildTimer(Timer &aTimer)
+{
+    aTimer.Get<MleRouter>().HandleChildTimer();
+}
+
+void MleRouter::HandleChildTimer(void)
+{
+    TimeMilli now = TimerMilli::GetNow();
+    TimeMilli time;
+    Child *   child;
+
+    VerifyOrExit(IsAttached());
+
+    // Only the children that are due are processed. A child may be
+    // found not to be due yet (it was heard from since it was keyed),
+    // in which case it is simply moved to its next timeout. A child
+    // still due after being processed (e.g., a supervision message or
+    // a Child Update Request could not be sent yet) is retried one
+    // state update period later.
+
+    while (((child = mChildTable.GetNextTimeout(time)) != nullptr) && (time <= now))
+    {
+        HandleChildTimeout(*child, now);
+        UpdateChildTimeout(*child, now, kStateUpdatePeriod);
+    }
+
+    StartChildTimer();
+
+exit:
+    return;
+}
+
+#endif // OPENTHREAD_CONFIG_MLE_CHILD_TIMEOUT_INDEX_ENABLE
+
 void MleRouter::SendParentResponse(Child *aChild, const Challenge &aChallenge, bool aRoutersOnlyRequest)
 {
     otError      error = OT_ERROR_NONE;
@@ -2270,6 +2477,9 @@ void MleRouter::HandleChildIdRequest(const Message &         aMessage,
 #if OPENTHREAD_CONFIG_MULTI_RADIO
     child->ClearLastRxFragmentTag();
 #endif
+#if OPENTHREAD_CONFIG_MLE_CHILD_TIMEOUT_INDEX_ENABLE
+    ScheduleChildTimeout(*child);
+#endif
 
     if (mode.IsFullNetworkData())
     {
@@ -2498,6 +2708,10 @@ void MleRouter::HandleChildUpdateRequest(const Message &         aMessage,
         Get<IndirectSender>().HandleChildModeChange(*child, oldMode);
     }
 
+#if OPENTHREAD_CONFIG_MLE_CHILD_TIMEOUT_INDEX_ENABLE
+    ScheduleChildTimeout(*child);
+#endif
+
     if (child->IsStateRestoring())
     {
         SetChildStateToValid(*child);
@@ -2658,6 +2872,9 @@ void MleRouter::HandleChildUpdateResponse(const Message &         aMessage,
     child->SetLastHeard(TimerMilli::GetNow());
     child->SetKeySequence(aKeySequence);
     child->GetLinkInfo().AddRss(aMessageInfo.GetThreadLinkInfo()->GetRss());
+#if OPENTHREAD_CONFIG_MLE_CHILD_TIMEOUT_INDEX_ENABLE
+    ScheduleChildTimeout(*child);
+#endif
 
 exit:
     LogProcessError(kTypeChildUpdateResponseOfChild, error);
@@ -2739,8 +2956,22 @@ exit:
 
 void MleRouter::SynchronizeChildNetworkData(void)
 {
+#if OPENTHREAD_CONFIG_MLE_CHILD_TIMEOUT_INDEX_ENABLE
+    uint8_t dataVersion       = Get<NetworkData::Leader>().GetVersion();
+    uint8_t stableDataVersion = Get<NetworkData::Leader>().GetStableVersion();
+    bool    isSynced          = true;
+#endif
+
     VerifyOrExit(IsRouterOrLeader());
 
+#if OPENTHREAD_CONFIG_MLE_CHILD_TIMEOUT_INDEX_ENABLE
+    // Skip checking every child while the Network Data and the
+    // children are unchanged since all children were found in sync.
+    VerifyOrExit(!mChildNetworkDataSynced || (dataVersion != mSyncedNetworkDataVersion) ||
+                 (stableDataVersion != mSyncedStableNetworkDataVersion));
+    mChildNetworkDataSynced = false;
+#endif
+
     for (Child &child : Get<ChildTable>().Iterate(Child::kInStateValid))
     {
         uint8_t version;
@@ -2764,9 +2995,18 @@ void MleRouter::SynchronizeChildNetworkData(void)
             continue;
         }
 
+#if OPENTHREAD_CONFIG_MLE_CHILD_TIMEOUT_INDEX_ENABLE
+        isSynced = false;
+#endif
         SuccessOrExit(SendChildUpdateRequest(child));
     }
 
+#if OPENTHREAD_CONFIG_MLE_CHILD_TIMEOUT_INDEX_ENABLE
+    mChildNetworkDataSynced         = isSynced;
+    mSyncedNetworkDataVersion       = dataVersion;
+    mSyncedStableNetworkDataVersion = stableDataVersion;
+#endif
+
 exit:
     return;
 }
@@ -3349,6 +3589,9 @@ void MleRouter::RemoveNeighbor(Neighbor &aNeighbor)
         }
 
         mChildTable.RemoveStoredChild(static_cast<Child &>(aNeighbor));
+#if OPENTHREAD_CONFIG_MLE_CHILD_TIMEOUT_INDEX_ENABLE
+        mChildTable.RemoveFromTimeoutIndex(static_cast<Child &>(aNeighbor));
+#endif
     }
     else if (aNeighbor.IsStateValid())
     {
@@ -3360,6 +3603,7 @@ void MleRouter::RemoveNeighbor(Neighbor &aNeighbor)
 
     aNeighbor.GetLinkInfo().Clear();
     aNeighbor.SetState(Neighbor::kStateInvalid);
+    mRouterTable.InvalidateRoutes();
 #if OPENTHREAD_CONFIG_MLE_LINK_METRICS_ENABLE
     aNeighbor.RemoveAllForwardTrackingSeriesInfo();
 #endif
@@ -3370,12 +3614,14 @@ exit:
 
 uint16_t MleRouter::GetNextHop(uint16_t aDestination)
 {
-    uint8_t       destinationId = RouterIdFromRloc16(aDestination);
+    uint8_t  destinationId = RouterIdFromRloc16(aDestination);
+    uint16_t rval          = Mac::kShortAddrInvalid;
+#if !OPENTHREAD_CONFIG_MLE_ROUTE_TABLE_ENABLE
     uint8_t       routeCost;
     uint8_t       linkCost;
-    uint16_t      rval = Mac::kShortAddrInvalid;
     const Router *router;
     const Router *nextHop;
+#endif
 
     if (IsChild())
     {
@@ -3388,6 +3634,9 @@ uint16_t MleRouter::GetNextHop(uint16_t aDestination)
         ExitNow(rval = aDestination);
     }
 
+#if OPENTHREAD_CONFIG_MLE_ROUTE_TABLE_ENABLE
+    rval = mRouterTable.GetNextHop(destinationId);
+#else
     router = mRouterTable.GetRouter(destinationId);
     VerifyOrExit(router != nullptr);
 
@@ -3405,6 +3654,7 @@ uint16_t MleRouter::GetNextHop(uint16_t aDestination)
     {
         rval = Rloc16FromRouterId(destinationId);
     }
+#endif // OPENTHREAD_CONFIG_MLE_ROUTE_TABLE_ENABLE
 
 exit:
     return rval;
@@ -3412,6 +3662,9 @@ exit:
 
 uint8_t MleRouter::GetCost(uint16_t aRloc16)
 {
+#if OPENTHREAD_CONFIG_MLE_ROUTE_TABLE_ENABLE
+    return mRouterTable.GetPathCost(RouterIdFromRloc16(aRloc16));
+#else
     uint8_t routerId = RouterIdFromRloc16(aRloc16);
     uint8_t cost     = GetLinkCost(routerId);
     Router *router   = mRouterTable.GetRouter(routerId);
@@ -3428,6 +3681,7 @@ uint8_t MleRouter::GetCost(uint16_t aRloc16)
 
 exit:
     return cost;
+#endif
 }
 
 uint8_t MleRouter::GetRouteCost(uint16_t aRloc16) const
@@ -3477,6 +3731,7 @@ void MleRouter::ResolveRoutingLoops(uint16_t aSourceMac, uint16_t aDestRloc16)
 
     // invalidate next hop
     router->SetNextHop(kInvalidRouterId);
+    mRouterTable.InvalidateRoutes();
     ResetAdvertiseInterval();
 
 exit:
@@ -3682,6 +3937,8 @@ void MleRouter::HandleAddressSolicitResponse(Coap::Message *         aMessage,
         leader->SetNextHop(RouterIdFromRloc16(mParent.GetRloc16()));
     }
 
+    mRouterTable.InvalidateRoutes();
+
     // send link request
     IgnoreError(SendLinkRequest(nullptr));
 
@@ -4267,6 +4524,14 @@ void MleRouter::SetChildStateToValid(Child &aChild)
     aChild.SetState(Neighbor::kStateValid);
     IgnoreError(mChildTable.StoreChild(aChild));
 
+#if OPENTHREAD_CONFIG_MLE_CHILD_TIMEOUT_INDEX_ENABLE
+#if OPENTHREAD_CONFIG_CHILD_SUPERVISION_ENABLE
+    // The supervision interval starts when the child becomes valid.
+    aChild.ResetSecondsSinceLastSupervision();
+#endif
+    ScheduleChildTimeout(aChild);
+#endif
+
 #if OPENTHREAD_FTD && OPENTHREAD_CONFIG_TMF_PROXY_MLR_ENABLE
     Get<MlrManager>().UpdateProxiedSubscriptions(aChild, nullptr, 0);
 #endif
@@ -77,6 +77,7 @@ class MleRouter : public Mle
     friend class Mle;
     friend class ot::Instance;
     friend class ot::TimeTicker;
+    friend class MleRouterTester;
 
 public:
     /**
@@ -341,6 +342,28 @@ public:
      */
     void RemoveNeighbor(Neighbor &aNeighbor);
 
+#if OPENTHREAD_CONFIG_MLE_CHILD_TIMEOUT_INDEX_ENABLE
+    /**
+     * This method schedules the timeout processing of a child.
+     *
+     * It MUST be called after the state, the timeouts or the device mode of a child are changed, or when it became
+     * CSL synchronized. It does not need to be called when the child is heard from (the next timeout can only be
+     * later then, which is detected when the earlier one is processed).
+     *
+     * @param[in]  aChild  A reference to the child.
+     *
+     */
+    void ScheduleChildTimeout(Child &aChild);
+
+    /**
+     * This method schedules the timeout processing of all children.
+     *
+     * It MUST be called after a change affecting the timeouts of all children, e.g., the supervision interval.
+     *
+     */
+    void ScheduleAllChildTimeouts(void);
+#endif
+
     /**
      * This method invalidates a direct link to a neighboring router (due to failed link-layer acks).
      *
@@ -631,6 +654,7 @@ private:
     otError UpdateChildAddresses(const Message &aMessage, uint16_t aOffset, Child &aChild);
     void    UpdateRoutes(const RouteTlv &aRoute, uint8_t aRouterId);
     bool    UpdateLinkQualityOut(const RouteTlv &aRoute, Router &aNeighbor, bool &aResetAdvInterval);
+    bool    UpdateRoute(Router &aRouter, uint8_t aNextHop, uint8_t aCost);
 
     static void HandleAddressSolicitResponse(void *               aContext,
                                              otMessage *          aMessage,
@@ -657,7 +681,19 @@ private:
     bool        HandleAdvertiseTimer(void);
     void        HandleTimeTick(void);
 
+#if OPENTHREAD_CONFIG_MLE_CHILD_TIMEOUT_INDEX_ENABLE
+    otError     GetNextChildTimeout(const Child &aChild, TimeMilli aNow, uint32_t &aDelay) const;
+    void        UpdateChildTimeout(Child &aChild, TimeMilli aNow, uint32_t aMinDelay);
+    void        HandleChildTimeout(Child &aChild, TimeMilli aNow);
+    void        StartChildTimer(void);
+    static void HandleChildTimer(Timer &aTimer);
+    void        HandleChildTimer(void);
+#endif
+
     TrickleTimer mAdvertiseTimer;
+#if OPENTHREAD_CONFIG_MLE_CHILD_TIMEOUT_INDEX_ENABLE
+    TimerMilli mChildTimer;
+#endif
 
     Coap::Resource mAddressSolicit;
     Coap::Resource mAddressRelease;
@@ -679,9 +715,16 @@ private:
     bool mRouterEligible : 1;
     bool mAddressSolicitPending : 1;
     bool mAddressSolicitRejected : 1;
+#if OPENTHREAD_CONFIG_MLE_CHILD_TIMEOUT_INDEX_ENABLE
+    bool mChildNetworkDataSynced : 1; ///< All children had the Network Data versions below at the last check.
+#endif
 
     uint8_t mRouterId;
     uint8_t mPreviousRouterId;
+#if OPENTHREAD_CONFIG_MLE_CHILD_TIMEOUT_INDEX_ENABLE
+    uint8_t mSyncedNetworkDataVersion;
+    uint8_t mSyncedStableNetworkDataVersion;
+#endif
 
     uint32_t mPreviousPartitionIdRouter;         ///< The partition ID when last operating as a router
     uint32_t mPreviousPartitionId;               ///< The partition ID when last attached
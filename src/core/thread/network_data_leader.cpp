@@ -64,6 +64,15 @@ void LeaderBase::Reset(void)
     mVersion       = Random::NonCrypto::GetUint8();
     mStableVersion = Random::NonCrypto::GetUint8();
     mLength        = 0;
+    SignalNetDataChanged();
+}
+
+void LeaderBase::SignalNetDataChanged(void)
+{
+#if OPENTHREAD_CONFIG_NETDATA_FIB_ENABLE
+    CompileFib();
+#endif
+
     Get<ot::Notifier>().Signal(kEventThreadNetdataChanged);
 }
 
@@ -93,6 +102,73 @@ exit:
     return error;
 }
 
+#if OPENTHREAD_CONFIG_NETDATA_FIB_ENABLE
+
+otError LeaderBase::GetContext(const Ip6::Address &aAddress, Lowpan::Context &aContext) const
+{
+    const Fib::Prefix *context = nullptr;
+    uint8_t            contextLength;
+    Fib::Bits          address;
+
+    aContext.mPrefix.SetLength(0);
+
+    if (Get<Mle::MleRouter>().IsMeshLocalAddress(aAddress))
+    {
+        aContext.mPrefix.Set(Get<Mle::MleRouter>().GetMeshLocalPrefix());
+        aContext.mContextId    = Mle::kMeshLocalPrefixContextId;
+        aContext.mCompressFlag = true;
+    }
+
+    contextLength = aContext.mPrefix.GetLength();
+    address.Set(aAddress);
+
+    for (const Fib::Prefix *prefix = mFib.mPrefixes; prefix < &mFib.mPrefixes[mFib.mNumPrefixes]; prefix++)
+    {
+        if (prefix->mHasContext && (prefix->mLength > contextLength) && prefix->mBits.Matches(address, prefix->mLength))
+        {
+            context       = prefix;
+            contextLength = prefix->mLength;
+        }
+    }
+
+    if (context != nullptr)
+    {
+        SetContext(*context, aContext);
+    }
+
+    return (aContext.mPrefix.GetLength() > 0) ? OT_ERROR_NONE : OT_ERROR_NOT_FOUND;
+}
+
+otError LeaderBase::GetContext(uint8_t aContextId, Lowpan::Context &aContext) const
+{
+    otError error = OT_ERROR_NONE;
+
+    if (aContextId == Mle::kMeshLocalPrefixContextId)
+    {
+        aContext.mPrefix.Set(Get<Mle::MleRouter>().GetMeshLocalPrefix());
+        aContext.mContextId    = Mle::kMeshLocalPrefixContextId;
+        aContext.mCompressFlag = true;
+        ExitNow();
+    }
+
+    VerifyOrExit(aContextId < Fib::kNumContextIds && mFib.mContextPrefixes[aContextId] != Fib::kNoPrefix,
+                 error = OT_ERROR_NOT_FOUND);
+
+    SetContext(mFib.mPrefixes[mFib.mContextPrefixes[aContextId]], aContext);
+
+exit:
+    return error;
+}
+
+void LeaderBase::SetContext(const Fib::Prefix &aPrefix, Lowpan::Context &aContext) const
+{
+    aPrefix.mBits.Get(aContext.mPrefix, aPrefix.mLength);
+    aContext.mContextId    = aPrefix.mContextId;
+    aContext.mCompressFlag = aPrefix.mCompress;
+}
+
+#else // OPENTHREAD_CONFIG_NETDATA_FIB_ENABLE
+
 const PrefixTlv *LeaderBase::FindNextMatchingPrefix(const Ip6::Address &aAddress, const PrefixTlv *aPrevTlv) const
 {
     const PrefixTlv *prefixTlv;
@@ -177,6 +253,8 @@ exit:
     return error;
 }
 
+#endif // OPENTHREAD_CONFIG_NETDATA_FIB_ENABLE
+
 otError LeaderBase::GetRlocByContextId(uint8_t aContextId, uint16_t &aRloc16) const
 {
     otError         error = OT_ERROR_NOT_FOUND;
@@ -201,6 +279,303 @@ exit:
     return error;
 }
 
+#if OPENTHREAD_CONFIG_NETDATA_FIB_ENABLE
+
+bool LeaderBase::IsOnMesh(const Ip6::Address &aAddress) const
+{
+    bool      rval = false;
+    Fib::Bits address;
+
+    VerifyOrExit(!Get<Mle::MleRouter>().IsMeshLocalAddress(aAddress), rval = true);
+
+    address.Set(aAddress);
+
+    for (const Fib::Prefix *prefix = mFib.mPrefixes; prefix < &mFib.mPrefixes[mFib.mNumPrefixes]; prefix++)
+    {
+        if (prefix->mOnMesh && prefix->mBits.Matches(address, prefix->mLength))
+        {
+            ExitNow(rval = true);
+        }
+    }
+
+exit:
+    return rval;
+}
+
+otError LeaderBase::RouteLookup(const Ip6::Address &aSource,
+                                const Ip6::Address &aDestination,
+                                uint8_t *           aPrefixMatchLength,
+                                uint16_t *          aRloc16) const
+{
+    otError   error = OT_ERROR_NO_ROUTE;
+    Fib::Bits source;
+    Fib::Bits destination;
+
+    source.Set(aSource);
+    destination.Set(aDestination);
+
+    for (const Fib::Prefix *prefix = mFib.mPrefixes; prefix < &mFib.mPrefixes[mFib.mNumPrefixes]; prefix++)
+    {
+        if (!prefix->mBits.Matches(source, prefix->mLength))
+        {
+            continue;
+        }
+
+        if (ExternalRouteLookup(prefix->mDomainId, destination, aPrefixMatchLength, aRloc16) == OT_ERROR_NONE)
+        {
+            ExitNow(error = OT_ERROR_NONE);
+        }
+
+        if (DefaultRouteLookup(*prefix, aRloc16) == OT_ERROR_NONE)
+        {
+            if (aPrefixMatchLength)
+            {
+                *aPrefixMatchLength = 0;
+            }
+
+            ExitNow(error = OT_ERROR_NONE);
+        }
+    }
+
+exit:
+    return error;
+}
+
+otError LeaderBase::ExternalRouteLookup(uint8_t          aDomainId,
+                                        const Fib::Bits &aDestination,
+                                        uint8_t *        aPrefixMatchLength,
+                                        uint16_t *       aRloc16) const
+{
+    otError             error           = OT_ERROR_NO_ROUTE;
+    const Fib::NextHop *bestRoute       = nullptr;
+    uint8_t             bestMatchLength = 0;
+
+    for (const Fib::Prefix *prefix = mFib.mPrefixes; prefix < &mFib.mPrefixes[mFib.mNumPrefixes]; prefix++)
+    {
+        const Fib::NextHop *route = &mFib.mNextHops[prefix->mExternalRoutes.mFirst];
+
+        if ((prefix->mDomainId != aDomainId) || (prefix->mLength <= bestMatchLength) ||
+            (prefix->mExternalRoutes.mCount == 0) || !prefix->mBits.Matches(aDestination, prefix->mLength))
+        {
+            continue;
+        }
+
+        for (uint8_t i = 0; i < prefix->mExternalRoutes.mCount; i++, route++)
+        {
+            if (bestRoute == nullptr ||
+                IsRoutePreferred(route->mRloc16, route->mPreference, bestRoute->mRloc16, bestRoute->mPreference))
+            {
+                bestRoute       = route;
+                bestMatchLength = prefix->mLength;
+            }
+        }
+    }
+
+    if (bestRoute != nullptr)
+    {
+        if (aRloc16 != nullptr)
+        {
+            *aRloc16 = bestRoute->mRloc16;
+        }
+
+        if (aPrefixMatchLength != nullptr)
+        {
+            *aPrefixMatchLength = bestMatchLength;
+        }
+
+        error = OT_ERROR_NONE;
+    }
+
+    return error;
+}
+
+otError LeaderBase::DefaultRouteLookup(const Fib::Prefix &aPrefix, uint16_t *aRloc16) const
+{
+    otError             error     = OT_ERROR_NO_ROUTE;
+    const Fib::NextHop *bestRoute = nullptr;
+    const Fib::NextHop *route     = &mFib.mNextHops[aPrefix.mDefaultRoutes.mFirst];
+
+    for (uint8_t i = 0; i < aPrefix.mDefaultRoutes.mCount; i++, route++)
+    {
+        if (bestRoute == nullptr ||
+            IsRoutePreferred(route->mRloc16, route->mPreference, bestRoute->mRloc16, bestRoute->mPreference))
+        {
+            bestRoute = route;
+        }
+    }
+
+    if (bestRoute != nullptr)
+    {
+        if (aRloc16 != nullptr)
+        {
+            *aRloc16 = bestRoute->mRloc16;
+        }
+
+        error = OT_ERROR_NONE;
+    }
+
+    return error;
+}
+
+void LeaderBase::CompileFib(void)
+{
+    const PrefixTlv *prefixTlv;
+
+    mFib.Clear();
+
+    for (const NetworkDataTlv *start = GetTlvsStart();
+         (prefixTlv = FindTlv<PrefixTlv>(start, GetTlvsEnd())) != nullptr; start = prefixTlv->GetNext())
+    {
+        const ContextTlv *     contextTlv;
+        const HasRouteTlv *    hasRoute;
+        const BorderRouterTlv *borderRouter;
+
+        if (!prefixTlv->IsValid())
+        {
+            continue;
+        }
+
+        // A valid Prefix TLV takes at least `sizeof(PrefixTlv)` bytes.
+        OT_ASSERT(mFib.mNumPrefixes < Fib::kMaxPrefixes);
+
+        Fib::Prefix &prefix = mFib.mPrefixes[mFib.mNumPrefixes];
+
+        prefix.mBits.Set(prefixTlv->GetPrefix(), prefixTlv->GetPrefixLength());
+        prefix.mLength     = prefixTlv->GetPrefixLength();
+        prefix.mDomainId   = prefixTlv->GetDomainId();
+        prefix.mHasContext = false;
+        prefix.mCompress   = false;
+        prefix.mOnMesh     = false;
+
+        if ((contextTlv = FindContext(*prefixTlv)) != nullptr)
+        {
+            prefix.mContextId  = contextTlv->GetContextId();
+            prefix.mHasContext = true;
+            prefix.mCompress   = contextTlv->IsCompress();
+
+            if (mFib.mContextPrefixes[prefix.mContextId] == Fib::kNoPrefix)
+            {
+                mFib.mContextPrefixes[prefix.mContextId] = mFib.mNumPrefixes;
+            }
+        }
+
+        // Only the first stable and temporary Border Router TLVs are
+        // checked for on-mesh entries.
+        for (int i = 0; i < 2; i++)
+        {
+            borderRouter = FindBorderRouter(*prefixTlv, /* aStable */ (i == 0));
+
+            if (borderRouter == nullptr)
+            {
+                continue;
+            }
+
+            for (const BorderRouterEntry *entry = borderRouter->GetFirstEntry(); entry <= borderRouter->GetLastEntry();
+                 entry                          = entry->GetNext())
+            {
+                prefix.mOnMesh |= entry->IsOnMesh();
+            }
+        }
+
+        prefix.mExternalRoutes.mFirst = mFib.mNumNextHops;
+        prefix.mExternalRoutes.mCount = 0;
+
+        for (const NetworkDataTlv *subStart = prefixTlv->GetSubTlvs();
+             (hasRoute = FindTlv<HasRouteTlv>(subStart, prefixTlv->GetNext())) != nullptr;
+             subStart = hasRoute->GetNext())
+        {
+            for (const HasRouteEntry *entry = hasRoute->GetFirstEntry(); entry <= hasRoute->GetLastEntry();
+                 entry                      = entry->GetNext())
+            {
+                AddFibNextHop(prefix.mExternalRoutes, entry->GetRloc(), entry->GetPreference());
+            }
+        }
+
+        prefix.mDefaultRoutes.mFirst = mFib.mNumNextHops;
+        prefix.mDefaultRoutes.mCount = 0;
+
+        for (const NetworkDataTlv *subStart = prefixTlv->GetSubTlvs();
+             (borderRouter = FindTlv<BorderRouterTlv>(subStart, prefixTlv->GetNext())) != nullptr;
+             subStart = borderRouter->GetNext())
+        {
+            for (const BorderRouterEntry *entry = borderRouter->GetFirstEntry(); entry <= borderRouter->GetLastEntry();
+                 entry                          = entry->GetNext())
+            {
+                if (entry->IsDefaultRoute())
+                {
+                    AddFibNextHop(prefix.mDefaultRoutes, entry->GetRloc(), entry->GetPreference());
+                }
+            }
+        }
+
+        mFib.mNumPrefixes++;
+    }
+}
+
+void LeaderBase::AddFibNextHop(Fib::NextHops &aNextHops, uint16_t aRloc16, int8_t aPreference)
+{
+    Fib::NextHop &nextHop = mFib.mNextHops[mFib.mNumNextHops];
+
+    // The entries take at least `sizeof(HasRouteEntry)` bytes each in
+    // the Network Data, so they always fit in the table.
+    OT_ASSERT(mFib.mNumNextHops < Fib::kMaxNextHops);
+
+    nextHop.mRloc16     = aRloc16;
+    nextHop.mPreference = aPreference;
+    mFib.mNumNextHops++;
+    aNextHops.mCount++;
+}
+
+void LeaderBase::Fib::Clear(void)
+{
+    mNumPrefixes = 0;
+    mNumNextHops = 0;
+    memset(mContextPrefixes, kNoPrefix, sizeof(mContextPrefixes));
+}
+
+void LeaderBase::Fib::Bits::Set(const uint8_t *aBytes, uint8_t aLength)
+{
+    uint8_t bytes[sizeof(Ip6::Address)];
+
+    memset(bytes, 0, sizeof(bytes));
+    memcpy(bytes, aBytes, Ip6::Prefix::SizeForLength(aLength));
+
+    mWords[0] = Encoding::BigEndian::ReadUint64(&bytes[0]) & GetMask(aLength);
+    mWords[1] = Encoding::BigEndian::ReadUint64(&bytes[sizeof(uint64_t)]) & GetMask(aLength > 64 ? aLength - 64 : 0);
+}
+
+void LeaderBase::Fib::Bits::Set(const Ip6::Address &aAddress)
+{
+    mWords[0] = Encoding::BigEndian::ReadUint64(&aAddress.mFields.m8[0]);
+    mWords[1] = Encoding::BigEndian::ReadUint64(&aAddress.mFields.m8[sizeof(uint64_t)]);
+}
+
+void LeaderBase::Fib::Bits::Get(Ip6::Prefix &aPrefix, uint8_t aLength) const
+{
+    uint8_t bytes[sizeof(Ip6::Address)];
+
+    Encoding::BigEndian::WriteUint64(mWords[0], &bytes[0]);
+    Encoding::BigEndian::WriteUint64(mWords[1], &bytes[sizeof(uint64_t)]);
+    aPrefix.Set(bytes, aLength);
+}
+
+bool LeaderBase::Fib::Bits::Matches(const Bits &aAddress, uint8_t aLength) const
+{
+    // The prefix bits past `aLength` are all zero.
+
+    return ((aAddress.mWords[0] & GetMask(aLength)) == mWords[0]) &&
+           ((aLength <= 64) || ((aAddress.mWords[1] & GetMask(aLength - 64)) == mWords[1]));
+}
+
+uint64_t LeaderBase::Fib::Bits::GetMask(uint8_t aLength)
+{
+    // Returns the mask of the first `aLength` bits of a word.
+
+    return (aLength == 0) ? 0 : (aLength >= 64) ? ~static_cast<uint64_t>(0) : ~(~static_cast<uint64_t>(0) >> aLength);
+}
+
+#else // OPENTHREAD_CONFIG_NETDATA_FIB_ENABLE
+
 bool LeaderBase::IsOnMesh(const Ip6::Address &aAddress) const
 {
     const PrefixTlv *prefix = nullptr;
@@ -303,12 +678,9 @@ otError LeaderBase::ExternalRouteLookup(uint8_t             aDomainId,
             for (const HasRouteEntry *entry = hasRoute->GetFirstEntry(); entry <= hasRoute->GetLastEntry();
                  entry                      = entry->GetNext())
             {
-                if (bestRouteEntry == nullptr || entry->GetPreference() > bestRouteEntry->GetPreference() ||
-                    (entry->GetPreference() == bestRouteEntry->GetPreference() &&
-                     (entry->GetRloc() == Get<Mle::MleRouter>().GetRloc16() ||
-                      (bestRouteEntry->GetRloc() != Get<Mle::MleRouter>().GetRloc16() &&
-                       Get<Mle::MleRouter>().GetCost(entry->GetRloc()) <
-                           Get<Mle::MleRouter>().GetCost(bestRouteEntry->GetRloc())))))
+                if (bestRouteEntry == nullptr ||
+                    IsRoutePreferred(entry->GetRloc(), entry->GetPreference(), bestRouteEntry->GetRloc(),
+                                     bestRouteEntry->GetPreference()))
                 {
                     bestRouteEntry  = entry;
                     bestMatchLength = prefixLength;
@@ -353,11 +725,8 @@ otError LeaderBase::DefaultRouteLookup(const PrefixTlv &aPrefix, uint16_t *aRloc
                 continue;
             }
 
-            if (route == nullptr || entry->GetPreference() > route->GetPreference() ||
-                (entry->GetPreference() == route->GetPreference() &&
-                 (entry->GetRloc() == Get<Mle::MleRouter>().GetRloc16() ||
-                  (route->GetRloc() != Get<Mle::MleRouter>().GetRloc16() &&
-                   Get<Mle::MleRouter>().GetCost(entry->GetRloc()) < Get<Mle::MleRouter>().GetCost(route->GetRloc())))))
+            if (route == nullptr ||
+                IsRoutePreferred(entry->GetRloc(), entry->GetPreference(), route->GetRloc(), route->GetPreference()))
             {
                 route = entry;
             }
@@ -377,6 +746,24 @@ otError LeaderBase::DefaultRouteLookup(const PrefixTlv &aPrefix, uint16_t *aRloc
     return error;
 }
 
+#endif // OPENTHREAD_CONFIG_NETDATA_FIB_ENABLE
+
+bool LeaderBase::IsRoutePreferred(uint16_t aRloc16,
+                                  int8_t   aPreference,
+                                  uint16_t aBestRloc16,
+                                  int8_t   aBestPreference) const
+{
+    // This method indicates whether a route through `aRloc16` is
+    // preferred over the current best one through `aBestRloc16`.
+
+    uint16_t rloc16 = Get<Mle::MleRouter>().GetRloc16();
+
+    return (aPreference > aBestPreference) ||
+           ((aPreference == aBestPreference) &&
+            ((aRloc16 == rloc16) || ((aBestRloc16 != rloc16) && (Get<Mle::MleRouter>().GetCost(aRloc16) <
+                                                                 Get<Mle::MleRouter>().GetCost(aBestRloc16)))));
+}
+
 otError LeaderBase::SetNetworkData(uint8_t        aVersion,
                                    uint8_t        aStableVersion,
                                    bool           aStableOnly,
@@ -411,7 +798,7 @@ otError LeaderBase::SetNetworkData(uint8_t        aVersion,
 
     otDumpDebgNetData("set network data", mTlvs, mLength);
 
-    Get<ot::Notifier>().Signal(kEventThreadNetdataChanged);
+    SignalNetDataChanged();
 
 exit:
     return error;
@@ -437,7 +824,7 @@ otError LeaderBase::SetCommissioningData(const uint8_t *aValue, uint8_t aValueLe
     }
 
     mVersion++;
-    Get<ot::Notifier>().Signal(kEventThreadNetdataChanged);
+    SignalNetDataChanged();
 
 exit:
     return error;
@@ -286,22 +286,111 @@ public:
                          uint8_t &      aServiceId) const;
 
 protected:
+    /**
+     * This method signals that the Network Data has changed.
+     *
+     * It must be called after any change to the Network Data TLVs (or to its version).
+     *
+     */
+    void SignalNetDataChanged(void);
+
     uint8_t mStableVersion;
     uint8_t mVersion;
 
 private:
     using FilterIndexes = MeshCoP::SteeringData::HashBitIndexes;
 
+#if OPENTHREAD_CONFIG_NETDATA_FIB_ENABLE
+    // The Network Data compiled into flat arrays by `CompileFib()`, so that the lookups do not parse any TLV.
+    // Prefixes are kept in the order of their Prefix TLVs, which the route selection depends on. The arrays are
+    // sized for the largest Network Data, so the compiled table is always complete.
+    class Fib
+    {
+    public:
+        // An IPv6 address, or prefix, as two 64-bit words in host byte order.
+        class Bits
+        {
+        public:
+            void Set(const uint8_t *aBytes, uint8_t aLength);
+            void Set(const Ip6::Address &aAddress);
+            void Get(Ip6::Prefix &aPrefix, uint8_t aLength) const;
+            bool Matches(const Bits &aAddress, uint8_t aLength) const;
+
+        private:
+            static uint64_t GetMask(uint8_t aLength);
+
+            uint64_t mWords[2];
+        };
+
+        // A range in `mNextHops`.
+        struct NextHops
+        {
+            uint8_t mFirst;
+            uint8_t mCount;
+        };
+
+        struct NextHop
+        {
+            uint16_t mRloc16;
+            int8_t   mPreference;
+        };
+
+        struct Prefix
+        {
+            Bits     mBits;
+            uint8_t  mLength;
+            uint8_t  mDomainId;
+            uint8_t  mContextId;
+            bool     mHasContext : 1;
+            bool     mCompress : 1;   // The Context compression flag.
+            bool     mOnMesh : 1;     // Any entry of the first stable or temporary Border Router TLV is on-mesh.
+            NextHops mExternalRoutes; // The Has Route TLV entries.
+            NextHops mDefaultRoutes;  // The Border Router TLV entries with the default route flag.
+        };
+
+        enum : uint8_t
+        {
+            kMaxPrefixes   = kMaxSize / sizeof(PrefixTlv),
+            kMaxNextHops   = kMaxSize / sizeof(HasRouteEntry),
+            kNumContextIds = 16,
+            kNoPrefix      = 0xff,
+        };
+
+        void Clear(void);
+
+        Prefix  mPrefixes[kMaxPrefixes];
+        NextHop mNextHops[kMaxNextHops];
+        uint8_t mContextPrefixes[kNumContextIds]; // Index of the first prefix with each Context ID, or `kNoPrefix`.
+        uint8_t mNumPrefixes;
+        uint8_t mNumNextHops;
+    };
+
+    void CompileFib(void);
+    void AddFibNextHop(Fib::NextHops &aNextHops, uint16_t aRloc16, int8_t aPreference);
+    void SetContext(const Fib::Prefix &aPrefix, Lowpan::Context &aContext) const;
+
+    otError ExternalRouteLookup(uint8_t          aDomainId,
+                                const Fib::Bits &aDestination,
+                                uint8_t *        aPrefixMatchLength,
+                                uint16_t *       aRloc16) const;
+    otError DefaultRouteLookup(const Fib::Prefix &aPrefix, uint16_t *aRloc16) const;
+#else
     const PrefixTlv *FindNextMatchingPrefix(const Ip6::Address &aAddress, const PrefixTlv *aPrevTlv) const;
 
-    void RemoveCommissioningData(void);
-
     otError ExternalRouteLookup(uint8_t             aDomainId,
                                 const Ip6::Address &aDestination,
                                 uint8_t *           aPrefixMatchLength,
                                 uint16_t *          aRloc16) const;
     otError DefaultRouteLookup(const PrefixTlv &aPrefix, uint16_t *aRloc16) const;
+#endif
+
+    void    RemoveCommissioningData(void);
+    bool    IsRoutePreferred(uint16_t aRloc16, int8_t aPreference, uint16_t aBestRloc16, int8_t aBestPreference) const;
     otError SteeringDataCheck(const FilterIndexes &aFilterIndexes) const;
+
+#if OPENTHREAD_CONFIG_NETDATA_FIB_ENABLE
+    Fib mFib;
+#endif
 };
 
 /**
@@ -58,6 +58,9 @@ RouterTable::RouterTable(Instance &aInstance)
     , mRouterIdSequenceLastUpdated(0)
     , mRouterIdSequence(Random::NonCrypto::GetUint8())
     , mActiveRouterCount(0)
+#if OPENTHREAD_CONFIG_MLE_ROUTE_TABLE_ENABLE
+    , mRoutesValid(false)
+#endif
 {
     for (Router &router : mRouters)
     {
@@ -105,6 +108,8 @@ void RouterTable::ClearNeighbors(void)
 
         router.SetState(Neighbor::kStateInvalid);
     }
+
+    InvalidateRoutes();
 }
 
 bool RouterTable::IsAllocated(uint8_t aRouterId) const
@@ -194,6 +199,12 @@ void RouterTable::UpdateAllocation(void)
         router.Clear();
         router.SetRloc16(0xffff);
     }
+
+#if OPENTHREAD_CONFIG_MLE_ROUTE_TABLE_ENABLE
+    memcpy(mRouterIndex, indexMap, sizeof(mRouterIndex));
+#endif
+
+    InvalidateRoutes();
 }
 
 Router *RouterTable::Allocate(void)
@@ -303,6 +314,8 @@ void RouterTable::RemoveRouterLink(Router &aRouter)
     aRouter.SetLinkQualityOut(0);
     aRouter.SetLastHeard(TimerMilli::GetNow());
 
+    InvalidateRoutes();
+
     for (Router *cur = GetFirstEntry(); cur != nullptr; cur = GetNextEntry(cur))
     {
         if (cur->GetNextHop() == aRouter.GetRouterId())
@@ -380,13 +393,18 @@ Router *RouterTable::GetNeighbor(const Mac::Address &aMacAddress)
 const Router *RouterTable::GetRouter(uint8_t aRouterId) const
 {
     const Router *router = nullptr;
-    uint16_t      rloc16;
 
     // Skip if invalid router id is passed.
     VerifyOrExit(aRouterId < Mle::kInvalidRouterId);
 
-    rloc16 = Mle::Mle::Rloc16FromRouterId(aRouterId);
-    router = FindRouter(Router::AddressMatcher(rloc16, Router::kInStateAny));
+#if OPENTHREAD_CONFIG_MLE_ROUTE_TABLE_ENABLE
+    if (mRouterIndex[aRouterId] != Mle::kInvalidRouterId)
+    {
+        router = &mRouters[mRouterIndex[aRouterId]];
+    }
+#else
+    router = FindRouter(Router::AddressMatcher(Mle::Mle::Rloc16FromRouterId(aRouterId), Router::kInStateAny));
+#endif
 
 exit:
     return router;
@@ -467,6 +485,84 @@ exit:
     return rval;
 }
 
+#if OPENTHREAD_CONFIG_MLE_ROUTE_TABLE_ENABLE
+
+bool RouterTable::UpdateRoute(uint8_t aRouterId)
+{
+    bool     changed = true;
+    uint16_t nextHop;
+    uint8_t  cost;
+
+    VerifyOrExit(mRoutesValid);
+
+    CalculateRoute(aRouterId, nextHop, cost);
+
+    changed = (nextHop != mRouteNextHops[aRouterId]) || (cost != mRouteCosts[aRouterId]);
+
+    mRouteNextHops[aRouterId] = nextHop;
+    mRouteCosts[aRouterId]    = cost;
+
+exit:
+    return changed;
+}
+
+void RouterTable::BuildRoutes(void)
+{
+    for (uint8_t routerId = 0; routerId <= Mle::kInvalidRouterId; routerId++)
+    {
+        CalculateRoute(routerId, mRouteNextHops[routerId], mRouteCosts[routerId]);
+    }
+
+    mRoutesValid = true;
+}
+
+void RouterTable::CalculateRoute(uint8_t aRouterId, uint16_t &aNextHop, uint8_t &aCost)
+{
+    // This mirrors the selection done by `MleRouter::GetNextHop()` and `MleRouter::GetCost()` when the route table
+    // is disabled: the direct link is used unless the route through the next hop is strictly cheaper.
+
+    Router *router = GetRouter(aRouterId);
+    Router *nextHop;
+    uint8_t linkCost;
+    uint8_t routeCost;
+
+    aNextHop = Mac::kShortAddrInvalid;
+    aCost    = Mle::kMaxRouteCost;
+
+    VerifyOrExit(router != nullptr);
+
+    linkCost = GetLinkCost(*router);
+    nextHop  = GetRouter(router->GetNextHop());
+    aCost    = linkCost;
+
+    if (nextHop != nullptr)
+    {
+        routeCost = router->GetCost() + GetLinkCost(*nextHop);
+
+        if (routeCost < linkCost)
+        {
+            aCost = routeCost;
+
+            if (!nextHop->IsStateInvalid())
+            {
+                aNextHop = nextHop->GetRloc16();
+            }
+
+            ExitNow();
+        }
+    }
+
+    if (linkCost < Mle::kMaxRouteCost)
+    {
+        aNextHop = router->GetRloc16();
+    }
+
+exit:
+    return;
+}
+
+#endif // OPENTHREAD_CONFIG_MLE_ROUTE_TABLE_ENABLE
+
 void RouterTable::UpdateRouterIdSet(uint8_t aRouterIdSequence, const Mle::RouterIdSet &aRouterIdSet)
 {
     mRouterIdSequence            = aRouterIdSequence;
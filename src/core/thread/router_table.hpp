@@ -180,6 +180,66 @@ public:
      */
     uint8_t GetLinkCost(Router &aRouter);
 
+#if OPENTHREAD_CONFIG_MLE_ROUTE_TABLE_ENABLE
+    /**
+     * This method returns the next hop toward a given router.
+     *
+     * The route table is rebuilt first if it was invalidated since the last lookup.
+     *
+     * @param[in]  aRouterId  The router ID of the destination (`Mle::kInvalidRouterId` is allowed).
+     *
+     * @returns The RLOC16 of the next hop or `Mac::kShortAddrInvalid` if there is no route to @p aRouterId.
+     *
+     */
+    uint16_t GetNextHop(uint8_t aRouterId)
+    {
+        ValidateRoutes();
+        return mRouteNextHops[aRouterId];
+    }
+
+    /**
+     * This method returns the path cost toward a given router.
+     *
+     * The route table is rebuilt first if it was invalidated since the last lookup.
+     *
+     * @param[in]  aRouterId  The router ID of the destination (`Mle::kInvalidRouterId` is allowed).
+     *
+     * @returns The lower of the link cost and the route cost to @p aRouterId.
+     *
+     */
+    uint8_t GetPathCost(uint8_t aRouterId)
+    {
+        ValidateRoutes();
+        return mRouteCosts[aRouterId];
+    }
+
+    /**
+     * This method updates the route table entry of a router after its next hop or route cost changed.
+     *
+     * @param[in]  aRouterId  The router ID.
+     *
+     * @retval TRUE   The next hop or the path cost toward @p aRouterId changed, or the table is waiting to be rebuilt.
+     * @retval FALSE  The route toward @p aRouterId is unchanged.
+     *
+     */
+    bool UpdateRoute(uint8_t aRouterId);
+#endif
+
+    /**
+     * This method invalidates the route table so that it is rebuilt on the next lookup.
+     *
+     * This method must be called whenever the state, the link quality or the link cost of a router changes, or the
+     * next hop or route cost of more than one router changes at once. It does nothing when
+     * `OPENTHREAD_CONFIG_MLE_ROUTE_TABLE_ENABLE` is disabled.
+     *
+     */
+    void InvalidateRoutes(void)
+    {
+#if OPENTHREAD_CONFIG_MLE_ROUTE_TABLE_ENABLE
+        mRoutesValid = false;
+#endif
+    }
+
     /**
      * This method returns the neighbor for a given RLOC16.
      *
@@ -368,12 +428,31 @@ private:
         return const_cast<Router *>(const_cast<const RouterTable *>(this)->FindRouter(aMatcher));
     }
 
+#if OPENTHREAD_CONFIG_MLE_ROUTE_TABLE_ENABLE
+    void ValidateRoutes(void)
+    {
+        if (!mRoutesValid)
+        {
+            BuildRoutes();
+        }
+    }
+
+    void BuildRoutes(void);
+    void CalculateRoute(uint8_t aRouterId, uint16_t &aNextHop, uint8_t &aCost);
+#endif
+
     Router           mRouters[Mle::kMaxRouters];
     Mle::RouterIdSet mAllocatedRouterIds;
     uint8_t          mRouterIdReuseDelay[Mle::kMaxRouterId + 1];
     TimeMilli        mRouterIdSequenceLastUpdated;
     uint8_t          mRouterIdSequence;
     uint8_t          mActiveRouterCount;
+#if OPENTHREAD_CONFIG_MLE_ROUTE_TABLE_ENABLE
+    uint8_t  mRouterIndex[Mle::kMaxRouterId + 1];
+    uint16_t mRouteNextHops[Mle::kInvalidRouterId + 1];
+    uint8_t  mRouteCosts[Mle::kInvalidRouterId + 1];
+    bool     mRoutesValid;
+#endif
 };
 
 } // namespace ot
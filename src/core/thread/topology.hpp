@@ -42,6 +42,7 @@
 #include "common/linked_list.hpp"
 #include "common/locator.hpp"
 #include "common/message.hpp"
+#include "common/pairing_heap.hpp"
 #include "common/random.hpp"
 #include "common/timer.hpp"
 #include "mac/mac_types.hpp"
@@ -825,6 +826,10 @@ class Child : public Neighbor,
     ,
               public CslTxScheduler::ChildInfo
 #endif
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MLE_CHILD_TIMEOUT_INDEX_ENABLE
+    ,
+              public PairingHeapEntry<Child, TimeMilli>
+#endif
 {
     class AddressIteratorBuilder;
 
@@ -1195,6 +1200,21 @@ public:
 
 #if OPENTHREAD_CONFIG_CHILD_SUPERVISION_ENABLE
 
+#if OPENTHREAD_CONFIG_MLE_CHILD_TIMEOUT_INDEX_ENABLE
+    /**
+     * This method returns the time of the last supervision of the child (last message to the child).
+     *
+     * @returns The time of the last supervision of the child.
+     *
+     */
+    TimeMilli GetLastSupervisionTime(void) const { return mLastSupervisionTime; }
+
+    /**
+     * This method resets the number of seconds since last supervision of the child to zero.
+     *
+     */
+    void ResetSecondsSinceLastSupervision(void) { mLastSupervisionTime = TimerMilli::GetNow(); }
+#else
     /**
      * This method increments the number of seconds since last supervision of the child.
      *
@@ -1214,6 +1234,7 @@ public:
      *
      */
     void ResetSecondsSinceLastSupervision(void) { mSecondsSinceSupervision = 0; }
+#endif
 
 #endif // #if OPENTHREAD_CONFIG_CHILD_SUPERVISION_ENABLE
 
@@ -1318,7 +1339,11 @@ private:
     };
 
 #if OPENTHREAD_CONFIG_CHILD_SUPERVISION_ENABLE
+#if OPENTHREAD_CONFIG_MLE_CHILD_TIMEOUT_INDEX_ENABLE
+    TimeMilli mLastSupervisionTime; ///< Time of last supervision of the child.
+#else
     uint16_t mSecondsSinceSupervision; ///< Number of seconds since last supervision of the child.
+#endif
 #endif
 
     static_assert(OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS < 8192, "mQueuedMessageCount cannot fit max required!");
@@ -56,7 +56,11 @@ ChildSupervisor::ChildSupervisor(Instance &aInstance)
 void ChildSupervisor::SetSupervisionInterval(uint16_t aInterval)
 {
     mSupervisionInterval = aInterval;
+#if OPENTHREAD_CONFIG_MLE_CHILD_TIMEOUT_INDEX_ENABLE
+    Get<Mle::MleRouter>().ScheduleAllChildTimeouts();
+#else
     CheckState();
+#endif
 }
 
 Child *ChildSupervisor::GetDestination(const Message &aMessage) const
@@ -105,6 +109,36 @@ void ChildSupervisor::UpdateOnSend(Child &aChild)
     aChild.ResetSecondsSinceLastSupervision();
 }
 
+#if OPENTHREAD_CONFIG_MLE_CHILD_TIMEOUT_INDEX_ENABLE
+
+otError ChildSupervisor::GetNextSupervisionTime(const Child &aChild, TimeMilli &aTime) const
+{
+    otError error = OT_ERROR_NONE;
+
+    VerifyOrExit((mSupervisionInterval != 0) && aChild.IsStateValid() && !aChild.IsRxOnWhenIdle(),
+                 error = OT_ERROR_NOT_FOUND);
+
+    aTime = aChild.GetLastSupervisionTime() + Time::SecToMsec(mSupervisionInterval);
+
+exit:
+    return error;
+}
+
+void ChildSupervisor::SuperviseChild(Child &aChild)
+{
+    TimeMilli supervisionTime;
+
+    SuccessOrExit(GetNextSupervisionTime(aChild, supervisionTime));
+    VerifyOrExit(supervisionTime <= TimerMilli::GetNow());
+
+    SendMessage(aChild);
+
+exit:
+    return;
+}
+
+#else // OPENTHREAD_CONFIG_MLE_CHILD_TIMEOUT_INDEX_ENABLE
+
 void ChildSupervisor::HandleTimeTick(void)
 {
     for (Child &child : Get<ChildTable>().Iterate(Child::kInStateValid))
@@ -150,6 +184,8 @@ void ChildSupervisor::HandleNotifierEvents(Events aEvents)
     }
 }
 
+#endif // OPENTHREAD_CONFIG_MLE_CHILD_TIMEOUT_INDEX_ENABLE
+
 #endif // #if OPENTHREAD_FTD
 
 SupervisionListener::SupervisionListener(Instance &aInstance)
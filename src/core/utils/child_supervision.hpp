@@ -92,8 +92,10 @@ namespace Utils {
  */
 class ChildSupervisor : public InstanceLocator, private NonCopyable
 {
+#if !OPENTHREAD_CONFIG_MLE_CHILD_TIMEOUT_INDEX_ENABLE
     friend class ot::Notifier;
     friend class ot::TimeTicker;
+#endif
 
 public:
     /**
@@ -155,6 +157,29 @@ public:
      */
     void UpdateOnSend(Child &aChild);
 
+#if OPENTHREAD_CONFIG_MLE_CHILD_TIMEOUT_INDEX_ENABLE
+    /**
+     * This method gets the next time a child should be supervised.
+     *
+     * @param[in]  aChild    A reference to the child.
+     * @param[out] aTime     A reference to output the time to supervise @p aChild.
+     *
+     * @retval OT_ERROR_NONE       Successfully got the next supervision time.
+     * @retval OT_ERROR_NOT_FOUND  Supervision is disabled, or @p aChild is not a valid sleepy child.
+     *
+     */
+    otError GetNextSupervisionTime(const Child &aChild, TimeMilli &aTime) const;
+
+    /**
+     * This method supervises a child, i.e., it sends a supervision message to the child if the supervision interval
+     * has passed since the last message to the child.
+     *
+     * @param[in] aChild     The child to supervise.
+     *
+     */
+    void SuperviseChild(Child &aChild);
+#endif
+
 private:
     enum
     {
@@ -163,9 +188,11 @@ private:
     };
 
     void SendMessage(Child &aChild);
+#if !OPENTHREAD_CONFIG_MLE_CHILD_TIMEOUT_INDEX_ENABLE
     void CheckState(void);
     void HandleTimeTick(void);
     void HandleNotifierEvents(Events aEvents);
+#endif
 
     uint16_t mSupervisionInterval;
 };
@@ -182,6 +209,10 @@ public:
     uint16_t GetSupervisionInterval(void) const { return 0; }
     Child *  GetDestination(const Message &) const { return nullptr; }
     void     UpdateOnSend(Child &) {}
+#if OPENTHREAD_CONFIG_MLE_CHILD_TIMEOUT_INDEX_ENABLE
+    otError GetNextSupervisionTime(const Child &, TimeMilli &) const { return OT_ERROR_NOT_FOUND; }
+    void    SuperviseChild(Child &) {}
+#endif
 };
 
 #endif // #if OPENTHREAD_CONFIG_CHILD_SUPERVISION_ENABLE && OPENTHREAD_FTD
@@ -68,6 +68,8 @@ void Flash::Init(void)
         }
     }
 
+    ResetIndex();
+
     for (mSwapUsed = kSwapMarkerSize; mSwapUsed <= mSwapSize - sizeof(record); mSwapUsed += record.GetSize())
     {
         otPlatFlashRead(&GetInstance(), mSwapIndex, mSwapUsed, &record, sizeof(record));
@@ -80,6 +82,11 @@ void Flash::Init(void)
         {
             break;
         }
+
+        if (record.IsValid())
+        {
+            AddIndexEntry(mSwapUsed, record);
+        }
     }
 
     SanitizeFreeSpace();
@@ -90,7 +97,7 @@ exit:
 
 void Flash::SanitizeFreeSpace(void)
 {
-    uint32_t temp;
+    uint32_t temp[8];
     bool     sanitizeNeeded = false;
 
     if (mSwapUsed & 3)
@@ -100,10 +107,16 @@ void Flash::SanitizeFreeSpace(void)
 
     for (uint32_t offset = mSwapUsed; offset < mSwapSize; offset += sizeof(temp))
     {
-        otPlatFlashRead(&GetInstance(), mSwapIndex, offset, &temp, sizeof(temp));
-        if (temp != ~0U)
+        uint32_t length = OT_MIN(mSwapSize - offset, static_cast<uint32_t>(sizeof(temp)));
+
+        otPlatFlashRead(&GetInstance(), mSwapIndex, offset, temp, length);
+
+        for (uint32_t i = 0; i < length / sizeof(temp[0]); i++)
         {
-            ExitNow(sanitizeNeeded = true);
+            if (temp[i] != ~0U)
+            {
+                ExitNow(sanitizeNeeded = true);
+            }
         }
     }
 
@@ -114,19 +127,81 @@ exit:
     }
 }
 
+Flash::RecordIterator::RecordIterator(const Flash &aFlash)
+    : mFlash(aFlash)
+    , mOffset(kSwapMarkerSize)
+#if OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_SIZE > 0
+    , mEntry(0)
+    , mIndexed(aFlash.mIndexInUse)
+#endif
+{
+    Load();
+}
+
+void Flash::RecordIterator::Advance(void)
+{
+#if OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_SIZE > 0
+    if (mIndexed)
+    {
+        mEntry++;
+    }
+    else
+#endif
+    {
+        mOffset += mRecord.GetSize();
+    }
+
+    Load();
+}
+
+void Flash::RecordIterator::Load(void)
+{
+#if OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_SIZE > 0
+    if (mIndexed)
+    {
+        for (; mEntry < mFlash.mIndexLength; mEntry++)
+        {
+            if (mFlash.mIndex[mEntry].mRecord.IsValid())
+            {
+                mOffset = mFlash.mIndex[mEntry].mOffset;
+                mRecord = mFlash.mIndex[mEntry].mRecord;
+                ExitNow();
+            }
+        }
+
+        mOffset = mFlash.mSwapUsed;
+        ExitNow();
+    }
+#endif
+
+    for (; mOffset < mFlash.mSwapUsed; mOffset += mRecord.GetSize())
+    {
+        otPlatFlashRead(&mFlash.GetInstance(), mFlash.mSwapIndex, mOffset, &mRecord, sizeof(mRecord));
+
+        if (mRecord.IsValid())
+        {
+            break;
+        }
+    }
+
+#if OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_SIZE > 0
+exit:
+#endif
+    return;
+}
+
 otError Flash::Get(uint16_t aKey, int aIndex, uint8_t *aValue, uint16_t *aValueLength) const
 {
-    otError      error       = OT_ERROR_NOT_FOUND;
-    uint16_t     valueLength = 0;
-    int          index       = 0; // This must be initalized to 0. See [Note] in Delete().
-    uint32_t     offset;
-    RecordHeader record;
+    otError  error       = OT_ERROR_NOT_FOUND;
+    uint16_t valueLength = 0;
+    int      index       = 0; // This must be initalized to 0. See [Note] in Delete().
+    uint32_t offset      = 0;
 
-    for (offset = kSwapMarkerSize; offset < mSwapUsed; offset += record.GetSize())
+    for (RecordIterator iterator(*this); !iterator.IsDone(); iterator.Advance())
     {
-        otPlatFlashRead(&GetInstance(), mSwapIndex, offset, &record, sizeof(record));
+        const RecordHeader &record = iterator.GetRecord();
 
-        if ((record.GetKey() != aKey) || !record.IsValid())
+        if (record.GetKey() != aKey)
         {
             continue;
         }
@@ -138,18 +213,7 @@ otError Flash::Get(uint16_t aKey, int aIndex, uint8_t *aValue, uint16_t *aValueL
 
         if (index == aIndex)
         {
-            if (aValue && aValueLength)
-            {
-                uint16_t readLength = *aValueLength;
-
-                if (readLength > record.GetLength())
-                {
-                    readLength = record.GetLength();
-                }
-
-                otPlatFlashRead(&GetInstance(), mSwapIndex, offset + sizeof(record), aValue, readLength);
-            }
-
+            offset      = iterator.GetOffset();
             valueLength = record.GetLength();
             error       = OT_ERROR_NONE;
         }
@@ -157,6 +221,18 @@ otError Flash::Get(uint16_t aKey, int aIndex, uint8_t *aValue, uint16_t *aValueL
         index++;
     }
 
+    if ((error == OT_ERROR_NONE) && aValue && aValueLength)
+    {
+        uint16_t readLength = *aValueLength;
+
+        if (readLength > valueLength)
+        {
+            readLength = valueLength;
+        }
+
+        otPlatFlashRead(&GetInstance(), mSwapIndex, offset + sizeof(RecordHeader), aValue, readLength);
+    }
+
     if (aValueLength)
     {
         *aValueLength = valueLength;
@@ -187,33 +263,52 @@ otError Flash::Add(uint16_t aKey, bool aFirst, const uint8_t *aValue, uint16_t a
 
     OT_ASSERT((mSwapSize - record.GetSize()) >= kSwapMarkerSize);
 
-    if ((mSwapSize - record.GetSize()) < mSwapUsed)
+    if (ShouldSwap(record.GetSize()))
     {
         Swap();
-        VerifyOrExit((mSwapSize - record.GetSize()) >= mSwapUsed, error = OT_ERROR_NO_BUFS);
     }
 
+    VerifyOrExit((mSwapSize - record.GetSize()) >= mSwapUsed, error = OT_ERROR_NO_BUFS);
+
     otPlatFlashWrite(&GetInstance(), mSwapIndex, mSwapUsed, &record, record.GetSize());
 
     record.SetAddCompleteFlag();
     otPlatFlashWrite(&GetInstance(), mSwapIndex, mSwapUsed, &record, sizeof(RecordHeader));
 
+    AddIndexEntry(mSwapUsed, record);
     mSwapUsed += record.GetSize();
 
 exit:
     return error;
 }
 
-bool Flash::DoesValidRecordExist(uint32_t aOffset, uint16_t aKey) const
+bool Flash::ShouldSwap(uint16_t aRecordSize) const
 {
-    RecordHeader record;
-    bool         rval = false;
+    uint32_t freeSpace = mSwapSize - mSwapUsed;
+    bool     rval      = (freeSpace < aRecordSize);
 
-    for (; aOffset < mSwapUsed; aOffset += record.GetSize())
+#if OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_SIZE > 0
+    if (mIndexInUse && (freeSpace < static_cast<uint32_t>(aRecordSize) + kSwapWatermark))
     {
-        otPlatFlashRead(&GetInstance(), mSwapIndex, aOffset, &record, sizeof(record));
+        // The index tells how much space a swap would reclaim. Skip swaps that cannot make room for the record, and
+        // swap early only when that restores the watermark.
+        uint32_t freeSpaceAfterSwap = mSwapSize - GetSwapUsedAfterSwap();
 
-        if (record.IsValid() && record.IsFirst() && (record.GetKey() == aKey))
+        rval = (freeSpaceAfterSwap >= static_cast<uint32_t>(aRecordSize) + (rval ? 0 : kSwapWatermark));
+    }
+#endif
+
+    return rval;
+}
+
+bool Flash::DoesValidRecordExist(const RecordIterator &aIterator, uint16_t aKey) const
+{
+    RecordIterator iterator(aIterator);
+    bool           rval = false;
+
+    for (iterator.Advance(); !iterator.IsDone(); iterator.Advance())
+    {
+        if (iterator.GetRecord().IsFirst() && (iterator.GetRecord().GetKey() == aKey))
         {
             ExitNow(rval = true);
         }
@@ -223,49 +318,80 @@ exit:
     return rval;
 }
 
+void Flash::UpdateRecord(const RecordIterator &aIterator, const RecordHeader &aRecord)
+{
+    otPlatFlashWrite(&GetInstance(), mSwapIndex, aIterator.GetOffset(), &aRecord, sizeof(aRecord));
+
+#if OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_SIZE > 0
+    if (aIterator.IsIndexed())
+    {
+        mIndex[aIterator.GetIndexEntry()].mRecord = aRecord;
+    }
+#endif
+}
+
 void Flash::Swap(void)
 {
-    uint8_t  dstIndex  = !mSwapIndex;
-    uint32_t dstOffset = kSwapMarkerSize;
+    uint8_t  dstIndex    = !mSwapIndex;
+    uint32_t dstOffset   = kSwapMarkerSize;
+    uint16_t indexLength = 0;
+    bool     indexInUse  = true;
     Record   record;
 
     otPlatFlashErase(&GetInstance(), dstIndex);
 
-    for (uint32_t srcOffset = kSwapMarkerSize; srcOffset < mSwapUsed; srcOffset += record.GetSize())
+    for (RecordIterator iterator(*this); !iterator.IsDone(); iterator.Advance())
     {
-        otPlatFlashRead(&GetInstance(), mSwapIndex, srcOffset, &record, sizeof(RecordHeader));
-
-        VerifyOrExit(record.IsAddBeginSet());
-
-        if (!record.IsValid() || DoesValidRecordExist(srcOffset + record.GetSize(), record.GetKey()))
+        if (DoesValidRecordExist(iterator, iterator.GetRecord().GetKey()))
         {
             continue;
         }
 
-        otPlatFlashRead(&GetInstance(), mSwapIndex, srcOffset, &record, record.GetSize());
+        otPlatFlashRead(&GetInstance(), mSwapIndex, iterator.GetOffset(), &record, iterator.GetRecord().GetSize());
         otPlatFlashWrite(&GetInstance(), dstIndex, dstOffset, &record, record.GetSize());
+
+#if OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_SIZE > 0
+        // Entries are only ever written at or before the iterator position, so the index can be rebuilt in place.
+        if (indexLength < kIndexSize)
+        {
+            mIndex[indexLength].mOffset = dstOffset;
+            mIndex[indexLength].mRecord = iterator.GetRecord();
+            indexLength++;
+        }
+        else
+        {
+            indexInUse = false;
+        }
+#endif
+
         dstOffset += record.GetSize();
     }
 
-exit:
     otPlatFlashWrite(&GetInstance(), dstIndex, 0, &sSwapActive, sizeof(sSwapActive));
     otPlatFlashWrite(&GetInstance(), mSwapIndex, 0, &sSwapInactive, sizeof(sSwapInactive));
 
     mSwapIndex = dstIndex;
     mSwapUsed  = dstOffset;
+
+#if OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_SIZE > 0
+    mIndexLength = indexLength;
+    mIndexInUse  = indexInUse;
+#else
+    OT_UNUSED_VARIABLE(indexLength);
+    OT_UNUSED_VARIABLE(indexInUse);
+#endif
 }
 
 otError Flash::Delete(uint16_t aKey, int aIndex)
 {
-    otError      error = OT_ERROR_NOT_FOUND;
-    int          index = 0; // This must be initalized to 0. See [Note] below.
-    RecordHeader record;
+    otError error = OT_ERROR_NOT_FOUND;
+    int     index = 0; // This must be initalized to 0. See [Note] below.
 
-    for (uint32_t offset = kSwapMarkerSize; offset < mSwapUsed; offset += record.GetSize())
+    for (RecordIterator iterator(*this); !iterator.IsDone(); iterator.Advance())
     {
-        otPlatFlashRead(&GetInstance(), mSwapIndex, offset, &record, sizeof(record));
+        RecordHeader record = iterator.GetRecord();
 
-        if ((record.GetKey() != aKey) || !record.IsValid())
+        if (record.GetKey() != aKey)
         {
             continue;
         }
@@ -278,7 +404,7 @@ otError Flash::Delete(uint16_t aKey, int aIndex)
         if ((aIndex == index) || (aIndex == -1))
         {
             record.SetDeleted();
-            otPlatFlashWrite(&GetInstance(), mSwapIndex, offset, &record, sizeof(record));
+            UpdateRecord(iterator, record);
             error = OT_ERROR_NONE;
         }
 
@@ -289,12 +415,14 @@ otError Flash::Delete(uint16_t aKey, int aIndex)
         if ((index == 1) && (aIndex == 0))
         {
             record.SetFirst();
-            otPlatFlashWrite(&GetInstance(), mSwapIndex, offset, &record, sizeof(record));
+            UpdateRecord(iterator, record);
         }
 
         index++;
     }
 
+    RemoveInvalidIndexEntries();
+
     return error;
 }
 
@@ -305,7 +433,76 @@ void Flash::Wipe(void)
 
     mSwapIndex = 0;
     mSwapUsed  = sizeof(sSwapActive);
+
+    ResetIndex();
+}
+
+void Flash::ResetIndex(void)
+{
+#if OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_SIZE > 0
+    mIndexInUse  = true;
+    mIndexLength = 0;
+#endif
+}
+
+void Flash::AddIndexEntry(uint32_t aOffset, const RecordHeader &aRecord)
+{
+#if OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_SIZE > 0
+    VerifyOrExit(mIndexInUse);
+
+    if (mIndexLength < kIndexSize)
+    {
+        mIndex[mIndexLength].mOffset = aOffset;
+        mIndex[mIndexLength].mRecord = aRecord;
+        mIndexLength++;
+    }
+    else
+    {
+        // Fall back to reading record headers from flash until the next swap.
+        mIndexInUse = false;
+    }
+
+exit:
+    return;
+#else
+    OT_UNUSED_VARIABLE(aOffset);
+    OT_UNUSED_VARIABLE(aRecord);
+#endif
+}
+
+void Flash::RemoveInvalidIndexEntries(void)
+{
+#if OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_SIZE > 0
+    uint16_t length = 0;
+
+    for (uint16_t i = 0; i < mIndexLength; i++)
+    {
+        if (mIndex[i].mRecord.IsValid())
+        {
+            mIndex[length++] = mIndex[i];
+        }
+    }
+
+    mIndexLength = length;
+#endif
+}
+
+#if OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_SIZE > 0
+uint32_t Flash::GetSwapUsedAfterSwap(void) const
+{
+    uint32_t used = kSwapMarkerSize;
+
+    for (RecordIterator iterator(*this); !iterator.IsDone(); iterator.Advance())
+    {
+        if (!DoesValidRecordExist(iterator, iterator.GetRecord().GetKey()))
+        {
+            used += iterator.GetRecord().GetSize();
+        }
+    }
+
+    return used;
 }
+#endif
 
 } // namespace ot
 
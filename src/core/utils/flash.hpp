@@ -138,6 +138,8 @@ private:
     enum
     {
         kSwapMarkerSize = 4, // in bytes
+        kIndexSize      = OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_SIZE,
+        kSwapWatermark  = OPENTHREAD_CONFIG_PLATFORM_FLASH_SWAP_WATERMARK, // in bytes
     };
 
     static const uint32_t sSwapActive   = 0xbe5cc5ee;
@@ -220,14 +222,67 @@ private:
         uint8_t mData[kMaxDataSize];
     } OT_TOOL_PACKED_END;
 
-    otError Add(uint16_t aKey, bool aFirst, const uint8_t *aValue, uint16_t aValueLength);
-    bool    DoesValidRecordExist(uint32_t aOffset, uint16_t aKey) const;
-    void    SanitizeFreeSpace(void);
-    void    Swap(void);
+#if OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_SIZE > 0
+    struct IndexEntry
+    {
+        uint32_t     mOffset;
+        RecordHeader mRecord;
+    };
+#endif
+
+    /**
+     * This class iterates over the valid records in the active swap area.
+     *
+     * The iterator walks the RAM index while it is in use, and reads the record headers from flash otherwise.
+     *
+     */
+    class RecordIterator
+    {
+    public:
+        explicit RecordIterator(const Flash &aFlash);
+
+        bool                IsDone(void) const { return mOffset >= mFlash.mSwapUsed; }
+        void                Advance(void);
+        uint32_t            GetOffset(void) const { return mOffset; }
+        const RecordHeader &GetRecord(void) const { return mRecord; }
+#if OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_SIZE > 0
+        bool     IsIndexed(void) const { return mIndexed; }
+        uint16_t GetIndexEntry(void) const { return mEntry; }
+#endif
+
+    private:
+        void Load(void);
+
+        const Flash &mFlash;
+        uint32_t     mOffset;
+        RecordHeader mRecord;
+#if OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_SIZE > 0
+        uint16_t mEntry;
+        bool     mIndexed;
+#endif
+    };
+
+    otError  Add(uint16_t aKey, bool aFirst, const uint8_t *aValue, uint16_t aValueLength);
+    bool     DoesValidRecordExist(const RecordIterator &aIterator, uint16_t aKey) const;
+    void     UpdateRecord(const RecordIterator &aIterator, const RecordHeader &aRecord);
+    void     SanitizeFreeSpace(void);
+    bool     ShouldSwap(uint16_t aRecordSize) const;
+    void     Swap(void);
+    void     ResetIndex(void);
+    void     AddIndexEntry(uint32_t aOffset, const RecordHeader &aRecord);
+    void     RemoveInvalidIndexEntries(void);
+#if OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_SIZE > 0
+    uint32_t GetSwapUsedAfterSwap(void) const;
+#endif
 
     uint32_t mSwapSize;
     uint32_t mSwapUsed;
     uint8_t  mSwapIndex;
+#if OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_SIZE > 0
+    bool       mIndexInUse;
+    uint16_t   mIndexLength;
+    IndexEntry mIndex[kIndexSize];
+#endif
 };
 
 } // namespace ot
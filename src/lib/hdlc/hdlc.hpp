@@ -98,6 +98,29 @@ public:
                                          : OT_ERROR_NO_BUFS;
     }
 
+    /**
+     * This method writes a sequence of bytes into the buffer and updates the write pointer (if space is available).
+     *
+     * @param[in]  aBytes   A pointer to the bytes to write.
+     * @param[in]  aLength  Number of bytes to write.
+     *
+     * @retval OT_ERROR_NONE     Successfully wrote the bytes and updated the pointer.
+     * @retval OT_ERROR_NO_BUFS  Insufficient buffer space to write the bytes, nothing was written.
+     *
+     */
+    otError WriteBytes(const uint8_t *aBytes, uint16_t aLength)
+    {
+        otError error = OT_ERROR_NONE;
+
+        VerifyOrExit(CanWrite(aLength), error = OT_ERROR_NO_BUFS);
+        memcpy(mWritePointer, aBytes, aLength);
+        mWritePointer += aLength;
+        mRemainingLength -= aLength;
+
+    exit:
+        return error;
+    }
+
     /**
      * This method undoes the last @p aUndoLength writes, removing them from frame.
      *
@@ -55,4 +55,18 @@
 #define OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT 0
 #endif
 
+/**
+ * @def OPENTHREAD_SPINEL_CONFIG_PIPELINED_REQUESTS_ENABLE
+ *
+ * Define 1 to post source match, MAC key and MAC frame counter updates to the RCP without waiting for their responses.
+ *
+ * Up to 13 posted requests can be in flight, each with its own transaction id. A source match entry the RCP fails to
+ * insert keeps source matching disabled on the RCP until the entry is removed or inserted again. Any other posted
+ * request that fails is handled as an RCP failure.
+ *
+ */
+#ifndef OPENTHREAD_SPINEL_CONFIG_PIPELINED_REQUESTS_ENABLE
+#define OPENTHREAD_SPINEL_CONFIG_PIPELINED_REQUESTS_ENABLE 1
+#endif
+
 #endif // OPENTHREAD_SPINEL_CONFIG_H_
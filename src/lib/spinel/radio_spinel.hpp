@@ -555,6 +555,14 @@ public:
      */
     uint64_t GetTxRadioEndUs(void) const { return mTxRadioEndUs; }
 
+    /**
+     * This method returns the timeout timepoint for the posted requests still waiting for a response.
+     *
+     * @returns The timeout timepoint for the oldest posted request, or `UINT64_MAX` if there is none.
+     *
+     */
+    uint64_t GetPostedRequestsEndUs(void) const;
+
     /**
      * This method processes any pending the I/O data.
      *
@@ -694,6 +702,14 @@ public:
      */
     bool HasPendingFrame(void) const { return mRxFrameBuffer.HasSavedFrame(); }
 
+    /**
+     * This method checks whether a source match update is waiting to be posted to the RCP by `Process()`.
+     *
+     * @returns Whether a source match update is waiting to be posted.
+     *
+     */
+    bool HasPendingSrcMatchUpdate(void) const;
+
     /**
      * This method gets dataset from NCP radio and saves it.
      *
@@ -751,6 +767,14 @@ private:
         kChannelMaskBufferSize = 32,   ///< Max buffer size used to store `SPINEL_PROP_PHY_CHAN_SUPPORTED` value.
     };
 
+#if OPENTHREAD_SPINEL_CONFIG_PIPELINED_REQUESTS_ENABLE
+    enum
+    {
+        kMaxPostedRequests  = SPINEL_HEADER_TID_MASK - 2,             ///< Leaves a tid for a request and a frame.
+        kMaxSrcMatchMissing = 2 * OPENTHREAD_CONFIG_MLE_MAX_CHILDREN, ///< Max source match entries not in the RCP.
+    };
+#endif
+
     enum State
     {
         kStateDisabled,     ///< Radio is disabled.
@@ -877,6 +901,47 @@ private:
                                         const char *      aFormat,
                                         va_list           aArgs);
     otError WaitResponse(void);
+#if OPENTHREAD_SPINEL_CONFIG_PIPELINED_REQUESTS_ENABLE
+    struct SrcMatchEntry
+    {
+        bool Matches(const SrcMatchEntry &aOther) const;
+
+        bool         mIsShort;      ///< Whether the entry is a short address.
+        uint16_t     mShortAddress; ///< The short address (if `mIsShort`).
+        otExtAddress mExtAddress;   ///< The extended address in little-endian byte order (if not `mIsShort`).
+    };
+
+    struct PostedRequest
+    {
+        spinel_prop_key_t mKey;             ///< The property key of the posted request.
+        uint32_t          mExpectedCommand; ///< Expected response command of the posted request.
+        uint64_t          mEndUs;           ///< When the response to the posted request is due.
+        SrcMatchEntry     mSrcMatchEntry;   ///< The source match entry inserted or removed (if any).
+        bool              mIsSrcMatchRetry; ///< Whether this request re-inserts a missing source match entry.
+    };
+
+    void    WaitPostedRequestSlot(void);
+    otError Post(spinel_tid_t &    aTid,
+                 uint32_t          aExpectedCommand,
+                 uint32_t          aCommand,
+                 spinel_prop_key_t aKey,
+                 const char *      aFormat,
+                 ...);
+    otError PostV(spinel_tid_t &    aTid,
+                  uint32_t          aExpectedCommand,
+                  uint32_t          aCommand,
+                  spinel_prop_key_t aKey,
+                  const char *      aFormat,
+                  va_list           aArgs);
+    otError PostSet(spinel_prop_key_t aKey, const char *aFormat, ...);
+    otError PostSrcMatchEntry(uint32_t aCommand, const SrcMatchEntry &aEntry, bool aIsRetry);
+    otError UpdateSrcMatch(void);
+    void    ProcessPostedRequests(void);
+    int16_t FindSrcMatchMissing(const SrcMatchEntry &aEntry) const;
+    void    AddSrcMatchMissing(const SrcMatchEntry &aEntry);
+    bool    RemoveSrcMatchMissing(const SrcMatchEntry &aEntry);
+    void    RemoveSrcMatchMissing(bool aIsShort);
+#endif
     otError SendReset(void);
     otError SendCommand(uint32_t          command,
                         spinel_prop_key_t key,
@@ -909,6 +974,14 @@ private:
     void HandleResponse(const uint8_t *aBuffer, uint16_t aLength);
     void HandleTransmitDone(uint32_t aCommand, spinel_prop_key_t aKey, const uint8_t *aBuffer, uint16_t aLength);
     void HandleWaitingResponse(uint32_t aCommand, spinel_prop_key_t aKey, const uint8_t *aBuffer, uint16_t aLength);
+#if OPENTHREAD_SPINEL_CONFIG_PIPELINED_REQUESTS_ENABLE
+    void HandlePostedResponse(spinel_tid_t      aTid,
+                              uint32_t          aCommand,
+                              spinel_prop_key_t aKey,
+                              const uint8_t *   aBuffer,
+                              uint16_t          aLength);
+    void HandleSrcMatchResponse(const PostedRequest &aRequest, otError aError);
+#endif
 
     void RadioReceive(void);
 
@@ -940,6 +1013,19 @@ private:
     uint32_t          mExpectedCommand; ///< Expected response command of current transaction.
     otError           mError;           ///< The result of current transaction.
 
+#if OPENTHREAD_SPINEL_CONFIG_PIPELINED_REQUESTS_ENABLE
+    uint16_t      mPostedTids;                                 ///< Transaction ids of posted requests in flight.
+    uint8_t       mPostedRequestCount;                         ///< Number of posted requests in flight.
+    PostedRequest mPostedRequests[SPINEL_HEADER_TID_MASK + 1]; ///< Posted requests, indexed by transaction id.
+
+    SrcMatchEntry mSrcMatchMissing[kMaxSrcMatchMissing]; ///< Source match entries the RCP failed to insert.
+    uint16_t      mSrcMatchMissingCount;                 ///< Number of entries in `mSrcMatchMissing`.
+    bool          mSrcMatchEnabled : 1;                  ///< Whether the core enabled source matching.
+    bool          mSrcMatchRcpEnabled : 1;               ///< Whether source matching was last enabled on the RCP.
+    bool          mSrcMatchRetrying : 1;                 ///< Whether a missing entry is being inserted again.
+    bool          mSrcMatchCanRetry : 1;                 ///< Whether an entry was removed since the last failure.
+#endif
+
     uint8_t       mRxPsdu[OT_RADIO_FRAME_MAX_SIZE];
     uint8_t       mTxPsdu[OT_RADIO_FRAME_MAX_SIZE];
     uint8_t       mAckPsdu[OT_RADIO_FRAME_MAX_SIZE];
@@ -183,6 +183,15 @@ RadioSpinel<InterfaceType, ProcessContextType>::RadioSpinel(void)
     , mPropertyFormat(nullptr)
     , mExpectedCommand(0)
     , mError(OT_ERROR_NONE)
+#if OPENTHREAD_SPINEL_CONFIG_PIPELINED_REQUESTS_ENABLE
+    , mPostedTids(0)
+    , mPostedRequestCount(0)
+    , mSrcMatchMissingCount(0)
+    , mSrcMatchEnabled(false)
+    , mSrcMatchRcpEnabled(false)
+    , mSrcMatchRetrying(false)
+    , mSrcMatchCanRetry(false)
+#endif
     , mTransmitFrame(nullptr)
     , mShortAddress(0)
     , mPanId(0xffff)
@@ -575,6 +584,12 @@ void RadioSpinel<InterfaceType, ProcessContextType>::HandleResponse(const uint8_
         FreeTid(mTxRadioTid);
         mTxRadioTid = 0;
     }
+#if OPENTHREAD_SPINEL_CONFIG_PIPELINED_REQUESTS_ENABLE
+    else if ((mPostedTids & (1 << SPINEL_HEADER_GET_TID(header))) != 0)
+    {
+        HandlePostedResponse(SPINEL_HEADER_GET_TID(header), cmd, key, data, static_cast<uint16_t>(len));
+    }
+#endif
     else
     {
         otLogWarnPlat("Unexpected Spinel transaction message: %u", SPINEL_HEADER_GET_TID(header));
@@ -1087,6 +1102,10 @@ void RadioSpinel<InterfaceType, ProcessContextType>::Process(const ProcessContex
 
     ProcessRadioStateMachine();
     RecoverFromRcpFailure();
+#if OPENTHREAD_SPINEL_CONFIG_PIPELINED_REQUESTS_ENABLE
+    ProcessPostedRequests();
+    RecoverFromRcpFailure();
+#endif
     CalcRcpTimeOffset();
 }
 
@@ -1125,11 +1144,19 @@ otError RadioSpinel<InterfaceType, ProcessContextType>::SetMacKey(uint8_t
 {
     otError error;
 
+#if OPENTHREAD_SPINEL_CONFIG_PIPELINED_REQUESTS_ENABLE
+    SuccessOrExit(error = PostSet(SPINEL_PROP_RCP_MAC_KEY,
+                                  SPINEL_DATATYPE_UINT8_S SPINEL_DATATYPE_UINT8_S SPINEL_DATATYPE_DATA_WLEN_S
+                                      SPINEL_DATATYPE_DATA_WLEN_S SPINEL_DATATYPE_DATA_WLEN_S,
+                                  aKeyIdMode, aKeyId, aPrevKey.m8, sizeof(otMacKey), aCurrKey.m8, sizeof(otMacKey),
+                                  aNextKey.m8, sizeof(otMacKey)));
+#else
     SuccessOrExit(error = Set(SPINEL_PROP_RCP_MAC_KEY,
                               SPINEL_DATATYPE_UINT8_S SPINEL_DATATYPE_UINT8_S SPINEL_DATATYPE_DATA_WLEN_S
                                   SPINEL_DATATYPE_DATA_WLEN_S SPINEL_DATATYPE_DATA_WLEN_S,
                               aKeyIdMode, aKeyId, aPrevKey.m8, sizeof(otMacKey), aCurrKey.m8, sizeof(otMacKey),
                               aNextKey.m8, sizeof(otMacKey)));
+#endif
 
 #if OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
     mKeyIdMode = aKeyIdMode;
@@ -1149,7 +1176,11 @@ otError RadioSpinel<InterfaceType, ProcessContextType>::SetMacFrameCounter(uint3
 {
     otError error;
 
+#if OPENTHREAD_SPINEL_CONFIG_PIPELINED_REQUESTS_ENABLE
+    SuccessOrExit(error = PostSet(SPINEL_PROP_RCP_MAC_FRAME_COUNTER, SPINEL_DATATYPE_UINT32_S, aMacFrameCounter));
+#else
     SuccessOrExit(error = Set(SPINEL_PROP_RCP_MAC_FRAME_COUNTER, SPINEL_DATATYPE_UINT32_S, aMacFrameCounter));
+#endif
 
 exit:
     return error;
@@ -1191,7 +1222,14 @@ exit:
 template <typename InterfaceType, typename ProcessContextType>
 otError RadioSpinel<InterfaceType, ProcessContextType>::EnableSrcMatch(bool aEnable)
 {
+#if OPENTHREAD_SPINEL_CONFIG_PIPELINED_REQUESTS_ENABLE
+    WaitPostedRequestSlot();
+    mSrcMatchEnabled = aEnable;
+
+    return UpdateSrcMatch();
+#else
     return Set(SPINEL_PROP_MAC_SRC_MATCH_ENABLED, SPINEL_DATATYPE_BOOL_S, aEnable);
+#endif
 }
 
 template <typename InterfaceType, typename ProcessContextType>
@@ -1199,7 +1237,17 @@ otError RadioSpinel<InterfaceType, ProcessContextType>::AddSrcMatchShortEntry(ui
 {
     otError error;
 
+#if OPENTHREAD_SPINEL_CONFIG_PIPELINED_REQUESTS_ENABLE
+    SrcMatchEntry entry;
+
+    entry.mIsShort      = true;
+    entry.mShortAddress = aShortAddress;
+
+    WaitPostedRequestSlot();
+    SuccessOrExit(error = PostSrcMatchEntry(SPINEL_CMD_PROP_VALUE_INSERT, entry, /* aIsRetry */ false));
+#else
     SuccessOrExit(error = Insert(SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES, SPINEL_DATATYPE_UINT16_S, aShortAddress));
+#endif
 
 #if OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
     assert(mSrcMatchShortEntryCount < OPENTHREAD_CONFIG_MLE_MAX_CHILDREN);
@@ -1224,8 +1272,18 @@ otError RadioSpinel<InterfaceType, ProcessContextType>::AddSrcMatchExtEntry(cons
 {
     otError error;
 
+#if OPENTHREAD_SPINEL_CONFIG_PIPELINED_REQUESTS_ENABLE
+    SrcMatchEntry entry;
+
+    entry.mIsShort    = false;
+    entry.mExtAddress = aExtAddress;
+
+    WaitPostedRequestSlot();
+    SuccessOrExit(error = PostSrcMatchEntry(SPINEL_CMD_PROP_VALUE_INSERT, entry, /* aIsRetry */ false));
+#else
     SuccessOrExit(error =
                       Insert(SPINEL_PROP_MAC_SRC_MATCH_EXTENDED_ADDRESSES, SPINEL_DATATYPE_EUI64_S, aExtAddress.m8));
+#endif
 
 #if OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
     assert(mSrcMatchExtEntryCount < OPENTHREAD_CONFIG_MLE_MAX_CHILDREN);
@@ -1250,7 +1308,17 @@ otError RadioSpinel<InterfaceType, ProcessContextType>::ClearSrcMatchShortEntry(
 {
     otError error;
 
+#if OPENTHREAD_SPINEL_CONFIG_PIPELINED_REQUESTS_ENABLE
+    SrcMatchEntry entry;
+
+    entry.mIsShort      = true;
+    entry.mShortAddress = aShortAddress;
+
+    WaitPostedRequestSlot();
+    SuccessOrExit(error = PostSrcMatchEntry(SPINEL_CMD_PROP_VALUE_REMOVE, entry, /* aIsRetry */ false));
+#else
     SuccessOrExit(error = Remove(SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES, SPINEL_DATATYPE_UINT16_S, aShortAddress));
+#endif
 
 #if OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
     for (int i = 0; i < mSrcMatchShortEntryCount; ++i)
@@ -1273,8 +1341,18 @@ otError RadioSpinel<InterfaceType, ProcessContextType>::ClearSrcMatchExtEntry(co
 {
     otError error;
 
+#if OPENTHREAD_SPINEL_CONFIG_PIPELINED_REQUESTS_ENABLE
+    SrcMatchEntry entry;
+
+    entry.mIsShort    = false;
+    entry.mExtAddress = aExtAddress;
+
+    WaitPostedRequestSlot();
+    SuccessOrExit(error = PostSrcMatchEntry(SPINEL_CMD_PROP_VALUE_REMOVE, entry, /* aIsRetry */ false));
+#else
     SuccessOrExit(error =
                       Remove(SPINEL_PROP_MAC_SRC_MATCH_EXTENDED_ADDRESSES, SPINEL_DATATYPE_EUI64_S, aExtAddress.m8));
+#endif
 
 #if OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
     for (int i = 0; i < mSrcMatchExtEntryCount; ++i)
@@ -1299,6 +1377,10 @@ otError RadioSpinel<InterfaceType, ProcessContextType>::ClearSrcMatchShortEntrie
 
     SuccessOrExit(error = Set(SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES, nullptr));
 
+#if OPENTHREAD_SPINEL_CONFIG_PIPELINED_REQUESTS_ENABLE
+    RemoveSrcMatchMissing(/* aIsShort */ true);
+#endif
+
 #if OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
     mSrcMatchShortEntryCount = 0;
 #endif
@@ -1314,6 +1396,10 @@ otError RadioSpinel<InterfaceType, ProcessContextType>::ClearSrcMatchExtEntries(
 
     SuccessOrExit(error = Set(SPINEL_PROP_MAC_SRC_MATCH_EXTENDED_ADDRESSES, nullptr));
 
+#if OPENTHREAD_SPINEL_CONFIG_PIPELINED_REQUESTS_ENABLE
+    RemoveSrcMatchMissing(/* aIsShort */ false);
+#endif
+
 #if OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
     mSrcMatchExtEntryCount = 0;
 #endif
@@ -1656,18 +1742,374 @@ exit:
 template <typename InterfaceType, typename ProcessContextType>
 spinel_tid_t RadioSpinel<InterfaceType, ProcessContextType>::GetNextTid(void)
 {
-    spinel_tid_t tid = 0;
+    spinel_tid_t tid = mCmdNextTid;
 
-    if (((1 << mCmdNextTid) & mCmdTidsInUse) == 0)
+    // Posted requests may still hold some tids, so skip over those.
+    while (((1 << tid) & mCmdTidsInUse) != 0)
     {
-        tid         = mCmdNextTid;
-        mCmdNextTid = SPINEL_GET_NEXT_TID(mCmdNextTid);
-        mCmdTidsInUse |= (1 << tid);
+        tid = SPINEL_GET_NEXT_TID(tid);
+
+        if (tid == mCmdNextTid)
+        {
+            ExitNow(tid = 0);
+        }
     }
 
+    mCmdNextTid = SPINEL_GET_NEXT_TID(tid);
+    mCmdTidsInUse |= (1 << tid);
+
+exit:
     return tid;
 }
 
+template <typename InterfaceType, typename ProcessContextType>
+uint64_t RadioSpinel<InterfaceType, ProcessContextType>::GetPostedRequestsEndUs(void) const
+{
+    uint64_t endUs = UINT64_MAX;
+
+#if OPENTHREAD_SPINEL_CONFIG_PIPELINED_REQUESTS_ENABLE
+    for (spinel_tid_t tid = 1; tid <= SPINEL_HEADER_TID_MASK; tid++)
+    {
+        if ((mPostedTids & (1 << tid)) != 0 && mPostedRequests[tid].mEndUs < endUs)
+        {
+            endUs = mPostedRequests[tid].mEndUs;
+        }
+    }
+#endif
+
+    return endUs;
+}
+
+template <typename InterfaceType, typename ProcessContextType>
+bool RadioSpinel<InterfaceType, ProcessContextType>::HasPendingSrcMatchUpdate(void) const
+{
+#if OPENTHREAD_SPINEL_CONFIG_PIPELINED_REQUESTS_ENABLE
+    return (mSrcMatchRcpEnabled != (mSrcMatchEnabled && mSrcMatchMissingCount == 0)) ||
+           (mSrcMatchMissingCount > 0 && mSrcMatchCanRetry && !mSrcMatchRetrying);
+#else
+    return false;
+#endif
+}
+
+#if OPENTHREAD_SPINEL_CONFIG_PIPELINED_REQUESTS_ENABLE
+template <typename InterfaceType, typename ProcessContextType>
+bool RadioSpinel<InterfaceType, ProcessContextType>::SrcMatchEntry::Matches(const SrcMatchEntry &aOther) const
+{
+    return (mIsShort == aOther.mIsShort) &&
+           (mIsShort ? (mShortAddress == aOther.mShortAddress)
+                     : (memcmp(mExtAddress.m8, aOther.mExtAddress.m8, OT_EXT_ADDRESS_SIZE) == 0));
+}
+
+template <typename InterfaceType, typename ProcessContextType>
+void RadioSpinel<InterfaceType, ProcessContextType>::WaitPostedRequestSlot(void)
+{
+    assert(mWaitingTid == 0);
+
+#if OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
+    do
+    {
+        RecoverFromRcpFailure();
+#endif
+        while (mPostedRequestCount >= kMaxPostedRequests)
+        {
+            uint64_t now   = otPlatTimeGet();
+            uint64_t endUs = GetPostedRequestsEndUs();
+
+            if (endUs <= now || mSpinelInterface.WaitForFrame(endUs - now) != OT_ERROR_NONE)
+            {
+                otLogWarnPlat("Wait for posted requests timeout");
+                HandleRcpTimeout();
+                break;
+            }
+        }
+#if OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
+    } while (mRcpFailed);
+#endif
+}
+
+template <typename InterfaceType, typename ProcessContextType>
+otError RadioSpinel<InterfaceType, ProcessContextType>::Post(spinel_tid_t &    aTid,
+                                                             uint32_t          aExpectedCommand,
+                                                             uint32_t          aCommand,
+                                                             spinel_prop_key_t aKey,
+                                                             const char *      aFormat,
+                                                             ...)
+{
+    otError error;
+    va_list args;
+
+    va_start(args, aFormat);
+    error = PostV(aTid, aExpectedCommand, aCommand, aKey, aFormat, args);
+    va_end(args);
+
+    return error;
+}
+
+template <typename InterfaceType, typename ProcessContextType>
+otError RadioSpinel<InterfaceType, ProcessContextType>::PostV(spinel_tid_t &    aTid,
+                                                              uint32_t          aExpectedCommand,
+                                                              uint32_t          aCommand,
+                                                              spinel_prop_key_t aKey,
+                                                              const char *      aFormat,
+                                                              va_list           aArgs)
+{
+    otError error = OT_ERROR_NONE;
+
+    VerifyOrExit(mPostedRequestCount < kMaxPostedRequests, error = OT_ERROR_BUSY);
+
+    aTid = GetNextTid();
+    VerifyOrExit(aTid > 0, error = OT_ERROR_BUSY);
+
+    error = SendCommand(aCommand, aKey, aTid, aFormat, aArgs);
+
+    if (error != OT_ERROR_NONE)
+    {
+        FreeTid(aTid);
+        ExitNow();
+    }
+
+    mPostedRequests[aTid].mKey             = aKey;
+    mPostedRequests[aTid].mExpectedCommand = aExpectedCommand;
+    mPostedRequests[aTid].mEndUs           = otPlatTimeGet() + kMaxWaitTime * US_PER_MS;
+    mPostedRequests[aTid].mIsSrcMatchRetry = false;
+    mPostedTids |= (1 << aTid);
+    mPostedRequestCount++;
+
+exit:
+    return error;
+}
+
+template <typename InterfaceType, typename ProcessContextType>
+otError RadioSpinel<InterfaceType, ProcessContextType>::PostSet(spinel_prop_key_t aKey, const char *aFormat, ...)
+{
+    otError      error;
+    spinel_tid_t tid;
+    va_list      args;
+
+    WaitPostedRequestSlot();
+
+    va_start(args, aFormat);
+    error = PostV(tid, SPINEL_CMD_PROP_VALUE_IS, SPINEL_CMD_PROP_VALUE_SET, aKey, aFormat, args);
+    va_end(args);
+
+    return error;
+}
+
+template <typename InterfaceType, typename ProcessContextType>
+otError RadioSpinel<InterfaceType, ProcessContextType>::PostSrcMatchEntry(uint32_t             aCommand,
+                                                                          const SrcMatchEntry &aEntry,
+                                                                          bool                 aIsRetry)
+{
+    otError      error;
+    spinel_tid_t tid;
+    uint32_t     expectedCommand =
+        (aCommand == SPINEL_CMD_PROP_VALUE_INSERT) ? SPINEL_CMD_PROP_VALUE_INSERTED : SPINEL_CMD_PROP_VALUE_REMOVED;
+
+    if (aEntry.mIsShort)
+    {
+        error = Post(tid, expectedCommand, aCommand, SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES,
+                     SPINEL_DATATYPE_UINT16_S, aEntry.mShortAddress);
+    }
+    else
+    {
+        error = Post(tid, expectedCommand, aCommand, SPINEL_PROP_MAC_SRC_MATCH_EXTENDED_ADDRESSES,
+                     SPINEL_DATATYPE_EUI64_S, aEntry.mExtAddress.m8);
+    }
+
+    SuccessOrExit(error);
+
+    mPostedRequests[tid].mSrcMatchEntry   = aEntry;
+    mPostedRequests[tid].mIsSrcMatchRetry = aIsRetry;
+
+exit:
+    return error;
+}
+
+template <typename InterfaceType, typename ProcessContextType>
+otError RadioSpinel<InterfaceType, ProcessContextType>::UpdateSrcMatch(void)
+{
+    // Source matching stays disabled on the RCP while any entry the core added is missing from the RCP table, so
+    // that the RCP sets the frame pending bit for every child, just like the core does when an insert fails.
+
+    otError      error  = OT_ERROR_NONE;
+    bool         enable = mSrcMatchEnabled && (mSrcMatchMissingCount == 0);
+    spinel_tid_t tid;
+
+    if (enable != mSrcMatchRcpEnabled)
+    {
+        SuccessOrExit(error = Post(tid, SPINEL_CMD_PROP_VALUE_IS, SPINEL_CMD_PROP_VALUE_SET,
+                                   SPINEL_PROP_MAC_SRC_MATCH_ENABLED, SPINEL_DATATYPE_BOOL_S, enable));
+        mSrcMatchRcpEnabled = enable;
+    }
+
+    // Insert the missing entries again one by one, once an entry was removed from the RCP table.
+    if (mSrcMatchMissingCount > 0 && mSrcMatchCanRetry && !mSrcMatchRetrying)
+    {
+        SuccessOrExit(PostSrcMatchEntry(SPINEL_CMD_PROP_VALUE_INSERT, mSrcMatchMissing[0], /* aIsRetry */ true));
+        mSrcMatchRetrying = true;
+    }
+
+exit:
+    return error;
+}
+
+template <typename InterfaceType, typename ProcessContextType>
+void RadioSpinel<InterfaceType, ProcessContextType>::ProcessPostedRequests(void)
+{
+    if (otPlatTimeGet() >= GetPostedRequestsEndUs())
+    {
+        otLogWarnPlat("Posted request timeout");
+        HandleRcpTimeout();
+        ExitNow();
+    }
+
+    if (HasPendingSrcMatchUpdate())
+    {
+        LogIfFail("Update source match failed", UpdateSrcMatch());
+    }
+
+exit:
+    return;
+}
+
+template <typename InterfaceType, typename ProcessContextType>
+void RadioSpinel<InterfaceType, ProcessContextType>::HandlePostedResponse(spinel_tid_t      aTid,
+                                                                          uint32_t          aCommand,
+                                                                          spinel_prop_key_t aKey,
+                                                                          const uint8_t *   aBuffer,
+                                                                          uint16_t          aLength)
+{
+    const PostedRequest &request = mPostedRequests[aTid];
+    otError              error   = OT_ERROR_NONE;
+
+    if (aKey == SPINEL_PROP_LAST_STATUS)
+    {
+        spinel_status_t status;
+        spinel_ssize_t  unpacked = spinel_datatype_unpack(aBuffer, aLength, "i", &status);
+
+        error = (unpacked > 0) ? SpinelStatusToOtError(status) : OT_ERROR_PARSE;
+    }
+    else if (aKey != request.mKey || aCommand != request.mExpectedCommand)
+    {
+        error = OT_ERROR_DROP;
+    }
+
+    FreeTid(aTid);
+    mPostedTids &= ~(1 << aTid);
+    mPostedRequestCount--;
+
+    if (request.mKey == SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES ||
+        request.mKey == SPINEL_PROP_MAC_SRC_MATCH_EXTENDED_ADDRESSES)
+    {
+        HandleSrcMatchResponse(request, error);
+    }
+    else if (error != OT_ERROR_NONE)
+    {
+        // The blocking request would have failed the caller, so treat this as an RCP failure.
+        otLogWarnPlat("Posted %s failed: %s", spinel_prop_key_to_cstr(request.mKey), otThreadErrorToString(error));
+        HandleRcpTimeout();
+    }
+}
+
+template <typename InterfaceType, typename ProcessContextType>
+void RadioSpinel<InterfaceType, ProcessContextType>::HandleSrcMatchResponse(const PostedRequest &aRequest,
+                                                                            otError              aError)
+{
+    if (aRequest.mExpectedCommand == SPINEL_CMD_PROP_VALUE_INSERTED)
+    {
+        if (aRequest.mIsSrcMatchRetry)
+        {
+            mSrcMatchRetrying = false;
+        }
+
+        if (aError == OT_ERROR_NONE)
+        {
+            IgnoreReturnValue(RemoveSrcMatchMissing(aRequest.mSrcMatchEntry));
+        }
+        else
+        {
+            otLogWarnPlat("Insert source match entry failed: %s", otThreadErrorToString(aError));
+            AddSrcMatchMissing(aRequest.mSrcMatchEntry);
+            mSrcMatchCanRetry = false;
+        }
+    }
+    else
+    {
+        // An entry whose insert failed is not in the RCP table, so removing it is expected to fail.
+        bool wasMissing = RemoveSrcMatchMissing(aRequest.mSrcMatchEntry);
+
+        if (aError == OT_ERROR_NONE)
+        {
+            mSrcMatchCanRetry = true;
+        }
+        else if (!wasMissing)
+        {
+            otLogWarnPlat("Remove source match entry failed: %s", otThreadErrorToString(aError));
+        }
+    }
+}
+
+template <typename InterfaceType, typename ProcessContextType>
+int16_t RadioSpinel<InterfaceType, ProcessContextType>::FindSrcMatchMissing(const SrcMatchEntry &aEntry) const
+{
+    int16_t index = -1;
+
+    for (uint16_t i = 0; i < mSrcMatchMissingCount; i++)
+    {
+        if (mSrcMatchMissing[i].Matches(aEntry))
+        {
+            ExitNow(index = static_cast<int16_t>(i));
+        }
+    }
+
+exit:
+    return index;
+}
+
+template <typename InterfaceType, typename ProcessContextType>
+void RadioSpinel<InterfaceType, ProcessContextType>::AddSrcMatchMissing(const SrcMatchEntry &aEntry)
+{
+    VerifyOrExit(FindSrcMatchMissing(aEntry) < 0);
+    VerifyOrExit(mSrcMatchMissingCount < kMaxSrcMatchMissing);
+
+    mSrcMatchMissing[mSrcMatchMissingCount++] = aEntry;
+
+exit:
+    return;
+}
+
+template <typename InterfaceType, typename ProcessContextType>
+bool RadioSpinel<InterfaceType, ProcessContextType>::RemoveSrcMatchMissing(const SrcMatchEntry &aEntry)
+{
+    int16_t index = FindSrcMatchMissing(aEntry);
+
+    if (index >= 0)
+    {
+        mSrcMatchMissing[index] = mSrcMatchMissing[--mSrcMatchMissingCount];
+    }
+
+    return (index >= 0);
+}
+
+template <typename InterfaceType, typename ProcessContextType>
+void RadioSpinel<InterfaceType, ProcessContextType>::RemoveSrcMatchMissing(bool aIsShort)
+{
+    for (uint16_t i = 0; i < mSrcMatchMissingCount;)
+    {
+        if (mSrcMatchMissing[i].mIsShort == aIsShort)
+        {
+            mSrcMatchMissing[i] = mSrcMatchMissing[--mSrcMatchMissingCount];
+        }
+        else
+        {
+            i++;
+        }
+    }
+
+    mSrcMatchCanRetry = true;
+}
+#endif // OPENTHREAD_SPINEL_CONFIG_PIPELINED_REQUESTS_ENABLE
+
 template <typename InterfaceType, typename ProcessContextType>
 otError RadioSpinel<InterfaceType, ProcessContextType>::SendReset(void)
 {
@@ -2204,6 +2646,12 @@ void RadioSpinel<InterfaceType, ProcessContextType>::RecoverFromRcpFailure(void)
     mError        = OT_ERROR_NONE;
     mIsReady      = false;
     mIsTimeSynced = false;
+#if OPENTHREAD_SPINEL_CONFIG_PIPELINED_REQUESTS_ENABLE
+    // The posted requests are lost with the RCP, `RestoreProperties()` sets what they carried.
+    mPostedTids         = 0;
+    mPostedRequestCount = 0;
+    mSrcMatchRetrying   = false;
+#endif
 
     if (mResetRadioOnStartup)
     {
@@ -2271,16 +2719,42 @@ void RadioSpinel<InterfaceType, ProcessContextType>::RestoreProperties(void)
 
     for (int i = 0; i < mSrcMatchShortEntryCount; ++i)
     {
+#if OPENTHREAD_SPINEL_CONFIG_PIPELINED_REQUESTS_ENABLE
+        SrcMatchEntry entry;
+
+        entry.mIsShort      = true;
+        entry.mShortAddress = mSrcMatchShortEntries[i];
+
+        if (FindSrcMatchMissing(entry) >= 0)
+        {
+            continue;
+        }
+#endif
         SuccessOrDie(
             Insert(SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES, SPINEL_DATATYPE_UINT16_S, mSrcMatchShortEntries[i]));
     }
 
     for (int i = 0; i < mSrcMatchExtEntryCount; ++i)
     {
+#if OPENTHREAD_SPINEL_CONFIG_PIPELINED_REQUESTS_ENABLE
+        SrcMatchEntry entry;
+
+        entry.mIsShort    = false;
+        entry.mExtAddress = mSrcMatchExtEntries[i];
+
+        if (FindSrcMatchMissing(entry) >= 0)
+        {
+            continue;
+        }
+#endif
         SuccessOrDie(
             Insert(SPINEL_PROP_MAC_SRC_MATCH_EXTENDED_ADDRESSES, SPINEL_DATATYPE_EUI64_S, mSrcMatchExtEntries[i].m8));
     }
 
+#if OPENTHREAD_SPINEL_CONFIG_PIPELINED_REQUESTS_ENABLE
+    SuccessOrDie(Set(SPINEL_PROP_MAC_SRC_MATCH_ENABLED, SPINEL_DATATYPE_BOOL_S, mSrcMatchRcpEnabled));
+#endif
+
     if (mCcaEnergyDetectThresholdSet)
     {
         SuccessOrDie(Set(SPINEL_PROP_PHY_CCA_THRESHOLD, SPINEL_DATATYPE_INT8_S, mCcaEnergyDetectThreshold));
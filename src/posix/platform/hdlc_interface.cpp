@@ -180,6 +180,7 @@ void HdlcInterface::Deinit(void)
 {
     VerifyOrExit(mSockFd != -1);
 
+    platformMainloopRemoveFd(mSockFd);
     VerifyOrExit(0 == close(mSockFd), perror("close RCP"));
     VerifyOrExit(-1 != wait(nullptr) || errno == ECHILD, perror("wait RCP"));
 
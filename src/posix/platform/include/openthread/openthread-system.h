@@ -104,6 +104,9 @@ void otSysDeinit(void);
 /**
  * This structure represents a context for a select() based mainloop.
  *
+ * On Linux the file descriptors are waited for with epoll() (see `OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE`), the
+ * file descriptor sets being filled and returned the same way as with select().
+ *
  */
 typedef struct otSysMainloopContext
 {
@@ -128,11 +131,23 @@ void otSysMainloopUpdate(otInstance *aInstance, otSysMainloopContext *aMainloop)
  *
  * @param[inout]    aMainloop   A pointer to the mainloop context.
  *
- * @returns value returned from select().
+ * @returns The number of ready file descriptors, 0 on timeout or -1 on failure, as returned by select().
  *
  */
 int otSysMainloopPoll(otSysMainloopContext *aMainloop);
 
+/**
+ * This function removes a file descriptor from the mainloop before it is closed.
+ *
+ * With epoll, a file descriptor put in the mainloop file descriptor sets stays registered across iterations. Code
+ * outside OpenThread which closes such a file descriptor should call this function first, so that a new file
+ * descriptor reusing its number gets registered even if it is put in the same sets.
+ *
+ * @param[in]  aFd  The file descriptor about to be closed.
+ *
+ */
+void otSysMainloopRemoveFd(int aFd);
+
 /**
  * This function performs all platform-specific processing for OpenThread's example applications.
  *
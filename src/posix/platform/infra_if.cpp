@@ -246,6 +246,7 @@ void platformInfraIfDeinit(void)
 {
     if (sInfraIfIcmp6Socket != -1)
     {
+        platformMainloopRemoveFd(sInfraIfIcmp6Socket);
         close(sInfraIfIcmp6Socket);
         sInfraIfIcmp6Socket = -1;
     }
@@ -206,6 +206,7 @@ void MulticastRoutingManager::FinalizeMulticastRouterSock(void)
 {
     VerifyOrExit(IsEnabled());
 
+    platformMainloopRemoveFd(mMulticastRouterSock);
     close(mMulticastRouterSock);
     mMulticastRouterSock = -1;
 
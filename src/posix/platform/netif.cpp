@@ -85,6 +85,7 @@
 #include <sys/socket.h>
 #include <sys/stat.h>
 #include <sys/types.h>
+#include <sys/uio.h>
 #include <unistd.h>
 
 #if defined(__APPLE__) || defined(__NetBSD__) || defined(__FreeBSD__)
@@ -145,6 +146,7 @@ extern int
 
 #include "common/code_utils.hpp"
 #include "common/logging.hpp"
+#include "common/message.hpp"
 #include "net/ip6_address.hpp"
 
 unsigned int gNetifIndex = 0;
@@ -514,18 +516,74 @@ void platformNetifStateChange(otInstance *aInstance, otChangedFlags aFlags)
     }
 }
 
+#if defined(__APPLE__) || defined(__NetBSD__) || defined(__FreeBSD__)
+// BSD tunnel drivers use (for legacy reasons) a 4-byte header to determine the address family of the packet
+static constexpr uint16_t kTunHeaderSize = 4;
+#else
+static constexpr uint16_t kTunHeaderSize = 0;
+#endif
+
+// The chunks of a message holding a full-size packet, plus one vector for the tunnel header.
+static constexpr int kMaxIoVectors =
+    static_cast<int>((kMaxIp6Size + kTunHeaderSize) / (OPENTHREAD_CONFIG_MESSAGE_BUFFER_SIZE - sizeof(otMessage))) + 3;
+
+/**
+ * This function adds I/O vectors pointing in place at the first @p aLength bytes of a message.
+ *
+ * @param[in]     aMessage    A reference to the message.
+ * @param[in]     aLength     The number of bytes to cover.
+ * @param[out]    aIoVectors  An array of `kMaxIoVectors` I/O vectors.
+ * @param[inout]  aCount      On entry, the number of I/O vectors already in use. On exit, the number in use.
+ *
+ * @retval OT_ERROR_NONE     Successfully added the I/O vectors.
+ * @retval OT_ERROR_NO_BUFS  The message is split in more chunks than there are I/O vectors.
+ *
+ */
+static otError addMessageIoVectors(ot::Message &aMessage, uint16_t aLength, struct iovec *aIoVectors, int &aCount)
+{
+    ot::Message::Segment segments[kMaxIoVectors];
+    uint8_t              numSegments = static_cast<uint8_t>(kMaxIoVectors - aCount);
+    otError              error       = aMessage.GetSegments(0, aLength, segments, numSegments);
+
+    SuccessOrExit(error);
+
+    for (uint8_t i = 0; i < numSegments; i++)
+    {
+        aIoVectors[aCount].iov_base = segments[i].mData;
+        aIoVectors[aCount].iov_len  = segments[i].mLength;
+        aCount++;
+    }
+
+exit:
+    return error;
+}
+
+#if OPENTHREAD_POSIX_LOG_TUN_PACKETS
+static void logTunPacket(const char *aDirection, const ot::Message &aMessage)
+{
+    uint8_t  packet[kMaxIp6Size];
+    uint16_t length = aMessage.ReadBytes(0, packet, sizeof(packet));
+
+    otLogInfoPlat("Packet %s NCP (%hu bytes)", aDirection, length);
+    otDumpInfo(OT_LOG_REGION_PLATFORM, "", packet, length);
+}
+#endif
+
 static void processReceive(otMessage *aMessage, void *aContext)
 {
     OT_UNUSED_VARIABLE(aContext);
 
-    char     packet[kMaxIp6Size + 4];
-    otError  error     = OT_ERROR_NONE;
-    uint16_t length    = otMessageGetLength(aMessage);
-    size_t   offset    = 0;
-    uint16_t maxLength = sizeof(packet) - 4;
+    ot::Message &message = *static_cast<ot::Message *>(aMessage);
+    struct iovec iov[kMaxIoVectors];
+    int          count  = 0;
+    otError      error  = OT_ERROR_NONE;
+    uint16_t     length = message.GetLength();
 #if defined(__APPLE__) || defined(__NetBSD__) || defined(__FreeBSD__)
-    // BSD tunnel drivers use (for legacy reasons) a 4-byte header to determine the address family of the packet
-    offset += 4;
+    uint8_t header[kTunHeaderSize] = {0, 0, (PF_INET6 << 8) & 0xFF, (PF_INET6 << 0) & 0xFF};
+
+    iov[count].iov_base = header;
+    iov[count].iov_len  = sizeof(header);
+    count++;
 #endif
 
     assert(sInstance == aContext);
@@ -533,85 +591,132 @@ static void processReceive(otMessage *aMessage, void *aContext)
 
     VerifyOrExit(sTunFd > 0);
 
-    VerifyOrExit(otMessageRead(aMessage, 0, &packet[offset], maxLength) == length, error = OT_ERROR_NO_BUFS);
-
 #if OPENTHREAD_POSIX_LOG_TUN_PACKETS
-    otLogInfoPlat("Packet from NCP (%hu bytes)", static_cast<uint16_t>(length));
-    otDumpInfo(OT_LOG_REGION_PLATFORM, "", &packet[offset], length);
+    logTunPacket("from", message);
 #endif
 
-#if defined(__APPLE__) || defined(__NetBSD__) || defined(__FreeBSD__)
-    packet[0] = 0;
-    packet[1] = 0;
-    packet[2] = (PF_INET6 << 8) & 0xFF;
-    packet[3] = (PF_INET6 << 0) & 0xFF;
-    length += 4;
-#endif
+    // The packet is written straight from the message buffers.
+    SuccessOrExit(error = addMessageIoVectors(message, length, iov, count));
 
-    VerifyOrExit(write(sTunFd, packet, length) == length, perror("write"); error = OT_ERROR_FAILED);
+    VerifyOrExit(writev(sTunFd, iov, count) == length + kTunHeaderSize, perror("writev"); error = OT_ERROR_FAILED);
 
 exit:
     otMessageFree(aMessage);
 
-    if (error == OT_ERROR_NONE)
-    {
-        otLogInfoPlat("%s: %s", __func__, otThreadErrorToString(error));
-    }
-    else
+    if (error != OT_ERROR_NONE)
     {
         otLogWarnPlat("%s: %s", __func__, otThreadErrorToString(error));
     }
 }
 
-static void processTransmit(otInstance *aInstance)
+/**
+ * This function reads a packet from the TUN device directly into a message, and sends it.
+ *
+ * The TUN device cannot tell the length of a pending packet, so the packet is read into the first buffer of a new
+ * message, which holds a full-size packet when `OPENTHREAD_CONFIG_MESSAGE_LARGE_BUFFER_ENABLE` is set. Otherwise the
+ * part of a packet not fitting in the first buffer is read into a scratch buffer and appended, so that the message
+ * only takes the buffers the packet needs.
+ *
+ * @param[in]  aInstance  The OpenThread instance structure.
+ *
+ * @retval TRUE   A packet was read, more packets may be pending.
+ * @retval FALSE  No packet was pending, or reading failed.
+ *
+ */
+static bool transmitPacket(otInstance *aInstance)
 {
-    otMessage *message = nullptr;
-    ssize_t    rval;
-    char       packet[kMaxIp6Size];
-    otError    error  = OT_ERROR_NONE;
-    size_t     offset = 0;
+    static uint8_t sPacket[kTunHeaderSize + kMaxIp6Size];
 
-    assert(sInstance == aInstance);
+    ot::Message *message = static_cast<ot::Message *>(otIp6NewMessage(aInstance, nullptr));
+    struct iovec iov[kMaxIoVectors];
+    int          count    = 0;
+    uint16_t     capacity = 0;
+    ssize_t      rval     = 0;
+    otError      error    = OT_ERROR_NONE;
+
+    if (message == nullptr)
+    {
+        // Drop the packet as no message could hold it.
+        rval = read(sTunFd, sPacket, sizeof(sPacket));
+        VerifyOrExit(rval < 0 && (errno == EAGAIN || errno == EWOULDBLOCK), error = OT_ERROR_NO_BUFS);
+        ExitNow();
+    }
+
+    capacity = OT_MIN(message->GetFirstBufferCapacity(), static_cast<uint16_t>(sizeof(sPacket)));
+    SuccessOrExit(error = message->SetLength(capacity));
+    SuccessOrExit(error = addMessageIoVectors(*message, capacity, iov, count));
+
+    if (capacity < sizeof(sPacket))
+    {
+        iov[count].iov_base = sPacket;
+        iov[count].iov_len  = sizeof(sPacket) - capacity;
+        count++;
+    }
+
+    rval = readv(sTunFd, iov, count);
+
+    if (rval < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+    {
+        ExitNow();
+    }
 
-    rval = read(sTunFd, packet, sizeof(packet));
     VerifyOrExit(rval > 0, error = OT_ERROR_FAILED);
 
-    message = otIp6NewMessage(aInstance, nullptr);
-    VerifyOrExit(message != nullptr, error = OT_ERROR_NO_BUFS);
+    if (rval <= capacity)
+    {
+        SuccessOrExit(error = message->SetLength(static_cast<uint16_t>(rval)));
+    }
+    else
+    {
+        SuccessOrExit(error = message->AppendBytes(sPacket, static_cast<uint16_t>(rval - capacity)));
+    }
 
 #if defined(__APPLE__) || defined(__NetBSD__) || defined(__FreeBSD__)
-    // BSD tunnel drivers have (for legacy reasons), may have a 4-byte header on them
-    if ((rval >= 4) && (packet[0] == 0) && (packet[1] == 0))
+    // BSD tunnel drivers may have (for legacy reasons) a 4-byte header on them
     {
-        rval -= 4;
-        offset = 4;
+        uint8_t header[2];
+
+        if ((rval >= kTunHeaderSize) && (message->ReadBytes(0, header, sizeof(header)) == sizeof(header)) &&
+            (header[0] == 0) && (header[1] == 0))
+        {
+            message->RemoveHeader(kTunHeaderSize);
+        }
     }
 #endif
 
 #if OPENTHREAD_POSIX_LOG_TUN_PACKETS
-    otLogInfoPlat("Packet to NCP (%hu bytes)", static_cast<uint16_t>(rval));
-    otDumpInfo(OT_LOG_REGION_PLATFORM, "", &packet[offset], static_cast<size_t>(rval));
+    logTunPacket("to", *message);
 #endif
 
-    SuccessOrExit(error = otMessageAppend(message, &packet[offset], static_cast<uint16_t>(rval)));
-
     error   = otIp6Send(aInstance, message);
     message = nullptr;
 
 exit:
     if (message != nullptr)
     {
-        otMessageFree(message);
+        message->Free();
     }
 
-    if (error == OT_ERROR_NONE)
+    if (error != OT_ERROR_NONE)
     {
-        otLogInfoPlat("%s: %s", __func__, otThreadErrorToString(error));
+        otLogWarnPlat("%s: %s", __func__, otThreadErrorToString(error));
     }
-    else
+
+    return (rval > 0) && (error != OT_ERROR_NO_BUFS) && (error != OT_ERROR_FAILED);
+}
+
+static void processTransmit(otInstance *aInstance)
+{
+    assert(sInstance == aInstance);
+
+    // Drain the packets pending on the TUN device, up to a budget so other file descriptors are served in time.
+    for (uint16_t i = 0; i < OPENTHREAD_POSIX_CONFIG_TUN_READ_BUDGET; i++)
     {
-        otLogWarnPlat("%s: %s", __func__, otThreadErrorToString(error));
+        VerifyOrExit(transmitPacket(aInstance));
     }
+
+exit:
+    return;
 }
 
 #define kAddAddress true
@@ -1118,6 +1223,7 @@ void platformNetifDeinit(void)
 {
     if (sTunFd != -1)
     {
+        platformMainloopRemoveFd(sTunFd);
         close(sTunFd);
         sTunFd = -1;
 
@@ -1128,12 +1234,14 @@ void platformNetifDeinit(void)
 
     if (sIpFd != -1)
     {
+        platformMainloopRemoveFd(sIpFd);
         close(sIpFd);
         sIpFd = -1;
     }
 
     if (sNetlinkFd != -1)
     {
+        platformMainloopRemoveFd(sNetlinkFd);
         close(sNetlinkFd);
         sNetlinkFd = -1;
     }
@@ -1141,6 +1249,7 @@ void platformNetifDeinit(void)
 #if OPENTHREAD_POSIX_USE_MLD_MONITOR
     if (sMLDMonitorFd != -1)
     {
+        platformMainloopRemoveFd(sMLDMonitorFd);
         close(sMLDMonitorFd);
         sMLDMonitorFd = -1;
     }
@@ -1522,12 +1631,14 @@ void platformNetifProcess(const fd_set *aReadFdSet, const fd_set *aWriteFdSet, c
 
     if (FD_ISSET(sTunFd, aErrorFdSet))
     {
+        platformMainloopRemoveFd(sTunFd);
         close(sTunFd);
         DieNow(OT_EXIT_FAILURE);
     }
 
     if (FD_ISSET(sNetlinkFd, aErrorFdSet))
     {
+        platformMainloopRemoveFd(sNetlinkFd);
         close(sNetlinkFd);
         DieNow(OT_EXIT_FAILURE);
     }
@@ -1535,6 +1646,7 @@ void platformNetifProcess(const fd_set *aReadFdSet, const fd_set *aWriteFdSet, c
 #if OPENTHREAD_POSIX_USE_MLD_MONITOR
     if (FD_ISSET(sMLDMonitorFd, aErrorFdSet))
     {
+        platformMainloopRemoveFd(sMLDMonitorFd);
         close(sMLDMonitorFd);
         DieNow(OT_EXIT_FAILURE);
     }
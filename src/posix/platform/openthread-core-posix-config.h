@@ -44,6 +44,90 @@
 #define OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS 256
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_MESSAGE_LARGE_BUFFER_ENABLE
+ *
+ * Define as 1 to store each message in a single buffer large enough for a full IPv6 datagram.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MESSAGE_LARGE_BUFFER_ENABLE
+#define OPENTHREAD_CONFIG_MESSAGE_LARGE_BUFFER_ENABLE 1
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_SRP_SERVER_NAME_INDEX_SIZE
+ *
+ * The number of buckets in each of the SRP server name hash indices.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_SRP_SERVER_NAME_INDEX_SIZE
+#define OPENTHREAD_CONFIG_SRP_SERVER_NAME_INDEX_SIZE 256
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_DNSSD_SERVER_NAME_COMPRESS_TABLE_SIZE
+ *
+ * The number of slots in the table of name suffixes used to compress the names in a DNS-SD Server response.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_DNSSD_SERVER_NAME_COMPRESS_TABLE_SIZE
+#define OPENTHREAD_CONFIG_DNSSD_SERVER_NAME_COMPRESS_TABLE_SIZE 256
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MESH_FORWARDER_SEND_QUEUE_INDEX_ENABLE
+ *
+ * Define as 1 to maintain per-destination indices over the mesh forwarder send queue.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MESH_FORWARDER_SEND_QUEUE_INDEX_ENABLE
+#define OPENTHREAD_CONFIG_MESH_FORWARDER_SEND_QUEUE_INDEX_ENABLE 1
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_NETDATA_FIB_ENABLE
+ *
+ * Define as 1 to compile the Leader Network Data into a forwarding table each time it changes.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_NETDATA_FIB_ENABLE
+#define OPENTHREAD_CONFIG_NETDATA_FIB_ENABLE 1
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MLE_ROUTE_TABLE_ENABLE
+ *
+ * Define as 1 to keep the next hop and path cost toward every router ID in a table indexed by router ID.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MLE_ROUTE_TABLE_ENABLE
+#define OPENTHREAD_CONFIG_MLE_ROUTE_TABLE_ENABLE 1
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MLE_CHILD_TIMEOUT_INDEX_ENABLE
+ *
+ * Define as 1 to process child timeouts from a timer set to the next child deadline.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MLE_CHILD_TIMEOUT_INDEX_ENABLE
+#define OPENTHREAD_CONFIG_MLE_CHILD_TIMEOUT_INDEX_ENABLE 1
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_KEY_SCHEDULE_CACHE_ENABLE
+ *
+ * Define as 1 to keep the expanded AES key schedules of the active MAC, MLE, TREL keys and KEK.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_KEY_SCHEDULE_CACHE_ENABLE
+#define OPENTHREAD_CONFIG_KEY_SCHEDULE_CACHE_ENABLE 1
+#endif
+
+#ifndef OPENTHREAD_CONFIG_MBEDTLS_AESNI_ENABLE
+#define OPENTHREAD_CONFIG_MBEDTLS_AESNI_ENABLE 1
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_LOG_PLATFORM
  *
@@ -78,6 +162,16 @@
 #define OPENTHREAD_CONFIG_LOG_LEVEL_DYNAMIC_ENABLE 1
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_TIMER_HEAP_ENABLE
+ *
+ * Define to 1 to keep the running timers in a pairing heap instead of a sorted list.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_TIMER_HEAP_ENABLE
+#define OPENTHREAD_CONFIG_TIMER_HEAP_ENABLE 1
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_PLATFORM_INFO
  *
@@ -140,6 +140,35 @@
 #define OPENTHREAD_POSIX_CONFIG_MAX_MULTICAST_FORWARDING_CACHE_TABLE (OPENTHREAD_CONFIG_MAX_MULTICAST_LISTENERS * 10)
 #endif
 
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_TUN_READ_BUDGET
+ *
+ * The maximum number of packets read from the TUN device in one mainloop iteration.
+ *
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_TUN_READ_BUDGET
+#define OPENTHREAD_POSIX_CONFIG_TUN_READ_BUDGET 16
+#endif
+
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+ *
+ * Define to 1 to wait for the mainloop file descriptors with epoll() and a timerfd instead of select().
+ *
+ * The file descriptors are still collected in the `otSysMainloopContext` fd sets, but stay registered with the epoll
+ * instance across iterations. Not used with virtual time.
+ *
+ * Use of epoll is enabled by default on linux-based platforms.
+ *
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+#ifdef __linux__
+#define OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE 1
+#else
+#define OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE 0
+#endif
+#endif
+
 /**
  * @def OPENTHREAD_POSIX_CONFIG_SECURE_SETTINGS_ENABLE
  *
@@ -151,6 +180,30 @@
 #define OPENTHREAD_POSIX_CONFIG_SECURE_SETTINGS_ENABLE 0
 #endif
 
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_SETTINGS_SYNC_INTERVAL
+ *
+ * The maximum delay in milliseconds between a settings write and the `fsync()` that makes it durable. All writes
+ * issued within the interval share a single `fsync()`. Define as 0 to sync the settings file on every write.
+ *
+ * Writes of the network info (which holds the MLE and MAC frame counters) are always synced right away.
+ *
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_SETTINGS_SYNC_INTERVAL
+#define OPENTHREAD_POSIX_CONFIG_SETTINGS_SYNC_INTERVAL 100
+#endif
+
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_SETTINGS_COMPACTION_THRESHOLD
+ *
+ * The minimum number of bytes taken by obsolete records before the settings log is compacted. Compaction also waits
+ * until obsolete records take at least as much space as live ones.
+ *
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_SETTINGS_COMPACTION_THRESHOLD
+#define OPENTHREAD_POSIX_CONFIG_SETTINGS_COMPACTION_THRESHOLD 4096
+#endif
+
 #ifdef __APPLE__
 
 /**
@@ -132,6 +132,34 @@ void platformAlarmProcess(otInstance *aInstance);
  */
 int32_t platformAlarmGetNext(void);
 
+/**
+ * This function shortens the mainloop timeout so that pending settings writes are synced in time.
+ *
+ * @param[inout]  aTimeout  A pointer to the timeout.
+ *
+ */
+void platformSettingsUpdateTimeout(struct timeval *aTimeout);
+
+/**
+ * This function performs settings driver processing: it syncs pending writes and compacts the settings log.
+ *
+ * @param[in]  aInstance  The OpenThread instance structure.
+ *
+ */
+void platformSettingsProcess(otInstance *aInstance);
+
+/**
+ * This function removes a file descriptor from the mainloop before it is closed.
+ *
+ * A file descriptor added to the mainloop file descriptor sets stays registered with the mainloop across iterations.
+ * The platform calls this function before closing each file descriptor it owns, so that a new file descriptor reusing
+ * its number gets registered. A file descriptor which is not registered is ignored.
+ *
+ * @param[in]  aFd  The file descriptor about to be closed.
+ *
+ */
+void platformMainloopRemoveFd(int aFd);
+
 #ifndef MS_PER_S
 #define MS_PER_S 1000
 #endif
@@ -144,6 +172,9 @@ int32_t platformAlarmGetNext(void);
 #ifndef NS_PER_US
 #define NS_PER_US 1000
 #endif
+#ifndef NS_PER_S
+#define NS_PER_S (US_PER_S * NS_PER_US)
+#endif
 
 /**
  * This function advances the alarm time by @p aDelta.
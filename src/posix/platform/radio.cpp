@@ -262,6 +262,11 @@ void platformRadioUpdateFdSet(fd_set *aReadFdSet, fd_set *aWriteFdSet, int *aMax
         }
     }
 
+    if (sRadioSpinel.GetPostedRequestsEndUs() < deadline)
+    {
+        deadline = sRadioSpinel.GetPostedRequestsEndUs();
+    }
+
     if (now < deadline)
     {
         uint64_t remain = deadline - now;
@@ -280,7 +285,7 @@ void platformRadioUpdateFdSet(fd_set *aReadFdSet, fd_set *aWriteFdSet, int *aMax
 
     sRadioSpinel.GetSpinelInterface().UpdateFdSet(*aReadFdSet, *aWriteFdSet, *aMaxFd, *aTimeout);
 
-    if (sRadioSpinel.HasPendingFrame() || sRadioSpinel.IsTransmitDone())
+    if (sRadioSpinel.HasPendingFrame() || sRadioSpinel.IsTransmitDone() || sRadioSpinel.HasPendingSrcMatchUpdate())
     {
         aTimeout->tv_sec  = 0;
         aTimeout->tv_usec = 0;
@@ -30,6 +30,13 @@
  * @file
  *   This file implements the OpenThread platform abstraction for non-volatile storage of settings.
  *
+ *   Settings are stored as an append-only log of CRC-protected records, preceded by a file header. Every change
+ *   (add, set or delete) appends one record, and an in-memory index maps each key to the file offsets of its values,
+ *   so reads never scan the file. Writes are made durable by a batched `fsync()` from the mainloop (except for the
+ *   network info, which is synced right away), and the log is compacted there once obsolete records outweigh live
+ *   ones. A torn or corrupted tail is dropped when the log is
+ *   loaded. Files in the legacy format (plain key/length/value triples) are converted on first open.
+ *
  */
 
 #include "openthread-posix-config.h"
@@ -40,8 +47,10 @@
 #include <inttypes.h>
 #include <stddef.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <sys/stat.h>
+#include <sys/uio.h>
 #include <unistd.h>
 
 #include <openthread/platform/misc.h>
@@ -53,12 +62,57 @@
 
 #include "common/code_utils.hpp"
 #include "common/encoding.hpp"
+#include "common/logging.hpp"
+
+static const size_t   kMaxFileNameSize     = sizeof(OPENTHREAD_CONFIG_POSIX_SETTINGS_PATH) + 32;
+static const uint32_t kSettingsFileMagic   = 0x4c53544f; // "OTSL"
+static const uint32_t kSettingsFileVersion = 1;
+static const uint16_t kIndexAll            = 0xffff;
+static const size_t   kBlockSize           = 512;
+static const uint32_t kCrc32Polynomial     = 0xedb88320;
+
+enum : uint8_t
+{
+    kOpAdd    = 1, ///< Appends a value to the key.
+    kOpSet    = 2, ///< Replaces all values of the key with a single value.
+    kOpDelete = 3, ///< Deletes the value at `mIndex` of the key, or all its values if `mIndex` is `kIndexAll`.
+};
+
+struct SettingsFileHeader
+{
+    uint32_t mMagic;
+    uint32_t mVersion;
+};
 
-static const size_t kMaxFileNameSize = sizeof(OPENTHREAD_CONFIG_POSIX_SETTINGS_PATH) + 32;
+struct SettingsRecordHeader
+{
+    uint32_t mCrc; ///< CRC-32 over the rest of the header and the value.
+    uint16_t mKey;
+    uint16_t mLength;
+    uint16_t mIndex;
+    uint8_t  mOp;
+    uint8_t  mReserved;
+};
 
-static int sSettingsFd = -1;
+static_assert(sizeof(SettingsRecordHeader) == 12, "SettingsRecordHeader must not contain padding");
 
-static otError platformSettingsDelete(otInstance *aInstance, uint16_t aKey, int aIndex, int *aSwapFd);
+struct SettingsEntry
+{
+    off_t    mOffset; ///< File offset of the value.
+    uint16_t mKey;
+    uint16_t mLength;
+};
+
+static int            sSettingsFd    = -1;
+static SettingsEntry *sEntries       = nullptr; ///< Values of all keys, in the order they were added.
+static size_t         sEntryCount    = 0;
+static size_t         sEntryCapacity = 0;
+static off_t          sFileSize      = 0; ///< End of the last valid record, where the next record is appended.
+static off_t          sLiveSize      = 0; ///< Total size of the records backing `sEntries`.
+static bool           sSyncPending   = false;
+static uint64_t       sSyncTime      = 0;
+
+static otError platformSettingsDelete(uint16_t aKey, int aIndex);
 
 #if OPENTHREAD_POSIX_CONFIG_SECURE_SETTINGS_ENABLE
 static const uint16_t *sKeys       = nullptr;
@@ -112,61 +166,367 @@ static int swapOpen(otInstance *aInstance)
     return fd;
 }
 
+static void swapPersist(otInstance *aInstance, int aFd)
+{
+    char swapFile[kMaxFileNameSize];
+    char dataFile[kMaxFileNameSize];
+
+    getSettingsFileName(aInstance, swapFile, true);
+    getSettingsFileName(aInstance, dataFile, false);
+
+    VerifyOrDie(0 == close(sSettingsFd), OT_EXIT_ERROR_ERRNO);
+    VerifyOrDie(0 == fsync(aFd), OT_EXIT_ERROR_ERRNO);
+    VerifyOrDie(0 == rename(swapFile, dataFile), OT_EXIT_ERROR_ERRNO);
+
+    sSettingsFd = aFd;
+}
+
+static uint32_t crc32Update(uint32_t aCrc, const void *aData, size_t aLength)
+{
+    const uint8_t *data = static_cast<const uint8_t *>(aData);
+
+    for (size_t i = 0; i < aLength; i++)
+    {
+        aCrc ^= data[i];
+
+        for (uint8_t bit = 0; bit < 8; bit++)
+        {
+            aCrc = (aCrc >> 1) ^ (kCrc32Polynomial & (0u - (aCrc & 1)));
+        }
+    }
+
+    return aCrc;
+}
+
+static uint32_t crc32Header(const SettingsRecordHeader &aHeader)
+{
+    return crc32Update(0xffffffff, &aHeader.mKey, sizeof(aHeader) - offsetof(SettingsRecordHeader, mKey));
+}
+
+static void writeFileHeader(int aFd)
+{
+    SettingsFileHeader header;
+
+    header.mMagic   = kSettingsFileMagic;
+    header.mVersion = kSettingsFileVersion;
+
+    VerifyOrDie(write(aFd, &header, sizeof(header)) == sizeof(header), OT_EXIT_ERROR_ERRNO);
+}
+
+static void syncSettings(void)
+{
+    VerifyOrExit(sSyncPending);
+
+    VerifyOrDie(fsync(sSettingsFd) == 0, OT_EXIT_ERROR_ERRNO);
+    sSyncPending = false;
+
+exit:
+    return;
+}
+
 /**
- * This function reads @p aLength bytes from the data file and appends to the swap file.
+ * This function indicates whether a change to a given key must be made durable before returning.
  *
- * @param[in]   aFd     The file descriptor of the current swap file.
- * @param[in]   aLength Number of bytes to copy.
+ * The network info holds the key sequence and the MLE and MAC frame counters. Losing its last write on a crash could
+ * make the device reuse frame counters after a restart, so it is never left to the batched `fsync()`.
+ *
+ * @param[in]  aKey  The key of the changed setting.
+ *
+ * @returns TRUE if the change must be synced right away, FALSE if it can be batched.
  *
  */
-static void swapWrite(otInstance *aInstance, int aFd, uint16_t aLength)
+static bool isSyncRequired(uint16_t aKey)
 {
-    OT_UNUSED_VARIABLE(aInstance);
+    return (aKey == OT_SETTINGS_KEY_NETWORK_INFO);
+}
+
+static void scheduleSync(bool aImmediate)
+{
+    if (aImmediate || (OPENTHREAD_POSIX_CONFIG_SETTINGS_SYNC_INTERVAL == 0))
+    {
+        sSyncPending = true;
+        syncSettings();
+    }
+    else if (!sSyncPending)
+    {
+        sSyncPending = true;
+        sSyncTime    = otPlatTimeGet() + OPENTHREAD_POSIX_CONFIG_SETTINGS_SYNC_INTERVAL * US_PER_MS;
+    }
+}
 
-    const size_t kBlockSize = 512;
-    uint8_t      buffer[kBlockSize];
+static SettingsEntry *findEntry(uint16_t aKey, int aIndex)
+{
+    SettingsEntry *entry = nullptr;
 
-    while (aLength > 0)
+    for (size_t i = 0; i < sEntryCount; i++)
     {
-        uint16_t count = aLength >= sizeof(buffer) ? sizeof(buffer) : aLength;
-        ssize_t  rval  = read(sSettingsFd, buffer, count);
+        if (sEntries[i].mKey != aKey)
+        {
+            continue;
+        }
+
+        if (aIndex == 0)
+        {
+            entry = &sEntries[i];
+            break;
+        }
 
-        VerifyOrDie(rval > 0, OT_EXIT_FAILURE);
-        count = static_cast<uint16_t>(rval);
-        rval  = write(aFd, buffer, count);
-        assert(rval == count);
-        VerifyOrDie(rval == count, OT_EXIT_FAILURE);
-        aLength -= count;
+        --aIndex;
     }
+
+    return entry;
 }
 
-static void swapPersist(otInstance *aInstance, int aFd)
+static void addEntry(uint16_t aKey, uint16_t aLength, off_t aOffset)
 {
-    char swapFile[kMaxFileNameSize];
-    char dataFile[kMaxFileNameSize];
+    if (sEntryCount == sEntryCapacity)
+    {
+        size_t         capacity = (sEntryCapacity == 0) ? 16 : sEntryCapacity * 2;
+        SettingsEntry *entries  = static_cast<SettingsEntry *>(realloc(sEntries, capacity * sizeof(SettingsEntry)));
 
-    getSettingsFileName(aInstance, swapFile, true);
-    getSettingsFileName(aInstance, dataFile, false);
+        VerifyOrDie(entries != nullptr, OT_EXIT_FAILURE);
+        sEntries       = entries;
+        sEntryCapacity = capacity;
+    }
 
-    VerifyOrDie(0 == close(sSettingsFd), OT_EXIT_ERROR_ERRNO);
-    VerifyOrDie(0 == fsync(aFd), OT_EXIT_ERROR_ERRNO);
-    VerifyOrDie(0 == rename(swapFile, dataFile), OT_EXIT_ERROR_ERRNO);
+    sEntries[sEntryCount].mOffset = aOffset;
+    sEntries[sEntryCount].mKey    = aKey;
+    sEntries[sEntryCount].mLength = aLength;
+    sEntryCount++;
 
-    sSettingsFd = aFd;
+    sLiveSize += sizeof(SettingsRecordHeader) + aLength;
 }
 
-static void swapDiscard(otInstance *aInstance, int aFd)
+/**
+ * This function removes values of a key from the index.
+ *
+ * @param[in]  aKey    The key of the values.
+ * @param[in]  aIndex  The index of the value to remove, or `kIndexAll` to remove all values of @p aKey.
+ *
+ */
+static void removeEntries(uint16_t aKey, uint16_t aIndex)
 {
-    char swapFileName[kMaxFileNameSize];
+    size_t count = 0;
+    int    index = 0;
 
-    VerifyOrDie(0 == close(aFd), OT_EXIT_ERROR_ERRNO);
-    getSettingsFileName(aInstance, swapFileName, true);
-    VerifyOrDie(0 == unlink(swapFileName), OT_EXIT_ERROR_ERRNO);
+    for (size_t i = 0; i < sEntryCount; i++)
+    {
+        SettingsEntry &entry = sEntries[i];
+
+        if (entry.mKey == aKey && (aIndex == kIndexAll || aIndex == index++))
+        {
+            sLiveSize -= sizeof(SettingsRecordHeader) + entry.mLength;
+            continue;
+        }
+
+        sEntries[count++] = entry;
+    }
+
+    sEntryCount = count;
+}
+
+static void clearEntries(void)
+{
+    sEntryCount = 0;
+    sLiveSize   = 0;
+}
+
+static void applyRecord(const SettingsRecordHeader &aHeader, off_t aValueOffset)
+{
+    switch (aHeader.mOp)
+    {
+    case kOpSet:
+        removeEntries(aHeader.mKey, kIndexAll);
+        OT_FALL_THROUGH;
+
+    case kOpAdd:
+        addEntry(aHeader.mKey, aHeader.mLength, aValueOffset);
+        break;
+
+    case kOpDelete:
+        removeEntries(aHeader.mKey, aHeader.mIndex);
+        break;
+
+    default:
+        assert(false);
+        break;
+    }
+}
+
+static void appendRecord(uint8_t aOp, uint16_t aKey, uint16_t aIndex, const uint8_t *aValue, uint16_t aValueLength)
+{
+    SettingsRecordHeader header;
+    struct iovec         iov[2];
+    ssize_t              length = static_cast<ssize_t>(sizeof(header) + aValueLength);
+
+    header.mKey      = aKey;
+    header.mLength   = aValueLength;
+    header.mIndex    = aIndex;
+    header.mOp       = aOp;
+    header.mReserved = 0;
+    header.mCrc      = ~crc32Update(crc32Header(header), aValue, aValueLength);
+
+    iov[0].iov_base = &header;
+    iov[0].iov_len  = sizeof(header);
+    iov[1].iov_base = const_cast<uint8_t *>(aValue);
+    iov[1].iov_len  = aValueLength;
+
+    VerifyOrDie(writev(sSettingsFd, iov, (aValueLength > 0) ? 2 : 1) == length, OT_EXIT_FAILURE);
+
+    applyRecord(header, sFileSize + static_cast<off_t>(sizeof(header)));
+    sFileSize += length;
+
+    scheduleSync(isSyncRequired(aKey));
+}
+
+/**
+ * This function loads the index from a settings log.
+ *
+ * @param[in]  aSize  The size of the settings file.
+ *
+ * @retval OT_ERROR_NONE   All records were loaded.
+ * @retval OT_ERROR_PARSE  A torn or corrupted record was found, the records before it were loaded.
+ *
+ */
+static otError loadLog(off_t aSize)
+{
+    otError error  = OT_ERROR_NONE;
+    off_t   offset = sizeof(SettingsFileHeader);
+
+    while (offset < aSize)
+    {
+        SettingsRecordHeader header;
+        uint8_t              buffer[kBlockSize];
+        uint32_t             crc;
+        off_t                valueOffset = offset + static_cast<off_t>(sizeof(header));
+
+        VerifyOrExit(pread(sSettingsFd, &header, sizeof(header), offset) == sizeof(header), error = OT_ERROR_PARSE);
+        VerifyOrExit(header.mOp == kOpAdd || header.mOp == kOpSet || header.mOp == kOpDelete, error = OT_ERROR_PARSE);
+        VerifyOrExit(valueOffset + header.mLength <= aSize, error = OT_ERROR_PARSE);
+
+        crc = crc32Header(header);
+
+        for (uint16_t read = 0; read < header.mLength;)
+        {
+            uint16_t count = OT_MIN(static_cast<uint16_t>(header.mLength - read), static_cast<uint16_t>(kBlockSize));
+
+            VerifyOrExit(pread(sSettingsFd, buffer, count, valueOffset + read) == count, error = OT_ERROR_PARSE);
+            crc = crc32Update(crc, buffer, count);
+            read += count;
+        }
+
+        VerifyOrExit(~crc == header.mCrc, error = OT_ERROR_PARSE);
+
+        applyRecord(header, valueOffset);
+        offset = valueOffset + header.mLength;
+    }
+
+exit:
+    sFileSize = offset;
+    return error;
+}
+
+/**
+ * This function loads the index from a settings file in the legacy format.
+ *
+ * @param[in]  aSize  The size of the settings file.
+ *
+ * @retval OT_ERROR_NONE   All records were loaded.
+ * @retval OT_ERROR_PARSE  A truncated record was found, the records before it were loaded.
+ *
+ */
+static otError loadLegacy(off_t aSize)
+{
+    otError error  = OT_ERROR_NONE;
+    off_t   offset = 0;
+
+    while (offset < aSize)
+    {
+        uint16_t key;
+        uint16_t length;
+        off_t    valueOffset = offset + static_cast<off_t>(sizeof(key) + sizeof(length));
+
+        VerifyOrExit(pread(sSettingsFd, &key, sizeof(key), offset) == sizeof(key), error = OT_ERROR_PARSE);
+        VerifyOrExit(pread(sSettingsFd, &length, sizeof(length), offset + static_cast<off_t>(sizeof(key))) ==
+                         sizeof(length),
+                     error = OT_ERROR_PARSE);
+        VerifyOrExit(valueOffset + length <= aSize, error = OT_ERROR_PARSE);
+
+        addEntry(key, length, valueOffset);
+        offset = valueOffset + length;
+    }
+
+exit:
+    sFileSize = offset;
+    return error;
+}
+
+/**
+ * This function rewrites the settings file with only the live values, in index order.
+ *
+ * The new file is built as a swap file and renamed over the settings file once it is synced, so a crash in the middle
+ * of compaction leaves the previous file intact.
+ *
+ */
+static void compactSettings(otInstance *aInstance)
+{
+    int   swapFd = swapOpen(aInstance);
+    off_t offset = sizeof(SettingsFileHeader);
+
+    writeFileHeader(swapFd);
+
+    for (size_t i = 0; i < sEntryCount; i++)
+    {
+        SettingsEntry &      entry = sEntries[i];
+        SettingsRecordHeader header;
+        uint8_t              buffer[kBlockSize];
+        off_t                valueOffset = offset + static_cast<off_t>(sizeof(header));
+        uint32_t             crc;
+
+        header.mKey      = entry.mKey;
+        header.mLength   = entry.mLength;
+        header.mIndex    = 0;
+        header.mOp       = kOpAdd;
+        header.mReserved = 0;
+
+        crc = crc32Header(header);
+
+        for (uint16_t copied = 0; copied < entry.mLength;)
+        {
+            uint16_t count = OT_MIN(static_cast<uint16_t>(entry.mLength - copied), static_cast<uint16_t>(kBlockSize));
+
+            VerifyOrDie(pread(sSettingsFd, buffer, count, entry.mOffset + copied) == count, OT_EXIT_FAILURE);
+            VerifyOrDie(pwrite(swapFd, buffer, count, valueOffset + copied) == count, OT_EXIT_FAILURE);
+            crc = crc32Update(crc, buffer, count);
+            copied += count;
+        }
+
+        header.mCrc = ~crc;
+        VerifyOrDie(pwrite(swapFd, &header, sizeof(header), offset) == sizeof(header), OT_EXIT_FAILURE);
+
+        entry.mOffset = valueOffset;
+        offset        = valueOffset + entry.mLength;
+    }
+
+    swapPersist(aInstance, swapFd);
+    VerifyOrDie(lseek(sSettingsFd, offset, SEEK_SET) == offset, OT_EXIT_ERROR_ERRNO);
+
+    sFileSize    = offset;
+    sLiveSize    = offset - static_cast<off_t>(sizeof(SettingsFileHeader));
+    sSyncPending = false;
+}
+
+static bool shouldCompact(void)
+{
+    off_t garbage = sFileSize - static_cast<off_t>(sizeof(SettingsFileHeader)) - sLiveSize;
+
+    return garbage >= OPENTHREAD_POSIX_CONFIG_SETTINGS_COMPACTION_THRESHOLD && garbage >= sLiveSize;
 }
 
 void otPlatSettingsInit(otInstance *aInstance)
 {
-    otError error = OT_ERROR_NONE;
+    SettingsFileHeader header;
+    off_t              size;
 
 #if OPENTHREAD_POSIX_CONFIG_SECURE_SETTINGS_ENABLE
     otPosixSecureSettingsInit(aInstance);
@@ -190,26 +550,38 @@ void otPlatSettingsInit(otInstance *aInstance)
 
     VerifyOrDie(sSettingsFd != -1, OT_EXIT_ERROR_ERRNO);
 
-    for (off_t size = lseek(sSettingsFd, 0, SEEK_END), offset = lseek(sSettingsFd, 0, SEEK_SET); offset < size;)
-    {
-        uint16_t key;
-        uint16_t length;
-        ssize_t  rval;
+    clearEntries();
+    sSyncPending = false;
 
-        rval = read(sSettingsFd, &key, sizeof(key));
-        VerifyOrExit(rval == sizeof(key), error = OT_ERROR_PARSE);
+    size = lseek(sSettingsFd, 0, SEEK_END);
+    VerifyOrDie(size >= 0, OT_EXIT_ERROR_ERRNO);
 
-        rval = read(sSettingsFd, &length, sizeof(length));
-        VerifyOrExit(rval == sizeof(length), error = OT_ERROR_PARSE);
+    if (size >= static_cast<off_t>(sizeof(header)) && pread(sSettingsFd, &header, sizeof(header), 0) == sizeof(header) &&
+        header.mMagic == kSettingsFileMagic && header.mVersion == kSettingsFileVersion)
+    {
+        if (loadLog(size) != OT_ERROR_NONE)
+        {
+            otLogWarnPlat("Dropping %" PRId64 " bytes of corrupted settings", static_cast<int64_t>(size - sFileSize));
+            VerifyOrDie(ftruncate(sSettingsFd, sFileSize) == 0, OT_EXIT_ERROR_ERRNO);
+        }
 
-        offset += sizeof(key) + sizeof(length) + length;
-        VerifyOrExit(offset == lseek(sSettingsFd, length, SEEK_CUR), error = OT_ERROR_PARSE);
+        VerifyOrDie(lseek(sSettingsFd, sFileSize, SEEK_SET) == sFileSize, OT_EXIT_ERROR_ERRNO);
     }
+    else if (size > 0)
+    {
+        if (loadLegacy(size) != OT_ERROR_NONE)
+        {
+            otLogWarnPlat("Dropping %" PRId64 " bytes of truncated legacy settings",
+                          static_cast<int64_t>(size - sFileSize));
+        }
 
-exit:
-    if (error == OT_ERROR_PARSE)
+        compactSettings(aInstance);
+    }
+    else
     {
-        VerifyOrDie(ftruncate(sSettingsFd, 0) == 0, OT_EXIT_ERROR_ERRNO);
+        writeFileHeader(sSettingsFd);
+        sFileSize = sizeof(header);
+        VerifyOrDie(fsync(sSettingsFd) == 0, OT_EXIT_ERROR_ERRNO);
     }
 }
 
@@ -222,16 +594,22 @@ void otPlatSettingsDeinit(otInstance *aInstance)
 #endif
 
     assert(sSettingsFd != -1);
+    syncSettings();
     VerifyOrDie(close(sSettingsFd) == 0, OT_EXIT_ERROR_ERRNO);
+    sSettingsFd = -1;
+
+    free(sEntries);
+    sEntries       = nullptr;
+    sEntryCapacity = 0;
+    clearEntries();
 }
 
 otError otPlatSettingsGet(otInstance *aInstance, uint16_t aKey, int aIndex, uint8_t *aValue, uint16_t *aValueLength)
 {
     OT_UNUSED_VARIABLE(aInstance);
 
-    otError     error  = OT_ERROR_NOT_FOUND;
-    const off_t size   = lseek(sSettingsFd, 0, SEEK_END);
-    off_t       offset = lseek(sSettingsFd, 0, SEEK_SET);
+    otError              error = OT_ERROR_NOT_FOUND;
+    const SettingsEntry *entry;
 
 #if OPENTHREAD_POSIX_CONFIG_SECURE_SETTINGS_ENABLE
     if (isCriticalKey(aKey))
@@ -240,48 +618,21 @@ otError otPlatSettingsGet(otInstance *aInstance, uint16_t aKey, int aIndex, uint
     }
 #endif
 
-    VerifyOrExit(offset == 0 && size >= 0, error = OT_ERROR_PARSE);
+    entry = findEntry(aKey, aIndex);
+    VerifyOrExit(entry != nullptr);
 
-    while (offset < size)
-    {
-        uint16_t key;
-        uint16_t length;
-        ssize_t  rval;
+    error = OT_ERROR_NONE;
 
-        rval = read(sSettingsFd, &key, sizeof(key));
-        VerifyOrExit(rval == sizeof(key), error = OT_ERROR_PARSE);
-
-        rval = read(sSettingsFd, &length, sizeof(length));
-        VerifyOrExit(rval == sizeof(length), error = OT_ERROR_PARSE);
-
-        if (key == aKey)
+    if (aValueLength)
+    {
+        if (aValue)
         {
-            if (aIndex == 0)
-            {
-                error = OT_ERROR_NONE;
-
-                if (aValueLength)
-                {
-                    if (aValue)
-                    {
-                        uint16_t readLength = (length <= *aValueLength ? length : *aValueLength);
-
-                        VerifyOrExit(read(sSettingsFd, aValue, readLength) == readLength, error = OT_ERROR_PARSE);
-                    }
-
-                    *aValueLength = length;
-                }
-
-                break;
-            }
-            else
-            {
-                --aIndex;
-            }
+            uint16_t readLength = (entry->mLength <= *aValueLength ? entry->mLength : *aValueLength);
+
+            VerifyOrExit(pread(sSettingsFd, aValue, readLength, entry->mOffset) == readLength, error = OT_ERROR_PARSE);
         }
 
-        offset += sizeof(key) + sizeof(length) + length;
-        VerifyOrExit(offset == lseek(sSettingsFd, length, SEEK_CUR), error = OT_ERROR_PARSE);
+        *aValueLength = entry->mLength;
     }
 
 exit:
@@ -291,8 +642,9 @@ exit:
 
 otError otPlatSettingsSet(otInstance *aInstance, uint16_t aKey, const uint8_t *aValue, uint16_t aValueLength)
 {
-    int     swapFd = -1;
-    otError error  = OT_ERROR_NONE;
+    OT_UNUSED_VARIABLE(aInstance);
+
+    otError error = OT_ERROR_NONE;
 
 #if OPENTHREAD_POSIX_CONFIG_SECURE_SETTINGS_ENABLE
     if (isCriticalKey(aKey))
@@ -301,23 +653,7 @@ otError otPlatSettingsSet(otInstance *aInstance, uint16_t aKey, const uint8_t *a
     }
 #endif
 
-    switch (platformSettingsDelete(aInstance, aKey, -1, &swapFd))
-    {
-    case OT_ERROR_NONE:
-    case OT_ERROR_NOT_FOUND:
-        break;
-
-    default:
-        assert(false);
-        break;
-    }
-
-    VerifyOrDie(write(swapFd, &aKey, sizeof(aKey)) == sizeof(aKey) &&
-                    write(swapFd, &aValueLength, sizeof(aValueLength)) == sizeof(aValueLength) &&
-                    write(swapFd, aValue, aValueLength) == aValueLength,
-                OT_EXIT_FAILURE);
-
-    swapPersist(aInstance, swapFd);
+    appendRecord(kOpSet, aKey, 0, aValue, aValueLength);
 
 #if OPENTHREAD_POSIX_CONFIG_SECURE_SETTINGS_ENABLE
 exit:
@@ -329,9 +665,7 @@ otError otPlatSettingsAdd(otInstance *aInstance, uint16_t aKey, const uint8_t *a
 {
     OT_UNUSED_VARIABLE(aInstance);
 
-    otError error  = OT_ERROR_NONE;
-    off_t   size   = lseek(sSettingsFd, 0, SEEK_END);
-    int     swapFd = swapOpen(aInstance);
+    otError error = OT_ERROR_NONE;
 
 #if OPENTHREAD_POSIX_CONFIG_SECURE_SETTINGS_ENABLE
     if (isCriticalKey(aKey))
@@ -340,18 +674,7 @@ otError otPlatSettingsAdd(otInstance *aInstance, uint16_t aKey, const uint8_t *a
     }
 #endif
 
-    if (size > 0)
-    {
-        VerifyOrDie(0 == lseek(sSettingsFd, 0, SEEK_SET), OT_EXIT_ERROR_ERRNO);
-        swapWrite(aInstance, swapFd, static_cast<uint16_t>(size));
-    }
-
-    VerifyOrDie(write(swapFd, &aKey, sizeof(aKey)) == sizeof(aKey) &&
-                    write(swapFd, &aValueLength, sizeof(aValueLength)) == sizeof(aValueLength) &&
-                    write(swapFd, aValue, aValueLength) == aValueLength,
-                OT_EXIT_FAILURE);
-
-    swapPersist(aInstance, swapFd);
+    appendRecord(kOpAdd, aKey, 0, aValue, aValueLength);
 
 #if OPENTHREAD_POSIX_CONFIG_SECURE_SETTINGS_ENABLE
 exit:
@@ -361,6 +684,8 @@ exit:
 
 otError otPlatSettingsDelete(otInstance *aInstance, uint16_t aKey, int aIndex)
 {
+    OT_UNUSED_VARIABLE(aInstance);
+
     otError error;
 
 #if OPENTHREAD_POSIX_CONFIG_SECURE_SETTINGS_ENABLE
@@ -371,114 +696,90 @@ otError otPlatSettingsDelete(otInstance *aInstance, uint16_t aKey, int aIndex)
     else
 #endif
     {
-        error = platformSettingsDelete(aInstance, aKey, aIndex, nullptr);
+        error = platformSettingsDelete(aKey, aIndex);
     }
 
     return error;
 }
 
 /**
- * This function removes a setting either from swap file or persisted file.
+ * This function removes a setting by appending a delete record to the settings log.
  *
- * @param[in]  aInstance  The OpenThread instance structure.
  * @param[in]  aKey       The key associated with the requested setting.
  * @param[in]  aIndex     The index of the value to be removed. If set to -1, all values for this aKey will be removed.
- * @param[out] aSwapFd    A optional pointer to receive file descriptor of the generated swap file descriptor.
- *
- * @note
- *   If @p aSwapFd is null, operate deleting on the setting file.
- *   If @p aSwapFd is not null, operate on the swap file, and aSwapFd will point to the swap file descriptor.
  *
  * @retval OT_ERROR_NONE        The given key and index was found and removed successfully.
  * @retval OT_ERROR_NOT_FOUND   The given key or index was not found in the setting store.
  *
  */
-static otError platformSettingsDelete(otInstance *aInstance, uint16_t aKey, int aIndex, int *aSwapFd)
+static otError platformSettingsDelete(uint16_t aKey, int aIndex)
 {
-    OT_UNUSED_VARIABLE(aInstance);
+    otError error = OT_ERROR_NONE;
 
-    otError error  = OT_ERROR_NOT_FOUND;
-    off_t   size   = lseek(sSettingsFd, 0, SEEK_END);
-    off_t   offset = lseek(sSettingsFd, 0, SEEK_SET);
-    int     swapFd = swapOpen(aInstance);
+    VerifyOrExit(aIndex >= -1 && aIndex < kIndexAll, error = OT_ERROR_NOT_FOUND);
+    VerifyOrExit(findEntry(aKey, (aIndex == -1) ? 0 : aIndex) != nullptr, error = OT_ERROR_NOT_FOUND);
 
-    assert(swapFd != -1);
-    assert(offset == 0);
-    VerifyOrExit(offset == 0 && size >= 0, error = OT_ERROR_PARSE);
+    appendRecord(kOpDelete, aKey, (aIndex == -1) ? kIndexAll : static_cast<uint16_t>(aIndex), nullptr, 0);
 
-    while (offset < size)
-    {
-        uint16_t key;
-        uint16_t length;
-        ssize_t  rval;
-
-        rval = read(sSettingsFd, &key, sizeof(key));
-        VerifyOrExit(rval == sizeof(key), error = OT_ERROR_PARSE);
-
-        rval = read(sSettingsFd, &length, sizeof(length));
-        VerifyOrExit(rval == sizeof(length), error = OT_ERROR_PARSE);
+exit:
+    return error;
+}
 
-        offset += sizeof(key) + sizeof(length) + length;
+void otPlatSettingsWipe(otInstance *aInstance)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+#if OPENTHREAD_POSIX_CONFIG_SECURE_SETTINGS_ENABLE
+    otPosixSecureSettingsWipe(aInstance);
+#endif
 
-        if (aKey == key)
-        {
-            if (aIndex == 0)
-            {
-                VerifyOrExit(offset == lseek(sSettingsFd, length, SEEK_CUR), error = OT_ERROR_PARSE);
-                swapWrite(aInstance, swapFd, static_cast<uint16_t>(size - offset));
-                error = OT_ERROR_NONE;
-                break;
-            }
-            else if (aIndex == -1)
-            {
-                VerifyOrExit(offset == lseek(sSettingsFd, length, SEEK_CUR), error = OT_ERROR_PARSE);
-                error = OT_ERROR_NONE;
-                continue;
-            }
-            else
-            {
-                --aIndex;
-            }
-        }
+    VerifyOrDie(0 == ftruncate(sSettingsFd, 0), OT_EXIT_ERROR_ERRNO);
+    VerifyOrDie(0 == lseek(sSettingsFd, 0, SEEK_SET), OT_EXIT_ERROR_ERRNO);
+    writeFileHeader(sSettingsFd);
 
-        rval = write(swapFd, &key, sizeof(key));
-        assert(rval == sizeof(key));
-        VerifyOrDie(rval == sizeof(key), OT_EXIT_FAILURE);
+    clearEntries();
+    sFileSize = sizeof(SettingsFileHeader);
+    scheduleSync(/* aImmediate */ true);
+}
 
-        rval = write(swapFd, &length, sizeof(length));
-        assert(rval == sizeof(length));
-        VerifyOrDie(rval == sizeof(length), OT_EXIT_FAILURE);
+void platformSettingsUpdateTimeout(struct timeval *aTimeout)
+{
+    uint64_t now;
+    uint64_t remaining = 0;
 
-        swapWrite(aInstance, swapFd, length);
-    }
+    VerifyOrExit(sSyncPending);
 
-exit:
-    VerifyOrDie(error != OT_ERROR_PARSE, OT_EXIT_FAILURE);
+    now = otPlatTimeGet();
 
-    if (aSwapFd != nullptr)
-    {
-        *aSwapFd = swapFd;
-    }
-    else if (error == OT_ERROR_NONE)
+    if (sSyncTime > now)
     {
-        swapPersist(aInstance, swapFd);
+        remaining = sSyncTime - now;
     }
-    else if (error == OT_ERROR_NOT_FOUND)
+
+    if (remaining < static_cast<uint64_t>(aTimeout->tv_sec) * US_PER_S + static_cast<uint64_t>(aTimeout->tv_usec))
     {
-        swapDiscard(aInstance, swapFd);
+        aTimeout->tv_sec  = static_cast<time_t>(remaining / US_PER_S);
+        aTimeout->tv_usec = static_cast<suseconds_t>(remaining % US_PER_S);
     }
 
-    return error;
+exit:
+    return;
 }
 
-void otPlatSettingsWipe(otInstance *aInstance)
+void platformSettingsProcess(otInstance *aInstance)
 {
-    OT_UNUSED_VARIABLE(aInstance);
-#if OPENTHREAD_POSIX_CONFIG_SECURE_SETTINGS_ENABLE
-    otPosixSecureSettingsWipe(aInstance);
-#endif
+    VerifyOrExit(!sSyncPending || otPlatTimeGet() >= sSyncTime);
 
-    VerifyOrDie(0 == ftruncate(sSettingsFd, 0), OT_EXIT_ERROR_ERRNO);
+    if (shouldCompact())
+    {
+        compactSettings(aInstance);
+    }
+    else
+    {
+        syncSettings();
+    }
+
+exit:
+    return;
 }
 
 #ifndef SELF_TEST
@@ -487,6 +788,13 @@ void otPlatSettingsWipe(otInstance *aInstance)
 
 #if SELF_TEST
 
+static uint64_t sNow = 0;
+
+uint64_t otPlatTimeGet(void)
+{
+    return sNow;
+}
+
 void otPlatRadioGetIeeeEui64(otInstance *aInstance, uint8_t *aIeeeEui64)
 {
     OT_UNUSED_VARIABLE(aInstance);
@@ -494,6 +802,15 @@ void otPlatRadioGetIeeeEui64(otInstance *aInstance, uint8_t *aIeeeEui64)
     memset(aIeeeEui64, 0, sizeof(uint64_t));
 }
 
+static off_t getSettingsFileSize(void)
+{
+    struct stat st;
+
+    VerifyOrDie(fstat(sSettingsFd, &st) == 0, OT_EXIT_ERROR_ERRNO);
+
+    return st.st_size;
+}
+
 int main()
 {
     otInstance *instance = nullptr;
@@ -629,6 +946,182 @@ int main()
         assert(otPlatSettingsGet(instance, 0, 0, nullptr, nullptr) == OT_ERROR_NOT_FOUND);
     }
     otPlatSettingsWipe(instance);
+
+    // verify records survive reopening
+    assert(otPlatSettingsAdd(instance, 0, data, sizeof(data)) == OT_ERROR_NONE);
+    assert(otPlatSettingsAdd(instance, 0, data, sizeof(data) / 2) == OT_ERROR_NONE);
+    assert(otPlatSettingsSet(instance, 1, data, sizeof(data) / 3) == OT_ERROR_NONE);
+    assert(otPlatSettingsDelete(instance, 0, 0) == OT_ERROR_NONE);
+    otPlatSettingsDeinit(instance);
+    otPlatSettingsInit(instance);
+    {
+        uint8_t  value[sizeof(data)];
+        uint16_t length = sizeof(value);
+
+        assert(otPlatSettingsGet(instance, 0, 0, value, &length) == OT_ERROR_NONE);
+        assert(length == sizeof(data) / 2);
+        assert(0 == memcmp(value, data, length));
+        assert(otPlatSettingsGet(instance, 0, 1, nullptr, nullptr) == OT_ERROR_NOT_FOUND);
+
+        length = sizeof(value);
+        assert(otPlatSettingsGet(instance, 1, 0, value, &length) == OT_ERROR_NONE);
+        assert(length == sizeof(data) / 3);
+        assert(0 == memcmp(value, data, length));
+    }
+
+    // verify a torn record at the end of the log is dropped
+    {
+        off_t   size = getSettingsFileSize();
+        uint8_t torn[sizeof(SettingsRecordHeader) + 4];
+
+        memset(torn, 0x5a, sizeof(torn));
+        assert(pwrite(sSettingsFd, torn, sizeof(torn), size) == sizeof(torn));
+        otPlatSettingsDeinit(instance);
+        otPlatSettingsInit(instance);
+
+        assert(getSettingsFileSize() == size);
+        assert(otPlatSettingsGet(instance, 0, 0, nullptr, nullptr) == OT_ERROR_NONE);
+        assert(otPlatSettingsGet(instance, 1, 0, nullptr, nullptr) == OT_ERROR_NONE);
+        assert(otPlatSettingsAdd(instance, 2, data, sizeof(data)) == OT_ERROR_NONE);
+        assert(otPlatSettingsGet(instance, 2, 0, nullptr, nullptr) == OT_ERROR_NONE);
+    }
+    otPlatSettingsWipe(instance);
+
+    // verify the network info is synced right away, and other keys are batched
+    assert(!sSyncPending);
+    assert(otPlatSettingsSet(instance, OT_SETTINGS_KEY_ACTIVE_DATASET, data, sizeof(data)) == OT_ERROR_NONE);
+    assert(sSyncPending == (OPENTHREAD_POSIX_CONFIG_SETTINGS_SYNC_INTERVAL != 0));
+    assert(otPlatSettingsSet(instance, OT_SETTINGS_KEY_NETWORK_INFO, data, sizeof(data)) == OT_ERROR_NONE);
+    assert(!sSyncPending);
+    assert(otPlatSettingsDelete(instance, OT_SETTINGS_KEY_NETWORK_INFO, -1) == OT_ERROR_NONE);
+    assert(!sSyncPending);
+    otPlatSettingsWipe(instance);
+
+    // verify the log is compacted once obsolete records outweigh live ones
+    {
+        uint8_t  value[sizeof(data)];
+        uint16_t length = sizeof(value);
+        off_t    size;
+
+        assert(otPlatSettingsAdd(instance, 1, data, sizeof(data)) == OT_ERROR_NONE);
+
+        for (uint16_t i = 0; i < OPENTHREAD_POSIX_CONFIG_SETTINGS_COMPACTION_THRESHOLD / sizeof(data) + 1; i++)
+        {
+            assert(otPlatSettingsSet(instance, 0, data, sizeof(data)) == OT_ERROR_NONE);
+        }
+
+        assert(otPlatSettingsSet(instance, 0, data, sizeof(data) / 2) == OT_ERROR_NONE);
+        size = getSettingsFileSize();
+
+        sNow += OPENTHREAD_POSIX_CONFIG_SETTINGS_SYNC_INTERVAL * US_PER_MS;
+        platformSettingsProcess(instance);
+
+        assert(getSettingsFileSize() < size);
+        assert(getSettingsFileSize() ==
+               static_cast<off_t>(sizeof(SettingsFileHeader) + 2 * sizeof(SettingsRecordHeader) + sizeof(data) +
+                                  sizeof(data) / 2));
+
+        assert(otPlatSettingsGet(instance, 0, 0, value, &length) == OT_ERROR_NONE);
+        assert(length == sizeof(data) / 2);
+        assert(0 == memcmp(value, data, length));
+        assert(otPlatSettingsGet(instance, 0, 1, nullptr, nullptr) == OT_ERROR_NOT_FOUND);
+
+        length = sizeof(value);
+        assert(otPlatSettingsGet(instance, 1, 0, value, &length) == OT_ERROR_NONE);
+        assert(length == sizeof(data));
+        assert(0 == memcmp(value, data, length));
+
+        // appending after compaction
+        assert(otPlatSettingsAdd(instance, 1, data, sizeof(data) / 3) == OT_ERROR_NONE);
+        otPlatSettingsDeinit(instance);
+        otPlatSettingsInit(instance);
+
+        length = sizeof(value);
+        assert(otPlatSettingsGet(instance, 1, 1, value, &length) == OT_ERROR_NONE);
+        assert(length == sizeof(data) / 3);
+        assert(0 == memcmp(value, data, length));
+        assert(otPlatSettingsGet(instance, 0, 0, nullptr, &length) == OT_ERROR_NONE);
+        assert(length == sizeof(data) / 2);
+    }
+    otPlatSettingsWipe(instance);
+    otPlatSettingsDeinit(instance);
+
+    // verify a settings file in the legacy format is converted
+    {
+        char     fileName[kMaxFileNameSize];
+        int      fd;
+        uint16_t key;
+        uint16_t length;
+        uint8_t  value[sizeof(data)];
+
+        getSettingsFileName(instance, fileName, false);
+        fd = open(fileName, O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0600);
+        assert(fd != -1);
+
+        key    = 0;
+        length = sizeof(data);
+        assert(write(fd, &key, sizeof(key)) == sizeof(key));
+        assert(write(fd, &length, sizeof(length)) == sizeof(length));
+        assert(write(fd, data, length) == length);
+
+        key    = 1;
+        length = sizeof(data) / 2;
+        assert(write(fd, &key, sizeof(key)) == sizeof(key));
+        assert(write(fd, &length, sizeof(length)) == sizeof(length));
+        assert(write(fd, data, length) == length);
+        assert(close(fd) == 0);
+
+        otPlatSettingsInit(instance);
+        otPlatSettingsDeinit(instance);
+        otPlatSettingsInit(instance);
+
+        length = sizeof(value);
+        assert(otPlatSettingsGet(instance, 0, 0, value, &length) == OT_ERROR_NONE);
+        assert(length == sizeof(data));
+        assert(0 == memcmp(value, data, length));
+
+        length = sizeof(value);
+        assert(otPlatSettingsGet(instance, 1, 0, value, &length) == OT_ERROR_NONE);
+        assert(length == sizeof(data) / 2);
+        assert(0 == memcmp(value, data, length));
+    }
+    otPlatSettingsWipe(instance);
+    otPlatSettingsDeinit(instance);
+
+    // verify the records before a truncated record of a legacy settings file are kept
+    {
+        char     fileName[kMaxFileNameSize];
+        int      fd;
+        uint16_t key;
+        uint16_t length;
+        uint8_t  value[sizeof(data)];
+
+        getSettingsFileName(instance, fileName, false);
+        fd = open(fileName, O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0600);
+        assert(fd != -1);
+
+        key    = 0;
+        length = sizeof(data);
+        assert(write(fd, &key, sizeof(key)) == sizeof(key));
+        assert(write(fd, &length, sizeof(length)) == sizeof(length));
+        assert(write(fd, data, length) == length);
+
+        key    = 1;
+        length = sizeof(data);
+        assert(write(fd, &key, sizeof(key)) == sizeof(key));
+        assert(write(fd, &length, sizeof(length)) == sizeof(length));
+        assert(write(fd, data, length / 2) == length / 2);
+        assert(close(fd) == 0);
+
+        otPlatSettingsInit(instance);
+
+        length = sizeof(value);
+        assert(otPlatSettingsGet(instance, 0, 0, value, &length) == OT_ERROR_NONE);
+        assert(length == sizeof(data));
+        assert(0 == memcmp(value, data, length));
+        assert(otPlatSettingsGet(instance, 1, 0, nullptr, nullptr) == OT_ERROR_NOT_FOUND);
+    }
+    otPlatSettingsWipe(instance);
     otPlatSettingsDeinit(instance);
 
     return 0;
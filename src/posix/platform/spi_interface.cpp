@@ -205,18 +205,21 @@ void SpiInterface::Deinit(void)
 {
     if (mSpiDevFd >= 0)
     {
+        platformMainloopRemoveFd(mSpiDevFd);
         close(mSpiDevFd);
         mSpiDevFd = -1;
     }
 
     if (mResetGpioValueFd >= 0)
     {
+        platformMainloopRemoveFd(mResetGpioValueFd);
         close(mResetGpioValueFd);
         mResetGpioValueFd = -1;
     }
 
     if (mIntGpioValueFd >= 0)
     {
+        platformMainloopRemoveFd(mIntGpioValueFd);
         close(mIntGpioValueFd);
         mIntGpioValueFd = -1;
     }
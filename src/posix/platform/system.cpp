@@ -36,6 +36,13 @@
 #include "platform-posix.h"
 
 #include <assert.h>
+#include <string.h>
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE && !OPENTHREAD_POSIX_VIRTUAL_TIME
+#include <poll.h>
+#include <sys/epoll.h>
+#include <sys/timerfd.h>
+#include <unistd.h>
+#endif
 
 #include <openthread-core-config.h>
 #include <openthread/border_router.h>
@@ -48,6 +55,438 @@
 
 #include "common/code_utils.hpp"
 
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE && !OPENTHREAD_POSIX_VIRTUAL_TIME
+enum
+{
+    kMaxEpollEvents = 32,      ///< The max number of ready file descriptors reported by one poll.
+    kFdSetWordBits  = NFDBITS, ///< The number of file descriptors in one word of a file descriptor set.
+};
+
+static int           sEpollFd    = -1;              ///< Used to wait for the mainloop file descriptors.
+static int           sTimerFd    = -1;              ///< Used to wake up the mainloop at its timeout.
+static uint64_t      sTimerAt    = 0;               ///< The time (ns) the timerfd is armed for, 0 if not armed.
+static int           sEpollMaxFd = -1;              ///< The max file descriptor of the previous iteration.
+static fd_set        sEpollReadFdSet;               ///< The read file descriptors of the previous iteration.
+static fd_set        sEpollWriteFdSet;              ///< The write file descriptors of the previous iteration.
+static fd_set        sEpollErrorFdSet;              ///< The error file descriptors of the previous iteration.
+static fd_set        sEpollRegisteredFdSet;         ///< The file descriptors registered with the epoll instance.
+static uint32_t      sEpollEvents[FD_SETSIZE];      ///< The events each file descriptor is registered for.
+static uint32_t      sEpollReadyEvents[FD_SETSIZE]; ///< The events each file descriptor was last reported ready for.
+static int           sEpollReadyFds[FD_SETSIZE];    ///< The file descriptors with ready events.
+static int           sEpollReadyCount = 0;          ///< The number of file descriptors in `sEpollReadyFds`.
+static struct pollfd sEpollPendingFds[FD_SETSIZE];  ///< Used to check the file descriptors still ready.
+
+// File descriptor `fd` is bit `fd % NFDBITS` of word `fd / NFDBITS` of a file descriptor set.
+static unsigned long *fdSetWords(fd_set &aFdSet)
+{
+    return reinterpret_cast<unsigned long *>(&aFdSet);
+}
+
+static const unsigned long *fdSetWords(const fd_set &aFdSet)
+{
+    return reinterpret_cast<const unsigned long *>(&aFdSet);
+}
+
+/**
+ * This function returns the mask of the file descriptors up to @p aMaxFd in a word of a file descriptor set.
+ *
+ * @param[in]  aWord   The index of the word.
+ * @param[in]  aMaxFd  The max file descriptor.
+ *
+ * @returns The mask of the file descriptors up to @p aMaxFd in the word.
+ *
+ */
+static unsigned long fdSetWordMask(int aWord, int aMaxFd)
+{
+    unsigned long mask = ~0UL;
+
+    if (aWord * kFdSetWordBits > aMaxFd)
+    {
+        mask = 0;
+    }
+    else if ((aWord + 1) * kFdSetWordBits - 1 > aMaxFd)
+    {
+        mask >>= kFdSetWordBits - 1 - aMaxFd % kFdSetWordBits;
+    }
+
+    return mask;
+}
+
+static void epollInit(void)
+{
+    struct epoll_event event;
+
+    sEpollFd = epoll_create1(EPOLL_CLOEXEC);
+    VerifyOrDie(sEpollFd >= 0, OT_EXIT_ERROR_ERRNO);
+
+    sTimerFd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    VerifyOrDie(sTimerFd >= 0, OT_EXIT_ERROR_ERRNO);
+
+    memset(&event, 0, sizeof(event));
+    event.events  = EPOLLIN;
+    event.data.fd = sTimerFd;
+    VerifyOrDie(epoll_ctl(sEpollFd, EPOLL_CTL_ADD, sTimerFd, &event) == 0, OT_EXIT_ERROR_ERRNO);
+
+    FD_ZERO(&sEpollReadFdSet);
+    FD_ZERO(&sEpollWriteFdSet);
+    FD_ZERO(&sEpollErrorFdSet);
+    FD_ZERO(&sEpollRegisteredFdSet);
+    memset(sEpollEvents, 0, sizeof(sEpollEvents));
+    memset(sEpollReadyEvents, 0, sizeof(sEpollReadyEvents));
+    sEpollReadyCount = 0;
+    sEpollMaxFd      = -1;
+    sTimerAt         = 0;
+}
+
+static void epollDeinit(void)
+{
+    if (sTimerFd != -1)
+    {
+        close(sTimerFd);
+        sTimerFd = -1;
+    }
+
+    if (sEpollFd != -1)
+    {
+        close(sEpollFd);
+        sEpollFd = -1;
+    }
+}
+
+/**
+ * This function registers a file descriptor with the epoll instance for new events.
+ *
+ * @param[in]  aFd      The file descriptor.
+ * @param[in]  aEvents  The events to wait for, 0 to remove the registration.
+ *
+ */
+static void epollUpdateFd(int aFd, uint32_t aEvents)
+{
+    struct epoll_event event;
+
+    sEpollReadyEvents[aFd] = 0;
+
+    if (aEvents == 0)
+    {
+        // The file descriptor may already be closed, which removed it from the epoll instance.
+        IgnoreReturnValue(epoll_ctl(sEpollFd, EPOLL_CTL_DEL, aFd, nullptr));
+        ExitNow();
+    }
+
+    memset(&event, 0, sizeof(event));
+    event.events  = aEvents | EPOLLET;
+    event.data.fd = aFd;
+
+    if (sEpollEvents[aFd] != 0)
+    {
+        VerifyOrExit(epoll_ctl(sEpollFd, EPOLL_CTL_MOD, aFd, &event) != 0);
+
+        // The file descriptor was closed and reopened without `otSysMainloopRemoveFd()`.
+        VerifyOrDie(errno == ENOENT, OT_EXIT_ERROR_ERRNO);
+    }
+
+    if (epoll_ctl(sEpollFd, EPOLL_CTL_ADD, aFd, &event) != 0)
+    {
+        // Regular files cannot be waited for, select() reports them always ready.
+        VerifyOrExit(errno != EPERM, aEvents = 0);
+        VerifyOrDie(errno == EEXIST, OT_EXIT_ERROR_ERRNO);
+        VerifyOrDie(epoll_ctl(sEpollFd, EPOLL_CTL_MOD, aFd, &event) == 0, OT_EXIT_ERROR_ERRNO);
+    }
+
+exit:
+    sEpollEvents[aFd] = aEvents;
+
+    if (aEvents != 0)
+    {
+        FD_SET(aFd, &sEpollRegisteredFdSet);
+    }
+    else
+    {
+        FD_CLR(aFd, &sEpollRegisteredFdSet);
+    }
+}
+
+/**
+ * This function brings the epoll registrations in line with the file descriptor sets of a mainloop context.
+ *
+ * Registrations persist across iterations. The sets are compared a word at a time with the ones of the previous
+ * iteration, and only the file descriptors whose bits changed are added, modified or removed. File descriptors are
+ * registered edge-triggered, and changing the events of a registration makes epoll report its current readiness again.
+ *
+ * @param[in]  aMainloop  A reference to the mainloop context.
+ *
+ * @returns Whether the sets hold a file descriptor which epoll cannot wait for.
+ *
+ */
+static bool epollUpdate(const otSysMainloopContext &aMainloop)
+{
+    const unsigned long *readFds       = fdSetWords(aMainloop.mReadFdSet);
+    const unsigned long *writeFds      = fdSetWords(aMainloop.mWriteFdSet);
+    const unsigned long *errorFds      = fdSetWords(aMainloop.mErrorFdSet);
+    unsigned long *      prevReadFds   = fdSetWords(sEpollReadFdSet);
+    unsigned long *      prevWriteFds  = fdSetWords(sEpollWriteFdSet);
+    unsigned long *      prevErrorFds  = fdSetWords(sEpollErrorFdSet);
+    const unsigned long *registeredFds = fdSetWords(sEpollRegisteredFdSet);
+    int                  maxFd         = OT_MAX(aMainloop.mMaxFd, sEpollMaxFd);
+    bool                 unpollable    = false;
+
+    for (int word = 0; word * kFdSetWordBits <= maxFd; word++)
+    {
+        unsigned long mask  = fdSetWordMask(word, aMainloop.mMaxFd);
+        unsigned long read  = readFds[word] & mask;
+        unsigned long write = writeFds[word] & mask;
+        unsigned long error = errorFds[word] & mask;
+        unsigned long dirty = (read ^ prevReadFds[word]) | (write ^ prevWriteFds[word]) | (error ^ prevErrorFds[word]);
+
+        for (; dirty != 0; dirty &= dirty - 1)
+        {
+            int      bit    = __builtin_ctzl(dirty);
+            uint32_t events = 0;
+
+            events |= ((read >> bit) & 1) ? static_cast<uint32_t>(EPOLLIN) : 0;
+            events |= ((write >> bit) & 1) ? static_cast<uint32_t>(EPOLLOUT) : 0;
+            events |= ((error >> bit) & 1) ? static_cast<uint32_t>(EPOLLPRI) : 0;
+
+            epollUpdateFd(word * kFdSetWordBits + bit, events);
+        }
+
+        prevReadFds[word]  = read;
+        prevWriteFds[word] = write;
+        prevErrorFds[word] = error;
+
+        unpollable |= ((read | write | error) & ~registeredFds[word]) != 0;
+    }
+
+    sEpollMaxFd = aMainloop.mMaxFd;
+
+    return unpollable;
+}
+
+/**
+ * This function checks which of the file descriptors reported ready by the previous poll are still ready.
+ *
+ * Readiness is edge-triggered, and drivers do not always drain a file descriptor in one pass. A file descriptor
+ * reported ready stays ready until a non-blocking poll() finds it is not, after which epoll reports its next edge.
+ * Only file descriptors which were ready on the previous iteration are checked, so an idle mainloop does not pay for
+ * it.
+ *
+ * @returns The number of file descriptors still ready.
+ *
+ */
+static int epollCheckPending(void)
+{
+    nfds_t count = 0;
+
+    // Drop the file descriptors whose registration changed since they were reported ready.
+    for (int i = 0; i < sEpollReadyCount; i++)
+    {
+        int fd = sEpollReadyFds[i];
+
+        if (sEpollReadyEvents[fd] != 0)
+        {
+            sEpollPendingFds[count].fd      = fd;
+            sEpollPendingFds[count].events  = static_cast<short>(sEpollEvents[fd]);
+            sEpollPendingFds[count].revents = 0;
+            count++;
+        }
+    }
+
+    sEpollReadyCount = 0;
+
+    if (count > 0 && poll(sEpollPendingFds, count, 0) < 0)
+    {
+        // Keep the previous readiness, the drivers find out with their non-blocking calls.
+        for (nfds_t i = 0; i < count; i++)
+        {
+            sEpollReadyFds[sEpollReadyCount++] = sEpollPendingFds[i].fd;
+        }
+
+        ExitNow();
+    }
+
+    for (nfds_t i = 0; i < count; i++)
+    {
+        uint32_t ready = 0;
+
+        ready |= (sEpollPendingFds[i].revents & POLLIN) ? static_cast<uint32_t>(EPOLLIN) : 0;
+        ready |= (sEpollPendingFds[i].revents & POLLOUT) ? static_cast<uint32_t>(EPOLLOUT) : 0;
+        ready |= (sEpollPendingFds[i].revents & POLLPRI) ? static_cast<uint32_t>(EPOLLPRI) : 0;
+        ready |= (sEpollPendingFds[i].revents & POLLERR) ? static_cast<uint32_t>(EPOLLERR) : 0;
+        ready |= (sEpollPendingFds[i].revents & POLLHUP) ? static_cast<uint32_t>(EPOLLHUP) : 0;
+
+        sEpollReadyEvents[sEpollPendingFds[i].fd] = ready;
+
+        if (ready != 0)
+        {
+            sEpollReadyFds[sEpollReadyCount++] = sEpollPendingFds[i].fd;
+        }
+    }
+
+exit:
+    return sEpollReadyCount;
+}
+
+/**
+ * This function arms the timerfd for the timeout of a mainloop context.
+ *
+ * The timerfd is only re-armed when the timeout ends before the time it is armed for, or when it is not armed. A
+ * timeout which moved later only causes one early wakeup, after which the timerfd is armed again.
+ *
+ * @param[in]  aTimeout  A reference to the timeout.
+ *
+ */
+static void epollArmTimer(const struct timeval &aTimeout)
+{
+    struct timespec now;
+    uint64_t        at;
+
+    VerifyOrDie(clock_gettime(CLOCK_MONOTONIC, &now) == 0, OT_EXIT_ERROR_ERRNO);
+
+    at = static_cast<uint64_t>(now.tv_sec) * NS_PER_S + static_cast<uint64_t>(now.tv_nsec) +
+         static_cast<uint64_t>(aTimeout.tv_sec) * NS_PER_S + static_cast<uint64_t>(aTimeout.tv_usec) * NS_PER_US;
+
+    if (sTimerAt == 0 || at < sTimerAt)
+    {
+        struct itimerspec timer;
+
+        memset(&timer, 0, sizeof(timer));
+        timer.it_value.tv_sec  = static_cast<time_t>(at / NS_PER_S);
+        timer.it_value.tv_nsec = static_cast<long>(at % NS_PER_S);
+        VerifyOrDie(timerfd_settime(sTimerFd, TFD_TIMER_ABSTIME, &timer, nullptr) == 0, OT_EXIT_ERROR_ERRNO);
+        sTimerAt = at;
+    }
+}
+
+/**
+ * This function waits for the file descriptors of a mainloop context with epoll.
+ *
+ * On return the file descriptor sets only hold the ready file descriptors, as they would after select(). The sets are
+ * updated in place: only the bits of the registered file descriptors which are not ready are cleared. As with
+ * select(), an error or hang-up makes a file descriptor readable and writable, and only priority data is reported in
+ * the error set.
+ *
+ * @param[inout]  aMainloop  A reference to the mainloop context.
+ *
+ * @returns The number of ready file descriptors in the sets, or -1 on failure.
+ *
+ */
+static int epollPoll(otSysMainloopContext &aMainloop)
+{
+    struct epoll_event   events[kMaxEpollEvents];
+    fd_set               readyReadFdSet;
+    fd_set               readyWriteFdSet;
+    fd_set               readyErrorFdSet;
+    unsigned long *      readFds       = fdSetWords(aMainloop.mReadFdSet);
+    unsigned long *      writeFds      = fdSetWords(aMainloop.mWriteFdSet);
+    unsigned long *      errorFds      = fdSetWords(aMainloop.mErrorFdSet);
+    const unsigned long *registeredFds = fdSetWords(sEpollRegisteredFdSet);
+    int                  timeout       = 0;
+    int                  count;
+    int                  rval = 0;
+
+    if (!epollUpdate(aMainloop) && epollCheckPending() == 0 && timerisset(&aMainloop.mTimeout))
+    {
+        epollArmTimer(aMainloop.mTimeout);
+        timeout = -1;
+    }
+
+    count = epoll_wait(sEpollFd, events, kMaxEpollEvents, timeout);
+    VerifyOrExit(count >= 0, rval = -1);
+
+    for (int i = 0; i < count; i++)
+    {
+        int fd = events[i].data.fd;
+
+        if (fd == sTimerFd)
+        {
+            uint64_t expirations;
+
+            IgnoreReturnValue(read(sTimerFd, &expirations, sizeof(expirations)));
+            sTimerAt = 0;
+            continue;
+        }
+
+        if (sEpollReadyEvents[fd] == 0)
+        {
+            sEpollReadyFds[sEpollReadyCount++] = fd;
+        }
+
+        sEpollReadyEvents[fd] |= events[i].events;
+    }
+
+    FD_ZERO(&readyReadFdSet);
+    FD_ZERO(&readyWriteFdSet);
+    FD_ZERO(&readyErrorFdSet);
+
+    for (int i = 0; i < sEpollReadyCount; i++)
+    {
+        int      fd    = sEpollReadyFds[i];
+        uint32_t ready = sEpollReadyEvents[fd];
+
+        if (ready & (EPOLLIN | EPOLLHUP | EPOLLERR))
+        {
+            FD_SET(fd, &readyReadFdSet);
+        }
+
+        if (ready & (EPOLLOUT | EPOLLHUP | EPOLLERR))
+        {
+            FD_SET(fd, &readyWriteFdSet);
+        }
+
+        if (ready & EPOLLPRI)
+        {
+            FD_SET(fd, &readyErrorFdSet);
+        }
+    }
+
+    // File descriptors epoll cannot wait for are always readable and writable, but never have priority data.
+    for (int word = 0; word * kFdSetWordBits <= aMainloop.mMaxFd; word++)
+    {
+        unsigned long mask = fdSetWordMask(word, aMainloop.mMaxFd);
+
+        readFds[word] &= (fdSetWords(readyReadFdSet)[word] | ~registeredFds[word]) & mask;
+        writeFds[word] &= (fdSetWords(readyWriteFdSet)[word] | ~registeredFds[word]) & mask;
+        errorFds[word] &= fdSetWords(readyErrorFdSet)[word] & mask;
+
+        rval += __builtin_popcountl(readFds[word]) + __builtin_popcountl(writeFds[word]) +
+                __builtin_popcountl(errorFds[word]);
+    }
+
+exit:
+    return rval;
+}
+#endif // OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE && !OPENTHREAD_POSIX_VIRTUAL_TIME
+
+void platformMainloopRemoveFd(int aFd)
+{
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE && !OPENTHREAD_POSIX_VIRTUAL_TIME
+    VerifyOrExit(aFd >= 0 && aFd < FD_SETSIZE);
+
+    if (sEpollEvents[aFd] != 0)
+    {
+        IgnoreReturnValue(epoll_ctl(sEpollFd, EPOLL_CTL_DEL, aFd, nullptr));
+    }
+
+    // Forget the file descriptor, so that the next iteration registers a new one reusing its number.
+    FD_CLR(aFd, &sEpollReadFdSet);
+    FD_CLR(aFd, &sEpollWriteFdSet);
+    FD_CLR(aFd, &sEpollErrorFdSet);
+    FD_CLR(aFd, &sEpollRegisteredFdSet);
+    sEpollEvents[aFd]      = 0;
+    sEpollReadyEvents[aFd] = 0;
+
+exit:
+    return;
+#else
+    OT_UNUSED_VARIABLE(aFd);
+#endif
+}
+
+void otSysMainloopRemoveFd(int aFd)
+{
+    platformMainloopRemoveFd(aFd);
+}
+
 #if OPENTHREAD_CONFIG_PLATFORM_NETIF_ENABLE || OPENTHREAD_CONFIG_BACKBONE_ROUTER_ENABLE
 static void processStateChange(otChangedFlags aFlags, void *aContext)
 {
@@ -86,6 +525,9 @@ otInstance *otSysInit(otPlatformConfig *aPlatformConfig)
 
     VerifyOrDie(radioUrl.GetPath() != nullptr, OT_EXIT_INVALID_ARGUMENTS);
     platformAlarmInit(aPlatformConfig->mSpeedUpFactor, aPlatformConfig->mRealTimeSignal);
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE && !OPENTHREAD_POSIX_VIRTUAL_TIME
+    epollInit();
+#endif
     platformRadioInit(&radioUrl);
 #if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
     platformTrelInit(aPlatformConfig->mTrelInterface);
@@ -138,6 +580,10 @@ void otSysDeinit(void)
 #if OPENTHREAD_CONFIG_BORDER_ROUTING_ENABLE
     platformInfraIfDeinit();
 #endif
+
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE && !OPENTHREAD_POSIX_VIRTUAL_TIME
+    epollDeinit();
+#endif
 }
 
 #if OPENTHREAD_POSIX_VIRTUAL_TIME
@@ -176,6 +622,7 @@ static int trySelect(fd_set *aReadFdSet, fd_set *aWriteFdSet, fd_set *aErrorFdSe
 void otSysMainloopUpdate(otInstance *aInstance, otSysMainloopContext *aMainloop)
 {
     platformAlarmUpdateTimeout(&aMainloop->mTimeout);
+    platformSettingsUpdateTimeout(&aMainloop->mTimeout);
     platformUartUpdateFdSet(&aMainloop->mReadFdSet, &aMainloop->mWriteFdSet, &aMainloop->mErrorFdSet,
                             &aMainloop->mMaxFd);
 #if OPENTHREAD_CONFIG_PLATFORM_UDP_ENABLE
@@ -244,8 +691,12 @@ int otSysMainloopPoll(otSysMainloopContext *aMainloop)
     else
 #endif
     {
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE && !OPENTHREAD_POSIX_VIRTUAL_TIME
+        rval = epollPoll(*aMainloop);
+#else
         rval = select(aMainloop->mMaxFd + 1, &aMainloop->mReadFdSet, &aMainloop->mWriteFdSet, &aMainloop->mErrorFdSet,
                       &aMainloop->mTimeout);
+#endif
     }
 
     return rval;
@@ -263,6 +714,7 @@ void otSysMainloopProcess(otInstance *aInstance, const otSysMainloopContext *aMa
 #endif
     platformUartProcess(&aMainloop->mReadFdSet, &aMainloop->mWriteFdSet, &aMainloop->mErrorFdSet);
     platformAlarmProcess(aInstance);
+    platformSettingsProcess(aInstance);
 #if OPENTHREAD_CONFIG_PLATFORM_NETIF_ENABLE
     platformNetifProcess(&aMainloop->mReadFdSet, &aMainloop->mWriteFdSet, &aMainloop->mErrorFdSet);
 #endif
@@ -548,6 +548,7 @@ void otPlatTrelUdp6UpdateAddress(otInstance *aInstance, const otIp6Address *aUni
 
     VerifyOrExit(memcmp(aUnicastAddress, &sInterfaceAddress, sizeof(otIp6Address)) != 0);
 
+    platformMainloopRemoveFd(sSocket);
     close(sSocket);
     RemoveUnicastAddress(&sInterfaceAddress);
 
@@ -646,11 +647,13 @@ void platformTrelDeinit(void)
 {
     if (sSocket != -1)
     {
+        platformMainloopRemoveFd(sSocket);
         close(sSocket);
     }
 
     if (sMulticastSocket != -1)
     {
+        platformMainloopRemoveFd(sMulticastSocket);
         close(sMulticastSocket);
     }
 
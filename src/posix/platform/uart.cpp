@@ -128,12 +128,14 @@ otError otPlatUartDisable(void)
 #if OPENTHREAD_POSIX_CONFIG_DAEMON_ENABLE
     if (sSessionSocket != -1)
     {
+        platformMainloopRemoveFd(sSessionSocket);
         close(sSessionSocket);
         sSessionSocket = -1;
     }
 
     if (sUartSocket != -1)
     {
+        platformMainloopRemoveFd(sUartSocket);
         close(sUartSocket);
         sUartSocket = -1;
     }
@@ -147,6 +149,7 @@ otError otPlatUartDisable(void)
     if (sUartLock != -1)
     {
         (void)flock(sUartLock, LOCK_UN);
+        platformMainloopRemoveFd(sUartLock);
         close(sUartLock);
         sUartLock = -1;
     }
@@ -247,6 +250,7 @@ static void InitializeSessionSocket(void)
 
     if (sSessionSocket != -1)
     {
+        platformMainloopRemoveFd(sSessionSocket);
         close(sSessionSocket);
     }
     sSessionSocket = newSessionSocket;
@@ -292,6 +296,7 @@ static otError UartWrite(int aFd)
         otLogWarnPlat("UART write: %s", strerror(errno));
         if (aFd == sSessionSocket)
         {
+            platformMainloopRemoveFd(sSessionSocket);
             close(sSessionSocket);
             sSessionSocket = -1;
         }
@@ -336,6 +341,7 @@ void platformUartProcess(const fd_set *aReadFdSet, const fd_set *aWriteFdSet, co
 
     if (FD_ISSET(sSessionSocket, aErrorFdSet))
     {
+        platformMainloopRemoveFd(sSessionSocket);
         close(sSessionSocket);
         sSessionSocket = -1;
     }
@@ -374,6 +380,7 @@ void platformUartProcess(const fd_set *aReadFdSet, const fd_set *aWriteFdSet, co
             {
                 perror("UART read");
             }
+            platformMainloopRemoveFd(sSessionSocket);
             close(sSessionSocket);
             sSessionSocket = -1;
             ExitNow();
@@ -434,6 +441,7 @@ otError otPlatUartFlush(void)
 #if OPENTHREAD_POSIX_CONFIG_DAEMON_ENABLE
             if (sSessionSocket == fd)
             {
+                platformMainloopRemoveFd(sSessionSocket);
                 close(sSessionSocket);
                 sSessionSocket = -1;
             }
@@ -254,6 +254,7 @@ otError otPlatUdpClose(otUdpSocket *aUdpSocket)
     VerifyOrExit(aUdpSocket->mHandle != nullptr);
 
     fd = FdFromHandle(aUdpSocket->mHandle);
+    platformMainloopRemoveFd(fd);
     VerifyOrExit(0 == close(fd), error = OT_ERROR_FAILED);
 
     aUdpSocket->mHandle = nullptr;
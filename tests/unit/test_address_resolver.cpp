@@ -0,0 +1,362 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <string.h>
+
+#include <openthread/config.h>
+#include <openthread/thread_ftd.h>
+
+#include "common/code_utils.hpp"
+#include "common/instance.hpp"
+#include "thread/address_resolver.hpp"
+#include "thread/mle_router.hpp"
+
+#include "test_platform.h"
+#include "test_util.hpp"
+
+namespace ot {
+
+#if OPENTHREAD_FTD
+
+enum : uint16_t
+{
+    kCacheEntries       = OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_ENTRIES,
+    kMaxSnoopEntries    = OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_MAX_SNOOP_ENTRIES,
+    kSnoopTimeout       = OPENTHREAD_CONFIG_TMF_SNOOP_CACHE_ENTRY_TIMEOUT,
+    kQueryTimeout       = OPENTHREAD_CONFIG_TMF_ADDRESS_QUERY_TIMEOUT,
+    kQueryRetryDelay    = OPENTHREAD_CONFIG_TMF_ADDRESS_QUERY_INITIAL_RETRY_DELAY,
+    kNumRouters         = 3,
+    kNewEntryIndexStart = 100,
+};
+
+static Instance *sInstance;
+
+void InitTest(void)
+{
+    sInstance = testInitSimInstance(0);
+    testStartLeader();
+}
+
+void FinalizeTest(void)
+{
+    testFreeSimInstance();
+}
+
+Ip6::Address GetEid(uint16_t aIndex)
+{
+    Ip6::Address eid;
+
+    SuccessOrQuit(eid.FromString("fd00:1234:5678:abcd::"), "Ip6::Address::FromString() failed");
+    eid.mFields.m16[7] = HostSwap16(aIndex + 1);
+
+    return eid;
+}
+
+// Spreads the entries over `kNumRouters` routers, with a distinct
+// child ID for each entry.
+uint8_t GetRouterId(uint16_t aIndex)
+{
+    return static_cast<uint8_t>((aIndex % kNumRouters) + 1);
+}
+
+Mac::ShortAddress GetRloc16(uint16_t aIndex)
+{
+    return static_cast<Mac::ShortAddress>((GetRouterId(aIndex) << Mle::kRouterIdOffset) | (aIndex + 1));
+}
+
+// Finds the cache entry of an EID by iterating over the cache table,
+// which (unlike `Resolve()`) does not move the entry between lists.
+bool FindEntry(const Ip6::Address &aEid, AddressResolver::EntryInfo &aInfo)
+{
+    AddressResolver::Iterator iterator;
+    bool                      found = false;
+
+    memset(&iterator, 0, sizeof(iterator));
+
+    while (sInstance->Get<AddressResolver>().GetNextCacheEntry(aInfo, iterator) == OT_ERROR_NONE)
+    {
+        if (static_cast<const Ip6::Address &>(aInfo.mTarget) == aEid)
+        {
+            found = true;
+            break;
+        }
+    }
+
+    return found;
+}
+
+uint16_t GetNumEntries(void)
+{
+    AddressResolver::Iterator  iterator;
+    AddressResolver::EntryInfo info;
+    uint16_t                   numEntries = 0;
+
+    memset(&iterator, 0, sizeof(iterator));
+
+    while (sInstance->Get<AddressResolver>().GetNextCacheEntry(info, iterator) == OT_ERROR_NONE)
+    {
+        numEntries++;
+    }
+
+    return numEntries;
+}
+
+void VerifyEntry(const Ip6::Address &aEid, Mac::ShortAddress aRloc16, otCacheEntryState aState)
+{
+    AddressResolver::EntryInfo info;
+
+    VerifyOrQuit(FindEntry(aEid, info), "cache entry is missing");
+    VerifyOrQuit(info.mRloc16 == aRloc16, "cache entry RLOC16 does not match");
+    VerifyOrQuit(info.mState == aState, "cache entry state does not match");
+}
+
+void VerifyNoEntry(const Ip6::Address &aEid)
+{
+    AddressResolver::EntryInfo info;
+    Mac::ShortAddress          rloc16;
+
+    VerifyOrQuit(!FindEntry(aEid, info), "removed cache entry is still in the table");
+    VerifyOrQuit(sInstance->Get<AddressResolver>().Resolve(aEid, rloc16, /* aAllowAddressQuery */ false) ==
+                     OT_ERROR_NOT_FOUND,
+                 "Resolve() found a removed cache entry");
+}
+
+// Adds a cache entry in cached state for each index in
+// [0, `aNumEntries`), the first index being the least recently used.
+void AddCachedEntries(uint16_t aNumEntries)
+{
+    AddressResolver &resolver = sInstance->Get<AddressResolver>();
+
+    for (uint16_t i = 0; i < aNumEntries; i++)
+    {
+        Mac::ShortAddress rloc16;
+
+        resolver.AddSnoopedCacheEntry(GetEid(i), GetRloc16(i));
+        SuccessOrQuit(resolver.Resolve(GetEid(i), rloc16, /* aAllowAddressQuery */ false), "Resolve() failed");
+        VerifyOrQuit(rloc16 == GetRloc16(i), "Resolve() returned a wrong RLOC16");
+    }
+}
+
+void TestInsertAndLookup(void)
+{
+    AddressResolver * resolver;
+    Mac::ShortAddress rloc16;
+
+    InitTest();
+    resolver = &sInstance->Get<AddressResolver>();
+
+    printf("TestInsertAndLookup\n");
+
+    VerifyOrQuit(GetNumEntries() == 0, "cache table is not empty after init");
+
+    for (uint16_t i = 0; i < kCacheEntries; i++)
+    {
+        resolver->AddSnoopedCacheEntry(GetEid(i), GetRloc16(i));
+        VerifyEntry(GetEid(i), GetRloc16(i), OT_CACHE_ENTRY_STATE_SNOOPED);
+    }
+
+    VerifyOrQuit(GetNumEntries() == kCacheEntries, "cache table has a wrong number of entries");
+
+    // Looking up an entry moves it to the cached list, with no change
+    // to the other entries.
+
+    for (uint16_t i = 0; i < kCacheEntries; i++)
+    {
+        SuccessOrQuit(resolver->Resolve(GetEid(i), rloc16, /* aAllowAddressQuery */ false), "Resolve() failed");
+        VerifyOrQuit(rloc16 == GetRloc16(i), "Resolve() returned a wrong RLOC16");
+        VerifyEntry(GetEid(i), GetRloc16(i), OT_CACHE_ENTRY_STATE_CACHED);
+    }
+
+    VerifyOrQuit(GetNumEntries() == kCacheEntries, "cache table has a wrong number of entries");
+    VerifyNoEntry(GetEid(kNewEntryIndexStart));
+    VerifyOrQuit(resolver->UpdateCacheEntry(GetEid(kNewEntryIndexStart), GetRloc16(0)) == OT_ERROR_NOT_FOUND,
+                 "UpdateCacheEntry() succeeded for a missing entry");
+
+    // Update the RLOC16 of an entry, then look it up again.
+
+    SuccessOrQuit(resolver->UpdateCacheEntry(GetEid(0), GetRloc16(1)), "UpdateCacheEntry() failed");
+    SuccessOrQuit(resolver->Resolve(GetEid(0), rloc16, /* aAllowAddressQuery */ false), "Resolve() failed");
+    VerifyOrQuit(rloc16 == GetRloc16(1), "Resolve() did not return the updated RLOC16");
+    SuccessOrQuit(resolver->UpdateCacheEntry(GetEid(0), GetRloc16(0)), "UpdateCacheEntry() failed");
+
+    // Remove entries by EID, by RLOC16 and by router ID, and verify
+    // only the matching entries are removed.
+
+    resolver->Remove(GetEid(0));
+    VerifyNoEntry(GetEid(0));
+
+    resolver->Remove(GetRloc16(1));
+    VerifyNoEntry(GetEid(1));
+
+    resolver->Remove(GetRouterId(2));
+
+    for (uint16_t i = 2; i < kCacheEntries; i++)
+    {
+        if (GetRouterId(i) == GetRouterId(2))
+        {
+            VerifyNoEntry(GetEid(i));
+        }
+        else
+        {
+            VerifyEntry(GetEid(i), GetRloc16(i), OT_CACHE_ENTRY_STATE_CACHED);
+        }
+    }
+
+    // Removed entries are back in the pool and can be reused.
+
+    for (uint16_t i = 0; i < kCacheEntries; i++)
+    {
+        resolver->AddSnoopedCacheEntry(GetEid(kNewEntryIndexStart + i), GetRloc16(i));
+        SuccessOrQuit(resolver->Resolve(GetEid(kNewEntryIndexStart + i), rloc16, /* aAllowAddressQuery */ false),
+                      "Resolve() failed");
+    }
+
+    VerifyOrQuit(GetNumEntries() == kCacheEntries, "cache table has a wrong number of entries");
+
+    resolver->Clear();
+    VerifyOrQuit(GetNumEntries() == 0, "cache table is not empty after Clear()");
+
+    FinalizeTest();
+}
+
+void TestEviction(void)
+{
+    AddressResolver * resolver;
+    Mac::ShortAddress rloc16;
+
+    InitTest();
+    resolver = &sInstance->Get<AddressResolver>();
+
+    printf("TestEviction\n");
+
+    // Fill the cache table with cached entries, entry 0 being the least
+    // recently used one, then use entry 0 again so entry 1 becomes the
+    // least recently used.
+
+    AddCachedEntries(kCacheEntries);
+    SuccessOrQuit(resolver->Resolve(GetEid(0), rloc16, /* aAllowAddressQuery */ false), "Resolve() failed");
+
+    // New snooped entries evict the least recently used cached entries,
+    // until the limit of non-evictable snooped entries is reached.
+
+    for (uint16_t i = 0; i < kMaxSnoopEntries; i++)
+    {
+        resolver->AddSnoopedCacheEntry(GetEid(kNewEntryIndexStart + i), GetRloc16(i));
+        VerifyEntry(GetEid(kNewEntryIndexStart + i), GetRloc16(i), OT_CACHE_ENTRY_STATE_SNOOPED);
+        VerifyNoEntry(GetEid(i + 1));
+    }
+
+    resolver->AddSnoopedCacheEntry(GetEid(kNewEntryIndexStart + kMaxSnoopEntries), GetRloc16(0));
+    VerifyNoEntry(GetEid(kNewEntryIndexStart + kMaxSnoopEntries));
+    VerifyEntry(GetEid(0), GetRloc16(0), OT_CACHE_ENTRY_STATE_CACHED);
+    VerifyEntry(GetEid(kMaxSnoopEntries + 1), GetRloc16(kMaxSnoopEntries + 1), OT_CACHE_ENTRY_STATE_CACHED);
+    VerifyOrQuit(GetNumEntries() == kCacheEntries, "cache table has a wrong number of entries");
+
+    // Once the snooped entries time out, the oldest one is evicted first.
+
+    testAdvanceTime((kSnoopTimeout + 1) * 1000);
+
+    resolver->AddSnoopedCacheEntry(GetEid(kNewEntryIndexStart + kMaxSnoopEntries), GetRloc16(0));
+    VerifyEntry(GetEid(kNewEntryIndexStart + kMaxSnoopEntries), GetRloc16(0), OT_CACHE_ENTRY_STATE_SNOOPED);
+    VerifyNoEntry(GetEid(kNewEntryIndexStart));
+
+    VerifyEntry(GetEid(kNewEntryIndexStart + 1), GetRloc16(1), OT_CACHE_ENTRY_STATE_SNOOPED);
+    VerifyEntry(GetEid(0), GetRloc16(0), OT_CACHE_ENTRY_STATE_CACHED);
+    VerifyOrQuit(GetNumEntries() == kCacheEntries, "cache table has a wrong number of entries");
+
+    FinalizeTest();
+}
+
+void TestQueryTimeout(void)
+{
+    AddressResolver *          resolver;
+    AddressResolver::EntryInfo info;
+    Ip6::Address               eid = GetEid(kNewEntryIndexStart);
+    Mac::ShortAddress          rloc16;
+
+    InitTest();
+    resolver = &sInstance->Get<AddressResolver>();
+
+    printf("TestQueryTimeout\n");
+
+    VerifyOrQuit(resolver->Resolve(eid, rloc16, /* aAllowAddressQuery */ false) == OT_ERROR_NOT_FOUND,
+                 "Resolve() did not fail without an address query");
+    VerifyOrQuit(resolver->Resolve(eid, rloc16) == OT_ERROR_ADDRESS_QUERY, "Resolve() did not start an address query");
+    testProcessTasklets();
+    VerifyEntry(eid, Mac::kShortAddrInvalid, OT_CACHE_ENTRY_STATE_QUERY);
+    VerifyOrQuit(resolver->Resolve(eid, rloc16) == OT_ERROR_ADDRESS_QUERY, "Resolve() failed with a pending query");
+
+    // A query entry cannot be evicted before it times out.
+
+    AddCachedEntries(kCacheEntries - 1);
+    resolver->AddSnoopedCacheEntry(GetEid(kNewEntryIndexStart + 1), GetRloc16(0));
+    VerifyEntry(eid, Mac::kShortAddrInvalid, OT_CACHE_ENTRY_STATE_QUERY);
+    VerifyNoEntry(GetEid(0));
+
+    // The query times out and the entry waits for the retry delay.
+
+    testAdvanceTime((kQueryTimeout + 1) * 1000);
+    VerifyOrQuit(FindEntry(eid, info), "query entry is missing");
+    VerifyOrQuit(info.mState == OT_CACHE_ENTRY_STATE_RETRY_QUERY, "query entry did not time out");
+    VerifyOrQuit(info.mCanEvict, "timed out query entry cannot be evicted");
+    VerifyOrQuit(resolver->Resolve(eid, rloc16) == OT_ERROR_DROP, "Resolve() did not drop during the retry delay");
+
+    // After the retry delay, a new query can be sent.
+
+    testAdvanceTime(kQueryRetryDelay * 1000);
+    VerifyOrQuit(resolver->Resolve(eid, rloc16) == OT_ERROR_ADDRESS_QUERY, "Resolve() did not restart the query");
+    testProcessTasklets();
+    VerifyEntry(eid, Mac::kShortAddrInvalid, OT_CACHE_ENTRY_STATE_QUERY);
+
+    // An address notification resolves the entry.
+
+    SuccessOrQuit(resolver->UpdateCacheEntry(eid, GetRloc16(0)), "UpdateCacheEntry() failed");
+    VerifyEntry(eid, GetRloc16(0), OT_CACHE_ENTRY_STATE_CACHED);
+    SuccessOrQuit(resolver->Resolve(eid, rloc16, /* aAllowAddressQuery */ false), "Resolve() failed");
+    VerifyOrQuit(rloc16 == GetRloc16(0), "Resolve() returned a wrong RLOC16");
+
+    FinalizeTest();
+}
+
+#endif // OPENTHREAD_FTD
+
+} // namespace ot
+
+int main(void)
+{
+#if OPENTHREAD_FTD
+    ot::TestInsertAndLookup();
+    ot::TestEviction();
+    ot::TestQueryTimeout();
+    printf("All tests passed\n");
+#else
+    printf("Address resolver is not used on MTD\n");
+#endif
+
+    return 0;
+}
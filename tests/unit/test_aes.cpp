@@ -26,9 +26,17 @@
  *  POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <limits.h>
+#include <stdlib.h>
+
+#include <mbedtls/ccm.h>
+
 #include <openthread/config.h>
 
+#include "common/code_utils.hpp"
 #include "common/debug.hpp"
+#include "common/instance.hpp"
+#include "common/message.hpp"
 #include "crypto/aes_ccm.hpp"
 
 #include "test_platform.h"
@@ -137,10 +145,140 @@ void TestMacCommandFrame()
     VerifyOrQuit(memcmp(test, decrypted, sizeof(decrypted)) == 0, "TestMacCommandFrame decrypt failed");
 }
 
+uint32_t GetRandom(uint32_t aMax)
+{
+    return static_cast<uint32_t>(rand()) % aMax;
+}
+
+/**
+ * Verifies the payload processing against mbedTLS CCM for random header/payload lengths, with the payload passed at
+ * once, split at random points, and in place within a message.
+ */
+void TestAesCcmPayloadSplit(void)
+{
+    enum : uint16_t
+    {
+        kMaxHeaderLength  = 64,
+        kMaxPayloadLength = 600,
+        kMessageOffset    = 5,
+        kIterations       = 500,
+    };
+
+    static const uint8_t kKey[] = {
+        0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf,
+    };
+
+    ot::Instance *      instance = static_cast<ot::Instance *>(testInitInstance());
+    ot::Message *       message;
+    mbedtls_ccm_context ccm;
+    uint8_t             nonce[ot::Crypto::AesCcm::kNonceSize];
+    uint8_t             header[kMaxHeaderLength];
+    uint8_t             plain[kMaxPayloadLength];
+    uint8_t             expected[kMaxPayloadLength];
+    uint8_t             expectedTag[ot::Crypto::AesCcm::kMaxTagLength];
+    uint8_t             buffer[kMaxPayloadLength];
+    uint8_t             tag[ot::Crypto::AesCcm::kMaxTagLength];
+
+    VerifyOrQuit(instance != nullptr, "Null OpenThread instance");
+
+    message = instance->Get<ot::MessagePool>().New(ot::Message::kTypeIp6, 0);
+    VerifyOrQuit(message != nullptr, "Message::New failed");
+
+    mbedtls_ccm_init(&ccm);
+    VerifyOrQuit(mbedtls_ccm_setkey(&ccm, MBEDTLS_CIPHER_ID_AES, kKey, CHAR_BIT * sizeof(kKey)) == 0,
+                 "mbedtls_ccm_setkey() failed");
+
+    for (uint16_t iter = 0; iter < kIterations; iter++)
+    {
+        ot::Crypto::AesCcm aesCcm;
+        uint16_t           headerLength  = static_cast<uint16_t>(GetRandom(kMaxHeaderLength + 1));
+        uint16_t           payloadLength = static_cast<uint16_t>(GetRandom(kMaxPayloadLength + 1));
+        uint8_t            tagLength     = static_cast<uint8_t>(4 + 2 * GetRandom(7));
+        uint16_t           headerSplit   = static_cast<uint16_t>(GetRandom(headerLength + 1));
+        uint16_t           offset;
+
+        for (uint8_t &byte : nonce)
+        {
+            byte = static_cast<uint8_t>(GetRandom(256));
+        }
+
+        for (uint16_t i = 0; i < headerLength; i++)
+        {
+            header[i] = static_cast<uint8_t>(GetRandom(256));
+        }
+
+        for (uint16_t i = 0; i < payloadLength; i++)
+        {
+            plain[i] = static_cast<uint8_t>(GetRandom(256));
+        }
+
+        VerifyOrQuit(mbedtls_ccm_encrypt_and_tag(&ccm, payloadLength, nonce, sizeof(nonce), header, headerLength, plain,
+                                                 expected, expectedTag, tagLength) == 0,
+                     "mbedtls_ccm_encrypt_and_tag() failed");
+
+        // Whole payload at once, in place
+
+        memcpy(buffer, plain, payloadLength);
+        aesCcm.SetKey(kKey, sizeof(kKey));
+        aesCcm.Init(headerLength, payloadLength, tagLength, nonce, sizeof(nonce));
+        aesCcm.Header(header, headerSplit);
+        aesCcm.Header(header + headerSplit, headerLength - headerSplit);
+        aesCcm.Payload(buffer, buffer, payloadLength, ot::Crypto::AesCcm::kEncrypt);
+        aesCcm.Finalize(tag);
+
+        VerifyOrQuit(memcmp(buffer, expected, payloadLength) == 0, "AesCcm::Payload() encrypt failed");
+        VerifyOrQuit(memcmp(tag, expectedTag, tagLength) == 0, "AesCcm::Finalize() encrypt failed");
+
+        // Payload split at random points, decrypting into a separate buffer
+
+        aesCcm.Init(headerLength, payloadLength, tagLength, nonce, sizeof(nonce));
+        aesCcm.Header(header, headerLength);
+
+        for (offset = 0; offset < payloadLength;)
+        {
+            uint16_t length = static_cast<uint16_t>(1 + GetRandom(OT_MIN(payloadLength - offset, 40)));
+
+            aesCcm.Payload(buffer + offset, expected + offset, length, ot::Crypto::AesCcm::kDecrypt);
+            offset += length;
+        }
+
+        aesCcm.Finalize(tag);
+
+        VerifyOrQuit(memcmp(buffer, plain, payloadLength) == 0, "AesCcm::Payload() decrypt failed");
+        VerifyOrQuit(memcmp(tag, expectedTag, tagLength) == 0, "AesCcm::Finalize() decrypt failed");
+
+        // Payload in place within a message spanning several buffers
+
+        SuccessOrQuit(message->SetLength(kMessageOffset + payloadLength), "Message::SetLength() failed");
+        message->WriteBytes(kMessageOffset, plain, payloadLength);
+
+        aesCcm.Init(headerLength, payloadLength, tagLength, nonce, sizeof(nonce));
+        aesCcm.Header(header, headerLength);
+        aesCcm.Payload(*message, kMessageOffset, payloadLength, ot::Crypto::AesCcm::kEncrypt);
+        aesCcm.Finalize(tag);
+
+        VerifyOrQuit(message->CompareBytes(kMessageOffset, expected, payloadLength), "Message payload encrypt failed");
+        VerifyOrQuit(memcmp(tag, expectedTag, tagLength) == 0, "AesCcm::Finalize() message encrypt failed");
+
+        aesCcm.Init(headerLength, payloadLength, tagLength, nonce, sizeof(nonce));
+        aesCcm.Header(header, headerLength);
+        aesCcm.Payload(*message, kMessageOffset, payloadLength, ot::Crypto::AesCcm::kDecrypt);
+        aesCcm.Finalize(tag);
+
+        VerifyOrQuit(message->CompareBytes(kMessageOffset, plain, payloadLength), "Message payload decrypt failed");
+        VerifyOrQuit(memcmp(tag, expectedTag, tagLength) == 0, "AesCcm::Finalize() message decrypt failed");
+    }
+
+    mbedtls_ccm_free(&ccm);
+    message->Free();
+    testFreeInstance(instance);
+}
+
 int main(void)
 {
     TestMacBeaconFrame();
     TestMacCommandFrame();
+    TestAesCcmPayloadSplit();
     printf("All tests passed\n");
     return 0;
 }
@@ -78,7 +78,7 @@ uint16_t CalculateChecksum(const Ip6::Address &aSource,
 
     enum : uint16_t
     {
-        kMaxPayload = 1024,
+        kMaxPayload = kBufferSize * 3 + 24,
     };
 
     OT_TOOL_PACKED_BEGIN
@@ -296,6 +296,46 @@ public:
         VerifyOrQuit(checksum.GetValue() == CalculateChecksum(kTestVector, sizeof(kTestVector)),
                      "Checksum::AddData() failed");
     }
+
+    static void TestSplitData(void)
+    {
+        // Verify that feeding the data in pieces of random length (and
+        // so at random odd/even alignment) matches the reference.
+
+        enum : uint16_t
+        {
+            kMaxLength  = 1500,
+            kIterations = 500,
+        };
+
+        uint8_t buffer[kMaxLength + 1];
+
+        for (uint16_t iter = 0; iter < kIterations; iter++)
+        {
+            uint16_t length = Random::NonCrypto::GetUint16InRange(0, kMaxLength);
+            uint8_t  start  = Random::NonCrypto::GetUint8InRange(0, 2);
+            uint16_t offset = 0;
+            Checksum checksum;
+
+            Random::NonCrypto::FillBuffer(buffer, sizeof(buffer));
+
+            while (offset < length)
+            {
+                uint16_t chunk = Random::NonCrypto::GetUint16InRange(1, 80);
+
+                if (chunk > length - offset)
+                {
+                    chunk = length - offset;
+                }
+
+                checksum.AddData(&buffer[start + offset], chunk);
+                offset += chunk;
+            }
+
+            VerifyOrQuit(checksum.GetValue() == CalculateChecksum(&buffer[start], length),
+                         "Checksum::AddData() failed on split data");
+        }
+    }
 };
 
 } // namespace ot
@@ -305,6 +345,7 @@ int main(void)
     ot::ChecksumTester::TestExampleVector();
     ot::TestUdpMessageChecksum();
     ot::TestIcmp6MessageChecksum();
+    ot::ChecksumTester::TestSplitData();
     printf("All tests passed\n");
     return 0;
 }
@@ -0,0 +1,292 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <string.h>
+
+#include <openthread/config.h>
+#include <openthread/child_supervision.h>
+#include <openthread/thread.h>
+#include <openthread/thread_ftd.h>
+
+#include "common/code_utils.hpp"
+#include "common/instance.hpp"
+#include "common/timer.hpp"
+#include "thread/child_table.hpp"
+#include "thread/mle_router.hpp"
+#include "thread/network_data_leader.hpp"
+#include "utils/child_supervision.hpp"
+
+#include "test_platform.h"
+#include "test_util.hpp"
+
+namespace ot {
+
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MLE_CHILD_TIMEOUT_INDEX_ENABLE
+
+enum : uint32_t
+{
+    kMaxChildren    = OPENTHREAD_CONFIG_MLE_MAX_CHILDREN,
+    kStartTime      = 0xfffff000, // Close to wrap around of the millisecond time.
+    kTestDuration   = 3600 * 1000,
+    kPollInterval   = 20 * 1000,
+    kPollingTimeout = 30,
+};
+
+static Instance *sInstance;
+static uint32_t  sNumAlarmFires;
+static uint32_t  sNumChildTimerFires;
+
+// Moves the time forward by `aDuration`, firing the alarm at each
+// time it is scheduled in between.
+void HandleAlarmFired(void)
+{
+    TimeMilli time;
+
+    if ((sInstance->Get<ChildTable>().GetNextTimeout(time) != nullptr) && (time <= TimeMilli(testGetNow())))
+    {
+        sNumChildTimerFires++;
+    }
+
+    sNumAlarmFires++;
+}
+
+void InitTest(void)
+{
+    sInstance = testInitSimInstance(kStartTime);
+    testStartLeader();
+
+    sNumAlarmFires          = 0;
+    sNumChildTimerFires     = 0;
+    g_testAlarmFiredHandler = HandleAlarmFired;
+}
+
+void FinalizeTest(void)
+{
+    testFreeSimInstance();
+}
+
+Child &AddChild(uint16_t aIndex, uint32_t aTimeout)
+{
+    Child *         child = sInstance->Get<ChildTable>().GetNewChild();
+    Mac::ExtAddress extAddress;
+
+    VerifyOrQuit(child != nullptr, "GetNewChild() failed");
+
+    memset(&extAddress, 0, sizeof(extAddress));
+    extAddress.m8[0] = 0x12;
+    extAddress.m8[7] = static_cast<uint8_t>(aIndex);
+
+    child->SetState(Neighbor::kStateValid);
+    child->SetExtAddress(extAddress);
+    child->SetRloc16(sInstance->Get<Mle::MleRouter>().GetRloc16() | (aIndex + 1));
+    child->SetDeviceMode(Mle::DeviceMode(0));
+    child->SetTimeout(aTimeout);
+    child->SetNetworkDataVersion(sInstance->Get<NetworkData::Leader>().GetStableVersion());
+    child->SetLastHeard(TimerMilli::GetNow());
+#if OPENTHREAD_CONFIG_CHILD_SUPERVISION_ENABLE
+    child->ResetSecondsSinceLastSupervision();
+#endif
+
+    sInstance->Get<Mle::MleRouter>().ScheduleChildTimeout(*child);
+
+    return *child;
+}
+
+void TestTimeoutIndex(void)
+{
+    static const uint32_t kTimes[] = {3000, 0, 7000, 9000, 1000, 5000, 8000, 2000, 6000, 4000};
+
+    ChildTable *table;
+    Child *     children[kMaxChildren];
+    uint16_t    numChildren = OT_MIN(static_cast<uint16_t>(kMaxChildren), OT_ARRAY_LENGTH(kTimes));
+    TimeMilli   time;
+    TimeMilli   lastTime;
+    Child *     child;
+
+    printf("\nTestTimeoutIndex");
+
+    InitTest();
+
+    table = &sInstance->Get<ChildTable>();
+
+    for (uint16_t i = 0; i < numChildren; i++)
+    {
+        children[i] = table->GetNewChild();
+        VerifyOrQuit(children[i] != nullptr, "GetNewChild() failed");
+        children[i]->SetState(Neighbor::kStateValid);
+
+        // The keys straddle the wrap around of the time value.
+        table->UpdateTimeoutIndex(*children[i], TimeMilli(kStartTime) + kTimes[i]);
+    }
+
+    // Move the last child first and the first child last, and
+    // remove the one in the middle.
+
+    table->UpdateTimeoutIndex(*children[numChildren - 1], TimeMilli(kStartTime) - 1);
+    table->UpdateTimeoutIndex(*children[0], TimeMilli(kStartTime) + 10000);
+    table->RemoveFromTimeoutIndex(*children[numChildren / 2]);
+
+    child = table->GetNextTimeout(time);
+    VerifyOrQuit(child == children[numChildren - 1], "GetNextTimeout() did not return the earliest child");
+    VerifyOrQuit(time == TimeMilli(kStartTime) - 1, "GetNextTimeout() returned incorrect time");
+
+    lastTime = time;
+
+    for (uint16_t i = 0; i < numChildren - 1; i++)
+    {
+        child = table->GetNextTimeout(time);
+        VerifyOrQuit(child != nullptr, "GetNextTimeout() failed");
+        VerifyOrQuit(child != children[numChildren / 2], "removed child is still in the index");
+        VerifyOrQuit(lastTime <= time, "children are not ordered by their timeout");
+
+        lastTime = time;
+        table->RemoveFromTimeoutIndex(*child);
+    }
+
+    VerifyOrQuit(lastTime == TimeMilli(kStartTime) + 10000, "the last child is incorrect");
+    VerifyOrQuit(table->GetNextTimeout(time) == nullptr, "index is not empty");
+
+    FinalizeTest();
+
+    printf(" -> PASSED\n");
+}
+
+void TestChildTimeout(void)
+{
+    Child *  children[kMaxChildren];
+    uint32_t startTime;
+    uint32_t lastPollTime;
+    uint32_t numChildren = kMaxChildren;
+
+    printf("\nTestChildTimeout");
+
+    InitTest();
+
+#if OPENTHREAD_CONFIG_CHILD_SUPERVISION_ENABLE
+    otChildSupervisionSetInterval(sInstance, 0);
+#endif
+
+    // The first child keeps polling, the others time out one after
+    // the other, one minute apart.
+
+    for (uint16_t i = 0; i < numChildren; i++)
+    {
+        children[i] = &AddChild(i, (i == 0) ? kPollingTimeout : 60 * i);
+    }
+
+    startTime    = testGetNow();
+    lastPollTime = testGetNow();
+
+    while (testGetNow() - startTime < kTestDuration)
+    {
+        testAdvanceTime(1000);
+
+        if (testGetNow() - lastPollTime >= kPollInterval)
+        {
+            // A data poll only updates the last heard time.
+            children[0]->SetLastHeard(TimerMilli::GetNow());
+            lastPollTime = testGetNow();
+        }
+
+        for (uint16_t i = 1; i < numChildren; i++)
+        {
+            uint32_t elapsed = testGetNow() - startTime;
+            uint32_t timeout = Time::SecToMsec(60 * i);
+
+            if (elapsed < timeout)
+            {
+                VerifyOrQuit(children[i]->IsStateValid(), "child timed out too early");
+            }
+            else if (elapsed >= timeout + 1000)
+            {
+                VerifyOrQuit(children[i]->IsStateInvalid(), "child did not time out");
+            }
+        }
+    }
+
+    VerifyOrQuit(children[0]->IsStateValid(), "polling child timed out");
+    VerifyOrQuit(sInstance->Get<ChildTable>().GetNumChildren(Child::kInStateValid) == 1, "timed out children remain");
+
+    printf(" -> %u children, %u child timer fires (of %u alarm fires) in one hour vs %u tick child visits",
+           numChildren, sNumChildTimerFires, sNumAlarmFires, kTestDuration / 1000 * numChildren);
+
+    VerifyOrQuit(sNumChildTimerFires < kTestDuration / 1000, "child timer fired more often than the time tick");
+
+    FinalizeTest();
+
+    printf(" -> PASSED\n");
+}
+
+#if OPENTHREAD_CONFIG_CHILD_SUPERVISION_ENABLE
+void TestChildSupervision(void)
+{
+    enum : uint16_t
+    {
+        kSupervisionInterval = 10,
+    };
+
+    Child *child;
+
+    printf("\nTestChildSupervision");
+
+    InitTest();
+
+    otChildSupervisionSetInterval(sInstance, kSupervisionInterval);
+
+    child = &AddChild(0, 240);
+
+    testAdvanceTime(Time::SecToMsec(kSupervisionInterval) - 1);
+    VerifyOrQuit(child->GetIndirectMessageCount() == 0, "supervision message sent too early");
+
+    testAdvanceTime(1);
+    VerifyOrQuit(child->GetIndirectMessageCount() == 1, "supervision message was not sent");
+
+    FinalizeTest();
+
+    printf(" -> PASSED\n");
+}
+#endif // OPENTHREAD_CONFIG_CHILD_SUPERVISION_ENABLE
+
+#endif // OPENTHREAD_FTD && OPENTHREAD_CONFIG_MLE_CHILD_TIMEOUT_INDEX_ENABLE
+
+} // namespace ot
+
+int main(void)
+{
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MLE_CHILD_TIMEOUT_INDEX_ENABLE
+    ot::TestTimeoutIndex();
+    ot::TestChildTimeout();
+#if OPENTHREAD_CONFIG_CHILD_SUPERVISION_ENABLE
+    ot::TestChildSupervision();
+#endif
+    printf("\nAll tests passed\n");
+#else
+    printf("Child timeout index is not enabled\n");
+#endif
+    return 0;
+}
@@ -0,0 +1,571 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include <openthread/config.h>
+#include <openthread/platform/alarm-milli.h>
+
+#include "common/debug.hpp"
+#include "common/instance.hpp"
+#include "net/dns_client.hpp"
+
+#include "test_platform.h"
+#include "test_util.h"
+
+#if OPENTHREAD_CONFIG_DNS_CLIENT_ENABLE && OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+
+static uint32_t sNow;
+
+static uint32_t testDnsClientAlarmGetNow(void)
+{
+    return sNow;
+}
+
+namespace ot {
+namespace Dns {
+
+class ClientTester
+{
+public:
+    static uint16_t GetNumQueries(Client &aClient)
+    {
+        uint16_t numQueries;
+        uint16_t numBuffers;
+
+        aClient.mQueries.GetInfo(numQueries, numBuffers);
+
+        return numQueries;
+    }
+
+    static uint16_t GetNumCacheEntries(Client &aClient)
+    {
+        uint16_t numEntries;
+        uint16_t numBuffers;
+
+        aClient.mCache.GetInfo(numEntries, numBuffers);
+
+        return numEntries;
+    }
+
+    // Returns the message ID of the most recently started query.
+    static uint16_t GetLastMessageId(Client &aClient)
+    {
+        Client::QueryInfo info;
+        Message *         query = aClient.mQueries.GetHead();
+
+        VerifyOrQuit(query != nullptr, "no pending query");
+
+        while (query->GetNext() != nullptr)
+        {
+            query = query->GetNext();
+        }
+
+        info.ReadFrom(*query);
+
+        return info.mMessageId;
+    }
+
+    // Delivers an AAAA response for `aHostName` to the client, as if it was received from the server. An empty
+    // response with `aResponseCode` is delivered when `aAddress` is `nullptr`.
+    static void SendAddressResponse(Instance &          aInstance,
+                                    uint16_t            aMessageId,
+                                    const char *        aHostName,
+                                    const Ip6::Address *aAddress,
+                                    uint32_t            aTtl,
+                                    Header::Response    aResponseCode = Header::kResponseSuccess)
+    {
+        Message *  message = aInstance.Get<MessagePool>().New(Message::kTypeOther, 0);
+        Header     header;
+        AaaaRecord record;
+
+        VerifyOrQuit(message != nullptr, "Message::New failed");
+
+        header.Clear();
+        header.SetMessageId(aMessageId);
+        header.SetType(Header::kTypeResponse);
+        header.SetResponseCode(aResponseCode);
+        header.SetQuestionCount(1);
+        header.SetAnswerCount((aAddress != nullptr) ? 1 : 0);
+
+        SuccessOrQuit(message->Append(header), "Append failed");
+        SuccessOrQuit(Name::AppendName(aHostName, *message), "AppendName failed");
+        SuccessOrQuit(message->Append(Question(ResourceRecord::kTypeAaaa)), "Append failed");
+
+        if (aAddress != nullptr)
+        {
+            record.Init();
+            record.SetTtl(aTtl);
+            record.SetAddress(*aAddress);
+
+            SuccessOrQuit(Name::AppendName(aHostName, *message), "AppendName failed");
+            SuccessOrQuit(message->Append(record), "Append failed");
+        }
+
+        aInstance.Get<Client>().ProcessResponse(*message);
+        message->Free();
+    }
+};
+
+} // namespace Dns
+
+static const char kHostName[] = "host.example.com";
+
+static uint16_t     sNumCallbacks;
+static otError      sLastError;
+static Ip6::Address sLastAddress;
+static uint32_t     sLastTtl;
+
+static void HandleAddressResponse(otError aError, const otDnsAddressResponse *aResponse, void *aContext)
+{
+    const Dns::Client::AddressResponse &response = *static_cast<const Dns::Client::AddressResponse *>(aResponse);
+
+    OT_UNUSED_VARIABLE(aContext);
+
+    sNumCallbacks++;
+    sLastError = aError;
+    sLastTtl   = 0;
+    sLastAddress.Clear();
+
+    if (aError == OT_ERROR_NONE)
+    {
+        SuccessOrQuit(response.GetAddress(0, sLastAddress, sLastTtl), "GetAddress failed");
+    }
+}
+
+static MessageQueue sAllocatedMessages;
+
+// Allocates messages until the message pool runs out of buffers.
+static void AllocateAllBuffers(Instance &aInstance)
+{
+    Message *message;
+
+    while ((message = aInstance.Get<MessagePool>().New(Message::kTypeOther, 0)) != nullptr)
+    {
+        sAllocatedMessages.Enqueue(*message);
+    }
+}
+
+static void FreeAllocatedMessages(void)
+{
+    Message *message;
+
+    while ((message = sAllocatedMessages.GetHead()) != nullptr)
+    {
+        sAllocatedMessages.Dequeue(*message);
+        message->Free();
+    }
+}
+
+static void HandleAddressResponseAllocatingAllBuffers(otError                     aError,
+                                                      const otDnsAddressResponse *aResponse,
+                                                      void *                      aContext)
+{
+    AllocateAllBuffers(*static_cast<Instance *>(aContext));
+    HandleAddressResponse(aError, aResponse, aContext);
+}
+
+static void HandleAddressResponseStoppingClient(otError aError, const otDnsAddressResponse *aResponse, void *aContext)
+{
+    HandleAddressResponse(aError, aResponse, aContext);
+    static_cast<Instance *>(aContext)->Get<Dns::Client>().Stop();
+}
+
+static void AdvanceTimeTo(Instance &aInstance, uint32_t aTime)
+{
+    sNow = aTime;
+    otPlatAlarmMilliFired(&aInstance);
+}
+
+void TestDnsClientCache(void)
+{
+    enum : uint32_t
+    {
+        kTimeT0 = 1000,
+        kTtl    = 100, // in sec
+    };
+
+    Instance *                        instance;
+    Dns::Client *                     client;
+    Ip6::Address                      address;
+    const Dns::Client::CacheCounters *counters;
+    uint16_t                          messageId;
+
+    sNow                  = kTimeT0;
+    g_testPlatAlarmGetNow = testDnsClientAlarmGetNow;
+
+    instance = testInitInstance();
+    VerifyOrQuit(instance != nullptr, "Null OpenThread instance");
+
+    client   = &instance->Get<Dns::Client>();
+    counters = &client->GetCacheCounters();
+    SuccessOrQuit(client->Start(), "Client::Start failed");
+    SuccessOrQuit(address.FromString("fd00::1234"), "FromString failed");
+
+    // A first query is sent to the server, an identical one waits
+    // for the response to it.
+
+    SuccessOrQuit(client->ResolveAddress(kHostName, HandleAddressResponse, nullptr), "ResolveAddress failed");
+    messageId = Dns::ClientTester::GetLastMessageId(*client);
+    SuccessOrQuit(client->ResolveAddress(kHostName, HandleAddressResponse, nullptr), "ResolveAddress failed");
+
+    VerifyOrQuit(counters->mMisses == 1, "miss is not counted");
+    VerifyOrQuit(counters->mCoalesced == 1, "coalesced query is not counted");
+    VerifyOrQuit(Dns::ClientTester::GetNumQueries(*client) == 2, "queries are not pending");
+
+    sNumCallbacks = 0;
+    Dns::ClientTester::SendAddressResponse(*instance, messageId, kHostName, &address, kTtl);
+
+    VerifyOrQuit(sNumCallbacks == 2, "response did not finalize both queries");
+    VerifyOrQuit(sLastError == OT_ERROR_NONE && sLastAddress == address && sLastTtl == kTtl, "response is wrong");
+    VerifyOrQuit(Dns::ClientTester::GetNumQueries(*client) == 0, "queries are still pending");
+    VerifyOrQuit(Dns::ClientTester::GetNumCacheEntries(*client) == 1, "response is not cached");
+
+    // A later query is answered from the cache, with the TTL aged by
+    // the time spent in the cache. The callback is invoked from the
+    // timer.
+
+    AdvanceTimeTo(*instance, kTimeT0 + 30 * 1000);
+
+    sNumCallbacks = 0;
+    SuccessOrQuit(client->ResolveAddress(kHostName, HandleAddressResponse, nullptr), "ResolveAddress failed");
+    VerifyOrQuit(sNumCallbacks == 0, "callback invoked from ResolveAddress");
+    VerifyOrQuit(counters->mHits == 1, "hit is not counted");
+
+    AdvanceTimeTo(*instance, sNow);
+    VerifyOrQuit(sNumCallbacks == 1, "cached response is not reported");
+    VerifyOrQuit(sLastError == OT_ERROR_NONE && sLastAddress == address, "cached response is wrong");
+    VerifyOrQuit(sLastTtl == kTtl - 30, "cached response TTL is not aged");
+
+    // Once the TTL expires the query is sent to the server again.
+
+    AdvanceTimeTo(*instance, kTimeT0 + kTtl * 1000);
+
+    SuccessOrQuit(client->ResolveAddress(kHostName, HandleAddressResponse, nullptr), "ResolveAddress failed");
+    VerifyOrQuit(counters->mMisses == 2, "expired response is used");
+    VerifyOrQuit(Dns::ClientTester::GetNumCacheEntries(*client) == 0, "expired response is not removed");
+
+    client->Stop();
+    testFreeInstance(instance);
+}
+
+void TestDnsClientCoalescing(void)
+{
+    enum : uint32_t
+    {
+        kTimeT0 = 1000,
+    };
+
+    Instance *                        instance;
+    Dns::Client *                     client;
+    Dns::Client::QueryConfig          config;
+    Ip6::Address                      address;
+    const Dns::Client::CacheCounters *counters;
+    uint16_t                          messageId;
+
+    sNow                  = kTimeT0;
+    g_testPlatAlarmGetNow = testDnsClientAlarmGetNow;
+
+    instance = testInitInstance();
+    VerifyOrQuit(instance != nullptr, "Null OpenThread instance");
+
+    client   = &instance->Get<Dns::Client>();
+    counters = &client->GetCacheCounters();
+    SuccessOrQuit(client->Start(), "Client::Start failed");
+    SuccessOrQuit(address.FromString("fd00::1234"), "FromString failed");
+
+    SuccessOrQuit(client->ResolveAddress(kHostName, HandleAddressResponse, nullptr), "ResolveAddress failed");
+    messageId = Dns::ClientTester::GetLastMessageId(*client);
+
+    // Queries which differ from the pending one in response timeout,
+    // max attempts or recursion flag are sent to the server.
+
+    config.Clear();
+    config.mResponseTimeout = client->GetDefaultConfig().GetResponseTimeout() + 1000;
+    SuccessOrQuit(client->ResolveAddress(kHostName, HandleAddressResponse, nullptr, &config), "ResolveAddress failed");
+
+    config.Clear();
+    config.mMaxTxAttempts = client->GetDefaultConfig().GetMaxTxAttempts() + 1;
+    SuccessOrQuit(client->ResolveAddress(kHostName, HandleAddressResponse, nullptr, &config), "ResolveAddress failed");
+
+    config.Clear();
+    config.mRecursionFlag =
+        (client->GetDefaultConfig().GetRecursionFlag() == Dns::Client::QueryConfig::kFlagRecursionDesired)
+            ? OT_DNS_FLAG_NO_RECURSION
+            : OT_DNS_FLAG_RECURSION_DESIRED;
+    SuccessOrQuit(client->ResolveAddress(kHostName, HandleAddressResponse, nullptr, &config), "ResolveAddress failed");
+
+    VerifyOrQuit(counters->mMisses == 4, "query with a different config is not sent");
+    VerifyOrQuit(counters->mCoalesced == 0, "query with a different config is coalesced");
+
+    sNumCallbacks = 0;
+    Dns::ClientTester::SendAddressResponse(*instance, messageId, kHostName, &address, 0);
+
+    VerifyOrQuit(sNumCallbacks == 1, "response finalized a query with a different config");
+    VerifyOrQuit(Dns::ClientTester::GetNumQueries(*client) == 3, "queries with a different config are not pending");
+
+    client->Stop();
+    testFreeInstance(instance);
+}
+
+void TestDnsClientNegativeCache(void)
+{
+    enum : uint32_t
+    {
+        kTimeT0 = 1000,
+    };
+
+    Instance *                        instance;
+    Dns::Client *                     client;
+    const Dns::Client::CacheCounters *counters;
+
+    sNow                  = kTimeT0;
+    g_testPlatAlarmGetNow = testDnsClientAlarmGetNow;
+
+    instance = testInitInstance();
+    VerifyOrQuit(instance != nullptr, "Null OpenThread instance");
+
+    client   = &instance->Get<Dns::Client>();
+    counters = &client->GetCacheCounters();
+    SuccessOrQuit(client->Start(), "Client::Start failed");
+
+    SuccessOrQuit(client->ResolveAddress(kHostName, HandleAddressResponse, nullptr), "ResolveAddress failed");
+
+    sNumCallbacks = 0;
+    Dns::ClientTester::SendAddressResponse(*instance, Dns::ClientTester::GetLastMessageId(*client), kHostName,
+                                           nullptr, 0, Dns::Header::kResponseNameError);
+    VerifyOrQuit(sNumCallbacks == 1 && sLastError == OT_ERROR_NOT_FOUND, "name error is not reported");
+
+    // The name error is reported from the cache until the negative
+    // TTL expires.
+
+    SuccessOrQuit(client->ResolveAddress(kHostName, HandleAddressResponse, nullptr), "ResolveAddress failed");
+    AdvanceTimeTo(*instance, sNow);
+    VerifyOrQuit(counters->mHits == 1, "negative response is not cached");
+    VerifyOrQuit(sNumCallbacks == 2 && sLastError == OT_ERROR_NOT_FOUND, "cached name error is not reported");
+
+    AdvanceTimeTo(*instance, kTimeT0 + OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_NEGATIVE_TTL * 1000);
+
+    SuccessOrQuit(client->ResolveAddress(kHostName, HandleAddressResponse, nullptr), "ResolveAddress failed");
+    VerifyOrQuit(counters->mHits == 1 && counters->mMisses == 2, "expired negative response is used");
+
+    client->Stop();
+    testFreeInstance(instance);
+}
+
+void TestDnsClientCacheEviction(void)
+{
+    enum : uint32_t
+    {
+        kTimeT0 = 1000,
+    };
+
+    Instance *                        instance;
+    Dns::Client *                     client;
+    const Dns::Client::CacheCounters *counters;
+    Ip6::Address                      address;
+    char                              name[Dns::Name::kMaxNameSize];
+
+    sNow                  = kTimeT0;
+    g_testPlatAlarmGetNow = testDnsClientAlarmGetNow;
+
+    instance = testInitInstance();
+    VerifyOrQuit(instance != nullptr, "Null OpenThread instance");
+
+    client   = &instance->Get<Dns::Client>();
+    counters = &client->GetCacheCounters();
+    SuccessOrQuit(client->Start(), "Client::Start failed");
+    SuccessOrQuit(address.FromString("fd00::1234"), "FromString failed");
+
+    // Fill the cache past its maximum number of entries, the least
+    // recently used ones are evicted.
+
+    for (uint16_t i = 0; i <= OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_MAX_ENTRIES; i++)
+    {
+        snprintf(name, sizeof(name), "host%u.example.com", i);
+
+        SuccessOrQuit(client->ResolveAddress(name, HandleAddressResponse, nullptr), "ResolveAddress failed");
+        Dns::ClientTester::SendAddressResponse(*instance, Dns::ClientTester::GetLastMessageId(*client), name,
+                                               &address, 3600);
+    }
+
+    VerifyOrQuit(counters->mEvictions == 1, "eviction is not counted");
+    VerifyOrQuit(Dns::ClientTester::GetNumCacheEntries(*client) == OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_MAX_ENTRIES,
+                 "cache is larger than its maximum number of entries");
+
+    SuccessOrQuit(client->ResolveAddress("host0.example.com", HandleAddressResponse, nullptr),
+                  "ResolveAddress failed");
+    VerifyOrQuit(counters->mHits == 0, "evicted response is used");
+
+    snprintf(name, sizeof(name), "host%u.example.com", OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_MAX_ENTRIES);
+    SuccessOrQuit(client->ResolveAddress(name, HandleAddressResponse, nullptr), "ResolveAddress failed");
+    VerifyOrQuit(counters->mHits == 1, "latest response is not cached");
+
+    client->ClearCache();
+    VerifyOrQuit(Dns::ClientTester::GetNumCacheEntries(*client) == 0, "ClearCache failed");
+
+    client->Stop();
+    testFreeInstance(instance);
+}
+
+void TestDnsClientCacheReclaim(void)
+{
+    enum : uint32_t
+    {
+        kTimeT0 = 1000,
+    };
+
+    Instance *                        instance;
+    Dns::Client *                     client;
+    const Dns::Client::CacheCounters *counters;
+    Ip6::Address                      address;
+    char                              name[Dns::Name::kMaxNameSize];
+
+    sNow                  = kTimeT0;
+    g_testPlatAlarmGetNow = testDnsClientAlarmGetNow;
+
+    instance = testInitInstance();
+    VerifyOrQuit(instance != nullptr, "Null OpenThread instance");
+
+    client   = &instance->Get<Dns::Client>();
+    counters = &client->GetCacheCounters();
+    SuccessOrQuit(client->Start(), "Client::Start failed");
+    SuccessOrQuit(address.FromString("fd00::1234"), "FromString failed");
+
+    // The cached responses give up their buffers when the message
+    // pool runs out of them.
+
+    for (uint16_t i = 0; i < 2; i++)
+    {
+        snprintf(name, sizeof(name), "host%u.example.com", i);
+
+        SuccessOrQuit(client->ResolveAddress(name, HandleAddressResponse, nullptr), "ResolveAddress failed");
+        Dns::ClientTester::SendAddressResponse(*instance, Dns::ClientTester::GetLastMessageId(*client), name,
+                                               &address, 3600);
+    }
+
+    VerifyOrQuit(Dns::ClientTester::GetNumCacheEntries(*client) == 2, "responses are not cached");
+
+    AllocateAllBuffers(*instance);
+
+    VerifyOrQuit(Dns::ClientTester::GetNumCacheEntries(*client) == 0, "cached responses are not evicted");
+    VerifyOrQuit(counters->mEvictions == 2, "evictions are not counted");
+
+    FreeAllocatedMessages();
+
+    // A cached response which is being reported to the callback is
+    // not evicted, even if the callback runs out of buffers.
+
+    SuccessOrQuit(client->ResolveAddress(kHostName, HandleAddressResponse, nullptr), "ResolveAddress failed");
+    Dns::ClientTester::SendAddressResponse(*instance, Dns::ClientTester::GetLastMessageId(*client), kHostName,
+                                           &address, 3600);
+
+    sNumCallbacks = 0;
+    SuccessOrQuit(client->ResolveAddress(kHostName, HandleAddressResponseAllocatingAllBuffers, instance),
+                  "ResolveAddress failed");
+    VerifyOrQuit(counters->mHits == 1, "hit is not counted");
+
+    AdvanceTimeTo(*instance, sNow);
+    VerifyOrQuit(sNumCallbacks == 1, "cached response is not reported");
+    VerifyOrQuit(sLastError == OT_ERROR_NONE && sLastAddress == address, "cached response is wrong");
+    VerifyOrQuit(Dns::ClientTester::GetNumCacheEntries(*client) == 1, "reported response is evicted");
+
+    FreeAllocatedMessages();
+
+    client->Stop();
+    testFreeInstance(instance);
+}
+
+void TestDnsClientCacheStop(void)
+{
+    enum : uint32_t
+    {
+        kTimeT0 = 1000,
+    };
+
+    Instance *                        instance;
+    Dns::Client *                     client;
+    const Dns::Client::CacheCounters *counters;
+    Ip6::Address                      address;
+    uint16_t                          numFreeBuffers;
+
+    sNow                  = kTimeT0;
+    g_testPlatAlarmGetNow = testDnsClientAlarmGetNow;
+
+    instance = testInitInstance();
+    VerifyOrQuit(instance != nullptr, "Null OpenThread instance");
+
+    client   = &instance->Get<Dns::Client>();
+    counters = &client->GetCacheCounters();
+    SuccessOrQuit(address.FromString("fd00::1234"), "FromString failed");
+
+    numFreeBuffers = instance->Get<MessagePool>().GetFreeBufferCount();
+    SuccessOrQuit(client->Start(), "Client::Start failed");
+
+    SuccessOrQuit(client->ResolveAddress(kHostName, HandleAddressResponse, nullptr), "ResolveAddress failed");
+    Dns::ClientTester::SendAddressResponse(*instance, Dns::ClientTester::GetLastMessageId(*client), kHostName,
+                                           &address, 3600);
+    VerifyOrQuit(Dns::ClientTester::GetNumCacheEntries(*client) == 1, "response is not cached");
+
+    // A callback reporting a cached response stops the client. The
+    // response is not added back to the cache after the callback.
+
+    sNumCallbacks = 0;
+    SuccessOrQuit(client->ResolveAddress(kHostName, HandleAddressResponseStoppingClient, instance),
+                  "ResolveAddress failed");
+    VerifyOrQuit(counters->mHits == 1, "hit is not counted");
+
+    AdvanceTimeTo(*instance, sNow);
+    VerifyOrQuit(sNumCallbacks == 1, "cached response is not reported");
+    VerifyOrQuit(Dns::ClientTester::GetNumCacheEntries(*client) == 0, "response is cached after Stop()");
+    VerifyOrQuit(instance->Get<MessagePool>().GetFreeBufferCount() == numFreeBuffers, "cached response is leaked");
+
+    testFreeInstance(instance);
+}
+
+} // namespace ot
+
+int main(void)
+{
+    ot::TestDnsClientCache();
+    ot::TestDnsClientCoalescing();
+    ot::TestDnsClientNegativeCache();
+    ot::TestDnsClientCacheEviction();
+    ot::TestDnsClientCacheReclaim();
+    ot::TestDnsClientCacheStop();
+    printf("All tests passed\n");
+    return 0;
+}
+
+#else
+int main(void)
+{
+    return 0;
+}
+#endif // OPENTHREAD_CONFIG_DNS_CLIENT_ENABLE && OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
@@ -30,6 +30,7 @@
 
 #include <stdint.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
 #include "utils/flash.hpp"
@@ -183,6 +184,235 @@ void TestFlash(void)
         VerifyOrQuit(length == key, "Get() did not return expected length");
         VerifyOrQuit(memcmp(readBuffer, writeBuffer, length) == 0, "Get() did not return expected value");
     }
+
+    // Records are found again after re-initialization
+
+    g_testPlatFlashRetainOnInit = true;
+    flash.Init();
+    g_testPlatFlashRetainOnInit = false;
+
+    for (uint16_t key = 0; key < 16; key++)
+    {
+        uint16_t length = key;
+
+        SuccessOrQuit(flash.Get(key, 0, readBuffer, &length), "Get() failed");
+        VerifyOrQuit(length == key, "Get() did not return expected length");
+        VerifyOrQuit(memcmp(readBuffer, writeBuffer, length) == 0, "Get() did not return expected value");
+        VerifyOrQuit(flash.Get(key, 1, nullptr, nullptr) == OT_ERROR_NOT_FOUND, "Get() failed");
+    }
+
+    testFreeInstance(instance);
+#endif // OPENTHREAD_CONFIG_PLATFORM_FLASH_API_ENABLE
+}
+
+void TestFlashRandom(void)
+{
+#if OPENTHREAD_CONFIG_PLATFORM_FLASH_API_ENABLE
+    enum
+    {
+        kNumKeys      = 4,
+        kMaxValues    = 8,
+        kMaxLength    = 32,
+        kNumOperation = 20000,
+    };
+
+    struct Value
+    {
+        uint16_t mLength;
+        uint8_t  mSeed;
+    };
+
+    Value     values[kNumKeys][kMaxValues];
+    uint8_t   numValues[kNumKeys];
+    uint8_t   buffer[kMaxLength];
+    Instance *instance = testInitInstance();
+    Flash     flash(*instance);
+
+    memset(numValues, 0, sizeof(numValues));
+    srand(0);
+
+    flash.Init();
+
+    for (uint32_t operation = 0; operation < kNumOperation; operation++)
+    {
+        uint16_t key   = static_cast<uint16_t>(rand() % kNumKeys);
+        Value    value = {static_cast<uint16_t>(rand() % (kMaxLength + 1)), static_cast<uint8_t>(rand())};
+
+        for (uint16_t i = 0; i < value.mLength; i++)
+        {
+            buffer[i] = static_cast<uint8_t>(value.mSeed + i);
+        }
+
+        switch (rand() % 5)
+        {
+        case 0:
+            // Set() only shadows earlier values, so it is used on keys with at most one value.
+            if (numValues[key] <= 1)
+            {
+                SuccessOrQuit(flash.Set(key, buffer, value.mLength), "Set() failed");
+                values[key][0] = value;
+                numValues[key] = 1;
+                break;
+            }
+
+            OT_FALL_THROUGH;
+
+        case 1:
+        case 2:
+            if (numValues[key] < kMaxValues)
+            {
+                SuccessOrQuit(flash.Add(key, buffer, value.mLength), "Add() failed");
+                values[key][numValues[key]++] = value;
+                break;
+            }
+
+            OT_FALL_THROUGH;
+
+        case 3:
+        {
+            int index = rand() % (kMaxValues + 1);
+
+            if (index >= numValues[key])
+            {
+                VerifyOrQuit(flash.Delete(key, index) == OT_ERROR_NOT_FOUND, "Delete() succeeded for missing index");
+                break;
+            }
+
+            SuccessOrQuit(flash.Delete(key, index), "Delete() failed");
+            memmove(&values[key][index], &values[key][index + 1], (numValues[key] - index - 1) * sizeof(Value));
+            numValues[key]--;
+            break;
+        }
+
+        default:
+            if (rand() % 8 == 0)
+            {
+                VerifyOrQuit(flash.Delete(key, -1) == (numValues[key] ? OT_ERROR_NONE : OT_ERROR_NOT_FOUND),
+                             "Delete() failed");
+                numValues[key] = 0;
+            }
+            else if (rand() % 8 == 0)
+            {
+                g_testPlatFlashRetainOnInit = true;
+                flash.Init();
+                g_testPlatFlashRetainOnInit = false;
+            }
+            break;
+        }
+
+        for (key = 0; key < kNumKeys; key++)
+        {
+            for (uint8_t index = 0; index <= numValues[key]; index++)
+            {
+                uint16_t length = sizeof(buffer);
+
+                if (index == numValues[key])
+                {
+                    VerifyOrQuit(flash.Get(key, index, buffer, &length) == OT_ERROR_NOT_FOUND, "Get() failed");
+                    continue;
+                }
+
+                SuccessOrQuit(flash.Get(key, index, buffer, &length), "Get() failed");
+                VerifyOrQuit(length == values[key][index].mLength, "Get() did not return expected length");
+
+                for (uint16_t i = 0; i < length; i++)
+                {
+                    VerifyOrQuit(buffer[i] == static_cast<uint8_t>(values[key][index].mSeed + i),
+                                 "Get() did not return expected value");
+                }
+            }
+        }
+    }
+
+    testFreeInstance(instance);
+#endif // OPENTHREAD_CONFIG_PLATFORM_FLASH_API_ENABLE
+}
+
+void TestFlashReadCount(void)
+{
+#if OPENTHREAD_CONFIG_PLATFORM_FLASH_API_ENABLE
+    // Stores records the way the settings module does (network info, dataset and a list of child entries), then
+    // reports how many flash reads each operation takes.
+
+    enum
+    {
+        kKeyNetworkInfo   = 3,
+        kKeyActiveDataset = 1,
+        kKeyChildInfo     = 7,
+        kNumChildren      = 32,
+        kChildInfoLength  = 16,
+    };
+
+    uint8_t   buffer[128];
+    uint16_t  length;
+    uint32_t  reads;
+    Instance *instance = testInitInstance();
+    Flash     flash(*instance);
+
+    memset(buffer, 0x5a, sizeof(buffer));
+
+    flash.Init();
+
+    SuccessOrQuit(flash.Set(kKeyNetworkInfo, buffer, 40), "Set() failed");
+    SuccessOrQuit(flash.Set(kKeyActiveDataset, buffer, 100), "Set() failed");
+
+    for (uint16_t i = 0; i < kNumChildren; i++)
+    {
+        SuccessOrQuit(flash.Add(kKeyChildInfo, buffer, kChildInfoLength), "Add() failed");
+    }
+
+    printf("Flash reads per operation with %d records (RAM index of %d records):\n", kNumChildren + 2,
+           OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_SIZE);
+
+    g_testPlatFlashReadCount    = 0;
+    g_testPlatFlashRetainOnInit = true;
+    flash.Init();
+    g_testPlatFlashRetainOnInit = false;
+    printf("  Init()                       %5u\n", g_testPlatFlashReadCount);
+
+    g_testPlatFlashReadCount = 0;
+    length                   = sizeof(buffer);
+    SuccessOrQuit(flash.Get(kKeyNetworkInfo, 0, buffer, &length), "Get() failed");
+    length = sizeof(buffer);
+    SuccessOrQuit(flash.Get(kKeyActiveDataset, 0, buffer, &length), "Get() failed");
+
+    for (int i = 0;; i++)
+    {
+        length = sizeof(buffer);
+
+        if (flash.Get(kKeyChildInfo, i, buffer, &length) != OT_ERROR_NONE)
+        {
+            VerifyOrQuit(i == kNumChildren, "Get() did not find all child entries");
+            break;
+        }
+    }
+
+    reads = g_testPlatFlashReadCount;
+    printf("  restore all records          %5u\n", reads);
+
+    g_testPlatFlashReadCount = 0;
+    length                   = sizeof(buffer);
+    SuccessOrQuit(flash.Get(kKeyChildInfo, kNumChildren - 1, buffer, &length), "Get() failed");
+    printf("  Get() last child entry       %5u\n", g_testPlatFlashReadCount);
+
+#if OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_SIZE >= kNumChildren + 2
+    VerifyOrQuit(g_testPlatFlashReadCount == 1, "Get() read more than the value");
+    VerifyOrQuit(reads == kNumChildren + 2, "restoring records read more than the values");
+#endif
+
+    g_testPlatFlashReadCount = 0;
+    SuccessOrQuit(flash.Add(kKeyChildInfo, buffer, kChildInfoLength), "Add() failed");
+    printf("  Add() child entry            %5u\n", g_testPlatFlashReadCount);
+
+    g_testPlatFlashReadCount = 0;
+    SuccessOrQuit(flash.Delete(kKeyChildInfo, kNumChildren / 2), "Delete() failed");
+    printf("  Delete() child entry         %5u\n", g_testPlatFlashReadCount);
+
+    g_testPlatFlashReadCount = 0;
+    SuccessOrQuit(flash.Set(kKeyNetworkInfo, buffer, 40), "Set() failed");
+    printf("  Set() network info           %5u\n", g_testPlatFlashReadCount);
+
+    testFreeInstance(instance);
 #endif // OPENTHREAD_CONFIG_PLATFORM_FLASH_API_ENABLE
 }
 
@@ -191,6 +421,8 @@ void TestFlash(void)
 int main(void)
 {
     ot::TestFlash();
+    ot::TestFlashRandom();
+    ot::TestFlashReadCount();
     printf("All tests passed\n");
     return 0;
 }
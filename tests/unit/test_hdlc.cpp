@@ -43,6 +43,9 @@ enum
     kMaxFrameLength    = 500,   // Maximum allowed frame length (used when randomly generating frames)
     kFuzzTestIteration = 50000, // Number of iteration during fuzz test (randomly generating frames)
     kFrameHeaderSize   = 4,     // Frame header size
+    kSmallBufferSize   = 256,   // Decoder buffer size during equivalence test (shorter than the longest frame)
+    kEquivalenceIters  = 2000,  // Number of frame streams compared against the reference implementation
+    kMaxStreamFrames   = 8,     // Maximum number of frames in a stream during equivalence test
 
     kFlagXOn        = 0x11,
     kFlagXOff       = 0x13,
@@ -671,6 +674,294 @@ void TestFuzzEncoderDecoder(void)
     printf(" -- PASS\n");
 }
 
+/**
+ * The reference HDLC-lite implementation processes one byte at a time and computes the FCS bit by bit, the
+ * `Hdlc::Encoder` and `Hdlc::Decoder` outputs are checked against it.
+ *
+ */
+uint16_t ReferenceUpdateFcs(uint16_t aFcs, uint8_t aByte)
+{
+    aFcs ^= aByte;
+
+    for (uint8_t bit = 0; bit < 8; bit++)
+    {
+        aFcs = (aFcs & 1) ? static_cast<uint16_t>((aFcs >> 1) ^ 0x8408) : static_cast<uint16_t>(aFcs >> 1);
+    }
+
+    return aFcs;
+}
+
+bool ReferenceNeedsEscape(uint8_t aByte)
+{
+    return (aByte == kFlagXOn) || (aByte == kFlagXOff) || (aByte == kFlagSequence) || (aByte == kEscapeSequence) ||
+           (aByte == kFlagSpecial);
+}
+
+void ReferenceEncodeByte(uint8_t aByte, uint8_t *aOutput, uint16_t &aLength)
+{
+    if (ReferenceNeedsEscape(aByte))
+    {
+        aOutput[aLength++] = kEscapeSequence;
+        aOutput[aLength++] = aByte ^ 0x20;
+    }
+    else
+    {
+        aOutput[aLength++] = aByte;
+    }
+}
+
+uint16_t ReferenceEncode(const uint8_t *aFrame, uint16_t aLength, uint8_t *aOutput)
+{
+    uint16_t length = 0;
+    uint16_t fcs    = 0xffff;
+
+    aOutput[length++] = kFlagSequence;
+
+    for (uint16_t i = 0; i < aLength; i++)
+    {
+        ReferenceEncodeByte(aFrame[i], aOutput, length);
+        fcs = ReferenceUpdateFcs(fcs, aFrame[i]);
+    }
+
+    fcs ^= 0xffff;
+    ReferenceEncodeByte(fcs & 0xff, aOutput, length);
+    ReferenceEncodeByte(fcs >> 8, aOutput, length);
+    aOutput[length++] = kFlagSequence;
+
+    return length;
+}
+
+/**
+ * This class records the frames (or errors) reported by a decoder.
+ *
+ */
+class DecodedFrameLog
+{
+public:
+    DecodedFrameLog(void)
+        : mLength(0)
+        , mCount(0)
+    {
+    }
+
+    void Add(otError aError, const uint8_t *aFrame, uint16_t aLength)
+    {
+        VerifyOrQuit(mLength + sizeof(otError) + sizeof(uint16_t) + aLength <= sizeof(mLog), "Decoded frame log full");
+
+        memcpy(&mLog[mLength], &aError, sizeof(otError));
+        mLength += sizeof(otError);
+        memcpy(&mLog[mLength], &aLength, sizeof(uint16_t));
+        mLength += sizeof(uint16_t);
+        memcpy(&mLog[mLength], aFrame, aLength);
+        mLength += aLength;
+        mCount++;
+    }
+
+    bool operator==(const DecodedFrameLog &aOther) const
+    {
+        return (mCount == aOther.mCount) && (mLength == aOther.mLength) && (memcmp(mLog, aOther.mLog, mLength) == 0);
+    }
+
+private:
+    uint8_t  mLog[kMaxStreamFrames * 2 * (kMaxFrameLength + 16)];
+    uint32_t mLength;
+    uint16_t mCount;
+};
+
+/**
+ * This class implements the reference decoder state machine, one byte at a time.
+ *
+ */
+class ReferenceDecoder
+{
+public:
+    explicit ReferenceDecoder(DecodedFrameLog &aLog)
+        : mLog(aLog)
+        , mState(kNoSync)
+        , mFcs(0)
+        , mLength(0)
+    {
+    }
+
+    void Decode(const uint8_t *aData, uint32_t aLength)
+    {
+        for (uint32_t i = 0; i < aLength; i++)
+        {
+            DecodeByte(aData[i]);
+        }
+    }
+
+private:
+    enum State
+    {
+        kNoSync,
+        kSync,
+        kEscaped,
+    };
+
+    void DecodeByte(uint8_t aByte)
+    {
+        switch (mState)
+        {
+        case kNoSync:
+            if (aByte == kFlagSequence)
+            {
+                mState  = kSync;
+                mLength = 0;
+                mFcs    = 0xffff;
+            }
+            break;
+
+        case kSync:
+            if (aByte == kEscapeSequence)
+            {
+                mState = kEscaped;
+            }
+            else if (aByte == kFlagSequence)
+            {
+                if (mLength > 0)
+                {
+                    bool isGood = (mLength >= 2) && (mFcs == 0xf0b8);
+
+                    mLog.Add(isGood ? OT_ERROR_NONE : OT_ERROR_PARSE, mFrame, isGood ? mLength - 2 : mLength);
+                }
+
+                mLength = 0;
+                mFcs    = 0xffff;
+            }
+            else
+            {
+                AddByte(aByte);
+            }
+            break;
+
+        case kEscaped:
+            if (AddByte(aByte ^ 0x20))
+            {
+                mState = kSync;
+            }
+            break;
+        }
+    }
+
+    bool AddByte(uint8_t aByte)
+    {
+        bool added = (mLength < kSmallBufferSize);
+
+        if (added)
+        {
+            mFcs              = ReferenceUpdateFcs(mFcs, aByte);
+            mFrame[mLength++] = aByte;
+        }
+        else
+        {
+            mLog.Add(OT_ERROR_NO_BUFS, mFrame, mLength);
+            mLength = 0;
+            mState  = kNoSync;
+        }
+
+        return added;
+    }
+
+    DecodedFrameLog &mLog;
+    State            mState;
+    uint16_t         mFcs;
+    uint16_t         mLength;
+    uint8_t          mFrame[kSmallBufferSize];
+};
+
+struct LoggingDecoderContext
+{
+    Hdlc::FrameBuffer<kSmallBufferSize> mBuffer;
+    DecodedFrameLog                     mLog;
+};
+
+void LogDecodedFrame(void *aContext, otError aError)
+{
+    LoggingDecoderContext &context = *static_cast<LoggingDecoderContext *>(aContext);
+
+    context.mLog.Add(aError, context.mBuffer.GetFrame(), context.mBuffer.GetLength());
+    context.mBuffer.Clear();
+}
+
+uint8_t GetRandomFrameByte(void)
+{
+    // Favor the bytes which need to be escaped, so that runs of all lengths are exercised.
+    return (GetRandom(4) == 0) ? sHdlcSpecials[GetRandom(sizeof(sHdlcSpecials))] : static_cast<uint8_t>(GetRandom(256));
+}
+
+void TestEncoderDecoderEquivalence(void)
+{
+    static uint8_t stream[kMaxStreamFrames * 2 * (kMaxFrameLength + 4) + 16];
+    uint8_t        frame[kMaxFrameLength];
+    uint8_t        expected[2 * (kMaxFrameLength + 4)];
+
+    printf("Testing Hdlc::Encoder and Hdlc::Decoder against the reference implementation");
+
+    for (uint32_t iter = 0; iter < kEquivalenceIters; iter++)
+    {
+        uint32_t              streamLength = 0;
+        uint16_t              numFrames    = static_cast<uint16_t>(GetRandom(kMaxStreamFrames) + 1);
+        LoggingDecoderContext decoderContext;
+        Hdlc::Decoder         decoder(decoderContext.mBuffer, LogDecodedFrame, &decoderContext);
+        DecodedFrameLog       referenceLog;
+        ReferenceDecoder      referenceDecoder(referenceLog);
+
+        // Leading garbage is ignored until the first flag.
+        stream[streamLength++] = static_cast<uint8_t>(GetRandom(256));
+
+        for (uint16_t frameIndex = 0; frameIndex < numFrames; frameIndex++)
+        {
+            Hdlc::FrameBuffer<kBufferSize> encoderBuffer;
+            Hdlc::Encoder                  encoder(encoderBuffer);
+            uint16_t                       length = static_cast<uint16_t>(GetRandom(kMaxFrameLength));
+            uint16_t                       expectedLength;
+
+            for (uint16_t i = 0; i < length; i++)
+            {
+                frame[i] = GetRandomFrameByte();
+            }
+
+            // Feed the encoder in randomly sized pieces.
+            SuccessOrQuit(encoder.BeginFrame(), "Encoder::BeginFrame() failed");
+
+            for (uint16_t offset = 0, pieceLength; offset < length; offset += pieceLength)
+            {
+                pieceLength = static_cast<uint16_t>(GetRandom(length - offset) + 1);
+                SuccessOrQuit(encoder.Encode(&frame[offset], pieceLength), "Encoder::Encode() failed");
+            }
+
+            SuccessOrQuit(encoder.EndFrame(), "Encoder::EndFrame() failed");
+
+            expectedLength = ReferenceEncode(frame, length, expected);
+            VerifyOrQuit(encoderBuffer.GetLength() == expectedLength, "Encoded frame length differs from reference");
+            VerifyOrQuit(memcmp(encoderBuffer.GetFrame(), expected, expectedLength) == 0,
+                         "Encoded frame differs from reference");
+
+            memcpy(&stream[streamLength], expected, expectedLength);
+            streamLength += expectedLength;
+        }
+
+        // Corrupt a few bytes of the stream, possibly turning them into flags or escapes.
+        for (uint32_t count = GetRandom(3); count > 0; count--)
+        {
+            stream[GetRandom(streamLength)] = GetRandomFrameByte();
+        }
+
+        referenceDecoder.Decode(stream, streamLength);
+
+        for (uint32_t offset = 0, pieceLength; offset < streamLength; offset += pieceLength)
+        {
+            pieceLength = GetRandom(streamLength - offset) + 1;
+            decoder.Decode(&stream[offset], static_cast<uint16_t>(pieceLength));
+        }
+
+        VerifyOrQuit(decoderContext.mLog == referenceLog, "Decoded frames differ from reference");
+    }
+
+    printf(" -- PASS\n");
+}
+
 } // namespace Ncp
 } // namespace ot
 
@@ -680,6 +971,7 @@ int main(void)
     ot::Ncp::TestHdlcMultiFrameBuffer();
     ot::Ncp::TestEncoderDecoder();
     ot::Ncp::TestFuzzEncoderDecoder();
+    ot::Ncp::TestEncoderDecoderEquivalence();
     printf("\nAll tests passed.\n");
     return 0;
 }
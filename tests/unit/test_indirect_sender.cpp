@@ -0,0 +1,244 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <string.h>
+
+#include <openthread/config.h>
+#include <openthread/platform/radio.h>
+
+#include "common/code_utils.hpp"
+#include "common/instance.hpp"
+#include "common/message.hpp"
+#include "mac/mac.hpp"
+#include "mac/mac_frame.hpp"
+#include "net/ip6_headers.hpp"
+#include "net/udp6.hpp"
+#include "thread/child_table.hpp"
+#include "thread/key_manager.hpp"
+#include "thread/mesh_forwarder.hpp"
+#include "thread/mle_router.hpp"
+
+#include "test_platform.h"
+#include "test_util.hpp"
+
+namespace ot {
+
+#if OPENTHREAD_FTD
+
+enum : uint16_t
+{
+    kMaxTxFrames = 8,
+};
+
+static Instance *sInstance;
+static uint16_t  sNumTxFrames;
+static uint16_t  sTxFrameLengths[kMaxTxFrames];
+static uint32_t  sPollFrameCounter;
+
+void HandleTransmit(const otRadioFrame *aFrame)
+{
+    VerifyOrQuit(sNumTxFrames < kMaxTxFrames, "Too many frames transmitted");
+    sTxFrameLengths[sNumTxFrames++] = aFrame->mLength;
+}
+
+void InitTest(void)
+{
+    sInstance = testInitSimInstance(0);
+    testStartLeader();
+
+    sNumTxFrames               = 0;
+    sPollFrameCounter          = 1;
+    g_testRadioTransmitHandler = HandleTransmit;
+}
+
+void FinalizeTest(void)
+{
+    testFreeSimInstance();
+}
+
+Child &AddSleepyChild(uint16_t aIndex)
+{
+    Child *         child = sInstance->Get<ChildTable>().GetNewChild();
+    Mac::ExtAddress extAddress;
+
+    VerifyOrQuit(child != nullptr, "GetNewChild() failed");
+
+    memset(&extAddress, 0, sizeof(extAddress));
+    extAddress.m8[0] = 0x12;
+    extAddress.m8[7] = static_cast<uint8_t>(aIndex);
+
+    child->SetState(Neighbor::kStateValid);
+    child->SetExtAddress(extAddress);
+    child->SetRloc16(sInstance->Get<Mle::MleRouter>().GetRloc16() | (aIndex + 1));
+    child->SetDeviceMode(Mle::DeviceMode(0));
+    child->SetTimeout(240);
+    child->SetLastHeard(TimerMilli::GetNow());
+
+    return *child;
+}
+
+// Sends a UDP message to `aDestination` through the mesh forwarder. The
+// payload length identifies the message in the transmitted frames.
+void SendUdpMessage(const Ip6::Address &aDestination, uint16_t aPayloadLength)
+{
+    uint8_t          payload[OT_RADIO_FRAME_MAX_SIZE];
+    Message *        message;
+    Ip6::Header      ip6Header;
+    Ip6::Udp::Header udpHeader;
+    Ip6::Address     source;
+
+    message = sInstance->Get<MessagePool>().New(Message::kTypeIp6, 0, Message::kPriorityNormal);
+    VerifyOrQuit(message != nullptr, "MessagePool::New() failed");
+
+    source.SetToLinkLocalAddress(sInstance->Get<Mac::Mac>().GetExtAddress());
+
+    ip6Header.Init();
+    ip6Header.SetPayloadLength(sizeof(udpHeader) + aPayloadLength);
+    ip6Header.SetNextHeader(Ip6::kProtoUdp);
+    ip6Header.SetHopLimit(64);
+    ip6Header.SetSource(source);
+    ip6Header.SetDestination(aDestination);
+
+    udpHeader.SetSourcePort(49152);
+    udpHeader.SetDestinationPort(49153);
+    udpHeader.SetLength(sizeof(udpHeader) + aPayloadLength);
+    udpHeader.SetChecksum(0);
+
+    memset(payload, 0x5a, aPayloadLength);
+
+    SuccessOrQuit(message->Append(ip6Header), "Message::Append() failed");
+    SuccessOrQuit(message->Append(udpHeader), "Message::Append() failed");
+    SuccessOrQuit(message->AppendBytes(payload, aPayloadLength), "Message::AppendBytes() failed");
+    message->SetLinkSecurityEnabled(true);
+
+    SuccessOrQuit(sInstance->Get<MeshForwarder>().SendMessage(*message), "MeshForwarder::SendMessage() failed");
+    testProcessTasklets();
+}
+
+// Receives a secured MAC Data Request from `aChild`, and returns the
+// length of the frame sent to the child in response.
+uint16_t PollFromChild(const Child &aChild)
+{
+    KeyManager &  keyManager  = sInstance->Get<KeyManager>();
+    uint32_t      keySequence = keyManager.GetCurrentKeySequence();
+    otRadioFrame  radioFrame;
+    uint8_t       psdu[OT_RADIO_FRAME_MAX_SIZE];
+    Mac::TxFrame &frame = *static_cast<Mac::TxFrame *>(&radioFrame);
+
+    memset(&radioFrame, 0, sizeof(radioFrame));
+    radioFrame.mPsdu    = psdu;
+    radioFrame.mChannel = sInstance->Get<Mac::Mac>().GetPanChannel();
+
+    frame.InitMacHeader(Mac::Frame::kFcfFrameMacCmd | Mac::Frame::kFcfPanidCompression | Mac::Frame::kFcfAckRequest |
+                            Mac::Frame::kFcfSecurityEnabled | Mac::Frame::kFcfFrameVersion2006 |
+                            Mac::Frame::kFcfDstAddrShort | Mac::Frame::kFcfSrcAddrExt,
+                        Mac::Frame::kKeyIdMode1 | Mac::Frame::kSecEncMic32);
+    frame.SetSequence(static_cast<uint8_t>(sPollFrameCounter));
+    frame.SetDstPanId(sInstance->Get<Mac::Mac>().GetPanId());
+    frame.SetDstAddr(sInstance->Get<Mac::Mac>().GetShortAddress());
+    frame.SetSrcAddr(aChild.GetExtAddress());
+    frame.SetFrameCounter(sPollFrameCounter++);
+    frame.SetKeyId((keySequence & 0x7f) + 1);
+    SuccessOrQuit(frame.SetCommandId(Mac::Frame::kMacCmdDataRequest), "Frame::SetCommandId() failed");
+    frame.ProcessTransmitAesCcm(aChild.GetExtAddress(),
+                                keyManager.GetAesKeySchedule(KeyManager::kKeyTypeMac, keySequence));
+
+    memset(&radioFrame.mInfo, 0, sizeof(radioFrame.mInfo));
+    radioFrame.mInfo.mRxInfo.mRssi                  = -20;
+    radioFrame.mInfo.mRxInfo.mLqi                   = 255;
+    radioFrame.mInfo.mRxInfo.mAckedWithFramePending = true;
+
+    sNumTxFrames = 0;
+    otPlatRadioReceiveDone(sInstance, &radioFrame, OT_ERROR_NONE);
+    testProcessTasklets();
+
+    VerifyOrQuit(sNumTxFrames == 1, "No frame was sent to the child for its data poll");
+
+    return sTxFrameLengths[0];
+}
+
+void TestIndirectMessageOrder(void)
+{
+    enum : uint16_t
+    {
+        kFirstLength  = 5,  // Unicast to the first child.
+        kSecondLength = 35, // Multicast to both children.
+        kThirdLength  = 65, // Unicast to the first child.
+    };
+
+    Ip6::Address address;
+    uint16_t     firstFrameLength;
+    uint16_t     secondFrameLength;
+    uint16_t     thirdFrameLength;
+
+    InitTest();
+
+    Child &child1 = AddSleepyChild(0);
+    AddSleepyChild(1);
+
+    // Queue three messages of equal priority for the first child. The
+    // second one is also pending for the other child, so it is tracked
+    // apart from the two messages pending only for the first child. The
+    // messages must still be sent in the order they were queued in.
+
+    address.SetToLinkLocalAddress(child1.GetExtAddress());
+    SendUdpMessage(address, kFirstLength);
+    SendUdpMessage(sInstance->Get<Mle::MleRouter>().GetLinkLocalAllThreadNodesAddress(), kSecondLength);
+    SendUdpMessage(address, kThirdLength);
+
+    VerifyOrQuit(child1.GetIndirectMessageCount() == 3, "Messages were not queued for the sleepy child");
+
+    firstFrameLength  = PollFromChild(child1);
+    secondFrameLength = PollFromChild(child1);
+    thirdFrameLength  = PollFromChild(child1);
+
+    printf("Frame lengths: %u %u %u\n", firstFrameLength, secondFrameLength, thirdFrameLength);
+
+    VerifyOrQuit(firstFrameLength < secondFrameLength, "Indirect messages were not sent in queue order");
+    VerifyOrQuit(secondFrameLength < thirdFrameLength, "Indirect messages were not sent in queue order");
+    VerifyOrQuit(child1.GetIndirectMessageCount() == 0, "Messages are still queued for the sleepy child");
+
+    FinalizeTest();
+
+    printf("TestIndirectMessageOrder passed\n");
+}
+
+#endif // OPENTHREAD_FTD
+
+} // namespace ot
+
+int main(void)
+{
+#if OPENTHREAD_FTD
+    ot::TestIndirectMessageOrder();
+    printf("\nAll tests passed\n");
+#else
+    printf("FTD is not enabled\n");
+#endif
+    return 0;
+}
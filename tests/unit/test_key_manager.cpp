@@ -0,0 +1,219 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <limits.h>
+
+#include <openthread/config.h>
+#include <openthread/thread.h>
+
+#include "common/debug.hpp"
+#include "common/instance.hpp"
+#include "crypto/aes_ccm.hpp"
+#include "thread/key_manager.hpp"
+
+#include "test_platform.h"
+#include "test_util.h"
+
+namespace ot {
+
+static bool IsScheduleOfKey(Crypto::AesEcb &aKeySchedule, const Mac::Key &aKey)
+{
+    static const uint8_t kBlock[Crypto::AesEcb::kBlockSize] = {
+        0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff,
+    };
+
+    Crypto::AesEcb reference;
+    uint8_t        output[Crypto::AesEcb::kBlockSize];
+    uint8_t        expected[Crypto::AesEcb::kBlockSize];
+
+    reference.SetKey(aKey.GetKey(), CHAR_BIT * Mac::Key::kSize);
+    reference.Encrypt(kBlock, expected);
+    aKeySchedule.Encrypt(kBlock, output);
+
+    return memcmp(output, expected, sizeof(output)) == 0;
+}
+
+static void VerifyCounters(Instance &aInstance, uint32_t aHits, uint32_t aMisses)
+{
+    const otKeyScheduleCacheCounters *counters = otThreadGetKeyScheduleCacheCounters(&aInstance);
+
+#if !OPENTHREAD_CONFIG_KEY_SCHEDULE_CACHE_ENABLE
+    // Without the cache every lookup expands the key.
+    aMisses += aHits;
+    aHits = 0;
+#endif
+
+    VerifyOrQuit(counters->mHits == aHits, "KeyScheduleCacheCounters::mHits is incorrect");
+    VerifyOrQuit(counters->mMisses == aMisses, "KeyScheduleCacheCounters::mMisses is incorrect");
+}
+
+void TestKeyScheduleCache(void)
+{
+    static const uint8_t kMasterKey1[] = {
+        0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff,
+    };
+
+    static const uint8_t kMasterKey2[] = {
+        0xff, 0xee, 0xdd, 0xcc, 0xbb, 0xaa, 0x99, 0x88, 0x77, 0x66, 0x55, 0x44, 0x33, 0x22, 0x11, 0x00,
+    };
+
+    static const uint8_t kKek1[] = {
+        0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f,
+    };
+
+    static const uint8_t kKek2[] = {
+        0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f,
+    };
+
+    enum : uint32_t
+    {
+        kKeySequence      = 10,
+        kOtherKeySequence = 100,
+    };
+
+    Instance *   instance = static_cast<Instance *>(testInitInstance());
+    KeyManager * keyManager;
+    Mac::SubMac *subMac;
+    MasterKey    masterKey;
+    Mle::Key     otherMleKey;
+
+    VerifyOrQuit(instance != nullptr, "Null OpenThread instance");
+
+    keyManager = &instance->Get<KeyManager>();
+    subMac     = &instance->Get<Mac::SubMac>();
+
+    memcpy(masterKey.m8, kMasterKey1, sizeof(masterKey.m8));
+    SuccessOrQuit(keyManager->SetMasterKey(masterKey), "KeyManager::SetMasterKey() failed");
+    keyManager->SetCurrentKeySequence(kKeySequence);
+    keyManager->SetKek(kKek1);
+    otThreadResetKeyScheduleCacheCounters(instance);
+
+    // The previous, current and next key sequences are served from the schedules expanded by `UpdateKeyMaterial()`
+
+    VerifyOrQuit(IsScheduleOfKey(keyManager->GetAesKeySchedule(KeyManager::kKeyTypeMac, kKeySequence),
+                                 subMac->GetCurrentMacKey()),
+                 "MAC key schedule (current) is incorrect");
+    VerifyOrQuit(IsScheduleOfKey(keyManager->GetAesKeySchedule(KeyManager::kKeyTypeMac, kKeySequence - 1),
+                                 subMac->GetPreviousMacKey()),
+                 "MAC key schedule (previous) is incorrect");
+    VerifyOrQuit(IsScheduleOfKey(keyManager->GetAesKeySchedule(KeyManager::kKeyTypeMac, kKeySequence + 1),
+                                 subMac->GetNextMacKey()),
+                 "MAC key schedule (next) is incorrect");
+    VerifyOrQuit(IsScheduleOfKey(keyManager->GetAesKeySchedule(KeyManager::kKeyTypeMle, kKeySequence),
+                                 keyManager->GetCurrentMleKey()),
+                 "MLE key schedule is incorrect");
+    keyManager->GetAesKeySchedule(KeyManager::kKeyTypeMle, kKeySequence - 1);
+    keyManager->GetAesKeySchedule(KeyManager::kKeyTypeMle, kKeySequence + 1);
+    VerifyOrQuit(
+        IsScheduleOfKey(keyManager->GetAesKeySchedule(KeyManager::kKeyTypeKek, 0), keyManager->GetKek()),
+        "KEK key schedule is incorrect");
+    VerifyCounters(*instance, 7, 0);
+
+    // Any other key sequence is derived on each lookup and leaves the pinned schedules untouched
+
+    otThreadResetKeyScheduleCacheCounters(instance);
+
+    for (uint32_t i = 0; i < 10; i++)
+    {
+        keyManager->GetAesKeySchedule(KeyManager::kKeyTypeMle, kOtherKeySequence + i);
+        keyManager->GetAesKeySchedule(KeyManager::kKeyTypeMac, kOtherKeySequence + i);
+    }
+
+    VerifyCounters(*instance, 0, 20);
+    VerifyOrQuit(IsScheduleOfKey(keyManager->GetAesKeySchedule(KeyManager::kKeyTypeMac, kKeySequence),
+                                 subMac->GetCurrentMacKey()),
+                 "MAC key schedule changed by other key sequences");
+    VerifyOrQuit(IsScheduleOfKey(keyManager->GetAesKeySchedule(KeyManager::kKeyTypeMle, kKeySequence),
+                                 keyManager->GetCurrentMleKey()),
+                 "MLE key schedule changed by other key sequences");
+    VerifyCounters(*instance, 2, 20);
+
+    // A derived schedule matches the key of that key sequence once it becomes current
+
+    keyManager->SetCurrentKeySequence(kOtherKeySequence);
+    otherMleKey = keyManager->GetCurrentMleKey();
+    keyManager->SetCurrentKeySequence(kKeySequence);
+
+    VerifyOrQuit(
+        IsScheduleOfKey(keyManager->GetAesKeySchedule(KeyManager::kKeyTypeMle, kOtherKeySequence), otherMleKey),
+        "MLE key schedule of other key sequence is incorrect");
+
+    // Changing the KEK expands the new KEK
+
+    keyManager->SetKek(kKek2);
+    otThreadResetKeyScheduleCacheCounters(instance);
+
+    VerifyOrQuit(
+        IsScheduleOfKey(keyManager->GetAesKeySchedule(KeyManager::kKeyTypeKek, 0), keyManager->GetKek()),
+        "KEK key schedule is incorrect after SetKek()");
+    VerifyCounters(*instance, 1, 0);
+
+    // A key rotation moves the pinned window to the new key sequence
+
+    keyManager->SetCurrentKeySequence(kKeySequence + 1);
+    otThreadResetKeyScheduleCacheCounters(instance);
+
+    VerifyOrQuit(IsScheduleOfKey(keyManager->GetAesKeySchedule(KeyManager::kKeyTypeMac, kKeySequence + 1),
+                                 subMac->GetCurrentMacKey()),
+                 "MAC key schedule is incorrect after key rotation");
+    VerifyOrQuit(IsScheduleOfKey(keyManager->GetAesKeySchedule(KeyManager::kKeyTypeMac, kKeySequence),
+                                 subMac->GetPreviousMacKey()),
+                 "MAC key schedule (previous) is incorrect after key rotation");
+    VerifyOrQuit(IsScheduleOfKey(keyManager->GetAesKeySchedule(KeyManager::kKeyTypeMac, kKeySequence + 2),
+                                 subMac->GetNextMacKey()),
+                 "MAC key schedule (next) is incorrect after key rotation");
+    VerifyCounters(*instance, 3, 0);
+
+    // Changing the master key expands the schedules of the new derived keys
+
+    memcpy(masterKey.m8, kMasterKey2, sizeof(masterKey.m8));
+    SuccessOrQuit(keyManager->SetMasterKey(masterKey), "KeyManager::SetMasterKey() failed");
+    otThreadResetKeyScheduleCacheCounters(instance);
+
+    VerifyOrQuit(IsScheduleOfKey(keyManager->GetAesKeySchedule(KeyManager::kKeyTypeMac, 0),
+                                 subMac->GetCurrentMacKey()),
+                 "MAC key schedule is incorrect after SetMasterKey()");
+    VerifyOrQuit(IsScheduleOfKey(keyManager->GetAesKeySchedule(KeyManager::kKeyTypeMle, 0),
+                                 keyManager->GetCurrentMleKey()),
+                 "MLE key schedule is incorrect after SetMasterKey()");
+    VerifyOrQuit(IsScheduleOfKey(keyManager->GetAesKeySchedule(KeyManager::kKeyTypeMac, UINT32_MAX),
+                                 subMac->GetPreviousMacKey()),
+                 "MAC key schedule (previous) is incorrect after SetMasterKey()");
+    VerifyCounters(*instance, 3, 0);
+
+    testFreeInstance(instance);
+}
+
+} // namespace ot
+
+int main(void)
+{
+    ot::TestKeyScheduleCache();
+    printf("All tests passed\n");
+    return 0;
+}
@@ -26,6 +26,10 @@
  *  POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+
 #include "common/code_utils.hpp"
 #include "common/debug.hpp"
 #include "mac/mac.hpp"
@@ -648,6 +652,256 @@ void TestMacFrameAckGeneration(void)
 #endif // (OPENTHREAD_CONFIG_THREAD_VERSION >= OT_THREAD_VERSION_1_2)
 }
 
+// Frames captured from a Thread network. The first is the `radio-receive-done` fuzz corpus
+// (tests/fuzz/corpora), the others are the frames used by the tests above.
+static const uint8_t kFrameCorpus0[] = {
+    0x41, 0xd8, 0xf8, 0xad, 0xde, 0xff, 0xff, 0x5e, 0xf8, 0xf3, 0xbd, 0xfd, 0x52, 0xbf, 0x5a, 0x7f,
+    0x3b, 0x02, 0xf0, 0x4d, 0x4c, 0x4d, 0x4c, 0xf2, 0xee, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x09, 0x01, 0x01, 0x0f, 0x03, 0x08, 0x1b, 0x81, 0x7f, 0x9f, 0xe4, 0xb7,
+    0x1d, 0x06, 0x0e, 0x01, 0x80, 0x12, 0x02, 0x00, 0x02, 0x5c, 0x57, 0xaa, 0xd1, 0x5a, 0x3b};
+static const uint8_t kFrameCorpus1[] = {0x02, 0x10, 0x5e, 0xd2, 0x9b};
+static const uint8_t kFrameCorpus2[] = {0x6b, 0xdc, 0x85, 0xce, 0xfa, 0x47, 0x36, 0x07, 0xd9, 0x74, 0x45, 0x8d,
+                                        0xb2, 0x6e, 0x81, 0x25, 0xc9, 0xdb, 0xac, 0x2b, 0x0a, 0x0d, 0x00, 0x00,
+                                        0x00, 0x00, 0x01, 0x04, 0xaf, 0x14, 0xce, 0xaa, 0x5a, 0xe5};
+static const uint8_t kFrameCorpus3[] = {0x29, 0xee, 0x53, 0xce, 0xfa, 0x01, 0x00, 0x00, 0x00,
+                                        0x00, 0x0a, 0x6e, 0x16, 0x05, 0x00, 0x00, 0x00, 0x00,
+                                        0x0a, 0x6e, 0x16, 0x0d, 0x01, 0x00, 0x00, 0x00, 0x01};
+static const uint8_t kFrameCorpus4[] = {0x6b, 0xaa, 0x8d, 0xce, 0xfa, 0x00, 0x68, 0x01, 0x68, 0x0d,
+                                        0x08, 0x00, 0x00, 0x00, 0x01, 0x04, 0x0d, 0xed, 0x0b, 0x35,
+                                        0x0c, 0x80, 0x3f, 0x04, 0x4b, 0x88, 0x89, 0xd6, 0x59, 0xe1};
+static const uint8_t kFrameCorpus5[] = {
+    0x61, 0xdc, 0xbd, 0xce, 0xfa, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x6e, 0x16, 0x02, 0x00, 0x00, 0x00, 0x00, 0x0a,
+    0x6e, 0x16, 0x7f, 0x33, 0xf0, 0x4d, 0x4c, 0x4d, 0x4c, 0x8b, 0xf0, 0x00, 0x15, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0xc2, 0x57, 0x9c, 0x31, 0xb3, 0x2a, 0xa1, 0x86, 0xba, 0x9a, 0xed, 0x5a, 0xb9, 0xa3, 0x59, 0x88,
+    0xeb, 0xbb, 0x0d, 0xc3, 0xed, 0xeb, 0x8a, 0x53, 0xa6, 0xed, 0xf7, 0xdd, 0x45, 0x6e, 0xf7, 0x9a, 0x17, 0xb4, 0xab,
+    0xc6, 0x75, 0x71, 0x46, 0x37, 0x93, 0x4a, 0x32, 0xb1, 0x21, 0x9f, 0x9d, 0xb3, 0x65, 0x27, 0xd5, 0xfc, 0x50, 0x16,
+    0x90, 0xd2, 0xd4};
+static const uint8_t kFrameCorpus6[] = {0x69, 0xa8, 0x8e, 0xce, 0xfa, 0x02, 0x24, 0x00, 0x24, 0x0d, 0x02,
+                                        0x00, 0x00, 0x00, 0x01, 0x6b, 0x64, 0x60, 0x08, 0x55, 0xb8, 0x10,
+                                        0x18, 0xc7, 0x40, 0x2e, 0xfb, 0xf3, 0xda, 0xf9, 0x4e, 0x58, 0x70};
+
+struct CorpusFrame
+{
+    const uint8_t *mPsdu;
+    uint8_t        mLength;
+};
+
+static const CorpusFrame kFrameCorpus[] = {
+    {kFrameCorpus0, sizeof(kFrameCorpus0)}, {kFrameCorpus1, sizeof(kFrameCorpus1)},
+    {kFrameCorpus2, sizeof(kFrameCorpus2)}, {kFrameCorpus3, sizeof(kFrameCorpus3)},
+    {kFrameCorpus4, sizeof(kFrameCorpus4)}, {kFrameCorpus5, sizeof(kFrameCorpus5)},
+    {kFrameCorpus6, sizeof(kFrameCorpus6)},
+};
+
+bool CompareAddress(const Mac::Address &aFirst, const Mac::Address &aSecond)
+{
+    bool matches = (aFirst.GetType() == aSecond.GetType());
+
+    if (matches && aFirst.IsShort())
+    {
+        matches = (aFirst.GetShort() == aSecond.GetShort());
+    }
+    else if (matches && aFirst.IsExtended())
+    {
+        matches = (aFirst.GetExtended() == aSecond.GetExtended());
+    }
+
+    return matches;
+}
+
+// Verifies that every `ParsedFrame` accessor agrees with the corresponding `Frame` accessor.
+void VerifyParsedFrame(Mac::Frame &aFrame)
+{
+    Mac::ParsedFrame parsedFrame;
+    otError          error = aFrame.ValidatePsdu();
+    Mac::Address     address1;
+    Mac::Address     address2;
+    Mac::PanId       panId1 = 0;
+    Mac::PanId       panId2 = 0;
+    uint32_t         value1 = 0;
+    uint32_t         value2 = 0;
+    uint8_t          byte1  = 0;
+    uint8_t          byte2  = 0;
+
+    VerifyOrQuit(parsedFrame.Parse(aFrame) == error, "ParsedFrame::Parse() does not match ValidatePsdu()");
+    VerifyOrExit(error == OT_ERROR_NONE);
+
+    VerifyOrQuit(&parsedFrame.GetFrame() == &aFrame, "ParsedFrame::GetFrame() failed");
+    VerifyOrQuit(parsedFrame.GetFrameControlField() == aFrame.GetFrameControlField(),
+                 "ParsedFrame::GetFrameControlField() failed");
+    VerifyOrQuit(parsedFrame.GetType() == aFrame.GetType(), "ParsedFrame::GetType() failed");
+    VerifyOrQuit(parsedFrame.GetSecurityEnabled() == aFrame.GetSecurityEnabled(),
+                 "ParsedFrame::GetSecurityEnabled() failed");
+
+    VerifyOrQuit(parsedFrame.GetDstPanId(panId1) == aFrame.GetDstPanId(panId2), "ParsedFrame::GetDstPanId() failed");
+    VerifyOrQuit(panId1 == panId2, "ParsedFrame::GetDstPanId() value failed");
+    VerifyOrQuit(parsedFrame.GetSrcPanId(panId1) == aFrame.GetSrcPanId(panId2), "ParsedFrame::GetSrcPanId() failed");
+    VerifyOrQuit(panId1 == panId2, "ParsedFrame::GetSrcPanId() value failed");
+
+    VerifyOrQuit(parsedFrame.GetDstAddr(address1) == aFrame.GetDstAddr(address2), "ParsedFrame::GetDstAddr() failed");
+    VerifyOrQuit(CompareAddress(address1, address2), "ParsedFrame::GetDstAddr() value failed");
+    VerifyOrQuit(parsedFrame.GetSrcAddr(address1) == aFrame.GetSrcAddr(address2), "ParsedFrame::GetSrcAddr() failed");
+    VerifyOrQuit(CompareAddress(address1, address2), "ParsedFrame::GetSrcAddr() value failed");
+
+    VerifyOrQuit(parsedFrame.GetSecurityLevel(byte1) == aFrame.GetSecurityLevel(byte2),
+                 "ParsedFrame::GetSecurityLevel() failed");
+    VerifyOrQuit(byte1 == byte2, "ParsedFrame::GetSecurityLevel() value failed");
+    VerifyOrQuit(parsedFrame.GetKeyIdMode(byte1) == aFrame.GetKeyIdMode(byte2), "ParsedFrame::GetKeyIdMode() failed");
+    VerifyOrQuit(byte1 == byte2, "ParsedFrame::GetKeyIdMode() value failed");
+    VerifyOrQuit(parsedFrame.GetKeyId(byte1) == aFrame.GetKeyId(byte2), "ParsedFrame::GetKeyId() failed");
+    VerifyOrQuit(byte1 == byte2, "ParsedFrame::GetKeyId() value failed");
+    VerifyOrQuit(parsedFrame.GetFrameCounter(value1) == aFrame.GetFrameCounter(value2),
+                 "ParsedFrame::GetFrameCounter() failed");
+    VerifyOrQuit(value1 == value2, "ParsedFrame::GetFrameCounter() value failed");
+
+    VerifyOrQuit(parsedFrame.GetCommandId(byte1) == aFrame.GetCommandId(byte2), "ParsedFrame::GetCommandId() failed");
+    VerifyOrQuit(byte1 == byte2, "ParsedFrame::GetCommandId() value failed");
+    VerifyOrQuit(parsedFrame.IsDataRequestCommand() == aFrame.IsDataRequestCommand(),
+                 "ParsedFrame::IsDataRequestCommand() failed");
+
+    VerifyOrQuit(parsedFrame.GetHeaderLength() == aFrame.GetHeaderLength(), "ParsedFrame::GetHeaderLength() failed");
+    VerifyOrQuit(parsedFrame.GetFooterLength() == aFrame.GetFooterLength(), "ParsedFrame::GetFooterLength() failed");
+    VerifyOrQuit(parsedFrame.GetPayloadLength() == aFrame.GetPayloadLength(),
+                 "ParsedFrame::GetPayloadLength() failed");
+    VerifyOrQuit(parsedFrame.GetPayload() == aFrame.GetPayload(), "ParsedFrame::GetPayload() failed");
+    VerifyOrQuit(parsedFrame.GetFooter() == aFrame.GetFooter(), "ParsedFrame::GetFooter() failed");
+
+#if OPENTHREAD_CONFIG_MAC_HEADER_IE_SUPPORT
+    VerifyOrQuit(parsedFrame.GetHeaderIe(Mac::Frame::kHeaderIeVendor) ==
+                     aFrame.GetHeaderIe(Mac::Frame::kHeaderIeVendor),
+                 "ParsedFrame::GetHeaderIe() failed");
+    VerifyOrQuit(parsedFrame.GetHeaderIe(Mac::Frame::kHeaderIeCsl) == aFrame.GetHeaderIe(Mac::Frame::kHeaderIeCsl),
+                 "ParsedFrame::GetHeaderIe() failed");
+    VerifyOrQuit(parsedFrame.GetHeaderIe(Mac::Frame::kHeaderIeTermination2) ==
+                     aFrame.GetHeaderIe(Mac::Frame::kHeaderIeTermination2),
+                 "ParsedFrame::GetHeaderIe() failed");
+#endif
+
+exit:
+    return;
+}
+
+void TestParsedFrame(void)
+{
+    uint8_t    psdu[OT_RADIO_FRAME_MAX_SIZE];
+    Mac::Frame frame;
+    uint32_t   numValid = 0;
+
+    memset(&frame, 0, sizeof(frame));
+    frame.mPsdu = psdu;
+
+    for (const CorpusFrame &corpusFrame : kFrameCorpus)
+    {
+        memset(psdu, 0, sizeof(psdu));
+        memcpy(psdu, corpusFrame.mPsdu, corpusFrame.mLength);
+        frame.mLength = corpusFrame.mLength;
+
+        VerifyParsedFrame(frame);
+
+        // Every truncation of the frame.
+
+        for (uint8_t length = 0; length < corpusFrame.mLength; length++)
+        {
+            frame.mLength = length;
+            VerifyParsedFrame(frame);
+        }
+
+        frame.mLength = corpusFrame.mLength;
+
+        // Every single bit flip.
+
+        for (uint8_t index = 0; index < corpusFrame.mLength; index++)
+        {
+            for (uint8_t bit = 0; bit < CHAR_BIT; bit++)
+            {
+                psdu[index] ^= (1 << bit);
+                numValid += (frame.ValidatePsdu() == OT_ERROR_NONE) ? 1 : 0;
+                VerifyParsedFrame(frame);
+                psdu[index] ^= (1 << bit);
+            }
+        }
+    }
+
+    // Random frames, with a valid address mode most of the time.
+
+    for (uint32_t i = 0; i < 20000; i++)
+    {
+        for (uint8_t &byte : psdu)
+        {
+            byte = static_cast<uint8_t>(rand());
+        }
+
+        if ((i % 4) != 0)
+        {
+            psdu[1] |= 0x88;
+        }
+
+        frame.mLength = static_cast<uint16_t>(rand() % (sizeof(psdu) + 1));
+        numValid += (frame.ValidatePsdu() == OT_ERROR_NONE) ? 1 : 0;
+        VerifyParsedFrame(frame);
+    }
+
+    VerifyOrQuit(numValid > 0, "no valid frame was generated");
+}
+
+void TestParsedFrameAesCcm(void)
+{
+    const uint8_t kPayload[] = {0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99, 0xaa, 0xbb};
+
+    uint8_t          psdu[OT_RADIO_FRAME_MAX_SIZE];
+    Mac::TxFrame     txFrame;
+    Mac::RxFrame     rxFrame;
+    Mac::ParsedFrame parsedFrame;
+    Mac::Key         key;
+    Mac::ExtAddress  extAddress;
+
+    for (uint8_t i = 0; i < sizeof(key.m8); i++)
+    {
+        key.m8[i] = i;
+    }
+
+    for (uint8_t i = 0; i < sizeof(extAddress.m8); i++)
+    {
+        extAddress.m8[i] = 0x10 + i;
+    }
+
+    // Secure a frame with the header of corpus frame 6 (Key ID Mode 1,
+    // ENC-MIC-32), then verify and decrypt it as a received frame.
+
+    memset(&txFrame, 0, sizeof(txFrame));
+    memset(psdu, 0, sizeof(psdu));
+    txFrame.mPsdu = psdu;
+    memcpy(psdu, kFrameCorpus6, 15);
+    memcpy(psdu + 15, kPayload, sizeof(kPayload));
+    txFrame.mLength = 15 + sizeof(kPayload) + Mac::Frame::kMic32Size + Mac::Frame::k154FcsSize;
+
+    VerifyOrQuit(txFrame.ValidatePsdu() == OT_ERROR_NONE, "Frame::ValidatePsdu() failed");
+    VerifyOrQuit(txFrame.GetPayloadLength() == sizeof(kPayload), "Frame::GetPayloadLength() failed");
+
+    txFrame.SetAesKey(key);
+    txFrame.ProcessTransmitAesCcm(extAddress);
+    VerifyOrQuit(txFrame.IsSecurityProcessed(), "TxFrame::ProcessTransmitAesCcm() failed");
+    VerifyOrQuit(memcmp(txFrame.GetPayload(), kPayload, sizeof(kPayload)) != 0,
+                 "TxFrame::ProcessTransmitAesCcm() did not encrypt the payload");
+
+    memset(&rxFrame, 0, sizeof(rxFrame));
+    rxFrame.mPsdu   = psdu;
+    rxFrame.mLength = txFrame.mLength;
+
+    SuccessOrQuit(parsedFrame.Parse(rxFrame), "ParsedFrame::Parse() failed");
+    SuccessOrQuit(rxFrame.ProcessReceiveAesCcm(parsedFrame, extAddress, key), "RxFrame::ProcessReceiveAesCcm() failed");
+    VerifyOrQuit(memcmp(parsedFrame.GetPayload(), kPayload, sizeof(kPayload)) == 0,
+                 "RxFrame::ProcessReceiveAesCcm() did not decrypt the payload");
+
+    // A frame with a modified header fails the MIC check.
+
+    txFrame.SetIsSecurityProcessed(false);
+    txFrame.ProcessTransmitAesCcm(extAddress);
+    psdu[Mac::Frame::kFcfSize]++;
+    VerifyOrQuit(rxFrame.ProcessReceiveAesCcm(parsedFrame, extAddress, key) == OT_ERROR_SECURITY,
+                 "RxFrame::ProcessReceiveAesCcm() accepted a modified frame");
+}
+
 } // namespace ot
 
 int main(void)
@@ -658,6 +912,8 @@ int main(void)
     ot::TestMacChannelMask();
     ot::TestMacFrameApi();
     ot::TestMacFrameAckGeneration();
+    ot::TestParsedFrame();
+    ot::TestParsedFrameAesCcm();
     printf("All tests passed\n");
     return 0;
 }
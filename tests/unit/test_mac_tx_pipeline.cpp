@@ -0,0 +1,396 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <string.h>
+
+#include <openthread/ip6.h>
+#include <openthread/platform/radio.h>
+
+#include "common/code_utils.hpp"
+#include "common/instance.hpp"
+#include "common/message.hpp"
+#include "mac/mac.hpp"
+#include "mac/mac_frame.hpp"
+#include "mac/sub_mac.hpp"
+#include "net/ip6_headers.hpp"
+#include "net/udp6.hpp"
+#include "thread/key_manager.hpp"
+#include "thread/lowpan.hpp"
+#include "thread/mesh_forwarder.hpp"
+
+#include "test_platform.h"
+#include "test_util.hpp"
+
+namespace ot {
+
+enum : uint16_t
+{
+    kLargePayloadLength = 1000, // Requires a dozen fragment frames.
+    kSmallPayloadLength = 20,   // Fits in a single frame.
+};
+
+static Instance *    sInstance;
+static uint8_t       sPacket[sizeof(Ip6::Header) + sizeof(Ip6::Udp::Header) + kLargePayloadLength];
+static uint16_t      sPacketLength;
+static uint16_t      sNumFrames;
+static uint16_t      sNumFramesFromTxDone;
+static uint16_t      sNextFragmentOffset;
+static uint8_t       sLastSequence;
+static uint32_t      sLastFrameCounter;
+static uint8_t       sLastKeyId;
+static bool          sFirstFragmentSent;
+static uint16_t      sNumSmallFrames;
+static Mac::Address  sLargeDstAddr;
+static Mac::Address  sSmallDstAddr;
+static void (*sFrameHandler)(uint16_t aFrameIndex);
+
+Message *NewUdpMessage(const Mac::ExtAddress &aDestination, uint16_t aPayloadLength, Message::Priority aPriority)
+{
+    // The packet content is kept in `sPacket` to verify the fragments
+    // against, which is only needed for the large message.
+
+    uint8_t          packet[sizeof(sPacket)];
+    uint16_t         length = 0;
+    Message *        message;
+    Ip6::Header      ip6Header;
+    Ip6::Udp::Header udpHeader;
+    Ip6::Address     address;
+
+    message = sInstance->Get<MessagePool>().New(Message::kTypeIp6, 0, aPriority);
+    VerifyOrQuit(message != nullptr, "MessagePool::New() failed");
+
+    ip6Header.Init();
+    ip6Header.SetPayloadLength(sizeof(udpHeader) + aPayloadLength);
+    ip6Header.SetNextHeader(Ip6::kProtoUdp);
+    ip6Header.SetHopLimit(64);
+    address.SetToLinkLocalAddress(sInstance->Get<Mac::Mac>().GetExtAddress());
+    ip6Header.SetSource(address);
+    address.SetToLinkLocalAddress(aDestination);
+    ip6Header.SetDestination(address);
+
+    udpHeader.SetSourcePort(49152);
+    udpHeader.SetDestinationPort(49153);
+    udpHeader.SetLength(sizeof(udpHeader) + aPayloadLength);
+    udpHeader.SetChecksum(0);
+
+    memcpy(&packet[length], &ip6Header, sizeof(ip6Header));
+    length += sizeof(ip6Header);
+    memcpy(&packet[length], &udpHeader, sizeof(udpHeader));
+    length += sizeof(udpHeader);
+
+    for (uint16_t i = 0; i < aPayloadLength; i++)
+    {
+        packet[length++] = static_cast<uint8_t>(i * 7 + 3);
+    }
+
+    SuccessOrQuit(message->AppendBytes(packet, length), "Message::AppendBytes() failed");
+    message->SetLinkSecurityEnabled(true);
+
+    if (aDestination == sLargeDstAddr.GetExtended())
+    {
+        memcpy(sPacket, packet, length);
+        sPacketLength = length;
+    }
+
+    return message;
+}
+
+void SendMessage(Message &aMessage)
+{
+    SuccessOrQuit(sInstance->Get<MeshForwarder>().SendMessage(aMessage), "MeshForwarder::SendMessage() failed");
+}
+
+void VerifyTxFrame(void)
+{
+    uint8_t                psdu[OT_RADIO_FRAME_MAX_SIZE];
+    Mac::RxFrame           rxFrame;
+    Mac::ParsedFrame       parsedFrame;
+    Mac::Address           dstAddr;
+    uint32_t               frameCounter;
+    uint8_t                keyId;
+    Lowpan::FragmentHeader fragmentHeader;
+    uint16_t               fragmentHeaderLength;
+    const uint8_t *        payload;
+    uint16_t               payloadLength;
+
+    // Verify and decrypt a copy of the frame as a receiver would, with
+    // the key and extended address in use when the frame is sent.
+
+    memcpy(psdu, g_testRadioTxFrame.mPsdu, g_testRadioTxFrame.mLength);
+    memset(&rxFrame, 0, sizeof(rxFrame));
+    rxFrame.mPsdu   = psdu;
+    rxFrame.mLength = g_testRadioTxFrame.mLength;
+
+    SuccessOrQuit(parsedFrame.Parse(rxFrame), "ParsedFrame::Parse() failed");
+    VerifyOrQuit(parsedFrame.GetSecurityEnabled(), "frame is not secured");
+    SuccessOrQuit(rxFrame.ProcessReceiveAesCcm(parsedFrame, sInstance->Get<Mac::Mac>().GetExtAddress(),
+                                               sInstance->Get<Mac::SubMac>().GetCurrentMacKey()),
+                  "frame was not secured with the current key");
+
+    // The frame counter restarts from zero on a key sequence change.
+    // A prepared frame that is discarded must not consume a sequence
+    // number or a frame counter, so both are contiguous.
+
+    SuccessOrQuit(parsedFrame.GetFrameCounter(frameCounter), "ParsedFrame::GetFrameCounter() failed");
+    SuccessOrQuit(parsedFrame.GetKeyId(keyId), "ParsedFrame::GetKeyId() failed");
+    VerifyOrQuit((sNumFrames == 0) || (keyId != sLastKeyId) || (frameCounter == sLastFrameCounter + 1),
+                 "frame counter is not contiguous");
+    VerifyOrQuit((sNumFrames == 0) || (rxFrame.GetSequence() == static_cast<uint8_t>(sLastSequence + 1)),
+                 "sequence number is not contiguous");
+
+    sLastFrameCounter = frameCounter;
+    sLastKeyId        = keyId;
+    sLastSequence     = rxFrame.GetSequence();
+
+    SuccessOrQuit(parsedFrame.GetDstAddr(dstAddr), "ParsedFrame::GetDstAddr() failed");
+    payload       = parsedFrame.GetPayload();
+    payloadLength = parsedFrame.GetPayloadLength();
+
+    if (dstAddr == sSmallDstAddr)
+    {
+        VerifyOrQuit(!Lowpan::FragmentHeader::IsFragmentHeader(payload, payloadLength),
+                     "small message was fragmented");
+        sNumSmallFrames++;
+        ExitNow();
+    }
+
+    VerifyOrQuit(dstAddr == sLargeDstAddr, "frame has an unexpected destination");
+
+    SuccessOrQuit(fragmentHeader.ParseFrom(payload, payloadLength, fragmentHeaderLength),
+                  "FragmentHeader::ParseFrom() failed");
+    VerifyOrQuit(fragmentHeader.GetDatagramSize() == sPacketLength, "fragment has an unexpected datagram size");
+
+    payload += fragmentHeaderLength;
+    payloadLength -= fragmentHeaderLength;
+
+    if (fragmentHeader.GetDatagramOffset() == 0)
+    {
+        // The first fragment carries the compressed headers, so the
+        // datagram offset it covers is only known from the next one.
+        VerifyOrQuit(sNextFragmentOffset == 0, "datagram restarted");
+        sFirstFragmentSent = true;
+        ExitNow();
+    }
+
+    VerifyOrQuit(sFirstFragmentSent, "subsequent fragment sent before the first one");
+
+    if (sNextFragmentOffset != 0)
+    {
+        VerifyOrQuit(fragmentHeader.GetDatagramOffset() == sNextFragmentOffset, "fragment offset is not contiguous");
+    }
+
+    sNextFragmentOffset = fragmentHeader.GetDatagramOffset();
+    VerifyOrQuit(sNextFragmentOffset + payloadLength <= sPacketLength, "fragment exceeds the datagram");
+    VerifyOrQuit(memcmp(payload, &sPacket[sNextFragmentOffset], payloadLength) == 0,
+                 "fragment content does not match the datagram");
+    sNextFragmentOffset += payloadLength;
+
+exit:
+    return;
+}
+
+uint16_t RunTransmissions(void)
+{
+    uint16_t numFrames = 0;
+
+    testProcessTasklets();
+
+    while (g_testRadioTransmitted)
+    {
+        g_testRadioTransmitted = false;
+
+        VerifyTxFrame();
+
+        if (sFrameHandler != nullptr)
+        {
+            sFrameHandler(numFrames);
+        }
+
+        numFrames++;
+        sNumFrames++;
+
+        otPlatRadioTxDone(sInstance, &g_testRadioTxFrame, nullptr, OT_ERROR_NONE);
+
+        if (g_testRadioTransmitted)
+        {
+            sNumFramesFromTxDone++;
+        }
+
+        testProcessTasklets();
+    }
+
+    return numFrames;
+}
+
+void InitTest(void)
+{
+    Mac::ExtAddress extAddress;
+
+    // The transmissions are reported as done by `RunTransmissions()`.
+    g_testRadioAutoTxDone = false;
+    sInstance             = testInitSimInstance(0);
+
+    for (uint8_t i = 0; i < sizeof(extAddress.m8); i++)
+    {
+        extAddress.m8[i] = 0x10 + i;
+    }
+
+    sLargeDstAddr.SetExtended(extAddress);
+    extAddress.m8[7] ^= 0xff;
+    sSmallDstAddr.SetExtended(extAddress);
+
+    g_testRadioTransmitted = false;
+    sFrameHandler          = nullptr;
+    sNumFrames             = 0;
+    sNumFramesFromTxDone   = 0;
+    sNumSmallFrames        = 0;
+}
+
+void FinalizeTest(void)
+{
+    testFreeSimInstance();
+}
+
+void StartLargeMessage(void)
+{
+    sNextFragmentOffset = 0;
+    sFirstFragmentSent  = false;
+    SendMessage(*NewUdpMessage(sLargeDstAddr.GetExtended(), kLargePayloadLength, Message::kPriorityNormal));
+}
+
+void TestFragmentedSend(void)
+{
+    uint16_t numFrames;
+
+    printf("\nTestFragmentedSend");
+
+    InitTest();
+
+    StartLargeMessage();
+    numFrames = RunTransmissions();
+
+    VerifyOrQuit(numFrames > 2, "message was not fragmented");
+    VerifyOrQuit(sNextFragmentOffset == sPacketLength, "datagram was not fully sent");
+
+#if OPENTHREAD_CONFIG_MAC_TX_PIPELINE_ENABLE
+    VerifyOrQuit(sNumFramesFromTxDone == numFrames - 1, "subsequent fragments were not started from tx done");
+#endif
+
+    printf(" -> %u frames, %u started from tx done", numFrames, sNumFramesFromTxDone);
+
+    FinalizeTest();
+
+    printf(" -> PASSED\n");
+}
+
+void HandleFrameChangeKeySequence(uint16_t aFrameIndex)
+{
+    // By now the next fragment may already be prepared. It must be
+    // secured with the new key when it is sent.
+
+    if (aFrameIndex == 2)
+    {
+        KeyManager &keyManager = sInstance->Get<KeyManager>();
+
+        keyManager.SetCurrentKeySequence(keyManager.GetCurrentKeySequence() + 1);
+    }
+}
+
+void TestKeySequenceChange(void)
+{
+    uint16_t numFrames;
+
+    printf("\nTestKeySequenceChange");
+
+    InitTest();
+
+    sFrameHandler = HandleFrameChangeKeySequence;
+    StartLargeMessage();
+    numFrames = RunTransmissions();
+
+    VerifyOrQuit(numFrames > 3, "message was not fragmented");
+    VerifyOrQuit(sNextFragmentOffset == sPacketLength, "datagram was not fully sent");
+    VerifyOrQuit(sLastKeyId == ((sInstance->Get<KeyManager>().GetCurrentKeySequence() & 0x7f) + 1),
+                 "last frame did not use the new key");
+
+    FinalizeTest();
+
+    printf(" -> PASSED\n");
+}
+
+void HandleFrameSendUrgentMessage(uint16_t aFrameIndex)
+{
+    // A higher priority message queued while a fragment is on air is
+    // sent next, ahead of the fragment that is already prepared (which
+    // is then discarded).
+
+    switch (aFrameIndex)
+    {
+    case 3:
+        VerifyOrQuit(sNumSmallFrames == 0, "small message sent too early");
+        SendMessage(*NewUdpMessage(sSmallDstAddr.GetExtended(), kSmallPayloadLength, Message::kPriorityNet));
+        break;
+
+    case 4:
+        VerifyOrQuit(sNumSmallFrames == 1, "higher priority message was not sent next");
+        break;
+
+    default:
+        break;
+    }
+}
+
+void TestHigherPriorityMessage(void)
+{
+    printf("\nTestHigherPriorityMessage");
+
+    InitTest();
+
+    sFrameHandler = HandleFrameSendUrgentMessage;
+    StartLargeMessage();
+    RunTransmissions();
+
+    VerifyOrQuit(sNumSmallFrames == 1, "higher priority message was not sent");
+    VerifyOrQuit(sNextFragmentOffset == sPacketLength, "datagram was not fully sent");
+
+    FinalizeTest();
+
+    printf(" -> PASSED\n");
+}
+
+} // namespace ot
+
+int main(void)
+{
+    ot::TestFragmentedSend();
+    ot::TestKeySequenceChange();
+    ot::TestHigherPriorityMessage();
+
+    printf("\nAll tests passed\n");
+    return 0;
+}
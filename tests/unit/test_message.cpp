@@ -199,11 +199,156 @@ void TestMessage(void)
     testFreeInstance(instance);
 }
 
+void TestMessageBufferBatches(void)
+{
+    enum : uint16_t
+    {
+        kLargeLength = 1280 + 4,
+        kSmallLength = 80,
+    };
+
+    Instance *   instance;
+    MessagePool *messagePool;
+    Message *    message;
+    Message *    messages[2];
+    uint16_t     numFreeBuffers;
+    uint16_t     numLargeBuffers;
+
+    instance = static_cast<Instance *>(testInitInstance());
+    VerifyOrQuit(instance != nullptr, "Null OpenThread instance\n");
+
+    messagePool    = &instance->Get<MessagePool>();
+    numFreeBuffers = messagePool->GetFreeBufferCount();
+
+    // Grow a message to a large length, shrink it and free it, and
+    // verify the buffer accounting along the way.
+
+    VerifyOrQuit((message = messagePool->New(Message::kTypeIp6, 0)) != nullptr, "Message::New failed");
+    VerifyOrQuit(messagePool->GetFreeBufferCount() == numFreeBuffers - 1, "Free buffer count is incorrect");
+
+    SuccessOrQuit(message->SetLength(kLargeLength), "Message::SetLength failed");
+    numLargeBuffers = message->GetBufferCount();
+    VerifyOrQuit(messagePool->GetFreeBufferCount() == numFreeBuffers - numLargeBuffers,
+                 "Free buffer count is incorrect");
+
+    SuccessOrQuit(message->SetLength(kSmallLength), "Message::SetLength failed");
+    VerifyOrQuit(numLargeBuffers == 1 || message->GetBufferCount() < numLargeBuffers,
+                 "Message::SetLength did not free buffers");
+    VerifyOrQuit(messagePool->GetFreeBufferCount() == numFreeBuffers - message->GetBufferCount(),
+                 "Free buffer count is incorrect");
+
+    message->Free();
+    VerifyOrQuit(messagePool->GetFreeBufferCount() == numFreeBuffers, "Free buffer count is incorrect");
+
+#if OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE && (OPENTHREAD_CONFIG_MESSAGE_BUFFER_MAGAZINE_SIZE > 0)
+    // The freed buffers are kept in the magazine, they are given back
+    // to the heap when the message pool is deinitialized.
+
+    {
+        size_t heapFreeSize = instance->GetHeap().GetFreeSize();
+
+        messagePool->Deinit();
+        VerifyOrQuit(instance->GetHeap().GetFreeSize() > heapFreeSize, "MessagePool::Deinit failed");
+        VerifyOrQuit(messagePool->GetFreeBufferCount() >= numFreeBuffers, "Free buffer count is incorrect");
+    }
+#endif
+
+    // Growing a message beyond the free buffers must fail without
+    // taking any buffer.
+
+    VerifyOrQuit((messages[0] = messagePool->New(Message::kTypeIp6, 0)) != nullptr, "Message::New failed");
+    VerifyOrQuit((messages[1] = messagePool->New(Message::kTypeIp6, 0)) != nullptr, "Message::New failed");
+    SuccessOrQuit(messages[0]->SetLength(kSmallLength), "Message::SetLength failed");
+
+    numFreeBuffers = messagePool->GetFreeBufferCount();
+
+    if ((numFreeBuffers + 2) * kBufferSize <= UINT16_MAX)
+    {
+        VerifyOrQuit(messages[1]->SetLength(static_cast<uint16_t>((numFreeBuffers + 2) * kBufferSize)) != OT_ERROR_NONE,
+                     "Message::SetLength did not fail");
+        VerifyOrQuit(messagePool->GetFreeBufferCount() == numFreeBuffers, "Failed Message::SetLength took buffers");
+        VerifyOrQuit(messages[1]->GetBufferCount() == 1, "Failed Message::SetLength added buffers");
+    }
+
+    messages[0]->Free();
+    messages[1]->Free();
+
+    testFreeInstance(instance);
+}
+
+void TestMessageContiguous(void)
+{
+    enum : uint16_t
+    {
+        kDatagramLength = 1280,
+        kReserved       = 56,
+    };
+
+    OT_TOOL_PACKED_BEGIN
+    struct Header
+    {
+        uint8_t mBytes[40];
+    } OT_TOOL_PACKED_END;
+
+    Instance *     instance;
+    MessagePool *  messagePool;
+    Message *      message;
+    uint8_t        datagram[kDatagramLength];
+    Header         headerCopy;
+    const Header * header;
+    const uint8_t *data;
+    uint16_t       offset;
+
+    instance = static_cast<Instance *>(testInitInstance());
+    VerifyOrQuit(instance != nullptr, "Null OpenThread instance\n");
+
+    messagePool = &instance->Get<MessagePool>();
+
+    Random::NonCrypto::FillBuffer(datagram, sizeof(datagram));
+
+    VerifyOrQuit((message = messagePool->New(Message::kTypeIp6, kReserved)) != nullptr, "Message::New failed");
+    SuccessOrQuit(message->SetLength(kDatagramLength), "Message::SetLength failed");
+    message->WriteBytes(0, datagram, kDatagramLength);
+
+    // A range in the first buffer is always contiguous, and a range
+    // past the end of the message never is.
+
+    data = message->GetContiguous(0, sizeof(Header));
+    VerifyOrQuit(data != nullptr, "Message::GetContiguous failed for the first buffer");
+    VerifyOrQuit(memcmp(data, datagram, sizeof(Header)) == 0, "Message::GetContiguous returned wrong data");
+    VerifyOrQuit(message->GetContiguous(kDatagramLength - 1, 2) == nullptr, "Message::GetContiguous past the end");
+    VerifyOrQuit(message->GetContiguous(kDatagramLength, 1) == nullptr, "Message::GetContiguous past the end");
+
+    // Every range of a message that fits in one buffer is contiguous,
+    // otherwise a range crossing buffers is read into the copy.
+
+    for (offset = 0; offset + sizeof(Header) <= kDatagramLength; offset++)
+    {
+        header = message->GetContiguous(offset, headerCopy);
+        VerifyOrQuit(header != nullptr, "Message::GetContiguous failed");
+        VerifyOrQuit(memcmp(header->mBytes, datagram + offset, sizeof(Header)) == 0,
+                     "Message::GetContiguous returned wrong data");
+
+        data = message->GetContiguous(offset, sizeof(Header));
+        VerifyOrQuit((data != nullptr) == (header != &headerCopy), "Message::GetContiguous is inconsistent");
+        VerifyOrQuit(message->GetBufferCount() > 1 || data != nullptr, "Message::GetContiguous failed");
+    }
+
+    VerifyOrQuit(message->GetContiguous(kDatagramLength - 1, headerCopy) == nullptr,
+                 "Message::GetContiguous past the end");
+
+    message->Free();
+
+    testFreeInstance(instance);
+}
+
 } // namespace ot
 
 int main(void)
 {
     ot::TestMessage();
+    ot::TestMessageBufferBatches();
+    ot::TestMessageContiguous();
     printf("All tests passed\n");
     return 0;
 }
@@ -30,6 +30,8 @@
 
 #include "common/code_utils.hpp"
 #include "common/instance.hpp"
+#include "thread/mle_tlvs.hpp"
+#include "thread/network_data_leader.hpp"
 #include "thread/network_data_local.hpp"
 
 #include "test_platform.h"
@@ -172,12 +174,234 @@ void TestNetworkDataIterator(void)
     testFreeInstance(instance);
 }
 
+// Builds Network Data TLVs, adding the sub-TLVs to the last Prefix TLV.
+class NetworkDataBuilder
+{
+public:
+    NetworkDataBuilder(void)
+        : mLength(0)
+        , mPrefixTlv(nullptr)
+    {
+    }
+
+    void AddPrefix(uint8_t aDomainId, const char *aPrefix, uint8_t aPrefixLength)
+    {
+        Ip6::Address prefix;
+
+        SuccessOrQuit(prefix.FromString(aPrefix), "Address::FromString() failed");
+
+        mPrefixTlv = reinterpret_cast<PrefixTlv *>(Reserve(sizeof(PrefixTlv)));
+        mPrefixTlv->Init(aDomainId, aPrefixLength, prefix.mFields.m8);
+        mPrefixTlv->SetStable();
+        memcpy(Reserve(Ip6::Prefix::SizeForLength(aPrefixLength)), prefix.mFields.m8,
+               Ip6::Prefix::SizeForLength(aPrefixLength));
+    }
+
+    void AddContext(uint8_t aContextId, bool aCompress)
+    {
+        ContextTlv *context = reinterpret_cast<ContextTlv *>(ReserveSubTlv(sizeof(ContextTlv)));
+
+        context->Init(aContextId, mPrefixTlv->GetPrefixLength());
+        context->SetStable();
+
+        if (aCompress)
+        {
+            context->SetCompress();
+        }
+    }
+
+    void AddExternalRoutes(const uint16_t *aRloc16s, uint8_t aCount, int8_t aPreference)
+    {
+        HasRouteTlv *hasRoute = reinterpret_cast<HasRouteTlv *>(ReserveSubTlv(sizeof(HasRouteTlv)));
+
+        hasRoute->Init();
+        hasRoute->SetStable();
+
+        for (uint8_t i = 0; i < aCount; i++)
+        {
+            HasRouteEntry *entry = reinterpret_cast<HasRouteEntry *>(ReserveSubTlv(sizeof(HasRouteEntry)));
+
+            entry->Init();
+            entry->SetRloc(aRloc16s[i]);
+            entry->SetPreference(aPreference);
+            hasRoute->IncreaseLength(sizeof(HasRouteEntry));
+        }
+    }
+
+    void AddBorderRouters(const uint16_t *aRloc16s, uint8_t aCount, int8_t aPreference, uint16_t aFlags)
+    {
+        BorderRouterTlv *borderRouter = reinterpret_cast<BorderRouterTlv *>(ReserveSubTlv(sizeof(BorderRouterTlv)));
+
+        borderRouter->Init();
+        borderRouter->SetStable();
+
+        for (uint8_t i = 0; i < aCount; i++)
+        {
+            BorderRouterEntry *entry = reinterpret_cast<BorderRouterEntry *>(ReserveSubTlv(sizeof(BorderRouterEntry)));
+
+            entry->Init();
+            entry->SetRloc(aRloc16s[i]);
+            entry->SetFlags(aFlags);
+            entry->SetPreference(aPreference);
+            borderRouter->IncreaseLength(sizeof(BorderRouterEntry));
+        }
+    }
+
+    // Sets the Network Data of the Leader (as received from the Leader).
+    void SetLeaderNetworkData(Instance &aInstance, uint8_t aVersion)
+    {
+        Message *message = aInstance.Get<MessagePool>().New(Message::kTypeOther, 0);
+        Mle::Tlv tlv;
+
+        VerifyOrQuit(message != nullptr, "MessagePool::New() failed");
+
+        tlv.SetType(Mle::Tlv::kNetworkData);
+        tlv.SetLength(mLength);
+        SuccessOrQuit(message->Append(tlv), "Message::Append() failed");
+        SuccessOrQuit(message->AppendBytes(mTlvs, mLength), "Message::AppendBytes() failed");
+
+        SuccessOrQuit(aInstance.Get<Leader>().SetNetworkData(aVersion, aVersion, false, *message, 0),
+                      "SetNetworkData() failed");
+        message->Free();
+    }
+
+private:
+    uint8_t *Reserve(uint8_t aLength)
+    {
+        uint8_t *start = &mTlvs[mLength];
+
+        VerifyOrQuit(mLength + aLength <= sizeof(mTlvs), "Network Data is too large");
+        mLength += aLength;
+
+        return start;
+    }
+
+    uint8_t *ReserveSubTlv(uint8_t aLength)
+    {
+        mPrefixTlv->IncreaseLength(aLength);
+
+        return Reserve(aLength);
+    }
+
+    uint8_t    mTlvs[NetworkData::kMaxSize];
+    uint8_t    mLength;
+    PrefixTlv *mPrefixTlv;
+};
+
+Ip6::Address ParseAddress(const char *aString)
+{
+    Ip6::Address address;
+
+    SuccessOrQuit(address.FromString(aString), "Address::FromString() failed");
+
+    return address;
+}
+
+void VerifyContext(Instance &aInstance, const char *aAddress, otError aError, uint8_t aContextId, uint8_t aLength)
+{
+    Lowpan::Context context;
+
+    VerifyOrQuit(aInstance.Get<Leader>().GetContext(ParseAddress(aAddress), context) == aError,
+                 "GetContext() returned an unexpected error");
+    VerifyOrQuit(aError != OT_ERROR_NONE ||
+                     (context.mContextId == aContextId && context.mPrefix.GetLength() == aLength &&
+                      ParseAddress(aAddress).MatchesPrefix(context.mPrefix)),
+                 "GetContext() returned an unexpected context");
+}
+
+void VerifyRoute(Instance &  aInstance,
+                 const char *aSource,
+                 const char *aDestination,
+                 otError     aError,
+                 uint16_t    aRloc16,
+                 uint8_t     aPrefixMatchLength)
+{
+    uint16_t rloc16            = Mac::kShortAddrInvalid;
+    uint8_t  prefixMatchLength = 0xff;
+
+    VerifyOrQuit(aInstance.Get<Leader>().RouteLookup(ParseAddress(aSource), ParseAddress(aDestination),
+                                                     &prefixMatchLength, &rloc16) == aError,
+                 "RouteLookup() returned an unexpected error");
+    VerifyOrQuit(aError != OT_ERROR_NONE || (rloc16 == aRloc16 && prefixMatchLength == aPrefixMatchLength),
+                 "RouteLookup() returned an unexpected route");
+}
+
+void TestNetworkDataLookups(void)
+{
+    const uint16_t kOnMeshBorderRouters[] = {0x0400};
+    const uint16_t kBorderRouters[]       = {0x0800};
+    const uint16_t kShortRoutes[]         = {0x0c00};
+    const uint16_t kLongRoutes[]          = {0x1000};
+    const uint16_t kOtherDomainRoutes[]   = {0x1400};
+
+    Instance *         instance;
+    Lowpan::Context    context;
+    NetworkDataBuilder builder;
+
+    instance = static_cast<Instance *>(testInitInstance());
+    VerifyOrQuit(instance != nullptr, "Null OpenThread instance\n");
+
+    builder.AddPrefix(0, "fd00:1::", 64);
+    builder.AddContext(1, true);
+    builder.AddBorderRouters(kOnMeshBorderRouters, 1, 0,
+                             BorderRouterEntry::kOnMeshFlag | BorderRouterEntry::kDefaultRouteFlag);
+    builder.AddBorderRouters(kBorderRouters, 1, 1, BorderRouterEntry::kDefaultRouteFlag);
+    builder.AddPrefix(0, "fd00:1::", 48);
+    builder.AddContext(2, false);
+    builder.AddPrefix(0, "2000::", 16);
+    builder.AddExternalRoutes(kShortRoutes, 1, 0);
+    builder.AddPrefix(0, "2000:1::", 32);
+    builder.AddExternalRoutes(kLongRoutes, 1, 1);
+    builder.AddPrefix(1, "3000::", 16);
+    builder.AddExternalRoutes(kOtherDomainRoutes, 1, 0);
+    builder.SetLeaderNetworkData(*instance, 1);
+
+    printf("\nTest #3: Network data lookups");
+    printf("\n-------------------------------------------------");
+
+    VerifyContext(*instance, "fd00:1::1", OT_ERROR_NONE, 1, 64);
+    VerifyContext(*instance, "fd00:1:0:1::1", OT_ERROR_NONE, 2, 48);
+    VerifyContext(*instance, "fd01::1", OT_ERROR_NOT_FOUND, 0, 0);
+
+    SuccessOrQuit(instance->Get<Leader>().GetContext(1, context), "GetContext() failed");
+    VerifyOrQuit(context.mPrefix.GetLength() == 64 && context.mCompressFlag, "GetContext() returned a wrong context");
+    SuccessOrQuit(instance->Get<Leader>().GetContext(2, context), "GetContext() failed");
+    VerifyOrQuit(context.mPrefix.GetLength() == 48 && !context.mCompressFlag, "GetContext() returned a wrong context");
+    VerifyOrQuit(instance->Get<Leader>().GetContext(5, context) == OT_ERROR_NOT_FOUND, "GetContext() succeeded");
+
+    VerifyOrQuit(instance->Get<Leader>().IsOnMesh(ParseAddress("fd00:1::5")), "IsOnMesh() failed");
+    VerifyOrQuit(!instance->Get<Leader>().IsOnMesh(ParseAddress("fd00:1:0:1::1")), "IsOnMesh() failed");
+    VerifyOrQuit(!instance->Get<Leader>().IsOnMesh(ParseAddress("2000::1")), "IsOnMesh() failed");
+
+    // External routes are looked up first (the longer prefix also has
+    // the higher preference here), then the default route with the
+    // highest preference (for destinations in other domains).
+    VerifyRoute(*instance, "fd00:1::1", "2000:1::1", OT_ERROR_NONE, 0x1000, 32);
+    VerifyRoute(*instance, "fd00:1::1", "2000:2::1", OT_ERROR_NONE, 0x0c00, 16);
+    VerifyRoute(*instance, "fd00:1::1", "3000::1", OT_ERROR_NONE, 0x0800, 0);
+    VerifyRoute(*instance, "fd01::1", "2000::1", OT_ERROR_NO_ROUTE, 0, 0);
+
+    // New Network Data replaces all of the above.
+    builder = NetworkDataBuilder();
+    builder.AddPrefix(0, "fd00:1::", 64);
+    builder.AddContext(1, true);
+    builder.SetLeaderNetworkData(*instance, 2);
+
+    VerifyContext(*instance, "fd00:1:0:1::1", OT_ERROR_NOT_FOUND, 0, 0);
+    VerifyOrQuit(instance->Get<Leader>().GetContext(2, context) == OT_ERROR_NOT_FOUND, "GetContext() succeeded");
+    VerifyOrQuit(!instance->Get<Leader>().IsOnMesh(ParseAddress("fd00:1::5")), "IsOnMesh() failed");
+    VerifyRoute(*instance, "fd00:1::1", "2000:1::1", OT_ERROR_NO_ROUTE, 0, 0);
+
+    testFreeInstance(instance);
+}
+
 } // namespace NetworkData
 } // namespace ot
 
 int main(void)
 {
     ot::NetworkData::TestNetworkDataIterator();
+    ot::NetworkData::TestNetworkDataLookups();
 
     printf("\nAll tests passed\n");
     return 0;
@@ -0,0 +1,135 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "test_platform.h"
+
+#include <openthread/config.h>
+
+#include "common/code_utils.hpp"
+#include "common/debug.hpp"
+#include "common/pairing_heap.hpp"
+
+#include "test_util.h"
+
+struct Entry : public ot::PairingHeapEntry<Entry, uint32_t>
+{
+};
+
+typedef ot::PairingHeap<Entry, uint32_t> Heap;
+
+// This function removes all entries from the heap and verifies they come out in non-decreasing key order.
+void VerifyHeapOrder(Heap &aHeap, uint16_t aNumEntries)
+{
+    uint32_t lastKey = 0;
+    Entry *  entry;
+
+    while ((entry = aHeap.GetTop()) != nullptr)
+    {
+        VerifyOrQuit(aNumEntries > 0, "Heap contains more entries than expected");
+        VerifyOrQuit(aHeap.Contains(*entry), "PairingHeap::Contains() failed for the top entry");
+        VerifyOrQuit(entry->GetHeapKey() >= lastKey, "PairingHeap::GetTop() returned entries out of order");
+
+        lastKey = entry->GetHeapKey();
+        aHeap.Remove(*entry);
+        VerifyOrQuit(!aHeap.Contains(*entry), "PairingHeap::Contains() succeeded for a removed entry");
+        aNumEntries--;
+    }
+
+    VerifyOrQuit(aNumEntries == 0, "Heap contains fewer entries than expected");
+    VerifyOrQuit(aHeap.IsEmpty(), "PairingHeap::IsEmpty() failed");
+}
+
+void TestPairingHeap(void)
+{
+    enum : uint16_t
+    {
+        kNumEntries = 40,
+    };
+
+    Entry entries[kNumEntries];
+    Heap  heap;
+
+    VerifyOrQuit(heap.IsEmpty(), "PairingHeap::IsEmpty() failed after init");
+    VerifyOrQuit(heap.GetTop() == nullptr, "PairingHeap::GetTop() failed when empty");
+    VerifyOrQuit(!heap.Contains(entries[0]), "PairingHeap::Contains() succeeded when empty");
+
+    // Removing an entry which is not in the heap is ignored.
+    heap.Remove(entries[0]);
+    VerifyOrQuit(heap.IsEmpty(), "PairingHeap::Remove() failed for a missing entry");
+
+    // Add entries with keys in a scrambled order, including duplicate keys.
+
+    for (uint16_t i = 0; i < kNumEntries; i++)
+    {
+        heap.Update(entries[i], (i * 7919) % 23);
+        VerifyOrQuit(heap.Contains(entries[i]), "PairingHeap::Contains() failed after Update()");
+    }
+
+    VerifyOrQuit(!heap.IsEmpty(), "PairingHeap::IsEmpty() failed");
+    VerifyOrQuit(heap.GetTop()->GetHeapKey() == 0, "PairingHeap::GetTop() did not return the smallest key");
+    VerifyHeapOrder(heap, kNumEntries);
+
+    // Move entries up and down, and remove entries from the middle of the heap.
+
+    for (uint16_t i = 0; i < kNumEntries; i++)
+    {
+        heap.Update(entries[i], 1000 + i);
+    }
+
+    heap.Update(entries[kNumEntries - 1], 1);
+    VerifyOrQuit(heap.GetTop() == &entries[kNumEntries - 1], "PairingHeap::Update() failed to move an entry up");
+
+    heap.Update(entries[kNumEntries - 1], 5000);
+    VerifyOrQuit(heap.GetTop() == &entries[0], "PairingHeap::Update() failed to move an entry down");
+
+    for (uint16_t i = 1; i < kNumEntries; i += 2)
+    {
+        heap.Remove(entries[i]);
+        VerifyOrQuit(!heap.Contains(entries[i]), "PairingHeap::Contains() succeeded for a removed entry");
+    }
+
+    VerifyOrQuit(heap.GetTop() == &entries[0], "PairingHeap::Remove() changed the top entry");
+
+    heap.Remove(entries[0]);
+    VerifyOrQuit(heap.GetTop() == &entries[2], "PairingHeap::Remove() failed for the top entry");
+
+    VerifyHeapOrder(heap, kNumEntries / 2 - 1);
+
+    // Clear the heap.
+
+    heap.Update(entries[0], 10);
+    heap.Clear();
+    VerifyOrQuit(heap.IsEmpty(), "PairingHeap::IsEmpty() failed after Clear()");
+}
+
+int main(void)
+{
+    TestPairingHeap();
+    printf("All tests passed\n");
+    return 0;
+}
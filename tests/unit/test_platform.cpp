@@ -54,7 +54,9 @@ enum
     FLASH_SWAP_NUM  = 2,
 };
 
-uint8_t g_flash[FLASH_SWAP_SIZE * FLASH_SWAP_NUM];
+uint8_t  g_flash[FLASH_SWAP_SIZE * FLASH_SWAP_NUM];
+uint32_t g_testPlatFlashReadCount    = 0;
+bool     g_testPlatFlashRetainOnInit = false;
 
 ot::Instance *testInitInstance(void)
 {
@@ -543,7 +545,10 @@ void otPlatFlashInit(otInstance *aInstance)
 {
     OT_UNUSED_VARIABLE(aInstance);
 
-    memset(g_flash, 0xff, sizeof(g_flash));
+    if (!g_testPlatFlashRetainOnInit)
+    {
+        memset(g_flash, 0xff, sizeof(g_flash));
+    }
 }
 
 uint32_t otPlatFlashGetSwapSize(otInstance *aInstance)
@@ -579,6 +584,7 @@ void otPlatFlashRead(otInstance *aInstance, uint8_t aSwapIndex, uint32_t aOffset
     address = aSwapIndex ? FLASH_SWAP_SIZE : 0;
 
     memcpy(aData, g_flash + address + aOffset, aSize);
+    g_testPlatFlashReadCount++;
 }
 
 void otPlatFlashWrite(otInstance *aInstance, uint8_t aSwapIndex, uint32_t aOffset, const void *aData, uint32_t aSize)
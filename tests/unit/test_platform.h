@@ -83,6 +83,13 @@ extern testPlatRadioReceive            g_testPlatRadioReceive;
 extern testPlatRadioTransmit           g_testPlatRadioTransmit;
 extern testPlatRadioGetTransmitBuffer  g_testPlatRadioGetTransmitBuffer;
 
+//
+// Flash Platform
+//
+
+extern uint32_t g_testPlatFlashReadCount;
+extern bool     g_testPlatFlashRetainOnInit;
+
 ot::Instance *testInitInstance(void);
 void          testFreeInstance(otInstance *aInstance);
 
@@ -31,6 +31,7 @@
 #include "common/debug.hpp"
 #include "common/instance.hpp"
 #include "common/message.hpp"
+#include "common/random.hpp"
 
 #include "test_platform.h"
 #include "test_util.h"
@@ -38,6 +39,8 @@
 #define kNumNewPriorityTestMessages 2
 #define kNumSetPriorityTestMessages 2
 #define kNumTestMessages (kNumNewPriorityTestMessages + kNumSetPriorityTestMessages)
+#define kNumEvictionTestFillers 512
+#define kNumIndirectTestMessages 512
 
 // This function verifies the content of the priority queue to match the passed in messages
 void VerifyPriorityQueueContent(ot::PriorityQueue &aPriorityQueue, int aExpectedLength, ...)
@@ -306,9 +309,546 @@ void TestPriorityQueue(void)
     testFreeInstance(instance);
 }
 
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_SEND_QUEUE_INDEX_ENABLE
+
+enum
+{
+    kNumIndexTestMessages   = 40, // Bounded by the message pool size of the test configuration.
+    kNumIndexTestChildren   = 8,
+    kNumIndexTestIterations = 5000,
+    kNotIndexed             = -1,
+};
+
+// This function verifies that an index list contains exactly the queued messages expected to be in it, in the same
+// order as they are in the queue.
+void VerifyIndexListContent(const ot::PriorityQueue &   aQueue,
+                            const ot::MessageIndexList &aList,
+                            ot::MessageIndexType        aType,
+                            ot::Message *               aMessages[],
+                            const int                   aListIds[],
+                            int                         aListId)
+{
+    ot::Message *indexed = aList.GetHead();
+    int          length  = 0;
+
+    for (ot::Message *message = aQueue.GetHead(); message != nullptr; message = message->GetNext())
+    {
+        int i;
+
+        for (i = 0; (i < kNumIndexTestMessages) && (aMessages[i] != message); i++)
+        {
+        }
+
+        VerifyOrQuit(i < kNumIndexTestMessages, "Queue contains an unknown message");
+
+        if (aListIds[i] != aListId)
+        {
+            continue;
+        }
+
+        VerifyOrQuit(indexed == message, "Index list does not match the queue");
+        VerifyOrQuit(message->GetIndexList(aType) == &aList, "GetIndexList() failed");
+
+        indexed = indexed->GetNextInIndex(aType);
+        length++;
+    }
+
+    VerifyOrQuit(indexed == nullptr, "Index list contains an unexpected message");
+    VerifyOrQuit(aList.IsEmpty() == (length == 0), "IsEmpty() failed");
+}
+
+void TestMessageIndexList(void)
+{
+    ot::Instance *       instance;
+    ot::MessagePool *    messagePool;
+    ot::PriorityQueue    queue;
+    ot::MessageIndexList directList;
+    ot::MessageIndexList childLists[kNumIndexTestChildren];
+    ot::Message *        messages[kNumIndexTestMessages];
+    int                  directIds[kNumIndexTestMessages];
+    int                  childIds[kNumIndexTestMessages];
+    int                  evictIds[kNumIndexTestMessages];
+
+    instance = testInitInstance();
+    VerifyOrQuit(instance != nullptr, "Null OpenThread instance");
+
+    messagePool = &instance->Get<ot::MessagePool>();
+
+    for (int i = 0; i < kNumIndexTestMessages; i++)
+    {
+        messages[i]  = nullptr;
+        directIds[i] = kNotIndexed;
+        childIds[i]  = kNotIndexed;
+        evictIds[i]  = kNotIndexed;
+    }
+
+    // Randomly add, remove, re-prioritize and (un)index messages
+    // while verifying that each index list mirrors the queue.
+
+    for (int iter = 0; iter < kNumIndexTestIterations; iter++)
+    {
+        int          i       = ot::Random::NonCrypto::GetUint8() % kNumIndexTestMessages;
+        ot::Message *message = messages[i];
+
+        if (message == nullptr)
+        {
+            message = messagePool->New(ot::Message::kTypeIp6, 0,
+                                       static_cast<ot::Message::Priority>(ot::Random::NonCrypto::GetUint8() %
+                                                                          ot::Message::kNumPriorities));
+            // The message pool may be smaller than the number of test
+            // messages (e.g. with the heap), so a failed allocation
+            // only skips this step.
+            if (message == nullptr)
+            {
+                continue;
+            }
+
+            messages[i] = message;
+            queue.Enqueue(*message);
+        }
+
+        switch (ot::Random::NonCrypto::GetUint8() % 6)
+        {
+        case 0:
+            if (directIds[i] == kNotIndexed)
+            {
+                directList.Add(*message, ot::kMessageIndexDirect);
+                directIds[i] = 0;
+            }
+            else
+            {
+                directList.Remove(*message, ot::kMessageIndexDirect);
+                directIds[i] = kNotIndexed;
+            }
+            break;
+
+        case 1:
+            if (childIds[i] != kNotIndexed)
+            {
+                childLists[childIds[i]].Remove(*message, ot::kMessageIndexIndirect);
+            }
+
+            childIds[i] = ot::Random::NonCrypto::GetUint8() % kNumIndexTestChildren;
+            childLists[childIds[i]].Add(*message, ot::kMessageIndexIndirect);
+            break;
+
+        case 2:
+        {
+            uint8_t priority = ot::Random::NonCrypto::GetUint8() % ot::Message::kNumPriorities;
+
+            SuccessOrQuit(message->SetPriority(static_cast<ot::Message::Priority>(priority)),
+                          "Message::SetPriority failed");
+
+            // An indexed message moves to the eviction list of its new priority.
+            if (evictIds[i] != kNotIndexed)
+            {
+                evictIds[i] = priority;
+            }
+
+            break;
+        }
+
+        case 3:
+            if (directIds[i] != kNotIndexed)
+            {
+                directList.Remove(*message, ot::kMessageIndexDirect);
+                directIds[i] = kNotIndexed;
+            }
+
+            if (childIds[i] != kNotIndexed)
+            {
+                childLists[childIds[i]].Remove(*message, ot::kMessageIndexIndirect);
+                childIds[i] = kNotIndexed;
+            }
+
+            if (evictIds[i] != kNotIndexed)
+            {
+                queue.GetEvictionIndex(message->GetPriority()).Remove(*message, ot::kMessageIndexEvict);
+                evictIds[i] = kNotIndexed;
+            }
+
+            queue.Dequeue(*message);
+            message->Free();
+            messages[i] = nullptr;
+            break;
+
+        case 4:
+            if (evictIds[i] == kNotIndexed)
+            {
+                queue.GetEvictionIndex(message->GetPriority()).Add(*message, ot::kMessageIndexEvict);
+                evictIds[i] = message->GetPriority();
+            }
+            else
+            {
+                queue.GetEvictionIndex(message->GetPriority()).Remove(*message, ot::kMessageIndexEvict);
+                evictIds[i] = kNotIndexed;
+            }
+            break;
+
+        default:
+            break;
+        }
+
+        VerifyIndexListContent(queue, directList, ot::kMessageIndexDirect, messages, directIds, 0);
+
+        for (int child = 0; child < kNumIndexTestChildren; child++)
+        {
+            VerifyIndexListContent(queue, childLists[child], ot::kMessageIndexIndirect, messages, childIds, child);
+        }
+
+        for (uint8_t priority = 0; priority < ot::Message::kNumPriorities; priority++)
+        {
+            VerifyIndexListContent(queue, queue.GetEvictionIndex(static_cast<ot::Message::Priority>(priority)),
+                                   ot::kMessageIndexEvict, messages, evictIds, priority);
+        }
+    }
+
+    for (int i = 0; i < kNumIndexTestMessages; i++)
+    {
+        if (messages[i] == nullptr)
+        {
+            continue;
+        }
+
+        if (directIds[i] != kNotIndexed)
+        {
+            directList.Remove(*messages[i], ot::kMessageIndexDirect);
+        }
+
+        if (childIds[i] != kNotIndexed)
+        {
+            childLists[childIds[i]].Remove(*messages[i], ot::kMessageIndexIndirect);
+        }
+
+        if (evictIds[i] != kNotIndexed)
+        {
+            queue.GetEvictionIndex(messages[i]->GetPriority()).Remove(*messages[i], ot::kMessageIndexEvict);
+        }
+
+        queue.Dequeue(*messages[i]);
+        messages[i]->Free();
+    }
+
+    VerifyOrQuit(directList.IsEmpty(), "Direct index list is not empty");
+
+    for (ot::MessageIndexList &list : childLists)
+    {
+        VerifyOrQuit(list.IsEmpty(), "Child index list is not empty");
+    }
+
+    for (uint8_t priority = 0; priority < ot::Message::kNumPriorities; priority++)
+    {
+        VerifyOrQuit(queue.GetEvictionIndex(static_cast<ot::Message::Priority>(priority)).IsEmpty(),
+                     "Eviction index list is not empty");
+    }
+
+    testFreeInstance(instance);
+}
+
+#endif // OPENTHREAD_CONFIG_MESH_FORWARDER_SEND_QUEUE_INDEX_ENABLE
+
+#if OPENTHREAD_FTD
+
+namespace ot {
+
+class IndirectSenderTester
+{
+public:
+    static Message *GetIndirectMessage(Child &aChild) { return aChild.GetIndirectMessage(); }
+};
+
+} // namespace ot
+
+ot::Message *NewIp6Message(ot::MessagePool &       aMessagePool,
+                           ot::Message::Priority  aPriority,
+                           const ot::Ip6::Address &aDestination)
+{
+    ot::Message *   message = aMessagePool.New(ot::Message::kTypeIp6, 0, aPriority);
+    ot::Ip6::Header header;
+
+    VerifyOrQuit(message != nullptr, "Message::New failed");
+
+    memset(&header, 0, sizeof(header));
+    header.Init();
+    header.SetDestination(aDestination);
+    SuccessOrQuit(message->Append(header), "Message::Append failed");
+
+    return message;
+}
+
+void TestMessageEviction(void)
+{
+    ot::Instance *                  instance;
+    ot::MessagePool *               messagePool;
+    ot::MeshForwarder *             meshForwarder;
+    ot::Child *                     child;
+    ot::Mac::ExtAddress             extAddress;
+    ot::Ip6::Address                childAddress;
+    ot::Ip6::Address                otherAddress;
+    ot::Message *                   fillers[kNumEvictionTestFillers];
+    ot::Message *                   direct;
+    ot::Message *                   indirectLow;
+    ot::Message *                   indirectNormal;
+    ot::Message *                   message;
+    uint16_t                        numFillers = 0;
+    const otMessageEvictionCounters *counters;
+
+    instance = testInitInstance();
+    VerifyOrQuit(instance != nullptr, "Null OpenThread instance");
+
+    messagePool   = &instance->Get<ot::MessagePool>();
+    meshForwarder = &instance->Get<ot::MeshForwarder>();
+    counters      = &meshForwarder->GetEvictionCounters();
+
+    // Add a sleepy child to queue indirect messages for.
+
+    child = instance->Get<ot::ChildTable>().GetNewChild();
+    VerifyOrQuit(child != nullptr, "GetNewChild failed");
+
+    extAddress.GenerateRandom();
+    child->SetExtAddress(extAddress);
+    child->SetDeviceMode(ot::Mle::DeviceMode(0));
+    child->SetState(ot::Neighbor::kStateValid);
+
+    childAddress.SetToLinkLocalAddress(extAddress);
+    SuccessOrQuit(otherAddress.FromString("fd00::1234"), "Address::FromString failed");
+
+    // Use up all the buffers but three with messages that are not
+    // queued. Nothing can be evicted meanwhile.
+
+    while ((fillers[numFillers] = messagePool->New(ot::Message::kTypeIp6, 0)) != nullptr)
+    {
+        numFillers++;
+        VerifyOrQuit(numFillers < kNumEvictionTestFillers, "Too many buffers for the eviction test");
+    }
+
+    VerifyOrQuit(counters->mNotFound == 1, "Eviction not found counter is incorrect");
+    VerifyOrQuit(numFillers > 3, "Too few buffers for the eviction test");
+
+    for (int i = 0; i < 3; i++)
+    {
+        fillers[--numFillers]->Free();
+    }
+
+    meshForwarder->ResetEvictionCounters();
+
+    // Queue a low priority direct message, a low priority message for
+    // the sleepy child and a normal priority message for the child.
+
+    direct         = NewIp6Message(*messagePool, ot::Message::kPriorityLow, otherAddress);
+    indirectLow    = NewIp6Message(*messagePool, ot::Message::kPriorityLow, childAddress);
+    indirectNormal = NewIp6Message(*messagePool, ot::Message::kPriorityNormal, childAddress);
+
+    SuccessOrQuit(meshForwarder->SendMessage(*direct), "SendMessage failed");
+    SuccessOrQuit(meshForwarder->SendMessage(*indirectLow), "SendMessage failed");
+    SuccessOrQuit(meshForwarder->SendMessage(*indirectNormal), "SendMessage failed");
+
+    VerifyOrQuit(direct->GetDirectTransmission() && !direct->IsChildPending(), "Direct message is not direct");
+    VerifyOrQuit(indirectLow->IsChildPending(), "Indirect message is not pending for the child");
+    VerifyOrQuit(indirectNormal->IsChildPending(), "Indirect message is not pending for the child");
+
+    // High priority messages evict the low priority messages first,
+    // oldest first.
+
+    for (int i = 0; i < 2; i++)
+    {
+        message = messagePool->New(ot::Message::kTypeIp6, 0, ot::Message::kPriorityHigh);
+        VerifyOrQuit(message != nullptr, "Message::New with eviction failed");
+        VerifyOrQuit(counters->mLowerPriority[ot::Message::kPriorityLow] == static_cast<uint32_t>(i + 1),
+                     "Lower priority eviction counter is incorrect");
+        fillers[numFillers++] = message;
+
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_EVICTION_POLICY == OPENTHREAD_CONFIG_MESH_FORWARDER_EVICTION_POLICY_OLDEST
+        VerifyOrQuit(meshForwarder->GetSendQueue().GetTail() == ((i == 0) ? indirectLow : indirectNormal),
+                     "Evicted message is not the oldest one");
+#endif
+    }
+
+    // A low priority message can only evict the message pending
+    // indirect transmission.
+
+    message = messagePool->New(ot::Message::kTypeIp6, 0, ot::Message::kPriorityLow);
+    VerifyOrQuit(message != nullptr, "Message::New with eviction failed");
+    VerifyOrQuit(counters->mPendingIndirect[ot::Message::kPriorityNormal] == 1,
+                 "Pending indirect eviction counter is incorrect");
+    VerifyOrQuit(meshForwarder->GetSendQueue().GetHead() == nullptr, "Send queue is not empty");
+    VerifyOrQuit(child->GetIndirectMessageCount() == 0, "Child indirect message count is incorrect");
+    fillers[numFillers++] = message;
+
+    VerifyOrQuit(messagePool->New(ot::Message::kTypeIp6, 0, ot::Message::kPriorityNet) == nullptr,
+                 "Message::New did not fail");
+    VerifyOrQuit(counters->mNotFound == 1, "Eviction not found counter is incorrect");
+
+    for (uint16_t i = 0; i < numFillers; i++)
+    {
+        fillers[i]->Free();
+    }
+
+    testFreeInstance(instance);
+}
+
+
+// This function verifies that the indirect message selected for each child is the first message in the send queue
+// pending for the child, and that the child's indirect message count matches the send queue.
+void VerifyIndirectMessages(ot::Instance &aInstance)
+{
+    const ot::PriorityQueue &sendQueue = aInstance.Get<ot::MeshForwarder>().GetSendQueue();
+
+    for (ot::Child &child : aInstance.Get<ot::ChildTable>().Iterate(ot::Child::kInStateValid))
+    {
+        uint16_t     childIndex = aInstance.Get<ot::ChildTable>().GetChildIndex(child);
+        ot::Message *expected   = nullptr;
+        uint16_t     count      = 0;
+
+        for (ot::Message *message = sendQueue.GetHead(); message != nullptr; message = message->GetNext())
+        {
+            VerifyOrQuit(message->IsChildPending() || message->GetDirectTransmission(),
+                         "Send queue contains a message that is neither direct nor pending");
+
+            if (message->GetChildMask(childIndex))
+            {
+                expected = (expected == nullptr) ? message : expected;
+                count++;
+            }
+        }
+
+        VerifyOrQuit(ot::IndirectSenderTester::GetIndirectMessage(child) == expected,
+                     "Indirect message of the child is incorrect");
+        VerifyOrQuit(child.GetIndirectMessageCount() == count, "Indirect message count of the child is incorrect");
+    }
+}
+
+void TestIndirectMessageLookup(void)
+{
+    ot::Instance *      instance;
+    ot::MessagePool *   messagePool;
+    ot::MeshForwarder * meshForwarder;
+    ot::IndirectSender *indirectSender;
+    ot::Child *         children[ot::Mle::kMaxChildren];
+    ot::Child *         rxOnChild;
+    ot::Ip6::Address    addresses[ot::Mle::kMaxChildren];
+    ot::Message *       messages[kNumIndirectTestMessages];
+    ot::Mac::ExtAddress extAddress;
+    uint16_t            numChildren = 0;
+    uint16_t            numMessages = 0;
+    uint16_t            freeBuffers;
+
+    instance = testInitInstance();
+    VerifyOrQuit(instance != nullptr, "Null OpenThread instance");
+
+    messagePool    = &instance->Get<ot::MessagePool>();
+    meshForwarder  = &instance->Get<ot::MeshForwarder>();
+    indirectSender = &instance->Get<ot::IndirectSender>();
+    freeBuffers    = messagePool->GetFreeBufferCount();
+
+    // Fill the child table. The first child is rx-on-when-idle and
+    // receives direct messages, the others are sleepy.
+
+    while ((children[numChildren] = instance->Get<ot::ChildTable>().GetNewChild()) != nullptr)
+    {
+        ot::Child *child = children[numChildren];
+
+        extAddress.GenerateRandom();
+        child->SetExtAddress(extAddress);
+        child->SetDeviceMode(ot::Mle::DeviceMode((numChildren == 0) ? ot::Mle::DeviceMode::kModeRxOnWhenIdle : 0));
+        child->SetState(ot::Neighbor::kStateValid);
+        addresses[numChildren].SetToLinkLocalAddress(extAddress);
+        numChildren++;
+    }
+
+    VerifyOrQuit(numChildren > 2, "Too few children for the indirect message test");
+    rxOnChild = children[0];
+
+    // Queue messages of random priorities to the children until the
+    // message pool is exhausted. Every third message queued to a
+    // sleepy child is also pending for the next sleepy child.
+
+    while (numMessages < kNumIndirectTestMessages)
+    {
+        uint16_t        index = numMessages % numChildren;
+        ot::Message *   message;
+        ot::Ip6::Header header;
+
+        message = messagePool->New(
+            ot::Message::kTypeIp6, 0,
+            static_cast<ot::Message::Priority>(ot::Random::NonCrypto::GetUint8() % ot::Message::kNumPriorities));
+
+        if (message == nullptr)
+        {
+            break;
+        }
+
+        memset(&header, 0, sizeof(header));
+        header.Init();
+        header.SetDestination(addresses[index]);
+
+        if (message->Append(header) != OT_ERROR_NONE)
+        {
+            message->Free();
+            break;
+        }
+
+        message->SetDoNotEvict(true);
+        SuccessOrQuit(meshForwarder->SendMessage(*message), "SendMessage failed");
+
+        if ((index != 0) && (numMessages % 3 == 0))
+        {
+            indirectSender->AddMessageForSleepyChild(*message, *children[(index % (numChildren - 1)) + 1]);
+        }
+
+        messages[numMessages++] = message;
+    }
+
+    VerifyOrQuit(numMessages > numChildren, "Too few messages for the indirect message test");
+    printf("Indirect message lookup with %u messages and %u children\n", numMessages, numChildren);
+    VerifyIndirectMessages(*instance);
+
+    // Remove the shared messages from one of their children.
+
+    for (uint16_t i = 0; i < numMessages; i++)
+    {
+        uint16_t index = i % numChildren;
+
+        if ((index != 0) && (i % 3 == 0))
+        {
+            ot::Child &child = *children[(index % (numChildren - 1)) + 1];
+
+            SuccessOrQuit(indirectSender->RemoveMessageFromSleepyChild(*messages[i], child),
+                          "RemoveMessageFromSleepyChild failed");
+            VerifyOrQuit(messages[i]->IsChildPending(), "Shared message is no longer pending");
+            VerifyIndirectMessages(*instance);
+        }
+    }
+
+    // Remove the messages of each child in turn, including the direct
+    // messages to the rx-on-when-idle child.
+
+    for (uint16_t i = 0; i < numChildren; i++)
+    {
+        meshForwarder->RemoveMessages(*children[i], ot::Message::kSubTypeNone);
+        VerifyOrQuit(ot::IndirectSenderTester::GetIndirectMessage(*children[i]) == nullptr,
+                     "Indirect message of the child is not cleared");
+        VerifyIndirectMessages(*instance);
+    }
+
+    VerifyOrQuit(rxOnChild->IsRxOnWhenIdle(), "Child mode changed");
+    VerifyOrQuit(meshForwarder->GetSendQueue().GetHead() == nullptr, "Send queue is not empty");
+    VerifyOrQuit(messagePool->GetFreeBufferCount() == freeBuffers, "Messages were not freed");
+
+    testFreeInstance(instance);
+}
+#endif // OPENTHREAD_FTD
+
 int main(void)
 {
     TestPriorityQueue();
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_SEND_QUEUE_INDEX_ENABLE
+    TestMessageIndexList();
+#endif
+#if OPENTHREAD_FTD
+    TestMessageEviction();
+    TestIndirectMessageLookup();
+#endif
     printf("All tests passed\n");
     return 0;
 }
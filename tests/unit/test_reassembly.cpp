@@ -0,0 +1,559 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <string.h>
+
+#include <openthread/config.h>
+#include <openthread/ip6.h>
+#include <openthread/thread.h>
+#include <openthread/thread_ftd.h>
+#include <openthread/udp.h>
+#include <openthread/platform/radio.h>
+
+#include "common/code_utils.hpp"
+#include "common/instance.hpp"
+#include "mac/mac.hpp"
+#include "mac/mac_frame.hpp"
+#include "net/ip6_address.hpp"
+#include "thread/lowpan.hpp"
+#include "thread/mesh_forwarder.hpp"
+
+#include "test_platform.h"
+#include "test_util.hpp"
+
+namespace ot {
+
+#if OPENTHREAD_FTD
+
+enum : uint16_t
+{
+    kMaxEntries          = OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_MAX_ENTRIES,
+    kMaxBuffersPerSource = OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_MAX_BUFFERS_PER_SOURCE,
+    kReassemblyTimeout   = OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_TIMEOUT, // in seconds
+    kUdpPort             = 49153,
+    kIp6HeaderSize       = 40,
+    kUdpHeaderSize       = 8,
+    kFirstFragmentSize   = kIp6HeaderSize + kUdpHeaderSize, // Uncompressed datagram bytes in a first fragment.
+    kNextFragmentSize    = 64,                              // Datagram bytes in a next fragment.
+    kSmallDatagramSize   = kFirstFragmentSize + 8,
+    kLargeDatagramSize   = kFirstFragmentSize + 4 * kNextFragmentSize,
+    kMaxDatagramSize     = kLargeDatagramSize,
+};
+
+enum : uint32_t
+{
+    // Time ticks happen every second (with a small jitter) from a random
+    // start. Waiting `kAgeInterval` ages a datagram by at least one tick,
+    // and by at most two, so it is still not timed out.
+    kAgeInterval = 1100,
+    kTimeStep    = 100,
+};
+
+static Instance *  sInstance;
+static otUdpSocket sSocket;
+static uint16_t    sNumReceived;
+static uint16_t    sLastReceivedTag;
+
+// The payload of a datagram starts with its tag, followed by a pattern
+// derived from the tag.
+uint8_t GetPayloadByte(uint16_t aTag, uint16_t aIndex)
+{
+    return (aIndex < sizeof(uint16_t)) ? static_cast<uint8_t>(aTag >> (aIndex == 0 ? 8 : 0))
+                                       : static_cast<uint8_t>(aTag + aIndex);
+}
+
+void HandleUdpReceive(void *, otMessage *aMessage, const otMessageInfo *)
+{
+    uint16_t offset = otMessageGetOffset(aMessage);
+    uint16_t length = otMessageGetLength(aMessage) - offset;
+    uint8_t  payload[kMaxDatagramSize];
+    uint16_t tag;
+
+    VerifyOrQuit(length >= sizeof(uint16_t), "received datagram is too short");
+    VerifyOrQuit(otMessageRead(aMessage, offset, payload, length) == length, "otMessageRead() failed");
+
+    tag = static_cast<uint16_t>((payload[0] << 8) | payload[1]);
+
+    for (uint16_t i = 0; i < length; i++)
+    {
+        VerifyOrQuit(payload[i] == GetPayloadByte(tag, i), "received datagram content does not match");
+    }
+
+    sNumReceived++;
+    sLastReceivedTag = tag;
+}
+
+void InitTest(void)
+{
+    otSockAddr sockAddr;
+
+    sInstance = testInitSimInstance(0);
+    testStartLeader();
+
+    // The fragments are received without link security.
+
+    memset(&sockAddr, 0, sizeof(sockAddr));
+    sockAddr.mPort = kUdpPort;
+
+    SuccessOrQuit(otIp6AddUnsecurePort(sInstance, kUdpPort), "otIp6AddUnsecurePort() failed");
+    SuccessOrQuit(otUdpOpen(sInstance, &sSocket, HandleUdpReceive, nullptr), "otUdpOpen() failed");
+    SuccessOrQuit(otUdpBind(sInstance, &sSocket, &sockAddr), "otUdpBind() failed");
+
+    sNumReceived     = 0;
+    sLastReceivedTag = 0;
+
+    otThreadResetReassemblyCounters(sInstance);
+}
+
+void FinalizeTest(void)
+{
+    SuccessOrQuit(otUdpClose(sInstance, &sSocket), "otUdpClose() failed");
+    testFreeSimInstance();
+}
+
+Mac::ExtAddress GetSourceExtAddress(uint16_t aSourceIndex)
+{
+    Mac::ExtAddress extAddress;
+
+    memset(&extAddress, 0, sizeof(extAddress));
+    extAddress.m8[0] = 0x12;
+    extAddress.m8[7] = static_cast<uint8_t>(aSourceIndex);
+
+    return extAddress;
+}
+
+void AddChecksumData(uint32_t &aSum, const uint8_t *aData, uint16_t aLength)
+{
+    for (uint16_t i = 0; i < aLength; i++)
+    {
+        aSum += (i & 1) ? aData[i] : static_cast<uint32_t>(aData[i] << 8);
+    }
+}
+
+// Builds an IPv6/UDP datagram of `aSize` bytes from a source to the
+// link-local address of the instance.
+void BuildDatagram(uint8_t *aDatagram, uint16_t aSourceIndex, uint16_t aTag, uint16_t aSize)
+{
+    Ip6::Address source;
+    Ip6::Address destination;
+    uint16_t     udpLength = aSize - kIp6HeaderSize;
+    uint8_t *    udp       = aDatagram + kIp6HeaderSize;
+    uint32_t     sum       = Ip6::kProtoUdp + udpLength;
+    uint16_t     checksum;
+
+    source.SetToLinkLocalAddress(GetSourceExtAddress(aSourceIndex));
+    destination.SetToLinkLocalAddress(sInstance->Get<Mac::Mac>().GetExtAddress());
+
+    memset(aDatagram, 0, kIp6HeaderSize);
+    aDatagram[0] = 0x60;
+    aDatagram[4] = static_cast<uint8_t>(udpLength >> 8);
+    aDatagram[5] = static_cast<uint8_t>(udpLength);
+    aDatagram[6] = Ip6::kProtoUdp;
+    aDatagram[7] = 64;
+    memcpy(&aDatagram[8], source.mFields.m8, sizeof(source));
+    memcpy(&aDatagram[24], destination.mFields.m8, sizeof(destination));
+
+    udp[0] = static_cast<uint8_t>(kUdpPort >> 8);
+    udp[1] = static_cast<uint8_t>(kUdpPort);
+    udp[2] = static_cast<uint8_t>(kUdpPort >> 8);
+    udp[3] = static_cast<uint8_t>(kUdpPort);
+    udp[4] = static_cast<uint8_t>(udpLength >> 8);
+    udp[5] = static_cast<uint8_t>(udpLength);
+    udp[6] = 0;
+    udp[7] = 0;
+
+    for (uint16_t i = 0; i < udpLength - kUdpHeaderSize; i++)
+    {
+        udp[kUdpHeaderSize + i] = GetPayloadByte(aTag, i);
+    }
+
+    AddChecksumData(sum, &aDatagram[8], 2 * sizeof(Ip6::Address));
+    AddChecksumData(sum, udp, udpLength);
+
+    while (sum >> 16)
+    {
+        sum = (sum & 0xffff) + (sum >> 16);
+    }
+
+    checksum = static_cast<uint16_t>(~sum);
+    checksum = (checksum == 0) ? 0xffff : checksum;
+
+    udp[6] = static_cast<uint8_t>(checksum >> 8);
+    udp[7] = static_cast<uint8_t>(checksum);
+}
+
+// Receives the fragment of a datagram starting at datagram offset
+// `aOffset`. A first fragment carries the IPv6 header (with all fields
+// inline) and the UDP header.
+void ReceiveFragment(uint16_t aSourceIndex, uint16_t aTag, uint16_t aSize, uint16_t aOffset)
+{
+    uint8_t                datagram[kMaxDatagramSize];
+    otRadioFrame           radioFrame;
+    uint8_t                psdu[OT_RADIO_FRAME_MAX_SIZE];
+    Mac::TxFrame &         frame = *static_cast<Mac::TxFrame *>(&radioFrame);
+    Lowpan::FragmentHeader fragmentHeader;
+    uint8_t *              cur;
+    uint16_t               length;
+
+    BuildDatagram(datagram, aSourceIndex, aTag, aSize);
+
+    memset(&radioFrame, 0, sizeof(radioFrame));
+    radioFrame.mPsdu    = psdu;
+    radioFrame.mChannel = sInstance->Get<Mac::Mac>().GetPanChannel();
+
+    frame.InitMacHeader(Mac::Frame::kFcfFrameData | Mac::Frame::kFcfPanidCompression |
+                            Mac::Frame::kFcfFrameVersion2006 | Mac::Frame::kFcfDstAddrShort |
+                            Mac::Frame::kFcfSrcAddrExt,
+                        Mac::Frame::kSecNone);
+    frame.SetSequence(static_cast<uint8_t>(aTag + aOffset));
+    frame.SetDstPanId(sInstance->Get<Mac::Mac>().GetPanId());
+    frame.SetDstAddr(sInstance->Get<Mac::Mac>().GetShortAddress());
+    frame.SetSrcAddr(GetSourceExtAddress(aSourceIndex));
+
+    cur = frame.GetPayload();
+
+    if (aOffset == 0)
+    {
+        fragmentHeader.InitFirstFragment(aSize, aTag);
+        cur += fragmentHeader.WriteTo(cur);
+
+        // LOWPAN_IPHC with traffic class and flow label elided, and the
+        // next header, hop limit and both addresses inline.
+
+        *cur++ = 0x78;
+        *cur++ = 0x00;
+        *cur++ = datagram[6];
+        *cur++ = datagram[7];
+        memcpy(cur, &datagram[8], 2 * sizeof(Ip6::Address));
+        cur += 2 * sizeof(Ip6::Address);
+
+        length = kUdpHeaderSize;
+        memcpy(cur, &datagram[kIp6HeaderSize], length);
+    }
+    else
+    {
+        fragmentHeader.Init(aSize, aTag, aOffset);
+        cur += fragmentHeader.WriteTo(cur);
+
+        length = OT_MIN(static_cast<uint16_t>(kNextFragmentSize), static_cast<uint16_t>(aSize - aOffset));
+        memcpy(cur, &datagram[aOffset], length);
+    }
+
+    frame.SetPayloadLength(static_cast<uint16_t>(cur + length - frame.GetPayload()));
+
+    memset(&radioFrame.mInfo, 0, sizeof(radioFrame.mInfo));
+    radioFrame.mInfo.mRxInfo.mRssi = -20;
+    radioFrame.mInfo.mRxInfo.mLqi  = 255;
+
+    otPlatRadioReceiveDone(sInstance, &radioFrame, OT_ERROR_NONE);
+    testProcessTasklets();
+}
+
+void ReceiveFirstFragment(uint16_t aSourceIndex, uint16_t aTag, uint16_t aSize)
+{
+    ReceiveFragment(aSourceIndex, aTag, aSize, 0);
+}
+
+void ReceiveNextFragments(uint16_t aSourceIndex, uint16_t aTag, uint16_t aSize)
+{
+    for (uint16_t offset = kFirstFragmentSize; offset < aSize; offset += kNextFragmentSize)
+    {
+        ReceiveFragment(aSourceIndex, aTag, aSize, offset);
+    }
+}
+
+uint16_t GetNumReassemblyMessages(void)
+{
+    uint16_t numMessages;
+    uint16_t numBuffers;
+
+    sInstance->Get<MeshForwarder>().GetReassemblyQueue().GetInfo(numMessages, numBuffers);
+
+    return numMessages;
+}
+
+uint16_t GetNumReassemblyBuffers(void)
+{
+    uint16_t numMessages;
+    uint16_t numBuffers;
+
+    sInstance->Get<MeshForwarder>().GetReassemblyQueue().GetInfo(numMessages, numBuffers);
+
+    return numBuffers;
+}
+
+const otReassemblyCounters &GetCounters(void)
+{
+    return *otThreadGetReassemblyCounters(sInstance);
+}
+
+// Verifies that the remaining fragments of a datagram are (or are not)
+// matched to its reassembly message, completing the datagram.
+void VerifyCompletes(uint16_t aSourceIndex, uint16_t aTag, uint16_t aSize, bool aShouldComplete)
+{
+    uint16_t numReceived = sNumReceived;
+
+    ReceiveNextFragments(aSourceIndex, aTag, aSize);
+
+    if (aShouldComplete)
+    {
+        VerifyOrQuit(sNumReceived == numReceived + 1, "datagram was not reassembled");
+        VerifyOrQuit(sLastReceivedTag == aTag, "a wrong datagram was reassembled");
+    }
+    else
+    {
+        VerifyOrQuit(sNumReceived == numReceived, "dropped datagram was reassembled");
+    }
+}
+
+void TestReassemblyLookup(void)
+{
+    enum : uint16_t
+    {
+        kNumSources = 3,
+        kNumTags    = 3,
+    };
+
+    InitTest();
+
+    printf("TestReassemblyLookup\n");
+
+    // Interleave datagrams from several sources which use the same tags
+    // and size. Each next fragment must be matched to the datagram of
+    // its own source and tag.
+
+    for (uint16_t tag = 1; tag <= kNumTags; tag++)
+    {
+        for (uint16_t source = 0; source < kNumSources; source++)
+        {
+            ReceiveFirstFragment(source, tag, kLargeDatagramSize);
+        }
+    }
+
+    VerifyOrQuit(GetNumReassemblyMessages() == kNumSources * kNumTags, "first fragments were not queued");
+
+    for (uint16_t offset = kFirstFragmentSize; offset < kLargeDatagramSize; offset += kNextFragmentSize)
+    {
+        for (uint16_t tag = kNumTags; tag >= 1; tag--)
+        {
+            for (uint16_t source = 0; source < kNumSources; source++)
+            {
+                ReceiveFragment(source, tag, kLargeDatagramSize, offset);
+            }
+        }
+    }
+
+    VerifyOrQuit(sNumReceived == kNumSources * kNumTags, "not all datagrams were reassembled");
+    VerifyOrQuit(GetNumReassemblyMessages() == 0, "reassembly queue is not empty");
+
+    // A datagram of a different size with the same source and tag is a
+    // different datagram.
+
+    ReceiveFirstFragment(0, 1, kLargeDatagramSize);
+    ReceiveFirstFragment(0, 1, kLargeDatagramSize - kNextFragmentSize);
+    VerifyOrQuit(GetNumReassemblyMessages() == 2, "first fragments were not queued");
+    VerifyCompletes(0, 1, kLargeDatagramSize - kNextFragmentSize, /* aShouldComplete */ true);
+    VerifyCompletes(0, 1, kLargeDatagramSize, /* aShouldComplete */ true);
+
+    VerifyOrQuit(GetCounters().mEvictions == 0, "unexpected reassembly eviction");
+    VerifyOrQuit(GetCounters().mDuplicates == 0, "unexpected duplicate fragment");
+    VerifyOrQuit(GetCounters().mTimeouts == 0, "unexpected reassembly timeout");
+
+    FinalizeTest();
+}
+
+void TestReassemblyDuplicates(void)
+{
+    InitTest();
+
+    printf("TestReassemblyDuplicates\n");
+
+    ReceiveFirstFragment(0, 1, kLargeDatagramSize);
+    ReceiveFragment(0, 1, kLargeDatagramSize, kFirstFragmentSize);
+
+    // A repeated first fragment and a repeated next fragment are both
+    // dropped, keeping the datagram being reassembled.
+
+    ReceiveFirstFragment(0, 1, kLargeDatagramSize);
+    VerifyOrQuit(GetCounters().mDuplicates == 1, "duplicate first fragment was not detected");
+
+    ReceiveFragment(0, 1, kLargeDatagramSize, kFirstFragmentSize);
+    VerifyOrQuit(GetCounters().mDuplicates == 2, "duplicate next fragment was not detected");
+
+    VerifyOrQuit(GetNumReassemblyMessages() == 1, "reassembly queue does not contain the datagram");
+
+    for (uint16_t offset = kFirstFragmentSize + kNextFragmentSize; offset < kLargeDatagramSize;
+         offset += kNextFragmentSize)
+    {
+        ReceiveFragment(0, 1, kLargeDatagramSize, offset);
+    }
+
+    VerifyOrQuit(sNumReceived == 1, "datagram was not reassembled");
+    VerifyOrQuit(GetNumReassemblyMessages() == 0, "reassembly queue is not empty");
+
+    FinalizeTest();
+}
+
+void TestReassemblyTimeout(void)
+{
+    InitTest();
+
+    printf("TestReassemblyTimeout\n");
+
+    ReceiveFirstFragment(0, 1, kLargeDatagramSize);
+    testAdvanceTime(kAgeInterval);
+    ReceiveFirstFragment(1, 1, kLargeDatagramSize);
+    VerifyOrQuit(GetNumReassemblyMessages() == 2, "first fragments were not queued");
+
+    // The older datagram times out first.
+
+    for (uint32_t duration = 0; GetCounters().mTimeouts == 0; duration += kTimeStep)
+    {
+        VerifyOrQuit(duration <= (kReassemblyTimeout + 1) * 1000, "reassembly did not time out");
+        testAdvanceTime(kTimeStep);
+    }
+
+    VerifyOrQuit(GetCounters().mTimeouts == 1, "both datagrams timed out");
+    VerifyOrQuit(GetNumReassemblyMessages() == 1, "timed out datagram is still in reassembly queue");
+
+    VerifyCompletes(0, 1, kLargeDatagramSize, /* aShouldComplete */ false);
+    VerifyCompletes(1, 1, kLargeDatagramSize, /* aShouldComplete */ true);
+
+    // Next fragments restart the timeout.
+
+    ReceiveFirstFragment(0, 2, kLargeDatagramSize);
+
+    for (uint16_t offset = kFirstFragmentSize; offset < kLargeDatagramSize; offset += kNextFragmentSize)
+    {
+        testAdvanceTime((kReassemblyTimeout - 1) * 1000);
+        ReceiveFragment(0, 2, kLargeDatagramSize, offset);
+    }
+
+    VerifyOrQuit(sLastReceivedTag == 2, "datagram was not reassembled");
+    VerifyOrQuit(GetCounters().mTimeouts == 1, "unexpected reassembly timeout");
+
+    FinalizeTest();
+}
+
+void TestReassemblyEvictWhenFull(void)
+{
+    InitTest();
+
+    printf("TestReassemblyEvictWhenFull\n");
+
+    // Fill the table with datagrams from different sources, the one
+    // from source 0 being the oldest.
+
+    ReceiveFirstFragment(0, 1, kSmallDatagramSize);
+    testAdvanceTime(kAgeInterval);
+
+    for (uint16_t source = 1; source < kMaxEntries; source++)
+    {
+        ReceiveFirstFragment(source, 1, kSmallDatagramSize);
+    }
+
+    VerifyOrQuit(GetNumReassemblyMessages() == kMaxEntries, "first fragments were not queued");
+    VerifyOrQuit(GetCounters().mEvictions == 0, "unexpected reassembly eviction");
+
+    // A new datagram evicts the oldest one.
+
+    ReceiveFirstFragment(kMaxEntries, 1, kSmallDatagramSize);
+    VerifyOrQuit(GetNumReassemblyMessages() == kMaxEntries, "reassembly table exceeds its size");
+    VerifyOrQuit(GetCounters().mEvictions == 1, "oldest datagram was not evicted");
+
+    VerifyCompletes(0, 1, kSmallDatagramSize, /* aShouldComplete */ false);
+
+    for (uint16_t source = 1; source <= kMaxEntries; source++)
+    {
+        VerifyCompletes(source, 1, kSmallDatagramSize, /* aShouldComplete */ true);
+    }
+
+    VerifyOrQuit(GetNumReassemblyMessages() == 0, "reassembly queue is not empty");
+
+    FinalizeTest();
+}
+
+#if OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_MAX_BUFFERS_PER_SOURCE
+void TestReassemblyBuffersPerSource(void)
+{
+    uint16_t tag;
+
+    InitTest();
+
+    printf("TestReassemblyBuffersPerSource\n");
+
+    ReceiveFirstFragment(0, 1, kLargeDatagramSize);
+    testAdvanceTime(kAgeInterval);
+
+    // Keep adding datagrams from the same source until one is evicted
+    // to stay within the per-source limit.
+
+    for (tag = 2; GetCounters().mEvictions == 0; tag++)
+    {
+        VerifyOrQuit(tag <= kMaxEntries, "datagrams from one source were never evicted");
+
+        ReceiveFirstFragment(0, tag, kLargeDatagramSize);
+        VerifyOrQuit(GetNumReassemblyBuffers() <= kMaxBuffersPerSource, "source exceeds its buffer limit");
+    }
+
+    VerifyOrQuit(GetCounters().mEvictions == 1, "more than one datagram was evicted");
+
+    // Another source is not limited by the buffers used by the first.
+
+    ReceiveFirstFragment(1, 1, kLargeDatagramSize);
+    VerifyOrQuit(GetCounters().mEvictions == 1, "datagram from another source was evicted");
+
+    VerifyCompletes(0, 1, kLargeDatagramSize, /* aShouldComplete */ false);
+    VerifyCompletes(0, tag - 1, kLargeDatagramSize, /* aShouldComplete */ true);
+    VerifyCompletes(1, 1, kLargeDatagramSize, /* aShouldComplete */ true);
+
+    FinalizeTest();
+}
+#endif // OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_MAX_BUFFERS_PER_SOURCE
+
+#endif // OPENTHREAD_FTD
+
+} // namespace ot
+
+int main(void)
+{
+#if OPENTHREAD_FTD
+    ot::TestReassemblyLookup();
+    ot::TestReassemblyDuplicates();
+    ot::TestReassemblyTimeout();
+    ot::TestReassemblyEvictWhenFull();
+#if OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_MAX_BUFFERS_PER_SOURCE
+    ot::TestReassemblyBuffersPerSource();
+#endif
+    printf("All tests passed\n");
+#else
+    printf("FTD is not enabled\n");
+#endif
+
+    return 0;
+}
@@ -0,0 +1,336 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdlib.h>
+
+#include <openthread/config.h>
+
+#include "test_platform.h"
+#include "test_util.h"
+#include "common/code_utils.hpp"
+#include "common/instance.hpp"
+#include "mac/mac.hpp"
+#include "thread/mle_router.hpp"
+#include "thread/mle_tlvs.hpp"
+#include "thread/router_table.hpp"
+
+namespace ot {
+namespace Mle {
+
+class MleRouterTester
+{
+public:
+    static void UpdateRoutes(MleRouter &aMle, const RouteTlv &aRoute, uint8_t aRouterId)
+    {
+        aMle.UpdateRoutes(aRoute, aRouterId);
+    }
+
+    static bool UpdateRoute(MleRouter &aMle, Router &aRouter, uint8_t aNextHop, uint8_t aCost)
+    {
+        return aMle.UpdateRoute(aRouter, aNextHop, aCost);
+    }
+};
+
+enum : uint8_t
+{
+    kNumRouters   = 32,
+    kNumNeighbors = 8, // Routers at index 1 to `kNumNeighbors` are neighbors of the device (index 0).
+};
+
+// RSS values giving link quality 3, 2 and 1 with the -100 dBm receive sensitivity of the test platform.
+static const int8_t kRssValues[] = {-50, -85, -95};
+
+// Spreads the router IDs over the whole range so that router IDs differ from router table indices.
+static uint8_t RouterIdAt(uint8_t aIndex)
+{
+    return static_cast<uint8_t>(aIndex * 2);
+}
+
+static uint8_t DeviceRouterId(void)
+{
+    return RouterIdAt(0);
+}
+
+static void BuildRouterIdSet(RouterIdSet &aRouterIdSet)
+{
+    aRouterIdSet.Clear();
+
+    for (uint8_t index = 0; index < kNumRouters; index++)
+    {
+        aRouterIdSet.Add(RouterIdAt(index));
+    }
+}
+
+static Instance &InitTopology(void)
+{
+    Instance *   instance = static_cast<Instance *>(testInitInstance());
+    RouterIdSet  routerIdSet;
+    RouterTable *table;
+
+    VerifyOrQuit(instance != nullptr, "Null OpenThread instance");
+    table = &instance->Get<RouterTable>();
+
+    BuildRouterIdSet(routerIdSet);
+    instance->Get<MleRouter>().SetRouterId(DeviceRouterId());
+    instance->Get<Mac::Mac>().SetShortAddress(Mle::Rloc16FromRouterId(DeviceRouterId()));
+    table->UpdateRouterIdSet(1, routerIdSet);
+
+    for (uint8_t index = 1; index <= kNumNeighbors; index++)
+    {
+        Router *router = table->GetRouter(RouterIdAt(index));
+
+        VerifyOrQuit(router != nullptr, "GetRouter() failed");
+        router->GetLinkInfo().AddRss(kRssValues[index % OT_ARRAY_LENGTH(kRssValues)]);
+        router->SetLinkQualityOut(3);
+        router->SetState(Neighbor::kStateValid);
+    }
+
+    // Links are established directly here, as `HandleLinkAccept()` would.
+    table->InvalidateRoutes();
+
+    return *instance;
+}
+
+// Builds an Advertisement Route TLV listing all routers, where `aCosts` gives the route cost of each router index
+// and `aLinkQualityIn` the link quality in from the device.
+static void BuildRouteTlv(RouteTlv &aRoute, const uint8_t *aCosts, uint8_t aLinkQualityIn)
+{
+    RouterIdSet routerIdSet;
+
+    BuildRouterIdSet(routerIdSet);
+
+    aRoute.Init();
+    aRoute.SetRouterIdSequence(1);
+    aRoute.SetRouterIdMask(routerIdSet);
+
+    for (uint8_t index = 0; index < kNumRouters; index++)
+    {
+        aRoute.SetRouteCost(index, aCosts[index]);
+        aRoute.SetLinkQualityIn(index, (index == 0) ? aLinkQualityIn : 3);
+        aRoute.SetLinkQualityOut(index, 3);
+    }
+
+    aRoute.SetRouteDataLength(kNumRouters);
+}
+
+// The route selection done by `MleRouter::GetNextHop()` and `GetCost()` without the route table.
+
+static uint8_t ReferenceLinkCost(RouterTable &aTable, uint8_t aRouterId)
+{
+    Router *router = aTable.GetRouter(aRouterId);
+
+    return (router != nullptr) ? aTable.GetLinkCost(*router) : static_cast<uint8_t>(kMaxRouteCost);
+}
+
+static uint16_t ReferenceNextHop(RouterTable &aTable, uint8_t aRouterId)
+{
+    uint16_t nextHop = Mac::kShortAddrInvalid;
+    Router * router  = aTable.GetRouter(aRouterId);
+    uint8_t  linkCost;
+    uint8_t  routeCost;
+
+    VerifyOrExit(router != nullptr);
+
+    linkCost  = ReferenceLinkCost(aTable, aRouterId);
+    routeCost = (aTable.GetRouter(router->GetNextHop()) != nullptr) ? router->GetCost()
+                                                                   : static_cast<uint8_t>(kMaxRouteCost);
+
+    if (routeCost + ReferenceLinkCost(aTable, router->GetNextHop()) < linkCost)
+    {
+        Router *hop = aTable.GetRouter(router->GetNextHop());
+
+        VerifyOrExit(hop != nullptr && !hop->IsStateInvalid());
+        nextHop = Mle::Rloc16FromRouterId(router->GetNextHop());
+    }
+    else if (linkCost < kMaxRouteCost)
+    {
+        nextHop = Mle::Rloc16FromRouterId(aRouterId);
+    }
+
+exit:
+    return nextHop;
+}
+
+static uint8_t ReferenceCost(RouterTable &aTable, uint8_t aRouterId)
+{
+    uint8_t cost   = ReferenceLinkCost(aTable, aRouterId);
+    Router *router = aTable.GetRouter(aRouterId);
+
+    if (router != nullptr && aTable.GetRouter(router->GetNextHop()) != nullptr)
+    {
+        uint8_t routeCost = router->GetCost() + ReferenceLinkCost(aTable, router->GetNextHop());
+
+        cost = (routeCost < cost) ? routeCost : cost;
+    }
+
+    return cost;
+}
+
+static void VerifyRoutes(Instance &aInstance)
+{
+    MleRouter &  mle   = aInstance.Get<MleRouter>();
+    RouterTable &table = aInstance.Get<RouterTable>();
+
+    for (uint8_t routerId = 0; routerId <= kInvalidRouterId; routerId++)
+    {
+        uint16_t rloc16  = Mle::Rloc16FromRouterId(routerId);
+        Router * matched = nullptr;
+
+        for (Router &router : table.Iterate())
+        {
+            if (router.GetRouterId() == routerId)
+            {
+                matched = &router;
+            }
+        }
+
+        VerifyOrQuit(routerId == kInvalidRouterId || table.GetRouter(routerId) == matched, "GetRouter() failed");
+        VerifyOrQuit(mle.GetCost(rloc16) == ReferenceCost(table, routerId), "GetCost() failed");
+
+        if (routerId != DeviceRouterId())
+        {
+            VerifyOrQuit(mle.GetNextHop(rloc16) == ReferenceNextHop(table, routerId), "GetNextHop() failed");
+        }
+    }
+}
+
+void TestRouteTableConsistency(void)
+{
+    enum : uint16_t
+    {
+        kNumSteps = 3000,
+    };
+
+    Instance &   instance = InitTopology();
+    MleRouter &  mle      = instance.Get<MleRouter>();
+    RouterTable &table    = instance.Get<RouterTable>();
+
+    srand(1);
+    VerifyRoutes(instance);
+
+    for (uint16_t step = 0; step < kNumSteps; step++)
+    {
+        uint8_t neighborId = RouterIdAt(static_cast<uint8_t>(1 + rand() % kNumNeighbors));
+        Router *neighbor   = table.GetRouter(neighborId);
+
+        VerifyOrQuit(neighbor != nullptr, "GetRouter() failed");
+
+        switch (rand() % 5)
+        {
+        case 0:
+        case 1:
+            // Advertisement from a neighbor, with a random cost toward each router.
+            if (neighbor->IsStateValid())
+            {
+                RouteTlv route;
+                uint8_t  costs[kNumRouters];
+
+                for (uint8_t &cost : costs)
+                {
+                    cost = static_cast<uint8_t>(rand() % 16);
+                }
+
+                BuildRouteTlv(route, costs, static_cast<uint8_t>(rand() % 4));
+                MleRouterTester::UpdateRoutes(mle, route, neighborId);
+            }
+            break;
+
+        case 2:
+            // Received frame, possibly changing the link quality in.
+            neighbor->GetLinkInfo().AddRss(kRssValues[rand() % OT_ARRAY_LENGTH(kRssValues)]);
+            break;
+
+        case 3:
+            // Link lost, or re-established as `HandleLinkAccept()` does.
+            if (neighbor->IsStateValid())
+            {
+                mle.RemoveNeighbor(*neighbor);
+            }
+            else
+            {
+                neighbor->GetLinkInfo().Clear();
+                neighbor->GetLinkInfo().AddRss(kRssValues[rand() % OT_ARRAY_LENGTH(kRssValues)]);
+                neighbor->SetLinkQualityOut(static_cast<uint8_t>(1 + rand() % 3));
+                neighbor->SetState(Neighbor::kStateValid);
+                table.InvalidateRoutes();
+            }
+            break;
+
+        case 4:
+        {
+            // Routing loop detected toward a random router.
+            uint16_t destination = Mle::Rloc16FromRouterId(RouterIdAt(static_cast<uint8_t>(1 + rand() % 31)));
+
+            mle.ResolveRoutingLoops(mle.GetNextHop(destination), destination);
+            break;
+        }
+        }
+
+        VerifyRoutes(instance);
+    }
+
+    testFreeInstance(&instance);
+}
+
+void TestRouteChanges(void)
+{
+    Instance &   instance    = InitTopology();
+    MleRouter &  mle         = instance.Get<MleRouter>();
+    RouterTable &table       = instance.Get<RouterTable>();
+    Router *     destination = table.GetRouter(RouterIdAt(20));
+    Router *     neighbor    = table.GetRouter(RouterIdAt(2));
+
+    VerifyOrQuit(destination != nullptr && neighbor != nullptr, "GetRouter() failed");
+    VerifyOrQuit(mle.GetNextHop(destination->GetRloc16()) == Mac::kShortAddrInvalid, "GetNextHop() failed");
+
+    VerifyOrQuit(MleRouterTester::UpdateRoute(mle, *destination, RouterIdAt(1), 3), "UpdateRoute() failed");
+    VerifyOrQuit(mle.GetNextHop(destination->GetRloc16()) == Mle::Rloc16FromRouterId(RouterIdAt(1)),
+                 "GetNextHop() failed");
+    VerifyOrQuit(!MleRouterTester::UpdateRoute(mle, *destination, RouterIdAt(1), 3), "UpdateRoute() failed");
+
+    // A more expensive route toward a neighbor leaves its direct link selected.
+    VerifyOrQuit(MleRouterTester::UpdateRoute(mle, *neighbor, RouterIdAt(1), 10) ==
+                     !OPENTHREAD_CONFIG_MLE_ROUTE_TABLE_ENABLE,
+                 "UpdateRoute() failed");
+    VerifyOrQuit(mle.GetNextHop(neighbor->GetRloc16()) == neighbor->GetRloc16(), "GetNextHop() failed");
+
+    VerifyRoutes(instance);
+    testFreeInstance(&instance);
+}
+
+} // namespace Mle
+} // namespace ot
+
+int main(void)
+{
+    ot::Mle::TestRouteTableConsistency();
+    ot::Mle::TestRouteChanges();
+
+    printf("\nAll tests passed\n");
+    return 0;
+}
@@ -0,0 +1,588 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include <openthread/config.h>
+#include <openthread/platform/alarm-milli.h>
+
+#include "common/debug.hpp"
+#include "common/instance.hpp"
+#include "net/dnssd_server.hpp"
+#include "net/srp_server.hpp"
+
+#include "test_platform.h"
+#include "test_util.h"
+
+#if OPENTHREAD_CONFIG_SRP_SERVER_ENABLE
+
+static uint32_t sNow;
+
+static uint32_t testSrpServerAlarmGetNow(void)
+{
+    return sNow;
+}
+
+namespace ot {
+namespace Srp {
+
+class ServerTester
+{
+public:
+    enum : uint32_t
+    {
+        kMinLease    = 1,
+        kMaxLease    = 3600u * 24,
+        kMinKeyLease = 1,
+        kMaxKeyLease = 3600u * 24 * 14,
+    };
+
+    static Server &Init(Instance &aInstance)
+    {
+        Server &server = aInstance.Get<Server>();
+
+        SuccessOrQuit(server.SetLeaseRange(kMinLease, kMaxLease, kMinKeyLease, kMaxKeyLease), "SetLeaseRange failed");
+
+        return server;
+    }
+
+    // Registers (or updates) a host with `aNumServices` services named after `aHostIndex`, as if the SRP update was
+    // received and advertised. Returns false if there is not enough heap for the host.
+    static bool RegisterHost(Server & aServer,
+                             uint16_t aHostIndex,
+                             uint32_t aLease,
+                             uint32_t aKeyLease,
+                             uint16_t aFirstService,
+                             uint16_t aNumServices)
+    {
+        static const uint8_t kTxtData[] = {0};
+
+        bool              registered = false;
+        Server::Host *    host       = Server::Host::New();
+        Server::Service * service;
+        Dns::UpdateHeader header;
+        Ip6::MessageInfo  messageInfo;
+        Ip6::Address      address;
+        char              name[Dns::Name::kMaxNameSize];
+
+        VerifyOrExit(host != nullptr);
+
+        GetHostName(aHostIndex, name);
+        VerifyOrExit(host->SetFullName(name) == OT_ERROR_NONE, host->Free());
+        GetHostAddress(aHostIndex, address);
+        VerifyOrExit(host->AddIp6Address(address) == OT_ERROR_NONE, host->Free());
+
+        host->SetLease(aLease);
+        host->SetKeyLease(aKeyLease);
+
+        for (uint16_t i = aFirstService; i < aFirstService + aNumServices; i++)
+        {
+            GetServiceName(aHostIndex, i, name);
+            service = host->AddService(name);
+            VerifyOrExit(service != nullptr, host->Free());
+            VerifyOrExit(service->SetTxtData(kTxtData, sizeof(kTxtData)) == OT_ERROR_NONE, host->Free());
+        }
+
+        aServer.HandleSrpUpdateResult(OT_ERROR_NONE, header, *host, messageInfo);
+        registered = true;
+
+    exit:
+        return registered;
+    }
+
+    static const Server::Host *FindHost(Server &aServer, uint16_t aHostIndex)
+    {
+        char name[Dns::Name::kMaxNameSize];
+
+        GetHostName(aHostIndex, name);
+
+        return aServer.mHosts.FindMatching(name);
+    }
+
+    static const Server::Service *FindService(Server &aServer, uint16_t aHostIndex, uint16_t aServiceIndex)
+    {
+        char name[Dns::Name::kMaxNameSize];
+
+        GetServiceName(aHostIndex, aServiceIndex, name);
+
+        return aServer.FindService(name);
+    }
+
+    // Finds a service the way the server did before the name indices, by scanning the services of all hosts.
+    static const Server::Service *FindServiceByScan(Server &aServer, uint16_t aHostIndex, uint16_t aServiceIndex)
+    {
+        char                   name[Dns::Name::kMaxNameSize];
+        const Server::Service *service = nullptr;
+
+        GetServiceName(aHostIndex, aServiceIndex, name);
+
+        for (const Server::Host *host = aServer.mHosts.GetHead(); host != nullptr; host = host->GetNext())
+        {
+            service = host->FindService(name);
+            if (service != nullptr)
+            {
+                break;
+            }
+        }
+
+        return service;
+    }
+
+    static void GetHostName(uint16_t aHostIndex, char *aName)
+    {
+        snprintf(aName, Dns::Name::kMaxNameSize, "host%u.default.service.arpa.", aHostIndex);
+    }
+
+    static void GetHostAddress(uint16_t aHostIndex, Ip6::Address &aAddress)
+    {
+        aAddress.Clear();
+        aAddress.mFields.m8[0]  = 0xfd;
+        aAddress.mFields.m16[7] = HostSwap16(aHostIndex + 1);
+    }
+
+    static void GetServiceName(uint16_t aHostIndex, uint16_t aServiceIndex, char *aName)
+    {
+        snprintf(aName, Dns::Name::kMaxNameSize, "s%u-%u._test._udp.default.service.arpa.", aHostIndex,
+                 aServiceIndex);
+    }
+
+    static bool IsLeaseTimerRunning(Server &aServer) { return aServer.mLeaseTimer.IsRunning(); }
+
+    static uint32_t GetLeaseTimerFireTime(Server &aServer) { return aServer.mLeaseTimer.GetFireTime().GetValue(); }
+
+    static void RemoveAllHosts(Server &aServer)
+    {
+        while (!aServer.mHosts.IsEmpty())
+        {
+            aServer.RemoveAndFreeHost(aServer.mHosts.GetHead());
+        }
+
+        aServer.UpdateLeaseTimer();
+    }
+};
+
+} // namespace Srp
+
+#if OPENTHREAD_CONFIG_DNSSD_SERVER_ENABLE
+namespace Dns {
+namespace ServiceDiscovery {
+
+class ServerTester
+{
+public:
+    // Returns the response of the DNS-SD server to a query with a single `aType` question for `aName`.
+    static Message *Query(Instance &aInstance, const char *aName, uint16_t aType)
+    {
+        Message *query    = aInstance.Get<MessagePool>().New(Message::kTypeOther, 0);
+        Message *response = aInstance.Get<MessagePool>().New(Message::kTypeOther, 0);
+        Header   header;
+
+        VerifyOrQuit(query != nullptr && response != nullptr, "Message::New failed");
+
+        header.Clear();
+        header.SetMessageId(1);
+        header.SetQuestionCount(1);
+
+        SuccessOrQuit(query->Append(header), "Append failed");
+        SuccessOrQuit(Name::AppendName(aName, *query), "AppendName failed");
+        SuccessOrQuit(query->Append(Question(aType)), "Append failed");
+        SuccessOrQuit(response->SetLength(sizeof(Header)), "SetLength failed");
+
+        aInstance.Get<Server>().ProcessQuery(*query, *response, header);
+        query->Free();
+
+        return response;
+    }
+};
+
+} // namespace ServiceDiscovery
+} // namespace Dns
+#endif // OPENTHREAD_CONFIG_DNSSD_SERVER_ENABLE
+
+static void AdvanceTimeTo(Instance &aInstance, uint32_t aTime)
+{
+    sNow = aTime;
+    otPlatAlarmMilliFired(&aInstance);
+}
+
+void TestSrpServerLeaseExpiry(void)
+{
+    enum : uint32_t
+    {
+        kTimeT0 = 1000,
+    };
+
+    Instance *               instance;
+    Srp::Server *            server;
+    const Srp::Server::Host *host;
+
+    sNow                  = kTimeT0;
+    g_testPlatAlarmGetNow = testSrpServerAlarmGetNow;
+
+    instance = static_cast<Instance *>(testInitInstance());
+    VerifyOrQuit(instance != nullptr, "Null OpenThread instance\n");
+
+    server = &Srp::ServerTester::Init(*instance);
+
+    // t0:      host 1 (lease 100s, key lease 1000s) with services 1 and 2.
+    // t0+10s:  host 2 (lease 50s, key lease 200s) with service 3.
+    // t0+50s:  host 1 renews its lease with service 1 only.
+
+    VerifyOrQuit(Srp::ServerTester::RegisterHost(*server, 1, 100, 1000, 1, 2), "RegisterHost failed");
+    VerifyOrQuit(Srp::ServerTester::GetLeaseTimerFireTime(*server) == kTimeT0 + 100000, "Lease timer is incorrect");
+
+    sNow = kTimeT0 + 10000;
+    VerifyOrQuit(Srp::ServerTester::RegisterHost(*server, 2, 50, 200, 3, 1), "RegisterHost failed");
+    VerifyOrQuit(Srp::ServerTester::GetLeaseTimerFireTime(*server) == kTimeT0 + 60000, "Lease timer is incorrect");
+
+    sNow = kTimeT0 + 50000;
+    VerifyOrQuit(Srp::ServerTester::RegisterHost(*server, 1, 100, 1000, 1, 1), "RegisterHost failed");
+    VerifyOrQuit(Srp::ServerTester::GetLeaseTimerFireTime(*server) == kTimeT0 + 60000, "Lease timer is incorrect");
+
+    // t0+60s: the lease of host 2 expires, its name is retained.
+
+    AdvanceTimeTo(*instance, kTimeT0 + 60000);
+    host = Srp::ServerTester::FindHost(*server, 2);
+    VerifyOrQuit(host != nullptr && host->IsDeleted(), "Host 2 lease did not expire");
+    VerifyOrQuit(Srp::ServerTester::FindService(*server, 2, 3)->IsDeleted(), "Service 3 lease did not expire");
+    VerifyOrQuit(!Srp::ServerTester::FindHost(*server, 1)->IsDeleted(), "Host 1 lease expired early");
+    VerifyOrQuit(Srp::ServerTester::GetLeaseTimerFireTime(*server) == kTimeT0 + 100000, "Lease timer is incorrect");
+
+    // t0+100s: service 2 was not renewed, its lease expires on its own.
+
+    AdvanceTimeTo(*instance, kTimeT0 + 100000);
+    VerifyOrQuit(Srp::ServerTester::FindService(*server, 1, 2)->IsDeleted(), "Service 2 lease did not expire");
+    VerifyOrQuit(!Srp::ServerTester::FindService(*server, 1, 1)->IsDeleted(), "Service 1 lease expired early");
+    VerifyOrQuit(!Srp::ServerTester::FindHost(*server, 1)->IsDeleted(), "Host 1 lease expired early");
+    VerifyOrQuit(Srp::ServerTester::GetLeaseTimerFireTime(*server) == kTimeT0 + 150000, "Lease timer is incorrect");
+
+    // t0+150s: the renewed lease of host 1 expires.
+
+    AdvanceTimeTo(*instance, kTimeT0 + 150000);
+    VerifyOrQuit(Srp::ServerTester::FindHost(*server, 1)->IsDeleted(), "Host 1 lease did not expire");
+    VerifyOrQuit(Srp::ServerTester::FindService(*server, 1, 1)->IsDeleted(), "Service 1 lease did not expire");
+    VerifyOrQuit(Srp::ServerTester::GetLeaseTimerFireTime(*server) == kTimeT0 + 210000, "Lease timer is incorrect");
+
+    // t0+210s: the key lease of host 2 expires, it is removed.
+
+    AdvanceTimeTo(*instance, kTimeT0 + 210000);
+    VerifyOrQuit(Srp::ServerTester::FindHost(*server, 2) == nullptr, "Host 2 was not removed");
+    VerifyOrQuit(Srp::ServerTester::FindService(*server, 2, 3) == nullptr, "Service 3 was not removed");
+    VerifyOrQuit(Srp::ServerTester::GetLeaseTimerFireTime(*server) == kTimeT0 + 1000000, "Lease timer is incorrect");
+
+    // t0+1000s: the key lease of service 2 expires, then t0+1050s the key lease of host 1.
+
+    AdvanceTimeTo(*instance, kTimeT0 + 1000000);
+    VerifyOrQuit(Srp::ServerTester::FindService(*server, 1, 2) == nullptr, "Service 2 was not removed");
+    VerifyOrQuit(Srp::ServerTester::FindHost(*server, 1) != nullptr, "Host 1 was removed early");
+    VerifyOrQuit(Srp::ServerTester::GetLeaseTimerFireTime(*server) == kTimeT0 + 1050000, "Lease timer is incorrect");
+
+    AdvanceTimeTo(*instance, kTimeT0 + 1050000);
+    VerifyOrQuit(Srp::ServerTester::FindHost(*server, 1) == nullptr, "Host 1 was not removed");
+    VerifyOrQuit(!Srp::ServerTester::IsLeaseTimerRunning(*server), "Lease timer is still running");
+
+    testFreeInstance(instance);
+    g_testPlatAlarmGetNow = nullptr;
+}
+
+void TestSrpServerLeaseExpiryOrder(void)
+{
+    enum : uint16_t
+    {
+        kServicesPerHost = 5,
+        kNumHosts        = 50, // The internal heap only holds a few hundred services.
+    };
+
+    enum : uint32_t
+    {
+        kTimeT0    = 1000,
+        kBaseLease = 600,
+    };
+
+    Instance *   instance;
+    Srp::Server *server;
+
+    sNow                  = kTimeT0;
+    g_testPlatAlarmGetNow = testSrpServerAlarmGetNow;
+
+    instance = static_cast<Instance *>(testInitInstance());
+    VerifyOrQuit(instance != nullptr, "Null OpenThread instance\n");
+
+    server = &Srp::ServerTester::Init(*instance);
+
+    // Register all hosts at once, each with a lease one second longer than the previous one.
+
+    for (uint16_t i = 0; i < kNumHosts; i++)
+    {
+        VerifyOrQuit(Srp::ServerTester::RegisterHost(*server, i, kBaseLease + i, Srp::ServerTester::kMaxKeyLease, 0,
+                                                     kServicesPerHost),
+                     "RegisterHost failed");
+    }
+
+    // Let the leases expire one host at a time. Each lease timer fire should only touch the expired host and its
+    // services, and schedule the next fire at the following host.
+
+    for (uint16_t i = 0; i < kNumHosts; i++)
+    {
+        uint32_t expireAt = kTimeT0 + (kBaseLease + i) * 1000;
+
+        VerifyOrQuit(Srp::ServerTester::GetLeaseTimerFireTime(*server) == expireAt, "Lease timer is incorrect");
+        AdvanceTimeTo(*instance, expireAt);
+        VerifyOrQuit(Srp::ServerTester::FindHost(*server, i)->IsDeleted(), "Host lease did not expire");
+        VerifyOrQuit((i + 1 == kNumHosts) || !Srp::ServerTester::FindHost(*server, i + 1)->IsDeleted(),
+                     "Host lease expired early");
+    }
+
+    Srp::ServerTester::RemoveAllHosts(*server);
+    VerifyOrQuit(!Srp::ServerTester::IsLeaseTimerRunning(*server), "Lease timer is still running");
+
+    testFreeInstance(instance);
+    g_testPlatAlarmGetNow = nullptr;
+}
+
+static uint16_t CountServicesOfType(const Srp::Server &aServer, const char *aServiceName)
+{
+    uint16_t                    count   = 0;
+    const Srp::Server::Service *service = nullptr;
+
+    while ((service = aServer.FindNextServiceOfType(service, aServiceName)) != nullptr)
+    {
+        count++;
+    }
+
+    return count;
+}
+
+void TestSrpServerNameIndex(void)
+{
+    static const char kServiceName[]      = "_test._udp.default.service.arpa.";
+    static const char kOtherServiceName[] = "_other._udp.default.service.arpa.";
+
+    Instance *                  instance;
+    Srp::Server *               server;
+    const Srp::Server::Host *   host;
+    const Srp::Server::Service *service;
+    char                        name[Dns::Name::kMaxNameSize];
+
+    sNow                  = 1000;
+    g_testPlatAlarmGetNow = testSrpServerAlarmGetNow;
+
+    instance = static_cast<Instance *>(testInitInstance());
+    VerifyOrQuit(instance != nullptr, "Null OpenThread instance\n");
+
+    server = &Srp::ServerTester::Init(*instance);
+
+    // Host 1 with services 1 and 2, host 2 with service 3.
+
+    VerifyOrQuit(Srp::ServerTester::RegisterHost(*server, 1, 100, 1000, 1, 2), "RegisterHost failed");
+    VerifyOrQuit(Srp::ServerTester::RegisterHost(*server, 2, 100, 200, 3, 1), "RegisterHost failed");
+
+    Srp::ServerTester::GetHostName(1, name);
+    host = server->FindHost(name);
+    VerifyOrQuit(host != nullptr && host->Matches(name), "FindHost failed");
+    VerifyOrQuit(server->FindHost(kServiceName) == nullptr, "FindHost found a missing host");
+
+    Srp::ServerTester::GetServiceName(1, 2, name);
+    service = server->FindNextService(nullptr, name);
+    VerifyOrQuit(service != nullptr && service->Matches(name) && &service->GetHost() == host, "FindNextService failed");
+    VerifyOrQuit(server->FindNextService(service, name) == nullptr, "FindNextService found a duplicate");
+
+    VerifyOrQuit(CountServicesOfType(*server, kServiceName) == 3, "FindNextServiceOfType failed");
+    VerifyOrQuit(CountServicesOfType(*server, kOtherServiceName) == 0, "FindNextServiceOfType found a wrong type");
+
+    // Host 1 adds service 4; names of hosts and services stay indexed until their KEY-LEASE expires.
+
+    VerifyOrQuit(Srp::ServerTester::RegisterHost(*server, 1, 100, 1000, 4, 1), "RegisterHost failed");
+    VerifyOrQuit(Srp::ServerTester::FindService(*server, 1, 4) != nullptr, "Merged service is not indexed");
+    VerifyOrQuit(CountServicesOfType(*server, kServiceName) == 4, "FindNextServiceOfType failed");
+
+    AdvanceTimeTo(*instance, 1000 + 100000);
+    VerifyOrQuit(Srp::ServerTester::FindService(*server, 2, 3)->IsDeleted(), "Service 3 lease did not expire");
+    VerifyOrQuit(CountServicesOfType(*server, kServiceName) == 4, "Deleted services lost their names");
+
+    AdvanceTimeTo(*instance, 1000 + 200000);
+    Srp::ServerTester::GetHostName(2, name);
+    VerifyOrQuit(server->FindHost(name) == nullptr, "Removed host is still indexed");
+    VerifyOrQuit(Srp::ServerTester::FindService(*server, 2, 3) == nullptr, "Removed service is still indexed");
+    VerifyOrQuit(CountServicesOfType(*server, kServiceName) == 3, "Removed service is still indexed");
+
+    Srp::ServerTester::RemoveAllHosts(*server);
+    Srp::ServerTester::GetHostName(1, name);
+    VerifyOrQuit(server->FindHost(name) == nullptr, "Removed host is still indexed");
+    VerifyOrQuit(CountServicesOfType(*server, kServiceName) == 0, "Removed services are still indexed");
+
+    testFreeInstance(instance);
+    g_testPlatAlarmGetNow = nullptr;
+}
+
+void TestSrpServerNameIndexMatchesScan(void)
+{
+    enum : uint16_t
+    {
+        kServicesPerHost = 5,
+        kNumHosts        = 50,
+    };
+
+    Instance *   instance;
+    Srp::Server *server;
+
+    sNow                  = 1000;
+    g_testPlatAlarmGetNow = testSrpServerAlarmGetNow;
+
+    instance = static_cast<Instance *>(testInitInstance());
+    VerifyOrQuit(instance != nullptr, "Null OpenThread instance\n");
+
+    server = &Srp::ServerTester::Init(*instance);
+
+    for (uint16_t i = 0; i < kNumHosts; i++)
+    {
+        VerifyOrQuit(Srp::ServerTester::RegisterHost(*server, i, 600, 3600, 0, kServicesPerHost),
+                     "RegisterHost failed");
+    }
+
+    // Every service instance found through the name index is the one found by scanning all hosts.
+
+    for (uint16_t i = 0; i < kNumHosts; i++)
+    {
+        for (uint16_t j = 0; j < kServicesPerHost; j++)
+        {
+            const Srp::Server::Service *service = Srp::ServerTester::FindService(*server, i, j);
+
+            VerifyOrQuit(service != nullptr, "FindService failed");
+            VerifyOrQuit(service == Srp::ServerTester::FindServiceByScan(*server, i, j),
+                         "FindService and FindServiceByScan differ");
+        }
+    }
+
+    Srp::ServerTester::RemoveAllHosts(*server);
+
+    testFreeInstance(instance);
+    g_testPlatAlarmGetNow = nullptr;
+}
+
+#if OPENTHREAD_CONFIG_DNSSD_SERVER_ENABLE
+void TestDnssdBrowseResponse(void)
+{
+    enum : uint16_t
+    {
+        kNumInstances = 50,
+    };
+
+    static const char kServiceName[] = "_test._udp.default.service.arpa.";
+
+    Instance *   instance;
+    Srp::Server *server;
+    Message *    response;
+    Dns::Header  header;
+    uint16_t     offset;
+    uint16_t     length;
+    char         name[Dns::Name::kMaxNameSize];
+    char         expectedName[Dns::Name::kMaxNameSize];
+    bool         found[kNumInstances];
+    unsigned int index;
+
+    sNow                  = 1000;
+    g_testPlatAlarmGetNow = testSrpServerAlarmGetNow;
+
+    instance = static_cast<Instance *>(testInitInstance());
+    VerifyOrQuit(instance != nullptr, "Null OpenThread instance\n");
+
+    server = &Srp::ServerTester::Init(*instance);
+
+    for (uint16_t i = 0; i < kNumInstances; i++)
+    {
+        VerifyOrQuit(Srp::ServerTester::RegisterHost(*server, i, 600, 3600, 0, 1), "RegisterHost failed");
+    }
+
+    // A browse response holds a PTR answer per instance, with the SRV, TXT and AAAA records as additional data.
+    // Check that all the (compressed) names can be read back.
+
+    response = Dns::ServiceDiscovery::ServerTester::Query(*instance, kServiceName, Dns::ResourceRecord::kTypePtr);
+    length   = response->GetLength();
+
+    SuccessOrQuit(response->Read(0, header), "Read failed");
+    VerifyOrQuit(header.GetResponseCode() == Dns::Header::kResponseSuccess, "browse failed");
+    VerifyOrQuit(header.GetAnswerCount() == kNumInstances, "wrong number of PTR records");
+    VerifyOrQuit(header.GetAdditionalRecordCount() == 3 * kNumInstances, "wrong number of additional records");
+
+    offset = sizeof(header);
+    SuccessOrQuit(Dns::Name::CompareName(*response, offset, kServiceName), "wrong question name");
+    offset += sizeof(Dns::Question);
+
+    memset(found, 0, sizeof(found));
+
+    for (uint16_t i = 0; i < kNumInstances; i++)
+    {
+        Dns::PtrRecord ptrRecord;
+
+        SuccessOrQuit(Dns::Name::CompareName(*response, offset, kServiceName), "wrong PTR record name");
+        SuccessOrQuit(Dns::ResourceRecord::ReadRecord(*response, offset, ptrRecord), "ReadRecord failed");
+        SuccessOrQuit(ptrRecord.ReadPtrName(*response, offset, name, sizeof(name)), "ReadPtrName failed");
+
+        VerifyOrQuit(sscanf(name, "s%u-", &index) == 1 && index < kNumInstances && !found[index],
+                     "unexpected PTR record instance name");
+        Srp::ServerTester::GetServiceName(static_cast<uint16_t>(index), 0, expectedName);
+        VerifyOrQuit(strcmp(name, expectedName) == 0, "wrong PTR record instance name");
+        found[index] = true;
+    }
+
+    SuccessOrQuit(Dns::ResourceRecord::ParseRecords(*response, offset, header.GetAdditionalRecordCount()),
+                  "additional records cannot be parsed");
+    VerifyOrQuit(offset == length, "response has extra bytes");
+
+    response->Free();
+
+    Srp::ServerTester::RemoveAllHosts(*server);
+
+    testFreeInstance(instance);
+    g_testPlatAlarmGetNow = nullptr;
+}
+#endif // OPENTHREAD_CONFIG_DNSSD_SERVER_ENABLE
+
+} // namespace ot
+
+int main(void)
+{
+    ot::TestSrpServerLeaseExpiry();
+    ot::TestSrpServerLeaseExpiryOrder();
+    ot::TestSrpServerNameIndex();
+    ot::TestSrpServerNameIndexMatchesScan();
+#if OPENTHREAD_CONFIG_DNSSD_SERVER_ENABLE
+    ot::TestDnssdBrowseResponse();
+#endif
+    printf("All tests passed\n");
+    return 0;
+}
+
+#else
+int main(void)
+{
+    return 0;
+}
+#endif // OPENTHREAD_CONFIG_SRP_SERVER_ENABLE
@@ -26,11 +26,15 @@
  *  POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <new>
+#include <stdlib.h>
+
 #include "test_platform.h"
 
 #include "common/code_utils.hpp"
 #include "common/debug.hpp"
 #include "common/instance.hpp"
+#include "common/random.hpp"
 #include "common/timer.hpp"
 
 enum
@@ -660,11 +664,157 @@ int TestTimerTime(void)
     return 0;
 }
 
+/**
+ * `OrderTimer` sub-classes `ot::TimerMilli` or `ot::TimerMicro` and logs the order in which timers fire.
+ */
+template <typename TimerType> class OrderTimer : public TimerType
+{
+public:
+    OrderTimer(ot::Instance &aInstance, uint16_t aIndex)
+        : TimerType(aInstance, OrderTimer::HandleTimerFired)
+        , mIndex(aIndex)
+    {
+    }
+
+    static void HandleTimerFired(ot::Timer &aTimer) { sFiredIndex = static_cast<OrderTimer &>(aTimer).mIndex; }
+
+    static int32_t sFiredIndex;
+
+private:
+    uint16_t mIndex;
+};
+
+template <typename TimerType> int32_t OrderTimer<TimerType>::sFiredIndex;
+
+template <typename TimerType> static OrderTimer<TimerType> *NewOrderTimers(ot::Instance &aInstance, uint16_t aCount)
+{
+    OrderTimer<TimerType> *timers = static_cast<OrderTimer<TimerType> *>(malloc(aCount * sizeof(OrderTimer<TimerType>)));
+
+    VerifyOrQuit(timers != nullptr, "malloc() failed");
+
+    for (uint16_t i = 0; i < aCount; i++)
+    {
+        new (&timers[i]) OrderTimer<TimerType>(aInstance, i);
+    }
+
+    return timers;
+}
+
+template <typename TimerType> static void FreeOrderTimers(OrderTimer<TimerType> *aTimers, uint16_t aCount)
+{
+    for (uint16_t i = 0; i < aCount; i++)
+    {
+        aTimers[i].Stop();
+        aTimers[i].~OrderTimer<TimerType>();
+    }
+
+    free(aTimers);
+}
+
+/**
+ * Test that timers fire in fire time order (and in start order for the same fire time) under random starts and stops,
+ * and that the platform alarm always tracks the first timer.
+ */
+template <typename TimerType> int TestTimerOrder(void)
+{
+    const uint16_t kNumTimers    = 300;
+    const uint16_t kNumRounds    = 3000;
+    const uint32_t kTimeShifts[] = {1000, 0U - 5000U, ot::Timer::kMaxDelay};
+
+    ot::Instance *instance = testInitInstance();
+
+    printf("TestTimerOrder() ");
+
+    InitTestTimer();
+
+    for (uint32_t timeShift : kTimeShifts)
+    {
+        OrderTimer<TimerType> *timers = NewOrderTimers<TimerType>(*instance, kNumTimers);
+        uint32_t               sequence[kNumTimers];
+        uint32_t               nextSequence = 0;
+        uint16_t               numFired     = 0;
+
+        sNow = timeShift;
+
+        for (uint16_t round = 0; round < kNumRounds; round++)
+        {
+            uint16_t index = ot::Random::NonCrypto::GetUint16InRange(0, kNumTimers);
+            int32_t  first = -1;
+
+            if (ot::Random::NonCrypto::GetUint8InRange(0, 4) == 0)
+            {
+                timers[index].Stop();
+            }
+            else
+            {
+                // Use a coarse delay so that many timers share the same fire time.
+                timers[index].Start(ot::Random::NonCrypto::GetUint8InRange(0, 64) * 16);
+                sequence[index] = nextSequence++;
+            }
+
+            if (ot::Random::NonCrypto::GetUint8InRange(0, 8) == 0)
+            {
+                sNow += ot::Random::NonCrypto::GetUint8InRange(0, 64);
+            }
+
+            for (uint16_t i = 0; i < kNumTimers; i++)
+            {
+                int32_t distance;
+
+                if (!timers[i].IsRunning())
+                {
+                    continue;
+                }
+
+                distance = static_cast<int32_t>(timers[i].GetFireTime().GetValue() - sNow);
+
+                if ((first < 0) ||
+                    (distance < static_cast<int32_t>(timers[first].GetFireTime().GetValue() - sNow)) ||
+                    ((timers[i].GetFireTime() == timers[first].GetFireTime()) && (sequence[i] < sequence[first])))
+                {
+                    first = i;
+                }
+            }
+
+            if (first < 0)
+            {
+                VerifyOrQuit(!sTimerOn, "TestTimerOrder: Alarm running without any timer");
+                continue;
+            }
+
+            VerifyOrQuit(sTimerOn, "TestTimerOrder: Alarm not running");
+            VerifyOrQuit((sPlatT0 + sPlatDt == timers[first].GetFireTime().GetValue()) ||
+                             ((sPlatDt == 0) && (timers[first].GetFireTime() <= ot::Time(sNow))),
+                         "TestTimerOrder: Alarm does not match the first timer");
+
+            if (timers[first].GetFireTime() <= ot::Time(sNow))
+            {
+                OrderTimer<TimerType>::sFiredIndex = -1;
+                AlarmFired<TimerType>(instance);
+                VerifyOrQuit(OrderTimer<TimerType>::sFiredIndex == first, "TestTimerOrder: Timer fired out of order");
+                VerifyOrQuit(!timers[first].IsRunning(), "TestTimerOrder: Fired timer still running");
+                numFired++;
+            }
+        }
+
+        VerifyOrQuit(numFired > 0, "TestTimerOrder: No timer fired");
+
+        FreeOrderTimers(timers, kNumTimers);
+    }
+
+    printf(" --> PASSED\n");
+
+    testFreeInstance(instance);
+
+    return 0;
+}
+
 template <typename TimerType> void RunTimerTests(void)
 {
     TestOneTimer<TimerType>();
     TestTwoTimers<TimerType>();
     TestTenTimers<TimerType>();
+    TestTimerOrder<TimerType>();
 }
 
 int main(void)
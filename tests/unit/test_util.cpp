@@ -30,6 +30,11 @@
 
 #include <ctype.h>
 
+#include <openthread/ip6.h>
+#include <openthread/tasklet.h>
+#include <openthread/thread.h>
+#include <openthread/thread_ftd.h>
+
 void DumpBuffer(const char *aTextMessage, const uint8_t *aBuffer, uint16_t aBufferLength)
 {
     enum
@@ -69,3 +74,123 @@ void DumpBuffer(const char *aTextMessage, const uint8_t *aBuffer, uint16_t aBuff
 
     printf("    %s\n", charBuff);
 }
+
+otRadioFrame             g_testRadioTxFrame;
+bool                     g_testRadioTransmitted     = false;
+bool                     g_testRadioAutoTxDone      = true;
+testRadioTransmitHandler g_testRadioTransmitHandler = nullptr;
+testAlarmFiredHandler    g_testAlarmFiredHandler    = nullptr;
+
+static ot::Instance *sSimInstance = nullptr;
+static uint32_t      sSimNow;
+static uint8_t       sSimRadioTxPsdu[OT_RADIO_FRAME_MAX_SIZE];
+
+static otRadioFrame *testSimRadioGetTransmitBuffer(otInstance *)
+{
+    return &g_testRadioTxFrame;
+}
+
+static otError testSimRadioTransmit(otInstance *)
+{
+    if (g_testRadioTransmitHandler != nullptr)
+    {
+        g_testRadioTransmitHandler(&g_testRadioTxFrame);
+    }
+
+    g_testRadioTransmitted = true;
+
+    return OT_ERROR_NONE;
+}
+
+uint32_t testGetNow(void)
+{
+    return sSimNow;
+}
+
+ot::Instance *testInitSimInstance(uint32_t aStartTime)
+{
+    memset(&g_testRadioTxFrame, 0, sizeof(g_testRadioTxFrame));
+    g_testRadioTxFrame.mPsdu = sSimRadioTxPsdu;
+    g_testRadioTransmitted   = false;
+
+    sSimNow                          = aStartTime;
+    g_testPlatAlarmGetNow            = testGetNow;
+    g_testPlatAlarmSet               = false;
+    g_testPlatRadioGetTransmitBuffer = testSimRadioGetTransmitBuffer;
+    g_testPlatRadioTransmit          = testSimRadioTransmit;
+    g_testPlatRadioCaps = (OT_RADIO_CAPS_ACK_TIMEOUT | OT_RADIO_CAPS_CSMA_BACKOFF | OT_RADIO_CAPS_TRANSMIT_RETRIES);
+
+    sSimInstance = testInitInstance();
+    VerifyOrQuit(sSimInstance != nullptr, "testInitInstance() failed");
+
+    SuccessOrQuit(otIp6SetEnabled(sSimInstance, true), "otIp6SetEnabled() failed");
+    testProcessTasklets();
+
+    return sSimInstance;
+}
+
+void testStartLeader(void)
+{
+    SuccessOrQuit(otThreadSetEnabled(sSimInstance, true), "otThreadSetEnabled() failed");
+    SuccessOrQuit(otThreadBecomeLeader(sSimInstance), "otThreadBecomeLeader() failed");
+    testProcessTasklets();
+
+    VerifyOrQuit(otThreadGetDeviceRole(sSimInstance) == OT_DEVICE_ROLE_LEADER, "device did not become leader");
+}
+
+void testFreeSimInstance(void)
+{
+    testFreeInstance(sSimInstance);
+    sSimInstance = nullptr;
+
+    g_testPlatAlarmGetNow            = nullptr;
+    g_testPlatRadioGetTransmitBuffer = nullptr;
+    g_testPlatRadioTransmit          = nullptr;
+    g_testPlatRadioCaps              = OT_RADIO_CAPS_NONE;
+    g_testRadioAutoTxDone            = true;
+    g_testRadioTransmitHandler       = nullptr;
+    g_testAlarmFiredHandler          = nullptr;
+}
+
+void testProcessTasklets(void)
+{
+    do
+    {
+        while (otTaskletsArePending(sSimInstance))
+        {
+            otTaskletsProcess(sSimInstance);
+        }
+
+        if (g_testRadioAutoTxDone && g_testRadioTransmitted)
+        {
+            g_testRadioTransmitted = false;
+            otPlatRadioTxDone(sSimInstance, &g_testRadioTxFrame, nullptr, OT_ERROR_NONE);
+        }
+    } while ((g_testRadioAutoTxDone && g_testRadioTransmitted) || otTaskletsArePending(sSimInstance));
+}
+
+// Moves the time forward by `aDuration` (in msec), firing the alarm at
+// each time it is scheduled in between.
+void testAdvanceTime(uint32_t aDuration)
+{
+    uint32_t endTime = sSimNow + aDuration;
+
+    while (g_testPlatAlarmSet && (static_cast<int32_t>(g_testPlatAlarmNext - endTime) <= 0))
+    {
+        if (static_cast<int32_t>(g_testPlatAlarmNext - sSimNow) > 0)
+        {
+            sSimNow = g_testPlatAlarmNext;
+        }
+
+        if (g_testAlarmFiredHandler != nullptr)
+        {
+            g_testAlarmFiredHandler();
+        }
+
+        g_testPlatAlarmSet = false;
+        otPlatAlarmMilliFired(sSimInstance);
+        testProcessTasklets();
+    }
+
+    sSimNow = endTime;
+}
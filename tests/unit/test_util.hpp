@@ -31,6 +31,7 @@
 
 #include <stdint.h>
 
+#include "test_platform.h"
 #include "test_util.h"
 
 /**
@@ -43,4 +44,71 @@
  */
 void DumpBuffer(const char *aTextMessage, const uint8_t *aBuffer, uint16_t aBufferLength);
 
+/**
+ * This function pointer is called when a frame is passed to the radio of the simulated instance for transmission.
+ *
+ * @param[in]  aFrame  A pointer to the frame.
+ *
+ */
+typedef void (*testRadioTransmitHandler)(const otRadioFrame *aFrame);
+
+/**
+ * This function pointer is called each time the alarm of the simulated instance is about to fire.
+ *
+ */
+typedef void (*testAlarmFiredHandler)(void);
+
+extern otRadioFrame             g_testRadioTxFrame;         ///< The transmit frame of the simulated instance.
+extern bool                     g_testRadioTransmitted;     ///< Whether a transmission is not reported as done yet.
+extern bool                     g_testRadioAutoTxDone;      ///< Whether tasklet processing reports transmissions done.
+extern testRadioTransmitHandler g_testRadioTransmitHandler; ///< Called on each transmission (if not nullptr).
+extern testAlarmFiredHandler    g_testAlarmFiredHandler;    ///< Called on each alarm fire (if not nullptr).
+
+/**
+ * This function initializes an instance running on a simulated millisecond time and radio, and enables IPv6.
+ *
+ * Radio transmissions are never acknowledged, they are reported as done when tasklets are processed (unless
+ * `g_testRadioAutoTxDone` is set to false before calling this function).
+ *
+ * @param[in]  aStartTime  The initial simulated time (in msec).
+ *
+ * @returns A pointer to the instance.
+ *
+ */
+ot::Instance *testInitSimInstance(uint32_t aStartTime);
+
+/**
+ * This function starts Thread on the simulated instance and makes it become leader.
+ *
+ */
+void testStartLeader(void);
+
+/**
+ * This function finalizes the simulated instance and restores the default platform behavior.
+ *
+ */
+void testFreeSimInstance(void);
+
+/**
+ * This function processes the pending tasklets of the simulated instance, and the transmissions they start.
+ *
+ */
+void testProcessTasklets(void);
+
+/**
+ * This function moves the simulated time forward, firing the alarm at each time it is scheduled in between.
+ *
+ * @param[in]  aDuration  The duration (in msec).
+ *
+ */
+void testAdvanceTime(uint32_t aDuration);
+
+/**
+ * This function returns the simulated time.
+ *
+ * @returns The simulated time (in msec).
+ *
+ */
+uint32_t testGetNow(void);
+
 #endif